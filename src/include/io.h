@@ -43,7 +43,11 @@ void print_string(const char *str, int color = VGA_COLOR_LIGHT_GREY)
     }
 }
 
-void print_vector(vector<char> &v, int color = VGA_COLOR_LIGHT_GREY)
+// One shell line fits in its inline storage, so reading it never allocates
+using line_buffer = small_vector<char, VGA_WIDTH>;
+
+template <typename Container>
+void print_vector(Container &v, int color = VGA_COLOR_LIGHT_GREY)
 {
     for (auto &c : v)
     {
@@ -82,7 +86,7 @@ uint8_t scankey()
             return inb(0x60);
 }
 
-void input(vector<char> &v, int color = VGA_COLOR_LIGHT_GREY)
+void input(line_buffer &v, int color = VGA_COLOR_LIGHT_GREY)
 {
     // Shift state variables
     bool left_shift_pressed = false;
@@ -91,11 +95,11 @@ void input(vector<char> &v, int color = VGA_COLOR_LIGHT_GREY)
     // For word wrapping
     size_t visual_cursor_x = 0;
     size_t visual_cursor_y = cursor_y;
-    vector<vector<char>> display_lines; // To track how content is visually displayed
-    vector<size_t> word_starts;         // Track the start of each word
+    small_vector<line_buffer, 4> display_lines; // To track how content is visually displayed
+    small_vector<size_t, 16> word_starts;       // Track the start of each word
 
     // Initialize with current line
-    display_lines.push_back(vector<char>());
+    display_lines.push_back(line_buffer());
 
     while (true)
     {
@@ -160,4 +164,170 @@ void input(vector<char> &v, int color = VGA_COLOR_LIGHT_GREY)
             break;
         }
     }
-}
\ No newline at end of file
+}
+
+// Serial port COM1, used for machine-readable output (QEMU: -serial stdio)
+#define COM1_PORT 0x3F8
+
+void serial_init()
+{
+    outb(COM1_PORT + 1, 0x00); // Disable interrupts
+    outb(COM1_PORT + 3, 0x80); // Enable DLAB to set the baud rate divisor
+    outb(COM1_PORT + 0, 0x03); // Divisor 3: 38400 baud
+    outb(COM1_PORT + 1, 0x00);
+    outb(COM1_PORT + 3, 0x03); // 8 bits, no parity, one stop bit
+    outb(COM1_PORT + 2, 0xC7); // Enable and clear FIFOs
+}
+
+void serial_print_char(char c)
+{
+    // Wait for the transmit holding register to empty
+    while (!(inb(COM1_PORT + 5) & 0x20))
+        ;
+    outb(COM1_PORT, c);
+}
+
+void serial_print_string(const char *str)
+{
+    for (int i = 0; str[i] != '\0'; ++i)
+    {
+        serial_print_char(str[i]);
+    }
+}
+
+void serial_print_uint(uint32_t x)
+{
+    char digits[10];
+    int count = 0;
+    do
+    {
+        digits[count++] = '0' + x % 10;
+        x /= 10;
+    } while (x > 0);
+    while (count > 0)
+    {
+        serial_print_char(digits[--count]);
+    }
+}
+
+// Compare a typed line with a command word
+template <typename Container>
+bool line_equals(Container &v, const char *str)
+{
+    size_t i = 0;
+    for (; i < v.size(); i++)
+    {
+        if (str[i] != v[i])
+        {
+            return false;
+        }
+    }
+    return str[i] == '\0';
+}
+
+// Print value at a fixed column so the meminfo table lines up
+void print_column(uint16_t column, int value)
+{
+    cursor_x = column;
+    print_int(value);
+}
+
+// Human-readable heap report for the `meminfo` command
+void print_meminfo()
+{
+    size_t pool_pages = 0;
+    for (size_t i = 0; i < HEAP_PAGE_COUNT; i++)
+    {
+        pool_pages += heap_page_used[i];
+    }
+
+    print_string("Heap live ");
+    print_int(heap_info.live_bytes);
+    print_string(" B, peak ");
+    print_int(heap_info.peak_bytes);
+    print_string(" B, pool pages ");
+    print_int(pool_pages);
+    print_string("/");
+    print_int(HEAP_PAGE_COUNT);
+    print_string(", failed ");
+    print_int(heap_info.failed);
+    print_string("\n");
+
+    print_string("Free physical pages ");
+    print_int(buddy_info.free_pages);
+    print_string(", fragmentation ");
+    print_int(buddy_fragmentation());
+    print_string("%\n");
+
+    print_string("tag", VGA_COLOR_LIGHT_BLUE);
+    cursor_x = 12;
+    print_string("live", VGA_COLOR_LIGHT_BLUE);
+    cursor_x = 24;
+    print_string("peak", VGA_COLOR_LIGHT_BLUE);
+    cursor_x = 36;
+    print_string("allocs", VGA_COLOR_LIGHT_BLUE);
+    cursor_x = 48;
+    print_string("frees\n", VGA_COLOR_LIGHT_BLUE);
+    for (int tag = 0; tag < HEAP_TAG_COUNT; tag++)
+    {
+        print_string(heap_tag_names[tag]);
+        print_column(12, heap_info.tags[tag].live_bytes);
+        print_column(24, heap_info.tags[tag].peak_bytes);
+        print_column(36, heap_info.tags[tag].allocs);
+        print_column(48, heap_info.tags[tag].frees);
+        print_string("\n");
+    }
+
+    print_string("sizes");
+    for (int size_class = 0; size_class <= HEAP_CLASS_COUNT; size_class++)
+    {
+        print_string(" ");
+        print_string(heap_class_names[size_class]);
+        print_string(":");
+        print_int(heap_info.histogram[size_class]);
+    }
+    print_string("\n");
+}
+
+// One `key value` line of the machine-readable dump, on screen and COM1
+void dump_value(const char *key, const char *subkey, uint32_t value)
+{
+    print_string(key);
+    serial_print_string(key);
+    if (subkey)
+    {
+        print_string(".");
+        print_string(subkey);
+        serial_print_char('.');
+        serial_print_string(subkey);
+    }
+    print_string(" ");
+    print_int(value);
+    print_string("\n");
+    serial_print_char(' ');
+    serial_print_uint(value);
+    serial_print_char('\n');
+}
+
+// Machine-readable heap report for `meminfo -m`
+void dump_meminfo()
+{
+    dump_value("heap.live_bytes", nullptr, heap_info.live_bytes);
+    dump_value("heap.peak_bytes", nullptr, heap_info.peak_bytes);
+    dump_value("heap.allocs", nullptr, heap_info.allocs);
+    dump_value("heap.frees", nullptr, heap_info.frees);
+    dump_value("heap.failed", nullptr, heap_info.failed);
+    for (int tag = 0; tag < HEAP_TAG_COUNT; tag++)
+    {
+        dump_value("heap.tag_live_bytes", heap_tag_names[tag], heap_info.tags[tag].live_bytes);
+        dump_value("heap.tag_peak_bytes", heap_tag_names[tag], heap_info.tags[tag].peak_bytes);
+        dump_value("heap.tag_allocs", heap_tag_names[tag], heap_info.tags[tag].allocs);
+    }
+    for (int size_class = 0; size_class <= HEAP_CLASS_COUNT; size_class++)
+    {
+        dump_value("heap.size_allocs", heap_class_names[size_class], heap_info.histogram[size_class]);
+    }
+    dump_value("pages.free", nullptr, buddy_info.free_pages);
+    dump_value("pages.total", nullptr, buddy_info.total_pages);
+    dump_value("pages.fragmentation", nullptr, buddy_fragmentation());
+}
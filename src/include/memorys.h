@@ -1,23 +1,349 @@
 // Memory pool for allocations
-alignas(16) char memory_pool[1024 * 1024]; // 1MB pool
-size_t pool_index = 0;
+alignas(4096) char memory_pool[1024 * 1024]; // 1MB pool
 
-// Implementation of operator new[] for array allocations
-void *operator new[](size_t size)
+// The pool is split into 4 KiB pages. Requests up to HEAP_MAX_SLAB bytes are
+// rounded up to a power-of-two size class and served from slab pages that hold
+// objects of a single class; bigger requests get a run of whole pages.
+// Every page run starts with a heap_page_header, so a pointer finds its page
+// (and with it its size class) by masking off the low 12 bits.
+#define HEAP_PAGE_SIZE 4096
+#define HEAP_PAGE_COUNT (sizeof(memory_pool) / HEAP_PAGE_SIZE)
+#define HEAP_MIN_SHIFT 4                                   // Smallest class: 16 bytes
+#define HEAP_MAX_SHIFT 10                                  // Largest class: 1024 bytes
+#define HEAP_CLASS_COUNT (HEAP_MAX_SHIFT - HEAP_MIN_SHIFT + 1)
+#define HEAP_MAX_SLAB (1u << HEAP_MAX_SHIFT)
+
+#define HEAP_MAGIC_SLAB 0x534C4142  // "SLAB"
+#define HEAP_MAGIC_LARGE 0x4C524745 // "LRGE"
+
+struct heap_page_header
+{
+    uint32_t magic;
+    uint32_t size_class;   // Class index for slab pages
+    uint32_t pages;        // Length of the run in pages
+    uint16_t tag;          // Owner of a large run
+    uint16_t first_object; // Offset of the first object in a slab page
+};
+
+// Subsystem tags for heap accounting. Slab pages keep one tag byte per object
+// right after the header; large runs keep theirs in the header.
+enum heap_tag
+{
+    HEAP_TAG_KERNEL,
+    HEAP_TAG_SHELL,
+    HEAP_TAG_DRIVERS,
+    HEAP_TAG_COUNT
+};
+
+static const char *heap_tag_names[HEAP_TAG_COUNT] = {"kernel", "shell", "drivers"};
+static const char *heap_class_names[HEAP_CLASS_COUNT + 1] = {"16", "32", "64", "128", "256", "512", "1024", "large"};
+
+struct heap_tag_stats
+{
+    uint32_t live_bytes;
+    uint32_t peak_bytes;
+    uint32_t allocs;
+    uint32_t frees;
+};
+
+// Byte counts are block sizes (size class or whole pages), i.e. what the
+// allocation really holds, not the size that was asked for
+struct heap_stats
+{
+    heap_tag_stats tags[HEAP_TAG_COUNT];
+    uint32_t live_bytes;
+    uint32_t peak_bytes;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failed;
+    uint32_t histogram[HEAP_CLASS_COUNT + 1]; // Allocations per size class, last entry: large
+};
+
+heap_stats heap_info;
+uint8_t heap_current_tag = HEAP_TAG_KERNEL;
+
+// Charge every allocation made while this is alive to one subsystem
+struct heap_tag_scope
 {
-    if (pool_index + size > sizeof(memory_pool))
+    uint8_t saved;
+
+    heap_tag_scope(uint8_t tag) : saved(heap_current_tag)
     {
-        return nullptr; // Out of memory
+        heap_current_tag = tag;
     }
-    void *ptr = &memory_pool[pool_index];
-    pool_index += size;
-    return ptr;
+
+    ~heap_tag_scope()
+    {
+        heap_current_tag = saved;
+    }
+};
+
+// Move the live byte counts of a tag (and the total) by delta
+void heap_account_bytes(uint8_t tag, int32_t delta)
+{
+    heap_tag_stats &t = heap_info.tags[tag];
+    t.live_bytes += delta;
+    if (t.live_bytes > t.peak_bytes)
+    {
+        t.peak_bytes = t.live_bytes;
+    }
+    heap_info.live_bytes += delta;
+    if (heap_info.live_bytes > heap_info.peak_bytes)
+    {
+        heap_info.peak_bytes = heap_info.live_bytes;
+    }
+}
+
+void heap_account_alloc(uint8_t tag, uint32_t bytes)
+{
+    heap_info.tags[tag].allocs++;
+    heap_info.allocs++;
+    heap_account_bytes(tag, bytes);
+}
+
+void heap_account_free(uint8_t tag, uint32_t bytes)
+{
+    heap_info.tags[tag].frees++;
+    heap_info.frees++;
+    heap_account_bytes(tag, -(int32_t)bytes);
+}
+
+struct heap_free_block
+{
+    heap_free_block *next;
+};
+
+heap_free_block *heap_free_lists[HEAP_CLASS_COUNT]; // One free list per size class
+bool heap_page_used[HEAP_PAGE_COUNT];
+
+// Physical page allocator (defined below), used once the pool runs out
+void *buddy_alloc_pages(uint32_t count);
+void buddy_free_pages(void *block, uint32_t count);
+
+// Map a request size to its size class index (0 = 16 bytes)
+static inline size_t heap_size_class(size_t size)
+{
+    if (size <= (1u << HEAP_MIN_SHIFT))
+    {
+        return 0;
+    }
+    return (32 - __builtin_clz(size - 1)) - HEAP_MIN_SHIFT;
+}
+
+// Find a run of free pages in the pool (first fit)
+heap_page_header *heap_alloc_pages(size_t count)
+{
+    size_t run = 0;
+    for (size_t page = 0; page < HEAP_PAGE_COUNT; page++)
+    {
+        run = heap_page_used[page] ? 0 : run + 1;
+        if (run == count)
+        {
+            size_t first = page + 1 - count;
+            for (size_t i = first; i <= page; i++)
+            {
+                heap_page_used[i] = true;
+            }
+            heap_page_header *header = (heap_page_header *)&memory_pool[first * HEAP_PAGE_SIZE];
+            header->pages = count;
+            return header;
+        }
+    }
+
+    // Pool exhausted: grow into physical memory
+    heap_page_header *header = (heap_page_header *)buddy_alloc_pages(count);
+    if (header)
+    {
+        header->pages = count;
+    }
+    return header;
+}
+
+void heap_free_pages(heap_page_header *header)
+{
+    if ((char *)header < memory_pool || (char *)header >= memory_pool + sizeof(memory_pool))
+    {
+        header->magic = 0;
+        buddy_free_pages(header, header->pages);
+        return;
+    }
+
+    size_t first = ((char *)header - memory_pool) / HEAP_PAGE_SIZE;
+    size_t count = header->pages;
+    header->magic = 0;
+    for (size_t i = first; i < first + count; i++)
+    {
+        heap_page_used[i] = false;
+    }
+}
+
+// Carve a fresh page into objects of one size class
+bool heap_refill(size_t size_class)
+{
+    heap_page_header *header = heap_alloc_pages(1);
+    if (!header)
+    {
+        return false;
+    }
+    header->magic = HEAP_MAGIC_SLAB;
+    header->size_class = size_class;
+
+    // Room for n objects plus n tag bytes, objects aligned to 16 bytes
+    size_t object_size = 1u << (size_class + HEAP_MIN_SHIFT);
+    size_t count = (HEAP_PAGE_SIZE - sizeof(heap_page_header)) / (object_size + 1);
+    header->first_object = (sizeof(heap_page_header) + count + 15) & ~15;
+
+    char *object = (char *)header + header->first_object;
+    char *end = (char *)header + HEAP_PAGE_SIZE;
+    while (object + object_size <= end)
+    {
+        heap_free_block *block = (heap_free_block *)object;
+        block->next = heap_free_lists[size_class];
+        heap_free_lists[size_class] = block;
+        object += object_size;
+    }
+    return true;
+}
+
+// Tag byte of a slab object
+static inline uint8_t *heap_slab_tag(heap_page_header *header, void *ptr)
+{
+    size_t index = ((char *)ptr - (char *)header - header->first_object) >> (header->size_class + HEAP_MIN_SHIFT);
+    return (uint8_t *)(header + 1) + index;
 }
 
-// Implementation of operator delete[] (no-op for bump allocator)
+void *heap_alloc(size_t size, uint8_t tag = heap_current_tag)
+{
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    if (size <= HEAP_MAX_SLAB)
+    {
+        size_t size_class = heap_size_class(size);
+        if (!heap_free_lists[size_class] && !heap_refill(size_class))
+        {
+            heap_info.failed++;
+            return nullptr;
+        }
+        heap_free_block *block = heap_free_lists[size_class];
+        heap_free_lists[size_class] = block->next;
+
+        heap_page_header *header = (heap_page_header *)((uint32_t)block & ~(HEAP_PAGE_SIZE - 1));
+        *heap_slab_tag(header, block) = tag;
+        heap_account_alloc(tag, 1u << (size_class + HEAP_MIN_SHIFT));
+        heap_info.histogram[size_class]++;
+        return block;
+    }
+
+    // Large object: whole pages with the header in front
+    size_t pages = (size + sizeof(heap_page_header) + HEAP_PAGE_SIZE - 1) / HEAP_PAGE_SIZE;
+    heap_page_header *header = heap_alloc_pages(pages);
+    if (!header)
+    {
+        heap_info.failed++;
+        return nullptr;
+    }
+    header->magic = HEAP_MAGIC_LARGE;
+    header->tag = tag;
+    heap_account_alloc(tag, pages * HEAP_PAGE_SIZE);
+    heap_info.histogram[HEAP_CLASS_COUNT]++;
+    return header + 1;
+}
+
+void heap_free(void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    heap_page_header *header = (heap_page_header *)((uint32_t)ptr & ~(HEAP_PAGE_SIZE - 1));
+    if (header->magic == HEAP_MAGIC_SLAB)
+    {
+        heap_account_free(*heap_slab_tag(header, ptr), 1u << (header->size_class + HEAP_MIN_SHIFT));
+        heap_free_block *block = (heap_free_block *)ptr;
+        block->next = heap_free_lists[header->size_class];
+        heap_free_lists[header->size_class] = block;
+    }
+    else if (header->magic == HEAP_MAGIC_LARGE)
+    {
+        heap_account_free(header->tag, header->pages * HEAP_PAGE_SIZE);
+        heap_free_pages(header);
+    }
+}
+
+// Grow an allocation in place: a slab object fits as long as its size class
+// does, a pool page run can take over the free pages right behind it
+bool heap_try_expand(void *ptr, size_t size)
+{
+    heap_page_header *header = (heap_page_header *)((uint32_t)ptr & ~(HEAP_PAGE_SIZE - 1));
+    if (header->magic == HEAP_MAGIC_SLAB)
+    {
+        return size <= (1u << (header->size_class + HEAP_MIN_SHIFT));
+    }
+    if (header->magic != HEAP_MAGIC_LARGE)
+    {
+        return false;
+    }
+
+    size_t pages = (size + sizeof(heap_page_header) + HEAP_PAGE_SIZE - 1) / HEAP_PAGE_SIZE;
+    if (pages <= header->pages)
+    {
+        return true;
+    }
+    if ((char *)header < memory_pool || (char *)header >= memory_pool + sizeof(memory_pool))
+    {
+        return false; // Buddy blocks are not extended
+    }
+
+    size_t first = ((char *)header - memory_pool) / HEAP_PAGE_SIZE;
+    if (first + pages > HEAP_PAGE_COUNT)
+    {
+        return false;
+    }
+    for (size_t i = first + header->pages; i < first + pages; i++)
+    {
+        if (heap_page_used[i])
+        {
+            return false;
+        }
+    }
+    for (size_t i = first + header->pages; i < first + pages; i++)
+    {
+        heap_page_used[i] = true;
+    }
+    heap_account_bytes(header->tag, (pages - header->pages) * HEAP_PAGE_SIZE);
+    header->pages = pages;
+    return true;
+}
+
+// Implementation of operator new[] for array allocations
+void *operator new[](size_t size)
+{
+    return heap_alloc(size);
+}
+
+void *operator new(size_t size)
+{
+    return heap_alloc(size);
+}
+
+// Return the block to its size class free list (or its pages to the pool)
 void operator delete[](void *ptr) noexcept
 {
-    // Do nothing
+    heap_free(ptr);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    heap_free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    heap_free(ptr);
 }
 
 // Function to read a byte from an I/O port
@@ -110,4 +436,392 @@ uint32_t get_total_ram_mb(multiboot_info *mbi)
     }
 
     return mem_mb;
-}
\ No newline at end of file
+}
+
+// Buddy allocator for physical pages. Free blocks of 2^order pages sit on
+// per-order doubly linked lists (the links live in the free pages themselves),
+// and one state byte per page frame records the order of each block head and
+// whether it is free, so a freed block can find and merge with its buddy.
+#define BUDDY_PAGE_SIZE 4096
+#define BUDDY_MAX_ORDER 10 // Largest block: 4 MiB
+#define BUDDY_FREE 0x80    // State flag: block head is on a free list
+#define BUDDY_NONE 0xFF    // State: frame is reserved or inside a bigger block
+#define BUDDY_MAX_RESERVED 16
+
+// Kernel image bounds from linker.ld
+extern "C" char kernel_start[];
+extern "C" char kernel_end[];
+
+struct buddy_block
+{
+    buddy_block *next;
+    buddy_block *prev;
+};
+
+struct buddy_range
+{
+    uint32_t start;
+    uint32_t end;
+};
+
+struct buddy_stats
+{
+    uint32_t total_pages;                      // Pages handed to the allocator at boot
+    uint32_t free_pages;                       // Pages currently on free lists
+    uint32_t free_blocks[BUDDY_MAX_ORDER + 1]; // Free blocks per order
+    uint32_t splits;
+    uint32_t merges;
+    uint32_t failed; // Requests that could not be satisfied
+};
+
+buddy_block *buddy_free_lists[BUDDY_MAX_ORDER + 1];
+uint8_t *buddy_page_state = nullptr; // One byte per page frame below buddy_frame_limit
+uint32_t buddy_frame_limit = 0;
+buddy_stats buddy_info;
+
+buddy_range buddy_reserved[BUDDY_MAX_RESERVED];
+int buddy_reserved_count = 0;
+
+static inline uint32_t buddy_align_down(uint32_t addr)
+{
+    return addr & ~(BUDDY_PAGE_SIZE - 1);
+}
+
+static inline uint32_t buddy_align_up(uint64_t addr)
+{
+    uint64_t aligned = (addr + BUDDY_PAGE_SIZE - 1) & ~(uint64_t)(BUDDY_PAGE_SIZE - 1);
+    return aligned > 0xFFFFF000 ? 0xFFFFF000 : (uint32_t)aligned;
+}
+
+// Smallest order whose block holds the given number of pages
+uint32_t buddy_order_for(uint32_t pages)
+{
+    if (pages <= 1)
+    {
+        return 0;
+    }
+    return 32 - __builtin_clz(pages - 1);
+}
+
+void buddy_push(uint32_t frame, uint32_t order)
+{
+    buddy_block *block = (buddy_block *)(frame * BUDDY_PAGE_SIZE);
+    block->prev = nullptr;
+    block->next = buddy_free_lists[order];
+    if (block->next)
+    {
+        block->next->prev = block;
+    }
+    buddy_free_lists[order] = block;
+    buddy_page_state[frame] = BUDDY_FREE | order;
+    buddy_info.free_blocks[order]++;
+    buddy_info.free_pages += 1u << order;
+}
+
+void buddy_unlink(buddy_block *block, uint32_t order)
+{
+    if (block->prev)
+    {
+        block->prev->next = block->next;
+    }
+    else
+    {
+        buddy_free_lists[order] = block->next;
+    }
+    if (block->next)
+    {
+        block->next->prev = block->prev;
+    }
+    buddy_page_state[(uint32_t)block / BUDDY_PAGE_SIZE] = BUDDY_NONE;
+    buddy_info.free_blocks[order]--;
+    buddy_info.free_pages -= 1u << order;
+}
+
+void *buddy_alloc(uint32_t order)
+{
+    uint32_t found = order;
+    while (found <= BUDDY_MAX_ORDER && !buddy_free_lists[found])
+    {
+        found++;
+    }
+    if (order > BUDDY_MAX_ORDER || found > BUDDY_MAX_ORDER)
+    {
+        buddy_info.failed++;
+        return nullptr;
+    }
+
+    buddy_block *block = buddy_free_lists[found];
+    buddy_unlink(block, found);
+
+    // Split down to the requested order, returning upper halves to the lists
+    uint32_t frame = (uint32_t)block / BUDDY_PAGE_SIZE;
+    while (found > order)
+    {
+        found--;
+        buddy_push(frame + (1u << found), found);
+        buddy_info.splits++;
+    }
+
+    buddy_page_state[frame] = order;
+    return block;
+}
+
+void buddy_free(void *ptr)
+{
+    if (!ptr || !buddy_page_state)
+    {
+        return;
+    }
+
+    uint32_t frame = (uint32_t)ptr / BUDDY_PAGE_SIZE;
+    if (frame >= buddy_frame_limit || buddy_page_state[frame] > BUDDY_MAX_ORDER)
+    {
+        return; // Not an allocated block head
+    }
+
+    // Merge with free buddies of the same order
+    uint32_t order = buddy_page_state[frame];
+    while (order < BUDDY_MAX_ORDER)
+    {
+        uint32_t buddy = frame ^ (1u << order);
+        if (buddy >= buddy_frame_limit || buddy_page_state[buddy] != (BUDDY_FREE | order))
+        {
+            break;
+        }
+        buddy_unlink((buddy_block *)(buddy * BUDDY_PAGE_SIZE), order);
+        buddy_page_state[frame] = BUDDY_NONE;
+        frame &= ~(1u << order);
+        order++;
+        buddy_info.merges++;
+    }
+
+    buddy_push(frame, order);
+}
+
+// Free [start_frame, end_frame) of allocated memory as maximal aligned blocks
+void buddy_release(uint32_t start_frame, uint32_t end_frame)
+{
+    while (start_frame < end_frame)
+    {
+        uint32_t order = BUDDY_MAX_ORDER;
+        while (order > 0 && ((start_frame & ((1u << order) - 1)) || start_frame + (1u << order) > end_frame))
+        {
+            order--;
+        }
+        buddy_page_state[start_frame] = order;
+        buddy_free((void *)(start_frame * BUDDY_PAGE_SIZE));
+        start_frame += 1u << order;
+    }
+}
+
+// Allocate exactly `count` contiguous pages: take the covering block and give
+// the unused tail back, so odd sizes do not waste up to half of the block
+void *buddy_alloc_pages(uint32_t count)
+{
+    uint32_t order = buddy_order_for(count);
+    void *block = buddy_alloc(order);
+    if (block && count < (1u << order))
+    {
+        uint32_t frame = (uint32_t)block / BUDDY_PAGE_SIZE;
+        buddy_release(frame + count, frame + (1u << order));
+        buddy_page_state[frame] = BUDDY_NONE;
+    }
+    return block;
+}
+
+void buddy_free_pages(void *block, uint32_t count)
+{
+    if (block && buddy_page_state)
+    {
+        uint32_t frame = (uint32_t)block / BUDDY_PAGE_SIZE;
+        buddy_release(frame, frame + count);
+    }
+}
+
+// Hand a page-aligned range to the allocator as maximal aligned blocks
+void buddy_add_free(uint32_t start_frame, uint32_t end_frame)
+{
+    while (start_frame < end_frame)
+    {
+        uint32_t order = BUDDY_MAX_ORDER;
+        while (order > 0 && ((start_frame & ((1u << order) - 1)) || start_frame + (1u << order) > end_frame))
+        {
+            order--;
+        }
+        buddy_push(start_frame, order);
+        buddy_info.total_pages += 1u << order;
+        start_frame += 1u << order;
+    }
+}
+
+// Add [start, end) minus every reserved range from index `first` on
+void buddy_add_range(uint32_t start, uint32_t end, int first)
+{
+    for (int i = first; i < buddy_reserved_count; i++)
+    {
+        buddy_range r = buddy_reserved[i];
+        if (r.start < end && r.end > start)
+        {
+            if (r.start > start)
+            {
+                buddy_add_range(start, r.start, i + 1);
+            }
+            if (r.end < end)
+            {
+                buddy_add_range(r.end, end, i + 1);
+            }
+            return;
+        }
+    }
+
+    uint32_t start_frame = buddy_align_up(start) / BUDDY_PAGE_SIZE;
+    uint32_t end_frame = buddy_align_down(end) / BUDDY_PAGE_SIZE;
+    buddy_add_free(start_frame, end_frame);
+}
+
+void buddy_reserve(uint32_t start, uint64_t end)
+{
+    if (buddy_reserved_count < BUDDY_MAX_RESERVED && end > start)
+    {
+        buddy_reserved[buddy_reserved_count].start = buddy_align_down(start);
+        buddy_reserved[buddy_reserved_count].end = buddy_align_up(end);
+        buddy_reserved_count++;
+    }
+}
+
+// Does [start, end) overlap any reserved range?
+bool buddy_is_reserved(uint32_t start, uint32_t end)
+{
+    for (int i = 0; i < buddy_reserved_count; i++)
+    {
+        if (buddy_reserved[i].start < end && buddy_reserved[i].end > start)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// End of a memory map entry, clipped to `top` and kept addressable
+uint32_t buddy_region_end(mmap_entry *entry, uint64_t top)
+{
+    uint64_t region_end = entry->addr + entry->len;
+    if (region_end > top)
+    {
+        region_end = top;
+    }
+    return region_end > 0xFFFFF000 ? 0xFFFFF000 : (uint32_t)region_end;
+}
+
+// Build the allocator from the type-1 regions of the multiboot memory map
+bool buddy_init(multiboot_info *mbi)
+{
+    if (!(mbi->flags & 0x40))
+    {
+        return false; // No memory map
+    }
+
+    mmap_entry *first = (mmap_entry *)mbi->mmap_addr;
+    mmap_entry *end = (mmap_entry *)((uint32_t)mbi->mmap_addr + mbi->mmap_length);
+
+    // Keep the first MiB (BIOS data, VGA memory, page 0 as the null page), the
+    // kernel image and everything the bootloader handed us
+    buddy_reserved_count = 0;
+    buddy_reserve(0, 0x100000);
+    buddy_reserve((uint32_t)kernel_start, (uint32_t)kernel_end);
+    buddy_reserve((uint32_t)mbi, (uint32_t)mbi + sizeof(multiboot_info));
+    buddy_reserve(mbi->mmap_addr, (uint64_t)mbi->mmap_addr + mbi->mmap_length);
+    if (mbi->flags & 0x4)
+    {
+        buddy_reserve(mbi->cmdline, (uint64_t)mbi->cmdline + 1);
+    }
+    if (mbi->flags & 0x8)
+    {
+        uint32_t *mods = (uint32_t *)mbi->mods_addr; // mod_start, mod_end, string, reserved
+        buddy_reserve(mbi->mods_addr, (uint64_t)mbi->mods_addr + mbi->mods_count * 16);
+        for (uint32_t i = 0; i < mbi->mods_count; i++)
+        {
+            buddy_reserve(mods[i * 4], mods[i * 4 + 1]);
+        }
+    }
+
+    // Size the state table for the highest usable frame below 4 GiB
+    uint64_t top = 0;
+    for (mmap_entry *entry = first; entry < end; entry = (mmap_entry *)((uint32_t)entry + entry->size + 4))
+    {
+        if (entry->type == 1 && entry->addr < 0x100000000ull && entry->addr + entry->len > top)
+        {
+            top = entry->addr + entry->len;
+        }
+    }
+    if (top > 0x100000000ull)
+    {
+        top = 0x100000000ull;
+    }
+    buddy_frame_limit = (uint32_t)(top / BUDDY_PAGE_SIZE);
+    uint32_t table_size = buddy_align_up(buddy_frame_limit);
+
+    // Place the state table in the first usable spot that is not reserved
+    buddy_page_state = nullptr;
+    for (mmap_entry *entry = first; entry < end && !buddy_page_state; entry = (mmap_entry *)((uint32_t)entry + entry->size + 4))
+    {
+        if (entry->type != 1 || entry->addr >= top)
+        {
+            continue;
+        }
+        uint32_t region_end = buddy_align_down(buddy_region_end(entry, top));
+        for (uint32_t addr = buddy_align_up(entry->addr); addr + table_size <= region_end; addr += BUDDY_PAGE_SIZE)
+        {
+            if (!buddy_is_reserved(addr, addr + table_size))
+            {
+                buddy_page_state = (uint8_t *)addr;
+                break;
+            }
+        }
+    }
+    if (!buddy_page_state)
+    {
+        return false;
+    }
+    buddy_reserve((uint32_t)buddy_page_state, (uint64_t)(uint32_t)buddy_page_state + table_size);
+
+    for (uint32_t i = 0; i < buddy_frame_limit; i++)
+    {
+        buddy_page_state[i] = BUDDY_NONE;
+    }
+
+    for (mmap_entry *entry = first; entry < end; entry = (mmap_entry *)((uint32_t)entry + entry->size + 4))
+    {
+        if (entry->type == 1 && entry->addr < top)
+        {
+            buddy_add_range((uint32_t)entry->addr, buddy_region_end(entry, top), 0);
+        }
+    }
+    return true;
+}
+
+// Highest order with a free block, or -1 when physical memory is exhausted
+int buddy_largest_free_order()
+{
+    for (int order = BUDDY_MAX_ORDER; order >= 0; order--)
+    {
+        if (buddy_free_lists[order])
+        {
+            return order;
+        }
+    }
+    return -1;
+}
+
+// External fragmentation in percent: the share of free memory that is not
+// part of the largest free block size
+uint32_t buddy_fragmentation()
+{
+    int order = buddy_largest_free_order();
+    if (order < 0 || buddy_info.free_pages == 0)
+    {
+        return 0;
+    }
+    uint32_t largest = buddy_info.free_blocks[order] << order;
+    return 100 - largest * 100 / buddy_info.free_pages;
+}
@@ -5,6 +5,80 @@ using size_t = unsigned int;
 inline void *operator new(size_t, void *p) noexcept { return p; }
 inline void operator delete(void *, void *) noexcept {}
 
+// Heap hook (memorys.h): grow a block in place if it has room for size bytes
+bool heap_try_expand(void *ptr, size_t size);
+
+// Freestanding replacements for the <type_traits>/<utility> pieces we need
+template <typename T>
+struct remove_reference
+{
+    using type = T;
+};
+
+template <typename T>
+struct remove_reference<T &>
+{
+    using type = T;
+};
+
+template <typename T>
+struct remove_reference<T &&>
+{
+    using type = T;
+};
+
+template <typename T>
+struct is_trivially_copyable
+{
+    static const bool value = __is_trivially_copyable(T);
+};
+
+template <typename T>
+inline typename remove_reference<T>::type &&move(T &&t) noexcept
+{
+    return static_cast<typename remove_reference<T>::type &&>(t);
+}
+
+template <typename T>
+inline T &&forward(typename remove_reference<T>::type &t) noexcept
+{
+    return static_cast<T &&>(t);
+}
+
+template <typename T>
+inline T &&forward(typename remove_reference<T>::type &&t) noexcept
+{
+    return static_cast<T &&>(t);
+}
+
+// Byte copy for trivially copyable data (rep movsd, then the odd tail bytes)
+extern "C" void *memcpy(void *dest, const void *src, size_t n)
+{
+    void *d = dest;
+    size_t dwords = n / 4;
+    asm volatile("rep movsl" : "+D"(d), "+S"(src), "+c"(dwords) : : "memory");
+    size_t tail = n % 4;
+    asm volatile("rep movsb" : "+D"(d), "+S"(src), "+c"(tail) : : "memory");
+    return dest;
+}
+
+// Move count elements from src into raw storage at dest and end the
+// lifetime of the originals; plain bytes for trivially copyable types
+template <typename T>
+void relocate(T *dest, T *src, size_t count)
+{
+    if (is_trivially_copyable<T>::value)
+    {
+        memcpy(dest, src, sizeof(T) * count);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        new (dest + i) T(move(src[i]));
+        src[i].~T();
+    }
+}
+
 template <typename T>
 class vector
 {
@@ -22,12 +96,35 @@ private:
         }
     }
 
+    static T *allocate(size_t n)
+    {
+        return reinterpret_cast<T *>(new char[sizeof(T) * n]);
+    }
+
+    // Grow the buffer to new_cap, in place when the heap block has room
+    void grow(size_t new_cap)
+    {
+        if (arr && heap_try_expand(arr, sizeof(T) * new_cap))
+        {
+            cap = new_cap;
+            return;
+        }
+        T *new_arr = allocate(new_cap);
+        relocate(new_arr, arr, current_size);
+        delete[] reinterpret_cast<char *>(arr);
+        arr = new_arr;
+        cap = new_cap;
+    }
+
+    size_t next_capacity() const
+    {
+        return cap ? cap * 2 : 10;
+    }
+
 public:
-    // Default constructor: initialize with capacity 10
-    vector() : current_size(0), cap(10)
+    // Default constructor: no storage until the first element arrives
+    vector() : arr(nullptr), current_size(0), cap(0)
     {
-        char *raw = new char[sizeof(T) * cap];
-        arr = reinterpret_cast<T *>(raw);
     }
 
     // Destructor: clean up elements and memory
@@ -37,25 +134,39 @@ public:
         delete[] reinterpret_cast<char *>(arr);
     }
 
-    // Add an element to the end
-    void push_back(const T &value)
+    // Construct an element in place at the end
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
     {
         if (current_size == cap)
         {
-            size_t new_cap = cap * 2;
-            char *new_raw = new char[sizeof(T) * new_cap];
-            T *new_arr = reinterpret_cast<T *>(new_raw);
-            for (size_t i = 0; i < current_size; ++i)
+            size_t new_cap = next_capacity();
+            if (!arr || !heap_try_expand(arr, sizeof(T) * new_cap))
             {
-                new (new_arr + i) T(arr[i]); // Copy existing elements
+                // Build the new element before relocating, args may point into arr
+                T *new_arr = allocate(new_cap);
+                new (new_arr + current_size) T(forward<Args>(args)...);
+                relocate(new_arr, arr, current_size);
+                delete[] reinterpret_cast<char *>(arr);
+                arr = new_arr;
+                cap = new_cap;
+                return arr[current_size++];
             }
-            destroy_elements();
-            delete[] reinterpret_cast<char *>(arr);
-            arr = new_arr;
             cap = new_cap;
         }
-        new (arr + current_size) T(value); // Construct new element
-        ++current_size;
+        new (arr + current_size) T(forward<Args>(args)...);
+        return arr[current_size++];
+    }
+
+    // Add an element to the end
+    void push_back(const T &value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+        emplace_back(move(value));
     }
 
     // Remove the last element
@@ -98,10 +209,12 @@ public:
     }
 
     // Copy constructor
-    vector(const vector &other) : current_size(other.current_size), cap(other.cap)
+    vector(const vector &other) : arr(nullptr), current_size(other.current_size), cap(other.cap)
     {
-        char *raw = new char[sizeof(T) * cap];
-        arr = reinterpret_cast<T *>(raw);
+        if (cap)
+        {
+            arr = allocate(cap);
+        }
         for (size_t i = 0; i < current_size; ++i)
         {
             new (arr + i) T(other.arr[i]); // Deep copy elements
@@ -117,8 +230,7 @@ public:
             delete[] reinterpret_cast<char *>(arr);
             current_size = other.current_size;
             cap = other.cap;
-            char *raw = new char[sizeof(T) * cap];
-            arr = reinterpret_cast<T *>(raw);
+            arr = cap ? allocate(cap) : nullptr;
             for (size_t i = 0; i < current_size; ++i)
             {
                 new (arr + i) T(other.arr[i]);
@@ -164,24 +276,10 @@ public:
     {
         if (n > cap)
         {
-            size_t new_cap = n > 2 * cap ? n : 2 * cap;
-            char *new_raw = new char[sizeof(T) * new_cap];
-            T *new_arr = reinterpret_cast<T *>(new_raw);
-            for (size_t i = 0; i < current_size; ++i)
-            {
-                new (new_arr + i) T(arr[i]); // Copy existing elements
-            }
-            for (size_t i = current_size; i < n; ++i)
-            {
-                new (new_arr + i) T(); // Default construct new elements
-            }
-            destroy_elements();
-            delete[] reinterpret_cast<char *>(arr);
-            arr = new_arr;
-            cap = new_cap;
-            current_size = n;
+            grow(n > 2 * cap ? n : 2 * cap);
         }
-        else if (n > current_size)
+
+        if (n > current_size)
         {
             for (size_t i = current_size; i < n; ++i)
             {
@@ -204,20 +302,252 @@ public:
     {
         if (n > cap)
         {
-            char *new_raw = new char[sizeof(T) * n];
-            T *new_arr = reinterpret_cast<T *>(new_raw);
-            for (size_t i = 0; i < current_size; ++i)
+            grow(n);
+        }
+    }
+
+    // Iterator support
+    T *begin()
+    {
+        return arr;
+    }
+
+    T *end()
+    {
+        return arr + current_size;
+    }
+
+    const T *begin() const
+    {
+        return arr;
+    }
+
+    const T *end() const
+    {
+        return arr + current_size;
+    }
+};
+
+// Vector with room for N elements inside the object itself. It only touches
+// the heap once it outgrows N, so short-lived small lists cost no allocation.
+template <typename T, size_t N>
+class small_vector
+{
+private:
+    T *arr;              // Inline storage or a heap block
+    size_t current_size; // Number of elements currently stored
+    size_t cap;          // N while inline, otherwise the heap capacity
+    alignas(T) unsigned char inline_storage[sizeof(T) * N];
+
+    T *inline_data()
+    {
+        return reinterpret_cast<T *>(inline_storage);
+    }
+
+    bool is_inline() const
+    {
+        return arr == reinterpret_cast<const T *>(inline_storage);
+    }
+
+    void destroy_elements()
+    {
+        for (size_t i = 0; i < current_size; ++i)
+        {
+            arr[i].~T();
+        }
+    }
+
+    void release()
+    {
+        if (!is_inline())
+        {
+            delete[] reinterpret_cast<char *>(arr);
+        }
+        arr = inline_data();
+        cap = N;
+    }
+
+    // Move to a heap block of new_cap elements (or grow the one we have)
+    void grow(size_t new_cap)
+    {
+        if (!is_inline() && heap_try_expand(arr, sizeof(T) * new_cap))
+        {
+            cap = new_cap;
+            return;
+        }
+        T *new_arr = reinterpret_cast<T *>(new char[sizeof(T) * new_cap]);
+        relocate(new_arr, arr, current_size);
+        if (!is_inline())
+        {
+            delete[] reinterpret_cast<char *>(arr);
+        }
+        arr = new_arr;
+        cap = new_cap;
+    }
+
+    // Take over the contents of other, stealing its heap block if it has one
+    void take(small_vector &other)
+    {
+        if (other.is_inline())
+        {
+            arr = inline_data();
+            cap = N;
+            relocate(arr, other.arr, other.current_size);
+        }
+        else
+        {
+            arr = other.arr;
+            cap = other.cap;
+            other.arr = other.inline_data();
+            other.cap = N;
+        }
+        current_size = other.current_size;
+        other.current_size = 0;
+    }
+
+public:
+    small_vector() : arr(inline_data()), current_size(0), cap(N)
+    {
+    }
+
+    ~small_vector()
+    {
+        destroy_elements();
+        release();
+    }
+
+    small_vector(const small_vector &other) : arr(inline_data()), current_size(0), cap(N)
+    {
+        reserve(other.current_size);
+        for (size_t i = 0; i < other.current_size; ++i)
+        {
+            new (arr + i) T(other.arr[i]);
+        }
+        current_size = other.current_size;
+    }
+
+    small_vector &operator=(const small_vector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.current_size);
+            for (size_t i = 0; i < other.current_size; ++i)
             {
-                new (new_arr + i) T(arr[i]); // Copy existing elements
+                new (arr + i) T(other.arr[i]);
             }
+            current_size = other.current_size;
+        }
+        return *this;
+    }
+
+    small_vector(small_vector &&other) : arr(inline_data()), current_size(0), cap(N)
+    {
+        take(other);
+    }
+
+    small_vector &operator=(small_vector &&other)
+    {
+        if (this != &other)
+        {
             destroy_elements();
-            delete[] reinterpret_cast<char *>(arr);
-            arr = new_arr;
-            cap = n;
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        if (current_size == cap)
+        {
+            // Build the new element before growing, args may point into arr
+            T value(forward<Args>(args)...);
+            grow(cap * 2);
+            new (arr + current_size) T(move(value));
+            return arr[current_size++];
+        }
+        new (arr + current_size) T(forward<Args>(args)...);
+        return arr[current_size++];
+    }
+
+    void push_back(const T &value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+        emplace_back(move(value));
+    }
+
+    void pop_back()
+    {
+        if (current_size > 0)
+        {
+            --current_size;
+            arr[current_size].~T();
+        }
+    }
+
+    size_t size() const
+    {
+        return current_size;
+    }
+
+    size_t capacity() const
+    {
+        return cap;
+    }
+
+    bool empty() const
+    {
+        return current_size == 0;
+    }
+
+    T &operator[](size_t index)
+    {
+        return arr[index];
+    }
+
+    const T &operator[](size_t index) const
+    {
+        return arr[index];
+    }
+
+    // Remove all elements (keep capacity)
+    void clear()
+    {
+        destroy_elements();
+        current_size = 0;
+    }
+
+    void resize(size_t n)
+    {
+        if (n > cap)
+        {
+            grow(n > 2 * cap ? n : 2 * cap);
+        }
+        for (size_t i = current_size; i < n; ++i)
+        {
+            new (arr + i) T();
+        }
+        for (size_t i = n; i < current_size; ++i)
+        {
+            arr[i].~T();
+        }
+        current_size = n;
+    }
+
+    void reserve(size_t n)
+    {
+        if (n > cap)
+        {
+            grow(n);
         }
     }
 
-    // Iterator support
     T *begin()
     {
         return arr;
@@ -237,4 +567,165 @@ public:
     {
         return arr + current_size;
     }
-};
\ No newline at end of file
+};
+
+// Fixed-capacity vector that never allocates. push_back/emplace_back report
+// false once all N slots are taken instead of growing.
+template <typename T, size_t N>
+class static_vector
+{
+private:
+    size_t current_size;
+    alignas(T) unsigned char storage[sizeof(T) * N];
+
+    T *data()
+    {
+        return reinterpret_cast<T *>(storage);
+    }
+
+    const T *data() const
+    {
+        return reinterpret_cast<const T *>(storage);
+    }
+
+public:
+    static_vector() : current_size(0)
+    {
+    }
+
+    ~static_vector()
+    {
+        clear();
+    }
+
+    static_vector(const static_vector &other) : current_size(0)
+    {
+        for (size_t i = 0; i < other.current_size; ++i)
+        {
+            new (data() + i) T(other[i]);
+        }
+        current_size = other.current_size;
+    }
+
+    static_vector &operator=(const static_vector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (size_t i = 0; i < other.current_size; ++i)
+            {
+                new (data() + i) T(other[i]);
+            }
+            current_size = other.current_size;
+        }
+        return *this;
+    }
+
+    template <typename... Args>
+    bool emplace_back(Args &&...args)
+    {
+        if (current_size == N)
+        {
+            return false;
+        }
+        new (data() + current_size) T(forward<Args>(args)...);
+        ++current_size;
+        return true;
+    }
+
+    bool push_back(const T &value)
+    {
+        return emplace_back(value);
+    }
+
+    bool push_back(T &&value)
+    {
+        return emplace_back(move(value));
+    }
+
+    void pop_back()
+    {
+        if (current_size > 0)
+        {
+            --current_size;
+            data()[current_size].~T();
+        }
+    }
+
+    size_t size() const
+    {
+        return current_size;
+    }
+
+    size_t capacity() const
+    {
+        return N;
+    }
+
+    bool empty() const
+    {
+        return current_size == 0;
+    }
+
+    bool full() const
+    {
+        return current_size == N;
+    }
+
+    T &operator[](size_t index)
+    {
+        return data()[index];
+    }
+
+    const T &operator[](size_t index) const
+    {
+        return data()[index];
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < current_size; ++i)
+        {
+            data()[i].~T();
+        }
+        current_size = 0;
+    }
+
+    // Resize up to N elements; larger requests are clamped
+    void resize(size_t n)
+    {
+        if (n > N)
+        {
+            n = N;
+        }
+        for (size_t i = current_size; i < n; ++i)
+        {
+            new (data() + i) T();
+        }
+        for (size_t i = n; i < current_size; ++i)
+        {
+            data()[i].~T();
+        }
+        current_size = n;
+    }
+
+    T *begin()
+    {
+        return data();
+    }
+
+    T *end()
+    {
+        return data() + current_size;
+    }
+
+    const T *begin() const
+    {
+        return data();
+    }
+
+    const T *end() const
+    {
+        return data() + current_size;
+    }
+};
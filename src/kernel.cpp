@@ -9,17 +9,32 @@
 extern "C" void kernel_main(multiboot_info *mbi)
 {
     cls();
+    serial_init();
+    buddy_init(mbi);
 
     print_string("Howdy! Welcome to Cinemint OS!\n", VGA_COLOR_LIGHT_CYAN);
     print_string("Free Memory: ");
     print_int(mbi->mem_lower + mbi->mem_upper);
     print_string("\n");
+    print_string("Free Pages: ");
+    print_int(buddy_info.free_pages);
+    print_string("\n");
 
     while (true)
     {
-        vector<char> i;
+        heap_tag_scope shell_tag(HEAP_TAG_SHELL);
+        line_buffer i;
         print_string("- ", VGA_COLOR_LIGHT_BLUE);
         input(i);
         print_char('\n');
+
+        if (line_equals(i, "meminfo"))
+        {
+            print_meminfo();
+        }
+        else if (line_equals(i, "meminfo -m"))
+        {
+            dump_meminfo();
+        }
     }
 }
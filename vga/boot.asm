@@ -11,6 +11,8 @@ section .data
 align 4
 mboot_info_ptr:
     dd 0                         ; Store multiboot info pointer here
+sse_enabled:
+    dd 0                         ; Set to 1 once SSE is enabled below
 
 section .bss
 align 16
@@ -21,6 +23,7 @@ stack_top:
 section .text
 global _start
 global mboot_info_ptr            ; Export memory info to C++
+global sse_enabled               ; Lets the ISRs know whether to save XMM state
 extern main
 
 _start:
@@ -52,8 +55,24 @@ reload_segments:
     or al, 2
     out 0x92, al
     
+    ; Enable SSE if the CPU has it (CPUID.1:EDX bit 25)
+    mov eax, 1
+    cpuid
+    test edx, 1 << 25
+    jz .no_sse
+    mov eax, cr0
+    and eax, ~(1 << 2)           ; Clear CR0.EM: no x87 emulation
+    or eax, 1 << 1               ; Set CR0.MP: monitor coprocessor
+    mov cr0, eax
+    mov eax, cr4
+    or eax, (1 << 9) | (1 << 10) ; Set CR4.OSFXSR and CR4.OSXMMEXCPT
+    mov cr4, eax
+    mov dword [sse_enabled], 1
+.no_sse:
+    fninit                       ; Put the FPU in a known state
+    
     ; Call the kernel main function
-    push mboot_info_ptr          ; Pass multiboot info pointer to kernel
+    push dword [mboot_info_ptr]  ; Pass multiboot info pointer to kernel
     call main
     
     ; If the kernel returns, hang the CPU
@@ -7,6 +7,7 @@ sudo apt-get install -y g++ nasm qemu-system-x86 grub-pc-bin xorriso python3
 mkdir -p build
 
 python3 scripts/import_img.py
+python3 scripts/import_font.py
 python3 scripts/import_wav.py
 
 # Compile the assembly bootloader
@@ -0,0 +1,103 @@
+namespace font_hud {
+const cm::sprite_span spans[] = {
+{1, 2},{1, 2},{1, 2},{1, 2},{1, 2},{1, 1},{3, 1},{1, 1},{3, 1},{1, 1},{3, 1},{1, 1},{3, 1},{1, 1},{3, 1},{0, 5},{1, 1},{3, 1},{1, 1},{3, 1},{0, 5},{1, 1},{3, 1},{1, 1},{3, 1},{2, 1},{1, 4},{0, 2},{4, 1},{0, 4},{1, 4},{3, 2},{0, 2},{3, 2},{0, 4},{2, 1},{0, 3},{0, 1},{2, 1},{4, 1},{0, 4},{2, 1},{1, 4},{0, 1},{2, 1},{4, 1},{2, 3},{1, 3},{0, 2},{1, 2},{0, 5},{0, 1},{2, 2},{0, 5},{2, 2},{2, 1},{1, 1},{3, 1},{2, 1},{1, 2},{1, 2},{1, 2},{1, 2},{2, 1},{3, 1},{1, 1},{2, 1},{2, 2},{2, 2},{2, 2},{2, 2},{2, 1},{1, 1},{2, 1},{0, 4},{1, 2},{0, 1},{3, 1},{2, 1},{2, 1},{0, 5},{2, 1},{2, 1},{2, 2},{2, 1},{1, 1},{0, 5},{1, 2},{4, 1},{4, 1},{3, 1},{3, 1},{2, 1},{2, 1},{1, 1},{1, 1},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{2, 2},{0, 4},{2, 2},{2, 2},{2, 2},{2, 2},{0, 6},{1, 3},{0, 2},{3, 2},{3, 2},{2, 2},{1, 2},{0, 2},{3, 2},{0, 5},{1, 3},{0, 2},{3, 2},{3, 2},{1, 3},{3, 2},{0, 2},{3, 2},{1, 3},{3, 2},{2, 3},{1, 1},{3, 2},{0, 2},{3, 2},{0, 6},{3, 2},{3, 2},{0, 5},{0, 2},{0, 4},{0, 2},{3, 2},{3, 2},{0, 1},{3, 2},{0, 4},{1, 3},{0, 2},{3, 2},{0, 2},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 5},{0, 2},{3, 2},{3, 2},{2, 2},{2, 2},{1, 2},{1, 2},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{1, 4},{3, 2},{0, 2},{3, 2},{1, 3},{1, 2},{1, 2},{1, 2},{1, 2},{1, 1},{0, 1},{2, 2},{1, 2},{0, 2},{1, 2},{2, 2},{0, 4},{0, 4},{1, 2},{2, 2},{3, 2},{2, 2},{1, 2},{1, 3},{0, 1},{3, 2},{2, 2},{1, 2},{1, 2},{1, 3},{0, 2},{4, 1},{0, 1},{3, 2},{0, 1},{2, 1},{4, 1},{0, 1},{2, 1},{4, 1},{0, 1},{3, 3},{0, 2},{1, 3},{0, 4},{1, 3},{1, 1},{3, 1},{0, 5},{0, 2},{3, 2},{0, 2},{3, 3},{0, 4},{0, 2},{3, 2},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{1, 4},{0, 2},{3, 2},{0, 2},{0, 2},{0, 2},{3, 2},{1, 3},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{0, 5},{0, 2},{0, 4},{0, 2},{0, 2},{3, 2},{0, 5},{0, 5},{0, 2},{0, 4},{0, 2},{0, 2},{0, 3},{1, 3},{0, 2},{3, 2},{0, 2},{0, 5},{0, 2},{3, 2},{1, 4},{0, 2},{3, 3},{0, 2},{3, 2},{0, 5},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 3},{0, 4},{1, 2},{1, 2},{1, 2},{1, 2},{0, 4},{1, 4},{2, 2},{2, 2},{0, 1},{2, 2},{0, 1},{2, 2},{0, 3},{0, 2},{3, 2},{0, 2},{3, 1},{0, 3},{0, 4},{0, 2},{3, 2},{0, 3},{4, 2},{0, 3},{0, 2},{0, 2},{0, 2},{0, 2},{3, 2},{0, 5},{0, 1},{4, 1},{0, 2},{3, 2},{0, 2},{3, 2},{0, 5},{0, 1},{2, 1},{4, 1},{0, 1},{2, 1},{4, 1},{0, 2},{3, 3},{0, 3},{4, 1},{0, 3},{4, 1},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{4, 1},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{0, 2},{0, 3},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{3, 2},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{0, 2},{3, 2},{0, 3},{4, 2},{1, 4},{0, 2},{4, 1},{0, 4},{2, 3},{0, 1},{3, 2},{0, 4},{0, 5},{1, 2},{4, 1},{1, 2},{1, 2},{1, 2},{0, 4},{0, 2},{3, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 2},{3, 3},{0, 2},{3, 2},{1, 1},{3, 1},{1, 3},{1, 3},{2, 1},{0, 1},{2, 1},{4, 2},{0, 1},{2, 1},{4, 1},{0, 1},{2, 1},{4, 1},{0, 5},{1, 3},{1, 1},{3, 1},{0, 2},{4, 2},{1, 4},{2, 2},{2, 2},{1, 4},{0, 2},{4, 2},{0, 2},{4, 2},{0, 2},{4, 2},{1, 4},{2, 2},{2, 2},{1, 4},{0, 5},{0, 2},{3, 2},{2, 2},{1, 2},{0, 2},{3, 2},{0, 5},{1, 3},{1, 2},{1, 2},{1, 2},{1, 2},{1, 2},{1, 2},{1, 3},{0, 1},{0, 1},{1, 1},{1, 1},{2, 1},{2, 1},{3, 1},{3, 1},{1, 3},{2, 2},{2, 2},{2, 2},{2, 2},{2, 2},{2, 2},{1, 3},{2, 1},{1, 3},{0, 2},{3, 2},{0, 6},{1, 2},{2, 1},{3, 1},{1, 3},{0, 2},{3, 2},{1, 4},{0, 2},{3, 2},{0, 6},{0, 2},{0, 2},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{1, 3},{0, 2},{3, 2},{0, 2},{0, 2},{3, 2},{1, 3},{2, 3},{3, 2},{1, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 5},{1, 3},{0, 2},{3, 2},{0, 5},{0, 2},{1, 4},{2, 3},{1, 2},{0, 5},{1, 2},{1, 2},{1, 2},{0, 5},{1, 2},{4, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 4},{3, 2},{0, 4},{0, 2},{0, 2},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{2, 2},{0, 4},{2, 2},{2, 2},{2, 2},{0, 6},{2, 2},{0, 4},{2, 2},{2, 2},{2, 2},{2, 2},{2, 2},{0, 3},{0, 2},{0, 2},{0, 2},{3, 2},{0, 4},{0, 3},{0, 4},{0, 2},{3, 3},{0, 4},{2, 2},{2, 2},{2, 2},{2, 2},{2, 2},{0, 6},{0, 4},{0, 5},{0, 1},{2, 1},{4, 1},{0, 1},{2, 1},{4, 1},{0, 1},{2, 1},{4, 1},{0, 1},{2, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{0, 4},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 4},{0, 2},{0, 3},{1, 2},{4, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 4},{3, 2},{2, 4},{0, 2},{3, 3},{1, 3},{5, 1},{1, 2},{1, 2},{0, 4},{1, 4},{0, 3},{1, 4},{3, 3},{0, 5},{1, 2},{1, 2},{0, 5},{1, 2},{1, 2},{1, 2},{4, 2},{2, 3},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{0, 2},{3, 2},{1, 5},{0, 2},{3, 2},{0, 2},{3, 2},{1, 3},{1, 3},{2, 1},{0, 1},{2, 1},{4, 2},{0, 1},{2, 1},{4, 1},{0, 5},{1, 4},{1, 1},{3, 1},{0, 3},{4, 2},{1, 4},{2, 2},{1, 4},{0, 2},{3, 3},{0, 2},{3, 3},{0, 2},{3, 2},{0, 2},{3, 2},{1, 1},{3, 1},{1, 3},{1, 2},{0, 2},{0, 5},{0, 1},{2, 2},{1, 2},{0, 2},{3, 2},{0, 5},{3, 2},{2, 2},{2, 2},{1, 2},{2, 2},{2, 2},{2, 2},{3, 2},{2, 1},{2, 1},{2, 1},{2, 1},{2, 1},{2, 1},{2, 1},{0, 2},{1, 2},{1, 2},{2, 2},{1, 2},{1, 2},{1, 2},{0, 2},{1, 2},{4, 1},{0, 1},{2, 2}};
+const uint32_t row_spans[] = {
+0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,2,3,4,4,5,5,
+5,5,5,5,7,9,11,11,11,11,11,
+11,11,11,13,15,16,18,20,21,23,25,
+25,25,26,27,29,30,31,32,34,35,36,
+36,36,36,37,40,41,42,43,46,47,47,
+47,47,47,47,48,49,50,51,53,54,54,
+54,54,54,55,56,57,57,57,57,57,57,
+57,57,57,58,59,60,61,62,63,64,65,
+65,65,65,66,67,68,69,70,71,72,73,
+73,73,73,74,75,76,78,78,78,78,78,
+78,78,78,78,79,80,81,82,83,83,83,
+83,83,83,83,83,83,83,83,83,84,85,
+86,86,86,86,86,86,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,88,88,
+88,88,88,89,90,91,92,93,94,95,96,
+96,96,96,97,99,101,103,105,107,108,108,
+108,108,108,109,110,111,112,113,114,115,115,
+115,115,115,116,118,119,120,121,123,124,124,
+124,124,124,125,127,128,129,130,132,133,133,
+133,133,133,134,135,137,139,140,141,142,142,
+142,142,142,143,144,145,147,148,150,151,151,
+151,151,151,152,154,155,156,158,160,161,161,
+161,161,161,162,164,165,166,167,168,169,169,
+169,169,169,170,172,174,175,177,179,180,180,
+180,180,180,181,183,185,186,187,189,190,190,
+190,190,190,190,190,190,191,191,191,192,192,
+192,192,192,192,192,192,193,193,193,194,195,
+196,196,196,196,197,198,199,200,201,201,201,
+201,201,201,201,201,202,202,203,203,203,203,
+203,203,203,203,204,205,206,207,208,208,208,
+208,208,208,208,209,211,212,213,213,214,214,
+214,214,214,215,217,219,222,225,227,228,229,
+229,229,229,229,230,231,233,234,236,238,238,
+238,238,238,238,239,241,242,244,246,247,247,
+247,247,247,247,248,250,251,252,254,255,255,
+255,255,255,255,256,258,260,262,264,265,265,
+265,265,265,265,266,267,268,269,271,272,272,
+272,272,272,272,273,274,275,276,277,278,278,
+278,278,278,278,279,281,282,283,285,286,286,
+286,286,286,286,288,290,291,293,295,297,297,
+297,297,297,297,298,299,300,301,302,303,303,
+303,303,303,303,304,305,306,308,310,311,311,
+311,311,311,311,313,315,316,317,319,321,321,
+321,321,321,321,322,323,324,325,327,328,328,
+328,328,328,328,330,332,334,335,338,341,341,
+341,341,341,341,343,345,347,349,351,353,353,
+353,353,353,353,354,356,358,360,362,363,363,
+363,363,363,363,364,366,368,369,370,371,371,
+371,371,371,371,372,374,376,378,380,381,382,
+382,382,382,382,383,385,387,388,390,392,392,
+392,392,392,392,393,395,396,397,399,400,400,
+400,400,400,400,401,403,404,405,406,407,407,
+407,407,407,407,409,411,413,415,417,418,418,
+418,418,418,418,420,422,424,425,426,427,427,
+427,427,427,427,430,433,436,437,438,440,440,
+440,440,440,440,442,443,444,445,446,448,448,
+448,448,448,448,450,452,453,454,455,456,456,
+456,456,456,456,457,459,460,461,463,464,464,
+464,464,464,465,466,467,468,469,470,471,472,
+472,472,472,473,474,475,476,477,478,479,480,
+480,480,480,481,482,483,484,485,486,487,488,
+488,488,488,489,490,492,492,492,492,492,492,
+492,492,492,492,492,492,492,492,492,492,492,
+493,493,493,494,495,496,496,496,496,496,496,
+496,496,496,496,496,497,499,500,502,503,503,
+503,503,503,504,505,506,508,510,512,513,513,
+513,513,513,513,513,514,516,517,519,520,520,
+520,520,520,521,522,523,525,527,529,530,530,
+530,530,530,530,530,531,533,534,535,536,536,
+536,536,536,537,538,539,540,541,542,543,543,
+543,543,543,543,543,545,547,549,551,552,553,
+554,554,554,555,556,557,559,561,563,565,565,
+565,565,565,566,566,567,568,569,570,571,571,
+571,571,571,572,572,573,574,575,576,577,578,
+579,579,579,580,581,583,584,585,586,588,588,
+588,588,588,589,590,591,592,593,594,595,595,
+595,595,595,595,595,596,597,600,603,606,606,
+606,606,606,606,606,608,610,612,614,616,616,
+616,616,616,616,616,617,619,621,623,624,624,
+624,624,624,624,624,625,627,629,631,632,633,
+634,634,634,634,634,636,638,640,642,643,644,
+645,645,645,645,645,647,649,650,651,652,652,
+652,652,652,652,652,653,654,655,656,657,657,
+657,657,657,658,659,660,661,662,664,665,665,
+665,665,665,665,665,667,669,671,673,674,674,
+674,674,674,674,674,676,678,679,680,681,681,
+681,681,681,681,681,684,687,688,689,691,691,
+691,691,691,691,691,693,694,695,696,698,698,
+698,698,698,698,698,700,702,704,706,707,708,
+709,709,709,709,709,710,712,713,715,716,716,
+716,716,716,717,718,719,720,721,722,723,724,
+724,724,724,724,725,726,727,728,729,730,731,
+731,731,731,732,733,734,735,736,737,738,739,
+739,739,739,739,739,741,743,743,743,743,743,
+743,
+};
+const cm::font font = {6, 11, 32, 95, spans, row_spans};
+}
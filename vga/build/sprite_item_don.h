@@ -1,94 +1,187 @@
 namespace sprite_don {
 const int width = 128;
 const int height = 87;
-const cm::pixel data[] = {
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 2, 2},{1, 2, 2},{1, 2, 2},{1, 2, 2},{2, 2, 2},{1, 1, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{4, 4, 4},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 2, 2},{3, 3, 3},{4, 3, 3},{4, 4, 4},{4, 4, 4},{4, 4, 4},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 1, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 4},{4, 4, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{3, 3, 3},{1, 1, 1},{3, 2, 2},{4, 4, 3},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{4, 4, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 0},{1, 2, 1},{2, 2, 2},{2, 3, 3},{2, 2, 2},{1, 1, 1},{3, 3, 3},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{2, 2, 2},{2, 1, 1},{4, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 4, 4},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 1},{2, 2, 2},{2, 3, 3},{3, 3, 3},{3, 4, 3},{3, 4, 3},{2, 2, 2},{1, 2, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 4, 4},{3, 3, 2},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 2},{2, 3, 3},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 2, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 4, 3},{4, 4, 4},{4, 4, 4},{4, 4, 4},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{3, 3, 3},{1, 2, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{3, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 4},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 0},{0, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{3, 2, 2},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 4},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 4, 4},{2, 2, 2},{3, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 2},{0, 0, 0},{1, 1, 1},{2, 2, 2},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{3, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 2, 2},{3, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 3, 3},{5, 3, 2},{5, 2, 2},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 2},{5, 3, 2},{5, 3, 3},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 3, 3},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{3, 3, 3},{3, 2, 2},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 3},{4, 3, 2},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 3, 2},{5, 4, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 0, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{2, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 3, 3},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 3},{4, 2, 2},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 2},{5, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 3, 2},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 2, 1},{4, 2, 2},{5, 4, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{5, 5, 4},{0, 0, 0},{0, 0, 0},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 3, 3},{0, 0, 0},{0, 0, 0},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{0, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{4, 4, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{3, 3, 2},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 3, 3},{0, 0, 0},{0, 0, 0},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 3, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 2, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 3, 3},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 2, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{1, 1, 0},{0, 0, 0},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 3, 3},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 3},{0, 0, 0},{0, 0, 0},{2, 2, 2},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 2},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 1, 1},{3, 1, 1},{2, 1, 0},{2, 1, 1},{3, 1, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 0},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{0, 0, 0},{1, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{3, 3, 3},{1, 2, 1},{2, 3, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 2},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 0},{4, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 4},{0, 1, 1},{4, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{2, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{2, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 1, 0},{4, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},{3, 3, 3},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{2, 2, 1},{4, 4, 4},{3, 3, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 0, 0},{4, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{2, 2, 2},{0, 0, 0},{0, 0, 0},{2, 2, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 3},{3, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 2},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 5},{3, 3, 3},{2, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 1},{4, 2, 1},{4, 2, 1},{4, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 0, 0},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{1, 1, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{2, 2, 1},{5, 5, 4},{5, 5, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{0, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 1, 1},{2, 0, 0},{1, 0, 0},{2, 0, 0},{3, 1, 0},{4, 1, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 1},{4, 2, 1},{4, 1, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 1, 2},{1, 1, 2},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{3, 4, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 2},{5, 2, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{2, 1, 1},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{3, 1, 1},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{5, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 2},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{2, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 1, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{5, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{1, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{2, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{5, 5, 4},{5, 5, 4},{4, 4, 3},{1, 1, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 4},{5, 5, 5},{3, 4, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{2, 2, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 2, 1},{2, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{3, 1, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{5, 5, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 5},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{3, 1, 1},{3, 1, 0},{3, 1, 0},{3, 1, 1},{4, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 5},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 1, 1},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 4},{4, 4, 4},{0, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 1},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 3, 2},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{2, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 1, 1},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 1, 1},{3, 0, 0},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 4},{3, 3, 3},{2, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 4, 4},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 1, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{3, 1, 1},{2, 0, 0},{4, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{4, 1, 1},{3, 0, 0},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{3, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{2, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 0},{4, 2, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{2, 0, 0},{3, 0, 0},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{4, 2, 1},{3, 1, 1},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 2},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 1, 1},{4, 2, 1},{3, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{2, 1, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 1, 1},{2, 0, 0},{3, 1, 0},{3, 0, 0},{3, 0, 0},{3, 1, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 1, 1},{3, 1, 1},{2, 0, 0},{2, 0, 0},{4, 1, 1},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 2, 2},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 2},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{3, 1, 1},{3, 1, 1},{4, 1, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{3, 1, 0},{3, 0, 0},{4, 1, 1},{3, 1, 0},{3, 1, 0},{3, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{3, 0, 0},{3, 1, 1},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{1, 2, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{0, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 2},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{4, 1, 1},{3, 1, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{3, 1, 0},{2, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{3, 1, 1},{2, 0, 0},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 0, 1},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{3, 1, 0},{3, 0, 0},{4, 1, 1},{4, 1, 1},{4, 1, 1},{4, 1, 1},{3, 1, 0},{3, 0, 0},{3, 0, 0},{3, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{3, 0, 0},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 1, 1},{2, 0, 0},{2, 0, 0},{2, 0, 0},{3, 0, 0},{3, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{2, 0, 0},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 0, 0},{0, 0, 0},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 3, 2},{4, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 1, 1},{2, 0, 0},{3, 1, 1},{3, 1, 1},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{3, 4, 3},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{0, 0, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 3, 3},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 0, 0},{3, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{3, 3, 3},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{0, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{1, 1, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 1, 1},{3, 0, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{2, 0, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{1, 2, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 2},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 1, 1},{2, 0, 0},{4, 0, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{3, 0, 0},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 4, 4},{4, 2, 1},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 1, 0},{3, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{3, 1, 0},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 1, 0},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 0, 0},{0, 0, 0},{4, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{3, 3, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{2, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 1, 1},{2, 0, 0},{3, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 0, 0},{3, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{3, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 4, 4},{4, 2, 2},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{3, 1, 0},{3, 0, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 0, 0},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 4, 3},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{4, 1, 1},{2, 0, 0},{3, 1, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{2, 0, 0},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 1, 1},{4, 4, 4},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{2, 1, 1},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 4, 4},{5, 3, 2},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{4, 1, 1},{3, 0, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 0, 0},{3, 1, 0},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{5, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{5, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 3},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 2},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{3, 0, 0},{3, 0, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{3, 1, 0},{2, 0, 0},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{1, 0, 0},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{3, 4, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{4, 2, 2},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 1, 1},{2, 0, 0},{3, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{3, 0, 0},{3, 1, 0},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 2},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 1, 1},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{0, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{3, 3, 3},{3, 2, 2},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 2, 2},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 1, 1},{3, 0, 0},{3, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{3, 0, 0},{3, 0, 0},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{2, 2, 1},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{2, 2, 2},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 2},{4, 2, 1},{4, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{4, 2, 1},{3, 1, 0},{3, 0, 0},{3, 0, 0},{4, 1, 0},{4, 1, 0},{4, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{4, 1, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{5, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 4, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 4, 4},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 3},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 1, 1},{3, 1, 0},{3, 0, 0},{2, 0, 0},{2, 0, 0},{3, 0, 0},{4, 1, 1},{4, 1, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 3},{1, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 5, 4},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{0, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 3},{4, 2, 2},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{5, 3, 2},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{2, 2, 2},{0, 0, 0},{1, 0, 0},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 3, 3},{4, 2, 1},{4, 2, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{4, 2, 1},{4, 2, 2},{5, 4, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{0, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{3, 4, 4},{2, 2, 3},{2, 2, 2},{4, 5, 4},{4, 4, 4},{3, 3, 3},{3, 3, 3},{4, 4, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 3, 3},{4, 2, 2},{4, 2, 1},{4, 2, 1},{4, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{5, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 2},{5, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 3, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{3, 3, 3},{2, 2, 2},{2, 2, 1},{1, 1, 1},{3, 3, 3},{3, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{4, 4, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 3},{5, 3, 3},{4, 2, 2},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 1},{4, 2, 2},{5, 3, 3},{5, 4, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 4},{5, 5, 4},{4, 4, 4},{4, 4, 4},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 1},{2, 3, 2},{4, 4, 4},{5, 5, 5},{5, 5, 5},{3, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 3},{5, 4, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{2, 2, 2},{0, 0, 0},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 3, 3},{2, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{2, 4, 3},{1, 2, 1},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{2, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 4, 4},{3, 3, 2},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{1, 2, 2},{2, 3, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{4, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 3},{1, 1, 1},{3, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 4},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{2, 2, 2},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 4, 3},{1, 2, 2},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{3, 3, 3},{1, 1, 1},{3, 3, 3},{5, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 4, 4},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{2, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 5, 4},{2, 2, 2},{2, 3, 2},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 1, 1},{2, 3, 3},{0, 1, 1},{3, 3, 3},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{3, 3, 3},{1, 1, 1},{3, 3, 3},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{4, 4, 4},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{3, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{2, 2, 2},{3, 4, 4},{2, 3, 3},{1, 2, 2},{1, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{3, 3, 3},{2, 2, 1},{2, 2, 2},{3, 3, 3},{4, 4, 4},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 4, 4},{4, 4, 4},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{4, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 0, 0},{0, 0, 0},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 2},{1, 2, 1},{0, 1, 1},{1, 2, 2},{2, 2, 2},{2, 3, 3},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 2, 2},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{4, 4, 4},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{3, 3, 3},{2, 2, 2},{1, 1, 1},{2, 2, 1},{2, 2, 2},{3, 3, 3},{3, 3, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{3, 3, 3},{3, 2, 2},{2, 2, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 4},{4, 4, 4},{3, 4, 4},{3, 3, 3},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{0, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{4, 4, 4},{4, 4, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{4, 4, 3},{4, 4, 4},{4, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{3, 3, 2},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{3, 4, 4},{1, 2, 2},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 2},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 3},{1, 1, 1},{1, 2, 2},{3, 3, 3},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{1, 1, 1},{0, 0, 0},{1, 1, 1},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 1},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 2},{0, 1, 1},{1, 2, 1},{2, 3, 3},{3, 4, 3},{4, 4, 4},{4, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 2, 2},{3, 4, 3},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{2, 3, 3},{2, 3, 2},{1, 2, 2},{1, 2, 1},{0, 1, 0},{1, 1, 1},{1, 2, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{1, 1, 1},{0, 0, 0},{1, 1, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{3, 3, 3},{1, 1, 1},{2, 2, 2},{3, 3, 3},{1, 1, 1},{2, 3, 3},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 2, 2},{3, 3, 3},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{0, 1, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{3, 3, 3},{3, 3, 3},{2, 3, 3},{1, 2, 2},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 4},{4, 4, 4},{3, 3, 3},{1, 1, 1},{0, 0, 0},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{3, 3, 3},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{1, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 5, 4},{4, 4, 4},{2, 2, 2},{1, 2, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 3},{1, 2, 2},{1, 1, 1},{3, 3, 3},{4, 4, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{4, 4, 4},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 2, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{0, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 3},{2, 3, 3},{2, 2, 2},{1, 2, 1},{1, 1, 1},{3, 3, 3},{4, 4, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 4, 4},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 4},{5, 5, 5},{4, 4, 4},{2, 3, 3},{1, 1, 1},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{1, 2, 1},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{2, 3, 3},{1, 2, 2},{0, 1, 1},{1, 2, 2},{3, 3, 3},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 4},{5, 5, 5},{4, 4, 4},{1, 2, 2},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 1},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 5, 4},{2, 2, 2},{2, 3, 3},{2, 3, 3},{2, 3, 3},{1, 2, 2},{1, 1, 1},{0, 0, 0},{0, 1, 1},{3, 3, 3},{4, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 4, 3},{4, 4, 4},{3, 4, 3},{1, 2, 1},{1, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 2, 2},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{2, 2, 2},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 3, 3},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 4, 4},{2, 3, 3},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 4, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 4},{4, 4, 4},{4, 4, 4},{4, 4, 4},{3, 3, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{4, 4, 4},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{1, 2, 2},{1, 2, 2},{1, 2, 2},{1, 1, 1},{0, 1, 0},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{3, 3, 3},{0, 0, 0},{0, 0, 0},{4, 4, 4},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{4, 4, 4},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{2, 2, 2},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{2, 2, 2},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{4, 4, 4},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{4, 4, 4},{1, 1, 1},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 4},{5, 5, 4},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{3, 3, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
+const uint8_t data[] = {
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,43,43,0,43,43,0,0,0,0,0,43,43,43,0,43,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7,0,0,0,0,0,0,0,0,43,86,86,129,129,43,0,0,79,122,129,165,172,172,172,171,171,129,86,43,0,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,6,43,0,0,0,0,0,0,0,0,43,129,172,172,255,255,172,129,43,122,171,172,255,255,255,255,255,255,255,255,255,214,255,255,172,171,86,43,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,0,6,49,86,93,86,43,129,172,255,255,255,172,86,79,165,208,214,255,255,255,255,255,255,255,255,255,255,214,214,214,214,214,255,255,208,171,86,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,1,0,0,0,43,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7,0,0,0,0,0,49,86,93,129,135,135,86,49,172,255,255,214,208,128,43,171,214,214,214,255,255,255,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,255,255,214,172,86,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,0,0,0,0,0,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,7,50,93,93,100,100,100,100,93,50,93,172,255,255,255,172,43,129,214,214,255,255,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,255,214,255,255,255,214,255,214,165,43,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,42,0,0,86,135,172,172,172,129,43,0,0,43,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7,0,0,0,0,43,86,93,100,100,100,100,100,100,100,93,43,129,255,255,255,214,129,49,172,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,214,214,214,255,172,122,0,0,43,255,255,255,255,255,255,255,255,255,255,43,0,43,171,214,214,214,214,255,255,172,129,0,0,43,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,42,6,0,0,0,7,50,93,100,100,100,100,100,100,100,100,100,93,43,172,255,255,255,214,122,86,172,214,214,214,214,214,214,214,214,214,214,214,255,214,214,214,214,214,214,214,214,214,214,214,255,214,214,255,214,214,214,214,255,214,171,42,0,0,255,255,255,255,255,255,255,255,255,0,0,171,214,214,214,214,214,214,214,214,214,129,0,0,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,7,50,93,100,100,100,100,100,100,100,100,100,100,100,93,43,172,214,255,255,208,86,128,214,214,214,255,214,214,214,214,214,214,214,214,214,214,214,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,255,255,255,172,43,0,0,255,255,255,255,255,255,255,43,0,86,214,214,214,214,214,214,214,214,214,214,214,128,0,43,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,43,93,93,100,100,100,100,100,100,100,100,100,100,100,100,93,43,136,255,214,214,214,122,128,214,214,214,214,214,214,214,214,214,214,214,214,208,208,201,200,194,157,157,157,157,157,157,158,200,201,208,208,214,214,214,214,214,214,214,214,255,214,172,85,0,0,255,255,255,255,255,255,0,0,171,214,214,214,214,214,214,214,214,214,214,214,172,0,0,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,50,93,99,100,100,100,100,100,100,100,100,100,100,100,100,100,99,50,129,255,255,255,214,129,122,214,255,214,214,214,214,214,214,214,214,214,208,207,164,157,157,157,193,187,187,187,187,193,193,157,157,157,157,164,207,208,214,214,214,214,214,214,214,214,255,172,86,0,0,255,255,255,255,255,0,0,172,214,255,214,214,214,214,214,214,214,214,214,214,86,0,37,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,1,0,0,7,50,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,93,255,255,255,255,165,86,255,255,255,214,214,214,214,214,214,214,208,207,158,157,157,193,187,187,187,187,187,187,187,187,187,193,193,193,193,157,157,158,201,208,214,214,255,214,214,214,255,214,172,43,0,0,255,255,255,255,0,0,172,214,214,214,214,214,214,214,214,214,214,214,255,129,0,43,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7,0,0,7,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,50,172,255,214,214,172,43,172,255,255,255,214,214,214,214,214,214,208,164,157,157,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,157,157,158,207,208,214,214,214,214,214,255,255,172,43,0,43,255,255,255,0,0,171,214,214,214,214,214,214,214,214,214,214,214,255,165,0,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,1,50,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,7,172,255,214,214,214,86,171,255,255,255,255,255,214,214,214,214,207,157,157,193,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,193,193,157,157,200,208,214,214,255,214,255,214,255,171,0,0,255,255,255,43,0,128,214,255,214,214,214,214,214,214,214,214,255,255,165,0,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,50,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,129,255,214,214,214,165,86,214,214,255,214,214,214,214,214,208,201,157,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,193,187,157,164,208,214,214,255,214,214,214,255,129,0,0,255,255,255,0,0,172,214,255,255,214,214,214,214,214,214,255,255,129,0,43,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,214,214,255,255,208,43,172,214,214,214,214,214,214,214,214,201,157,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,187,193,157,194,208,214,214,214,214,255,255,255,86,0,43,255,255,42,0,86,214,214,255,255,255,214,214,214,214,255,255,86,0,43,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7,0,0,50,93,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,214,214,214,255,129,129,255,214,214,214,214,214,214,214,207,157,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,157,158,208,214,214,255,255,255,255,172,0,0,255,255,255,0,0,86,172,214,255,214,255,214,214,214,255,172,42,0,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,50,93,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,255,214,255,208,43,172,214,214,214,214,214,214,214,207,157,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,158,208,214,214,214,255,255,255,129,0,0,255,255,255,0,0,43,171,214,214,255,214,214,214,255,171,0,0,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,255,255,255,255,129,129,214,214,214,214,214,214,214,208,158,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,157,157,157,157,157,164,208,214,214,214,255,255,172,43,0,255,255,255,255,0,0,129,214,255,214,214,214,255,255,86,0,43,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,43,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,255,255,214,214,43,172,214,214,214,214,214,214,208,201,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,151,115,78,79,115,157,157,157,201,214,214,214,255,255,255,129,0,42,255,255,255,0,0,172,214,255,214,214,214,255,172,0,0,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,129,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,255,255,214,214,172,86,214,214,214,214,214,214,214,208,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,157,115,36,36,0,0,36,78,157,157,157,207,214,214,255,255,255,172,43,0,255,255,43,0,43,214,214,214,214,214,255,214,86,0,43,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,128,129,49,94,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,136,255,214,214,214,129,129,255,255,255,214,214,214,214,200,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,115,36,0,0,0,0,0,36,78,157,157,200,208,214,255,255,255,255,129,0,0,255,0,0,129,214,214,214,214,214,255,165,0,0,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,86,172,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,94,7,178,214,214,255,214,79,172,255,255,255,255,214,214,208,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,193,157,72,0,0,0,0,0,0,0,36,114,157,157,207,214,214,214,255,214,172,0,0,43,0,43,214,255,214,214,214,255,172,43,0,43,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,42,0,85,172,129,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,255,214,214,214,172,79,214,214,214,214,214,214,214,201,157,187,187,193,187,187,187,187,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,115,36,0,0,0,0,0,0,0,0,72,157,157,200,208,214,214,255,214,214,86,0,0,0,172,255,255,214,214,214,255,86,0,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,172,172,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,129,255,214,214,214,171,128,214,214,214,214,214,214,208,158,193,193,193,187,187,187,193,193,193,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,157,115,36,0,0,0,0,0,0,0,0,36,157,157,157,207,214,214,214,214,214,129,0,0,86,255,255,255,214,214,255,129,0,0,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,129,255,129,86,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,49,172,255,214,214,214,129,171,214,214,214,214,214,214,207,157,151,187,187,187,193,157,157,157,157,157,193,193,187,187,187,193,193,187,187,187,187,187,187,187,187,187,187,157,115,36,0,0,0,0,0,0,0,0,36,121,157,157,164,208,214,214,214,214,172,0,43,172,255,255,255,255,214,172,42,0,43,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,85,214,214,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,7,172,255,214,214,214,86,172,255,214,214,214,214,214,201,157,193,193,187,193,157,115,72,36,72,114,151,157,193,187,187,193,187,187,187,187,187,187,187,187,187,187,187,157,115,36,0,0,0,0,0,0,0,0,36,121,157,151,157,208,214,214,214,214,214,43,129,255,255,255,214,255,172,43,0,43,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,172,255,135,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,255,214,214,214,214,43,172,214,255,214,214,214,214,200,193,187,193,193,157,79,36,36,0,0,36,36,115,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,151,36,0,0,0,0,0,0,0,0,36,157,193,193,157,201,214,214,214,214,214,129,172,214,255,255,255,172,43,0,0,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,43,0,86,255,255,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,214,214,214,214,214,43,214,255,214,214,214,214,208,158,187,193,193,157,115,36,0,0,0,0,0,0,36,151,193,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,78,36,0,0,0,0,0,0,36,114,157,193,187,157,200,214,214,214,255,255,129,129,214,255,214,172,43,0,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,0,0,172,255,172,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,93,214,255,255,214,172,43,214,214,214,214,214,214,208,157,187,187,193,157,72,0,0,0,0,0,0,0,36,78,157,193,187,187,187,187,187,187,187,187,187,187,187,187,193,193,157,36,0,0,0,0,0,0,36,157,193,187,187,187,157,208,214,214,214,214,172,86,214,214,171,42,0,36,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,43,0,86,214,255,135,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,129,214,255,255,214,172,85,214,255,214,214,214,214,208,157,187,187,193,115,36,0,0,0,0,0,0,0,0,36,157,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,157,121,72,36,0,0,36,36,115,157,193,193,187,193,157,208,214,214,214,214,172,43,214,129,0,0,36,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,0,0,129,255,255,93,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,129,255,214,214,214,172,86,214,214,255,214,214,214,207,157,187,187,157,115,36,0,0,0,0,0,0,0,0,36,121,193,187,187,187,187,187,187,187,187,187,187,193,187,187,187,193,157,157,115,114,114,115,151,193,193,193,187,187,187,157,207,214,214,214,214,214,43,43,0,0,43,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,0,0,172,214,255,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,255,255,214,214,172,86,214,214,255,214,214,214,207,157,187,187,157,115,36,0,0,0,0,0,0,0,0,36,115,157,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,157,157,193,193,187,187,187,187,187,187,157,201,214,214,214,214,214,43,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,43,0,86,255,214,172,7,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,255,255,214,214,172,85,214,214,214,214,214,214,207,157,187,187,157,115,36,0,0,0,0,0,0,0,0,36,121,157,187,187,193,193,187,187,187,187,187,187,187,187,187,187,187,187,187,187,193,157,193,187,187,187,187,187,187,187,157,201,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,43,0,129,214,214,172,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,56,129,255,255,255,255,172,79,214,214,214,214,214,214,207,157,187,187,193,157,36,36,0,0,0,0,0,0,0,36,157,157,193,187,187,193,187,187,187,151,151,187,187,187,187,187,187,187,187,187,151,108,151,187,187,187,187,187,187,187,157,164,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,0,172,255,214,129,86,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,129,255,255,255,214,208,43,214,255,214,214,214,214,208,157,187,193,187,157,115,36,0,0,0,0,0,0,0,115,157,193,187,187,187,187,187,187,187,115,72,151,187,193,187,187,187,193,187,157,151,108,151,187,187,187,187,187,187,187,157,164,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,43,214,255,214,129,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,129,255,214,214,214,214,43,208,214,214,214,214,214,208,157,187,193,193,193,157,78,36,0,0,0,0,0,78,157,187,193,187,187,187,187,193,187,157,115,72,108,157,193,193,187,193,187,157,115,72,151,193,187,187,187,187,187,187,187,157,164,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,86,255,255,255,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,92,255,214,214,214,214,85,172,214,214,214,214,214,208,157,193,193,193,193,151,157,114,36,36,36,36,78,157,193,187,187,187,187,187,193,193,193,151,72,114,108,108,115,157,157,157,151,115,72,72,151,151,187,187,187,187,187,187,187,157,164,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,0,0,129,255,214,214,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,255,214,214,214,214,122,171,214,214,214,214,214,208,158,193,187,187,193,187,193,157,157,115,115,151,157,157,193,187,187,187,187,193,193,193,157,114,108,151,114,114,108,72,72,72,72,108,115,72,151,193,193,187,187,187,187,187,187,157,164,214,214,214,214,214,86,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,43,0,129,214,214,255,49,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,7,214,214,214,214,214,129,129,255,214,255,214,214,214,200,157,193,193,187,187,187,193,193,157,157,193,187,151,114,157,193,187,193,157,157,157,114,72,150,150,150,150,150,150,150,150,150,150,115,72,151,187,187,187,187,187,187,187,187,157,201,214,255,214,214,214,43,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,37,0,172,214,214,214,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,43,172,214,214,214,214,172,86,214,214,255,214,214,214,201,157,193,187,187,187,187,187,187,187,187,187,187,187,114,108,151,151,151,151,114,108,108,114,150,144,144,144,144,150,150,150,144,150,150,108,151,187,187,187,187,187,187,187,187,157,207,214,255,214,214,214,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,43,0,172,214,214,214,43,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,172,255,214,214,214,214,43,214,214,255,214,214,214,208,157,193,187,187,187,187,187,187,187,187,187,187,193,157,115,72,72,72,108,108,144,150,150,144,144,144,144,144,144,150,144,144,150,114,72,151,187,187,187,187,187,187,187,187,157,208,214,214,214,214,172,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,0,0,172,214,214,214,43,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,129,255,214,214,214,214,86,172,214,214,214,214,214,208,164,151,187,187,187,187,187,187,187,187,187,187,187,157,151,72,115,115,150,150,150,144,144,144,144,144,144,144,144,144,144,144,150,114,72,151,193,187,187,187,187,187,187,187,157,208,214,214,255,214,135,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,0,0,172,214,214,255,50,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,50,255,255,214,214,255,165,129,214,214,214,214,214,214,207,157,187,187,187,187,187,187,187,187,187,187,187,187,157,108,114,150,144,144,144,144,144,144,144,144,144,144,144,144,144,144,150,114,72,151,193,187,187,187,187,187,193,157,200,208,214,214,255,214,129,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,0,0,172,214,214,255,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,7,172,214,255,214,214,208,43,214,214,214,214,214,214,208,157,193,193,187,187,187,187,187,187,187,187,187,187,193,151,108,150,144,144,144,144,144,144,144,144,144,144,144,144,144,144,150,114,72,157,193,187,187,187,187,187,193,157,207,214,214,255,214,214,49,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,0,0,172,214,214,255,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,135,214,214,255,214,214,86,172,214,214,214,214,214,208,200,157,193,187,187,187,187,187,187,187,187,187,187,193,151,72,144,150,144,144,144,144,144,144,144,144,144,144,144,144,144,150,114,108,157,193,187,187,187,187,187,193,157,208,214,214,214,255,172,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,43,0,172,214,214,255,129,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,214,214,214,255,255,171,86,214,214,214,214,255,214,208,157,157,187,187,187,187,187,187,187,187,187,187,193,157,114,108,144,144,144,144,144,144,144,144,144,144,144,144,144,144,150,114,114,193,193,187,187,187,187,187,157,200,214,214,255,255,255,129,0,42,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,36,0,165,255,214,214,129,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,43,172,214,214,214,214,208,79,172,214,255,214,214,214,214,201,157,193,193,187,193,187,187,187,187,187,187,187,193,151,72,114,144,144,144,144,144,144,144,144,144,144,144,144,144,150,108,115,193,187,187,187,187,187,193,157,208,214,255,255,255,255,86,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,43,0,129,255,214,214,172,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,129,214,255,214,214,255,129,122,214,214,255,214,214,255,208,158,193,187,187,187,187,187,187,187,187,187,187,187,193,114,108,150,144,144,144,144,144,144,144,144,144,144,144,150,144,72,151,193,187,187,187,193,193,157,200,208,214,255,214,255,172,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,43,0,129,255,214,214,172,7,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,255,255,214,255,208,43,172,214,214,255,214,255,214,207,157,193,187,187,187,187,187,187,187,187,187,193,187,151,72,114,150,150,144,144,144,144,144,144,144,144,144,144,144,72,157,187,187,187,187,187,193,157,208,214,214,255,214,255,129,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,79,255,214,214,214,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,255,214,214,214,255,171,86,214,214,255,214,255,214,208,200,157,187,187,187,187,187,187,187,187,187,187,187,157,151,108,150,150,144,144,144,144,144,144,144,144,144,150,108,114,157,187,187,187,187,187,157,201,208,214,214,255,255,172,36,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,0,208,255,214,255,93,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,255,255,255,214,214,86,171,255,255,214,255,214,214,208,200,157,187,187,187,187,187,187,187,187,187,187,193,157,108,108,150,150,144,144,144,150,144,144,144,150,114,72,151,193,187,187,187,193,157,164,208,214,214,214,255,255,129,0,36,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,0,0,172,214,255,214,135,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,129,255,214,214,214,214,172,43,208,214,214,214,255,214,214,208,158,157,187,187,187,187,187,187,187,187,187,193,193,151,72,108,150,150,150,150,144,144,150,150,150,108,114,193,193,187,193,193,157,158,207,214,214,214,214,214,172,36,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,43,0,129,214,214,214,172,7,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,7,172,255,214,214,255,214,129,122,214,255,255,255,255,214,214,208,194,157,187,187,187,187,187,187,187,187,187,187,193,151,108,108,150,150,150,144,150,150,150,108,108,157,187,187,193,193,157,157,207,214,214,255,255,214,214,86,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,0,85,214,214,214,214,86,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,214,214,214,255,255,214,86,129,214,255,255,255,214,214,214,208,200,157,151,193,187,187,187,187,187,187,187,187,187,157,114,108,108,150,150,144,108,108,108,151,157,193,193,193,157,157,207,214,214,214,214,255,255,129,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,0,0,172,214,214,214,135,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,129,255,214,255,214,214,208,43,171,214,214,214,214,214,214,214,208,201,157,193,193,187,187,187,187,187,187,187,187,193,157,151,114,108,72,72,108,151,151,193,193,187,193,157,158,208,214,214,214,214,255,255,172,43,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,36,0,129,255,255,214,178,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,7,172,214,255,255,255,255,172,43,172,214,214,214,214,214,214,214,208,207,158,157,193,187,187,187,187,187,187,187,187,187,193,157,157,157,157,157,157,193,187,193,157,157,200,208,214,214,214,214,214,255,172,86,0,36,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,0,43,214,255,255,214,93,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,255,255,214,255,214,172,43,172,214,255,214,214,214,214,214,214,208,201,157,157,187,187,187,187,187,193,187,187,193,193,193,193,193,193,187,187,193,157,158,207,208,214,214,214,214,214,255,214,86,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,43,0,0,0,0,0,36,0,0,172,255,255,255,172,7,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,136,87,86,178,172,129,129,172,214,172,43,171,214,214,214,214,214,214,214,214,208,208,201,158,157,157,157,193,193,193,193,193,193,193,193,157,157,157,157,158,201,208,214,214,214,214,214,214,214,214,86,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,43,0,0,0,0,36,0,0,0,0,0,86,255,214,255,255,92,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,129,86,85,43,129,129,43,172,255,172,43,171,214,255,214,214,214,214,214,214,214,214,208,207,201,158,157,157,157,157,157,157,157,157,157,158,201,207,208,214,214,214,214,255,214,214,214,214,86,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,43,0,0,86,171,172,214,172,172,129,42,0,0,172,255,255,255,172,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,49,92,172,255,255,122,172,255,255,172,86,129,214,255,214,214,214,214,214,214,214,214,214,208,208,208,207,207,201,201,201,207,207,208,208,214,214,214,214,214,214,214,214,214,214,172,86,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,0,0,129,214,214,214,214,214,214,214,172,86,0,86,214,214,255,255,93,86,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,99,49,129,214,255,214,214,86,172,255,255,255,208,128,86,172,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,214,214,214,214,214,171,43,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,0,0,129,214,214,214,214,214,214,214,214,214,214,129,0,129,255,255,255,172,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,50,92,214,214,255,255,172,43,178,255,255,255,255,214,171,43,129,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,214,255,214,214,214,172,128,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,0,43,172,214,214,214,214,214,214,214,214,214,255,214,86,43,172,255,255,255,135,50,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,86,214,214,214,214,214,129,43,172,255,255,214,214,214,255,172,129,43,129,208,255,255,214,214,214,214,214,214,214,214,255,214,214,214,214,214,214,255,214,255,255,214,208,129,43,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+43,0,129,255,214,214,214,214,214,214,214,214,214,214,214,172,43,86,214,214,255,178,86,92,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,172,214,214,214,214,172,7,93,7,129,208,214,214,214,214,214,214,172,129,43,129,172,255,214,255,214,255,255,214,214,214,214,214,214,214,214,255,214,255,214,172,129,43,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+43,0,129,214,214,214,214,214,214,214,214,214,214,214,214,255,129,0,129,214,255,255,172,43,93,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,43,136,255,214,214,214,255,129,86,136,93,50,50,172,214,255,255,214,214,214,214,172,129,85,86,129,172,172,214,214,214,214,214,214,214,214,214,255,208,172,129,86,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+43,0,165,214,214,214,214,214,214,214,214,214,214,214,214,214,172,0,0,129,129,129,128,49,7,50,86,93,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,86,255,214,255,214,214,172,7,93,100,100,100,93,43,86,172,214,255,214,214,214,255,255,255,172,129,86,43,85,86,129,129,171,165,129,129,122,85,43,43,0,0,0,0,42,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+43,0,129,255,214,214,214,214,214,214,214,214,214,214,214,214,214,172,171,171,171,171,171,171,172,172,136,129,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,7,172,255,214,214,255,255,129,50,100,100,100,100,100,100,93,43,86,172,214,255,214,255,214,214,214,255,255,214,172,172,171,129,129,129,129,171,172,165,86,43,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+43,0,128,255,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,214,214,214,255,255,255,255,136,50,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,92,255,214,214,255,255,255,86,93,100,100,100,100,100,100,100,93,93,43,50,129,172,214,214,214,214,214,255,214,214,255,255,255,255,255,255,172,128,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,0,43,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,255,214,214,214,214,214,255,255,172,43,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,49,172,255,214,214,255,255,172,7,93,100,100,100,100,100,100,100,100,100,100,93,50,7,49,93,135,172,178,214,255,255,255,255,255,214,165,86,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,0,0,129,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,172,43,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,93,49,214,255,214,214,255,255,172,50,135,99,100,100,100,100,100,100,100,100,100,100,100,99,93,92,50,49,6,43,49,86,86,86,85,43,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,43,0,43,172,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,172,129,43,86,129,43,93,99,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,86,129,255,214,214,214,214,255,172,7,50,93,100,100,100,100,100,100,100,100,100,99,100,100,100,100,100,99,129,129,93,50,0,43,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,0,0,86,172,214,214,214,214,214,214,214,255,214,214,214,214,214,214,172,172,129,43,0,43,172,255,255,129,7,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,50,172,255,214,214,214,214,214,255,178,172,86,49,93,100,100,100,100,100,100,100,100,100,100,100,100,100,93,93,50,43,129,172,129,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,0,0,85,172,214,214,214,255,255,255,255,255,214,172,172,129,86,0,0,0,0,0,0,86,172,255,255,172,49,50,93,100,100,100,100,100,100,100,100,100,100,100,100,100,100,7,214,255,214,214,214,214,214,214,255,214,255,129,7,93,100,100,100,100,100,100,100,100,99,93,86,49,43,129,172,214,255,255,86,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,0,0,0,128,172,214,214,255,255,208,172,86,0,0,0,0,0,0,43,255,255,0,0,0,129,172,255,172,93,43,93,100,100,100,100,100,100,100,100,100,100,100,100,93,43,214,255,214,214,214,214,214,214,214,214,214,255,129,49,100,100,100,100,100,93,93,50,7,50,129,172,214,214,255,255,214,172,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,42,0,0,0,42,79,86,43,0,0,0,0,0,43,43,255,255,255,255,255,255,43,0,0,0,129,172,255,172,50,50,93,100,100,100,100,100,100,100,100,100,100,93,49,255,255,214,214,214,214,214,214,214,214,214,214,178,86,93,93,93,50,43,0,7,129,172,214,214,255,214,214,214,255,172,43,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,43,0,0,0,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,86,135,172,135,49,50,93,100,100,100,100,100,100,100,100,93,50,214,214,214,214,214,214,214,214,214,214,214,214,214,129,0,0,0,0,0,0,0,172,255,214,214,214,214,214,214,129,42,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,86,129,86,0,43,86,93,100,100,100,100,100,93,43,255,255,214,214,214,214,214,214,214,214,214,214,214,171,0,0,43,0,255,43,0,0,129,172,172,172,172,129,79,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,0,0,0,0,0,7,50,50,50,50,43,6,214,255,255,214,214,214,214,214,214,214,214,214,255,129,0,0,255,255,255,255,0,0,0,0,0,0,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,0,0,0,0,0,0,0,0,0,0,172,255,214,214,214,214,214,214,214,214,214,255,255,86,0,43,255,255,255,255,255,255,0,0,0,0,0,43,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,255,43,0,86,255,255,255,214,214,214,214,214,214,255,255,172,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,129,255,255,255,214,214,214,214,214,255,172,43,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,129,172,255,255,255,255,214,214,129,43,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,0,0,43,128,129,171,129,128,43,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,43,43,0,43,43,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
 };
-const cm::sprite_item item = {width, height, data};
+const uint32_t rgb[] = {
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x2d2928,0x2a2827,0x2e2c2a,0x13110d,0x3d3b37,0x454541,0x141510,0x080906,0x030401,0x030401,0x070705,0x2d2e2b,0x323230,0x454543,0x0e0e0c,0x2b2b2b,0x262626,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x262628,0x201d1e,0x171214,0x171312,0x040000,0x080303,0x030000,0x080303,0x030100,0x000000,0x050300,0x000000,0x030100,0x030100,0x000000,0x030100,0x030100,0x000000,0x070602,0x060501,0x030100,0x020000,0x020000,0x050301,0x020000,0x000000,0x151513,0x222220,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x181c1d,0x141919,0x000705,0x000402,0x000402,0x000100,0x020000,0x060100,0x070300,0x272320,0x605c59,0x787470,0x8e8a87,0x8d8983,0x403c36,0x070300,0x090500,0x4d4941,0x817e76,0x98958d,0xb4b1a9,0xc3c0b8,0xc7c4bc,0xc2bfb7,0xbdbab2,0xb8b4ac,0x9c9890,0x7c7971,0x434038,0x050400,0x040300,0x050300,0x020000,0x161712,0x22231e,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x181d19,0x1c211f,0x070e0c,0x000100,0x000505,0x000302,0x000402,0x000400,0x0b150f,0x010400,0x22231e,0x94938d,0xcfcbc6,0xdedad5,0x000000,0x000000,0xd2cfc9,0x8d8983,0x36332b,0x807d75,0xb9b6ae,0xe2ded6,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xf3efe3,0x000000,0x000000,0xdcd9cc,0xbdbab2,0x7e7d77,0x25231d,0x040300,0x020000,0x070803,0x21211d,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x242627,0x040907,0x000703,0x000604,0x000505,0x00110f,0x001b16,0x294e48,0x507871,0x6c8f88,0x607870,0x28342e,0x898580,0xe1d9d3,0x000000,0x000000,0x000000,0xd4d0c8,0x767069,0x4f4a42,0xb5afa8,0xe7e1d8,0xf1ece2,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xf9f2e4,0xf9f2e4,0xf9f2e4,0xf9f2e4,0xf7f2e4,0x000000,0x000000,0xe6e3db,0xb8b4ac,0x58554d,0x050400,0x000000,0x050400,0x26241e,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x29282b,0x18181a,0x0f0f11,0x0c0b0e,0x111111,0x262626,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x151a1a,0x000709,0x000305,0x000203,0x000706,0x001513,0x2d4e4a,0x5d7f7d,0x6e9893,0x80aeaa,0x83b3ae,0x8bb5b0,0x50716b,0x3d5049,0xc0c6c0,0x000000,0x000000,0xf3eee5,0xe7e5da,0x8d8a7f,0x474439,0xb8b3a9,0xefeae0,0xf3eee5,0xf6f1e5,0x000000,0x000000,0x000000,0xf9f2e4,0xf9f2e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xf9f2e4,0x000000,0x000000,0x000000,0x000000,0xf0ebe1,0xc1bcb3,0x5e5b53,0x010000,0x050400,0x0f100b,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x232321,0x030401,0x030401,0x030401,0x000000,0x000000,0x000000,0x020202,0x010101,0x111111,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a1d1c,0x030505,0x000000,0x000405,0x000b0c,0x0e3737,0x416f6d,0x5d928d,0x71aea7,0x7abbb3,0x78bdb6,0x7cbfb8,0x7fb8b5,0x7ea9a8,0x354e51,0x7b8485,0xe2e0df,0x000000,0x000000,0x000000,0xcac5b9,0x474437,0x9c998c,0xeceadd,0xf4f2e5,0x000000,0x000000,0xf5f0e2,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0x000000,0x000000,0x000000,0xf9efe5,0x000000,0x000000,0x000000,0xf7f0e5,0x000000,0xf2eadf,0xb6b0a7,0x36352e,0x010400,0x000200,0x262926,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1f2119,0x010300,0x030500,0x6c6e64,0xb1b3a9,0xc9cbc1,0xcfd1c7,0xbdbeb7,0x8f908d,0x2a2a2a,0x020202,0x060606,0x2c2c2c,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x181f1f,0x06100f,0x000202,0x000504,0x000707,0x213837,0x527273,0x6b9b9d,0x79b7b6,0x77bbb9,0x72beb9,0x73c1bb,0x6ebcb6,0x73c1bb,0x73b8b3,0x74a4a1,0x1d3b3a,0x9da9a9,0x000000,0x000000,0x000000,0xf6efe4,0xa8a395,0x4c4d3a,0xcfcfbd,0xf4f2e3,0xf7f2e4,0xf2f0e1,0xf1efdd,0xf4f3e1,0xf5f1e0,0xfaf1e2,0xfcf0e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfaf1e4,0xfcf0e4,0xfcf0e4,0xfdefe4,0xfdefe4,0xfdefe4,0xfdefe4,0xfcf0e4,0xfcf0e4,0xfcf0e4,0xfbefe3,0xf8efe2,0xf9f0e3,0xfbf2e5,0x000000,0xf7f1e1,0xf4eddd,0xfbf4e4,0x000000,0xe4e1d9,0x817f79,0x060702,0x000200,0x1e211d,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x23241f,0x030200,0x2d2d1f,0xbebeb1,0xf1f1e4,0xf1f1e4,0xf3f3e5,0xf3f3e5,0x000000,0x000000,0xe2e1dd,0x898783,0x030100,0x020300,0x2a2a28,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a2019,0x131a15,0x000300,0x000404,0x000c0b,0x113333,0x4a7876,0x609998,0x7bbbba,0x78bcbc,0x77b8be,0x72bbbe,0x6abfbe,0x67c1bc,0x6bc0bd,0x6ebab7,0x77b9ba,0x71a1a1,0x243934,0xb7bdb4,0x000000,0x000000,0x000000,0xf4eae2,0x857e73,0x737160,0xdee2cc,0xeef1db,0xf9f5e4,0xf6efe2,0xf8f4e3,0xf7f5e1,0xf8f5dd,0xf9f3de,0xfcf0e4,0xfbeee5,0xf6efe4,0xf3efe1,0x000000,0xf7f2e4,0xf9f0e1,0xf9eee0,0xfdece0,0xfeece0,0xfdece0,0xfdece0,0xfff2e4,0xfdf0e2,0xf8eddf,0xf7ecdd,0x000000,0xf9efe5,0xf9f0e3,0x000000,0xf7f3e0,0xf7f3e0,0xf7f3e0,0xf7f3e2,0x000000,0xf4ede1,0xb4b3aa,0x1a1e18,0x000100,0x111411,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x040200,0x060300,0xc1bfb0,0xf4f2e3,0xf3f1e2,0xf5f3e4,0xf5f3e4,0xf5f3e4,0xf7f2e4,0xf3efe1,0xf7f2e4,0xf2eedf,0xa7a598,0x000000,0x060500,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1c211f,0x000803,0x000700,0x000903,0x062220,0x436565,0x6d9998,0x7db3b3,0x79bcba,0x71bfbe,0x6dc1c0,0x6ac0c1,0x6fbcc0,0x6dbdc0,0x66c1c0,0x64c2be,0x6bc1bb,0x75bcb9,0x71a2a6,0x203b3d,0xbdc1bb,0xf7f0e5,0x000000,0x000000,0xebe3da,0x777065,0x90887d,0xeeead9,0xecf0d8,0xf5f8e0,0x000000,0xf6efe2,0xf8f4e5,0xf7f5e1,0xf8f5dd,0xfaf2dc,0xfdf0e0,0xffede1,0xffeee0,0xffeedc,0xffeddb,0xffe8d4,0xffe1cd,0xffdbc7,0xffd5c4,0xffd5c4,0xffd5c4,0xffd6c4,0xffe2ce,0xffe5d0,0xffe7d1,0xffe9d6,0xffeadc,0xffede1,0xffefe0,0xf7eedd,0xf5f4e0,0xf4f5e0,0xf5f4e0,0xf7f3e0,0x000000,0x000000,0x000000,0xd1d0c7,0x3d3d39,0x000000,0x0c0c08,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x252623,0x040300,0x6f6d60,0xf2eedd,0xf9f5e4,0xf6f2e1,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf9f2e2,0xfdf4e2,0xfaf2e0,0xf9f2e0,0xf6f2e1,0x848275,0x020000,0x1a1a1a,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x181916,0x030804,0x000804,0x000b08,0x1e4a47,0x528888,0x71b0af,0x7abebe,0x72bbbc,0x70bbba,0x70c0be,0x6dbfbf,0x6bc0bf,0x6bc0bf,0x6abfbe,0x6abfbe,0x67c1bc,0x69c0ba,0x6cbdb4,0x72b0ab,0x1b3a3d,0xb2babe,0x000000,0xf6efe4,0xf6efe4,0xf2eadf,0x837c70,0x90887d,0xf0e9de,0xf7f3e2,0xf8f7e0,0xf9f8df,0xf9f5e4,0xf7f2e4,0xf5f3e4,0xf8f4e3,0xfaf4df,0xfdf3db,0xffeed9,0xffe8d1,0xffddc9,0xffd4bf,0xffae98,0xfb947b,0xe67257,0xd95940,0xda533d,0xdc523d,0xd9543d,0xd4573d,0xd56144,0xe27857,0xfd9876,0xffb091,0xffd2bd,0xffdccc,0xffead9,0xfcefdf,0xf5f4e2,0xf2f5e4,0xf4f5e2,0xf7f3e2,0xf7f1e3,0xf9f0e3,0x000000,0xf9f0e3,0xe2ddd3,0x545048,0x020300,0x070906,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x10110e,0x000000,0xbbb9ac,0xf4f3e1,0xf6f1e3,0xf7f2e4,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf9f2e2,0xf9f0df,0xfbf3e1,0xf9f2e2,0xf7f2e4,0xdddace,0x14130d,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x131615,0x000603,0x000402,0x000f0c,0x3b605d,0x649793,0x73b3b2,0x74bfbf,0x69bdbe,0x6ac0c3,0x6ac0c3,0x66bdbd,0x6ac0c1,0x6ac1bf,0x6ac1bf,0x6ac1bf,0x69c0be,0x69c0bc,0x69c0ba,0x6dbfb5,0x75b8af,0x25534d,0x9fafae,0x000000,0x000000,0x000000,0xf6efe4,0x978f84,0x837c70,0xf6efe4,0x000000,0xf5f0e2,0xf4f3dd,0xf3f2dc,0xf4f3e1,0xf9f5e4,0xf8f4e3,0xfbf3e1,0xffefdb,0xffecd3,0xffe2c7,0xfcbc9f,0xdd866b,0xca5f43,0xd45235,0xe24e30,0xec4d2e,0xf44b2e,0xf8492e,0xf8492e,0xf54b2e,0xf04d2e,0xeb512f,0xe5532e,0xe1532c,0xd65631,0xd06144,0xdd8169,0xfab59f,0xffdbc6,0xffedd8,0xfdf0de,0xf9f2e0,0xf7f3e2,0xfaf3e5,0xfbf2e5,0xfaeddd,0xfaeddd,0x000000,0xddd8ce,0x53534f,0x000100,0x191713,0x000000,0x000000,0x000000,0x000000,0x000000,0x131311,0x050400,0xd1cfc2,0xf5f4e2,0x000000,0xf6f1e3,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf9f2e2,0xf8efde,0xf9f0df,0xfbf4e4,0xf5f0e2,0xf3f1e4,0x74726c,0x000000,0x1a191c,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x19161b,0x000306,0x000402,0x05211c,0x426b68,0x6ea5a2,0x75baba,0x6fbdbc,0x6abfbc,0x67c0be,0x67bfc4,0x67bfc6,0x67bfc6,0x67bfc4,0x67c0c0,0x67c0be,0x67c0be,0x66c0ba,0x65beb9,0x69c0ba,0x6bc1b7,0x76bfb4,0x406f66,0x758d85,0x000000,0x000000,0x000000,0x000000,0xb4ada1,0x625b50,0x000000,0x000000,0x000000,0xf7f2e4,0xf9f8e4,0xeff1d9,0xf1f3de,0xf3f2de,0xfdf8e1,0xffead1,0xffe3ce,0xffb49b,0xdd7353,0xdc603d,0xda502f,0xe75132,0xeb4c2b,0xf04a29,0xf14a27,0xf44a28,0xf84a2a,0xf84a2a,0xf74b2a,0xf54b2a,0xf44c2a,0xf04e2a,0xf04e2a,0xed4f2c,0xea522f,0xdf502e,0xd75637,0xdf7255,0xffb198,0xffddc8,0xffefdb,0xfaf1e2,0x000000,0xfdf2e3,0xfff0de,0xfeeedd,0x000000,0xfaf1e4,0xddd9d4,0x474642,0x030100,0x18140f,0x000000,0x000000,0x000000,0x000000,0x0f100d,0x050400,0xd4d1c4,0xf4f3e1,0xf4f2e3,0xf2f0e1,0xf7f2e4,0xf7f2e4,0xf7f3e2,0xf9f2e2,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f2e4,0x000000,0xa1a099,0x010200,0x262626,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x191b1f,0x000408,0x00060a,0x051b1f,0x4d726f,0x72a3a0,0x7abab7,0x72bdbd,0x69bfc0,0x66c1c0,0x64c2be,0x66c1c0,0x67bfc6,0x67bfc6,0x67bfc4,0x67c0c2,0x67c0c0,0x67c0be,0x67c1bc,0x66c2bc,0x6ac6c0,0x66beb5,0x72bfb5,0x5b958a,0x425f55,0xd7e2d7,0x000000,0xf6efe2,0xf7f0e5,0xe0d9ce,0x3f382d,0xe0d9ce,0x000000,0x000000,0x000000,0xf9f2e4,0xf6f2e1,0xf9f6e2,0xf7f2dd,0xfff0da,0xffecd5,0xffd1b9,0xe0866e,0xd2593e,0xe1512d,0xec4d25,0xf14c26,0xf44b26,0xf74926,0xf94826,0xf94826,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84b24,0xf54c24,0xee4b27,0xe3502f,0xd1593b,0xd5775e,0xffc3ac,0xffe5d0,0xfff0de,0xfbecdb,0xfff4e3,0xfeeedd,0xfff4e4,0x000000,0x000000,0xd6d3cb,0x312d27,0x030000,0x211d1a,0x000000,0x000000,0x000000,0x141412,0x000100,0xbebeb1,0xf2f0df,0xf7f4e5,0xf4f2e3,0xf7f2e4,0xf7f2e4,0xf7f3e2,0xf9f2e2,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f2e4,0x000000,0xb3b1ab,0x020300,0x161616,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x262324,0x010304,0x000409,0x00151a,0x406d6e,0x72aaac,0x78babb,0x77c0c0,0x6dbdbc,0x6ac1bf,0x67c0be,0x66c1c0,0x67c0c0,0x69bfc2,0x69bfc2,0x69bfc2,0x69bfc0,0x67c0c0,0x67c0be,0x66c1be,0x66c2bc,0x64c2bc,0x62c4ba,0x67bcb4,0x6faba5,0x193e36,0xbacbc1,0x000000,0xf1f3de,0xf9f6e2,0xf4eddf,0x676055,0xbdb6ab,0x000000,0x000000,0x000000,0x000000,0x000000,0xfaf3e5,0xfbf0df,0xfff2de,0xffe9d5,0xffb5a5,0xd55f4c,0xdf5438,0xed512f,0xf7502b,0xfa4f27,0xf84c27,0xf74b26,0xf74926,0xfa4928,0xfd472a,0xfc482a,0xf84a2a,0xf74b2a,0xf74b2a,0xf84a2a,0xf84a2a,0xfa492a,0xfa492a,0xfa4928,0xfa4a26,0xfa4c27,0xf74e2a,0xf34f30,0xe85032,0xde5133,0xd7583a,0xfc9c7f,0xffe4ca,0xffefda,0xfff0de,0x000000,0xf8efe2,0x000000,0xf6ecdf,0x000000,0xbfbab0,0x0b0500,0x040100,0x000000,0x000000,0x000000,0x21211f,0x010200,0x88877a,0xf3f3e1,0x000000,0xf3f1e4,0xf7f2e4,0xf7f2e4,0xf7f3e2,0xf9f2e2,0xfaf1e2,0xfaf1e2,0xf9f2e4,0x000000,0x000000,0xb3b1ab,0x020300,0x161616,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0c140c,0x000602,0x000707,0x365a5b,0x6ea0a2,0x77b9ba,0x70bdbf,0x6dbfc1,0x65bcbc,0x65bebd,0x67c2bf,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc2,0x69bfc0,0x69bfc0,0x69c0be,0x67c0be,0x67c0be,0x66c1be,0x66c1be,0x66c2bc,0x68c4bc,0x72bcb5,0x4e7571,0x869792,0x000000,0xf7f4e5,0xf8f4e1,0xfbf4e4,0xb6afa4,0x7a7269,0xf5eee3,0xf9f2e4,0x000000,0xf9f2e4,0xf7f2e4,0xf9f2e2,0xfbefe1,0xffe8d9,0xffe5d2,0xfdaf99,0xd45543,0xeb4f39,0xf14929,0xf74924,0xfa4822,0xfc4924,0xfa4c25,0xf84c27,0xf84a28,0xfa4928,0xfd472a,0xfc482a,0xf84a2a,0xf74b2a,0xf74b2a,0xf84a2a,0xf84a2a,0xfa492a,0xfa492a,0xfa4928,0xfb4b27,0xfa4a26,0xf64825,0xf34726,0xf54d2b,0xf24d2c,0xee4b29,0xdf5534,0xe18a6c,0xffd9c1,0xffe8d4,0xfeeedf,0x000000,0xf7f1e3,0xfaf1e2,0xf9f0e3,0x000000,0x97928b,0x030000,0x080400,0x000000,0x000000,0x000000,0x010200,0x19180d,0xd4d4c7,0xf2efe3,0x000000,0x000000,0xf7f2e4,0xf7f2e4,0xf9f2e2,0xfaf1e2,0xfaf1e2,0xf9f2e4,0x000000,0x000000,0xa1a099,0x010200,0x262626,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1d2422,0x000401,0x000804,0x193e38,0x619790,0x75bbb5,0x6fbdbc,0x6cbec0,0x6abec2,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x64c2c0,0x64c2c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69c0be,0x72c2c0,0x6ea8a4,0x2c3f3b,0xe8e7e0,0xf2ede1,0x000000,0x000000,0xeddeda,0x463839,0xe2d7d4,0xfbf2e5,0xfbf2e3,0xf9f0e3,0xf6f2e1,0xf3f4dd,0xf4f3dd,0xfdeddc,0xffe7d6,0xffab98,0xd95940,0xe85130,0xf44d28,0xf74b26,0xfa4a24,0xfa4a26,0xfa4a26,0xf84a26,0xf84a28,0xf84a28,0xf84a28,0xfa4928,0xfa4928,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xfa4928,0xfa4a26,0xfa4a24,0xfa4a26,0xf84a26,0xf54c26,0xf44d28,0xf54c28,0xef4e2c,0xe35636,0xe67b5d,0xffd3bd,0xffebd7,0xfbf3e1,0xf3f3e3,0xf7f4e5,0x000000,0x000000,0x000000,0x625e58,0x060200,0x211f1b,0x000000,0x000000,0x1a1a18,0x000000,0x63625c,0xe7e7db,0xf2efe5,0x000000,0x000000,0x000000,0xfaf3e5,0xfbf2e3,0xfaf1e2,0xf9f2e4,0x000000,0x000000,0x6f6e67,0x000000,0x1c1e1d,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x191d1e,0x000503,0x000805,0x3b5e59,0x7ab2ab,0x71bbb2,0x69c0ba,0x66c1be,0x67c0c2,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x64c2c0,0x64c2c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6cbebe,0x75b7b7,0x3d6664,0xa7aca8,0xf7ede5,0xf6eddd,0xf4ebde,0x000000,0xa79796,0x9c9190,0x000000,0xfcf0e4,0xf9efde,0xf9f0e3,0xf6f2e1,0xf3f5db,0xf9f2d7,0xffebd5,0xffb5a1,0xd4543d,0xed5033,0xf44d26,0xf74c1f,0xf84b21,0xfa4a24,0xf84a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xfa4928,0xfc4828,0xfc4828,0xfa4928,0xf84a26,0xf74b26,0xf74b26,0xf84a28,0xf84a28,0xf34927,0xe15031,0xd9745d,0xffd3bf,0xffeedb,0xf5f1de,0x000000,0x000000,0x000000,0x000000,0xcdc7c2,0x0d0903,0x030100,0x000000,0x000000,0x000000,0x0a0b08,0x030400,0x67665d,0xe1e1d5,0xf3f1e4,0x000000,0xfaf3e5,0x000000,0xfaf1e2,0xfaf1e2,0xf9f2e4,0x000000,0xe5e2d8,0x1e1c16,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0f0910,0x000004,0x000a0c,0x2f5450,0x79b1aa,0x74bcb1,0x6bbeb4,0x66c2bc,0x64c2be,0x67c0c2,0x69bfc2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x66c1c0,0x67c0c0,0x6fbdbc,0x70a7a4,0x243f3d,0xe4e5e0,0x000000,0xfaf3e5,0x000000,0xe6ded5,0x3c342d,0xe3ded4,0xf4eddf,0xfcf1e0,0xf8eddd,0xf9f0e3,0xf7f1e3,0xf4f3dd,0xffecd3,0xffc4ab,0xd15c44,0xe75134,0xf14a27,0xf54c24,0xf74c21,0xf84b24,0xfa4a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xfa492a,0xfc482c,0xfc482c,0xf84a2a,0xf84a2a,0xf84a2a,0xf84a2a,0xfa4928,0xfa4928,0xf74926,0xf55134,0xe04f39,0xe47a67,0xffddca,0xffeede,0xfceee1,0xf9efe5,0x000000,0x000000,0x000000,0x918e88,0x040200,0x13110d,0x000000,0x000000,0x000000,0x080904,0x000000,0x3c3b30,0xbbb9ac,0xf6f1e5,0xf5eee1,0x000000,0xfaf1e2,0xfaf1e2,0xf9f2e4,0x000000,0xb9b6ac,0x070600,0x0f100d,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0e0709,0x000001,0x000309,0x1f393e,0x73aba6,0x77c1b8,0x6abdb3,0x67c1ba,0x64c2bc,0x64c2c0,0x67c0c2,0x69bfc2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x67c0c0,0x67c0c0,0x66c1c0,0x67c0c0,0x69bfc0,0x74bbba,0x4b7472,0x93a49e,0x000000,0x000000,0x000000,0x000000,0xaca99f,0x918e84,0xf3f1e2,0xf9f2e0,0xfcf1e0,0xfbf0df,0xf9f0e3,0xfbefe1,0xffeed9,0xffe5cb,0xe17459,0xe95338,0xf1492b,0xf84a28,0xf74c24,0xf74c21,0xf84a26,0xf84a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a2a,0xfa482e,0xfa482e,0xf84a2a,0xf54b2c,0xf04c32,0xea4f34,0xe45236,0xe05338,0xe25439,0xe25039,0xe44d39,0xdc5945,0xe28d78,0xffdec8,0xffeedd,0xfdf2e3,0xf9efe5,0x000000,0x000000,0xe2dcd5,0x27241e,0x000000,0x000000,0x000000,0x000000,0x000000,0x13120b,0x000000,0x99978c,0xf5f0e4,0x000000,0xf5eee1,0xf9f0e1,0xfaf1e4,0x000000,0x000000,0x646159,0x060500,0x262724,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x080200,0x060403,0x373d3f,0x091c23,0x719c9f,0x73bab6,0x69c0ba,0x66c2bc,0x64c2bc,0x62c3be,0x64c2c0,0x66c0c2,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6cbec0,0x6abec0,0x67c0c0,0x66c1c0,0x69c2c2,0x69bfc0,0x6dbdc0,0x6facac,0x1a3631,0xdce2dc,0x000000,0x000000,0xf6efe2,0xf2f0e1,0x4c4c3e,0xd7d7c9,0xf6f2e1,0xf9f2e0,0xfaf2e0,0xfbf0df,0xfcf0e4,0xffecdf,0xffe5d2,0xf3a188,0xdf5237,0xf6492c,0xfa4728,0xfa4824,0xf84a26,0xf74b26,0xf74b26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a2a,0xf6492a,0xf34728,0xf74b26,0xf04f2d,0xda5138,0xbb4c39,0x8b3a28,0x6b2717,0x762d1f,0x9b4031,0xcc523e,0xd85339,0xd45c3e,0xfea686,0xffe9cd,0xf9f0d8,0xf9f0e1,0x000000,0x000000,0x000000,0x9d9994,0x030100,0x1a1a18,0x000000,0x000000,0x000000,0x0a0802,0x040300,0xcdcabf,0xf5f0e4,0x000000,0xf4eddf,0xf7f1e3,0xf7f1e3,0x000000,0xcbc5bc,0x000000,0x090703,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x080500,0x080500,0x828783,0x576a68,0x598083,0x7cb6bc,0x6dbdbe,0x66c1be,0x64c2be,0x64c2c0,0x64c2c0,0x64c2c0,0x66c0c2,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x66c1c0,0x66c1c0,0x66bfbe,0x6fc1c3,0x75bdc2,0x5b8f92,0x6b7e78,0x000000,0x000000,0xf7ede3,0xfaf3e5,0xcecabb,0x616153,0xf4f4e4,0xf9f2e4,0xfaf1e2,0xf7f1e1,0xf9f0e1,0xfef3e4,0xffebda,0xffc8b5,0xd3624b,0xec4c32,0xfc4628,0xfc4628,0xfa4726,0xf84a28,0xf74b28,0xf54c28,0xf74b28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74b2a,0xf44a2a,0xee4928,0xea4a25,0xdb5130,0x9d3725,0x3e0000,0x1f0000,0x150000,0x150000,0x2a0000,0x6f1b0a,0xbd4d33,0xd75430,0xcf5c38,0xffceae,0xffefd5,0xfeeedf,0x000000,0x000000,0x000000,0xdfdcd6,0x22211d,0x020300,0x000000,0x000000,0x2a2b26,0x000000,0x47473e,0xeae7dc,0xf2efe3,0xf8f4e5,0xf6efe2,0xf9f2e4,0x000000,0xf6f1e5,0x656258,0x030200,0x22231e,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x030802,0x090800,0x848679,0xa2b1a7,0x30544c,0x77b2b3,0x74bfc3,0x6abec2,0x67c0c2,0x66c0c2,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x67c0c0,0x64c2c0,0x64c2c0,0x68bebe,0x71bec2,0x79b7c0,0x345f63,0xb2c1b7,0x000000,0xf2eedf,0xfaf1e4,0xf7ede3,0x999287,0xb0ab9d,0x000000,0x000000,0x000000,0xf6f1e5,0xf7f1e3,0xfaecdf,0xffead9,0xf6907c,0xdc5139,0xef4b30,0xf7482c,0xf7482c,0xf6492c,0xf74a2c,0xf54b2c,0xf44c2a,0xf54b2a,0xf74b28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74b28,0xf34927,0xed4f2c,0xdf5532,0xa94328,0x2f0000,0x130000,0x0f0000,0x050000,0x090301,0x0a0000,0x1e0000,0x5e1a06,0xc6532e,0xd55a34,0xe68d70,0xffe5cf,0xffecde,0x000000,0x000000,0x000000,0x000000,0x8b8985,0x000000,0x151714,0x000000,0x0d0e09,0x050400,0xaeada4,0xf1eee3,0xf4f2e5,0xf8f4e5,0xf7f3e2,0xf7f2e4,0x000000,0xb7b2a8,0x080500,0x0b0a03,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x030804,0x020500,0x737267,0xd8ded3,0x223f36,0x73a6a0,0x75bebc,0x68bebe,0x67c0c2,0x67c0c2,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x64c2c0,0x64c2c0,0x6bc1c2,0x71bbc0,0x7ab0b7,0x123436,0xdfeadd,0xf7f5e3,0xf6f1e3,0x000000,0xf8eee4,0x51483d,0xded7c9,0x000000,0x000000,0x000000,0x000000,0xfbefe3,0xffeada,0xffd0bc,0xd65a42,0xe7482c,0xf24a2c,0xf6492a,0xf6492a,0xf6492c,0xf8492e,0xf74a2c,0xf54b2a,0xf54c28,0xf74b28,0xf84a28,0xfa4928,0xfa4928,0xfa4928,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74b28,0xf64d29,0xea5231,0xc95337,0x5b0e00,0x140000,0x040000,0x030001,0x010101,0x000201,0x020300,0x020000,0x1f0000,0x963416,0xcf5734,0xcf6043,0xffb9a1,0xffe9d6,0xfdf0e2,0xf9f2e4,0x000000,0xf0f0e5,0xd2d3ca,0x000100,0x020501,0x222220,0x070803,0x403f39,0xf0ece4,0x000000,0xf5f3e4,0xf7f3e2,0xf8f4e3,0x000000,0xe0dad1,0x38342c,0x030200,0x23241f,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a1a16,0x000300,0x4f5049,0xe5e2da,0x919b93,0x487471,0x74b9b6,0x69beba,0x67c2bf,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1be,0x66c1be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0be,0x67c0c0,0x66c1c0,0x66c0c2,0x69c2c4,0x76c1c3,0x669394,0x5c7470,0x000000,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xdbd5c7,0x4d4739,0xf5f0e2,0xf6f1e3,0xf6f1e5,0xf7f0e5,0xf7f1e3,0xffeddd,0xffe6d4,0xf7a389,0xdf5332,0xf64c2b,0xf44827,0xfd4f2c,0xf74926,0xfb4a29,0xf64526,0xfa492a,0xfb4d28,0xf84d25,0xf74c24,0xf84a26,0xfc4828,0xfd4828,0xfc4926,0xf84a26,0xf74b2a,0xf74b2a,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74b28,0xfa512a,0xe25132,0xab4737,0x2b0000,0x130000,0x060000,0x020000,0x000000,0x000000,0x000100,0x050000,0x160000,0x550800,0xc55a3e,0xd55938,0xea805f,0xffdfc6,0xfff0db,0xfaf2e0,0x000000,0xf4f5e0,0xf0f3e2,0x55564f,0x010200,0x000000,0x040200,0xbfbbb5,0x000000,0x000000,0xf8f4e5,0xf7f5e3,0xf4f2e3,0x000000,0x7f7b77,0x020000,0x151410,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010200,0x181610,0xcdccc6,0xdbdcd5,0x1e332e,0x74adac,0x71c1c1,0x65bebb,0x68c3c0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x66c1be,0x66c1be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0be,0x67c0c0,0x66c1c0,0x66c0c2,0x68c3c4,0x71baba,0x517a78,0x9bada4,0x000000,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xbeb9ab,0x918c7e,0xf6f1e3,0xf6f1e3,0xf6f1e3,0xf6f1e3,0xf7f1e1,0xffebd9,0xffddc7,0xd76e54,0xe6512c,0xfc4e27,0xfb4d26,0xf74a22,0xef471e,0xf24b26,0xf34f32,0xf14f34,0xf04f2f,0xee4d28,0xf14d24,0xf54c26,0xfc4828,0xfd4828,0xfa4a26,0xf74b26,0xf54c28,0xf54b2a,0xf74b28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84c27,0xe05033,0x933c31,0x230000,0x100000,0x050000,0x020000,0x000100,0x000000,0x020000,0x030000,0x120000,0x360000,0xb4533d,0xdc5636,0xd85c38,0xffc1a6,0xffebd3,0xfff2dd,0xf8f6e2,0xf8fae3,0xeff2df,0xa2a39a,0x050300,0x070300,0x716d69,0x000000,0x000000,0x000000,0xf6f1e3,0xf3f1e0,0x000000,0xaba7a2,0x060100,0x040200,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0e0f08,0x030200,0xa5a29a,0x000000,0x8f9e97,0x4e736e,0x7abfbc,0x6dc1c0,0x66bdbd,0x67c0c0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69c2c2,0x76bdbc,0x2c524c,0xc1d0c7,0x000000,0xf7f2e4,0xf7f2e4,0xf7f2e4,0x979385,0xbab6a8,0xf2eedf,0xf6f1e3,0xf6f2e1,0xf6f2e1,0xf6f2e1,0xffebd7,0xffc2ad,0xd35a41,0xe54c29,0xf74c24,0xfa4b1f,0xf64b1e,0xf05125,0xe4522c,0xd7523a,0xd25340,0xd3553d,0xda5535,0xe8522a,0xf24e26,0xf74b2a,0xf8492c,0xf54b2a,0xf44d28,0xf44d26,0xf54c26,0xf74b28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74926,0xe05035,0x8d3a2d,0x1c0000,0x0a0000,0x000002,0x000100,0x000200,0x000100,0x000000,0x050000,0x100000,0x250000,0xa24d36,0xe25439,0xdc4f31,0xe28b6f,0xffe5cc,0xfff2dd,0xf6f2dd,0xf0f2db,0xf4f5e2,0xd9d8cf,0x060500,0x26221d,0xd9d3cc,0x000000,0x000000,0x000000,0x000000,0xf4f2e3,0xc9c9bb,0x1b1a14,0x020000,0x2a2827,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x21211d,0x000100,0x53524b,0xf0eae3,0xe7eae5,0x24403b,0x72a7a2,0x71bcba,0x69bfc0,0x69bfc0,0x64babb,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x68bebc,0x71b6b3,0x0a2c23,0xdae5db,0x000000,0xf6f1e3,0xf8f4e5,0xf7f2e4,0x6c685a,0xcdc9ba,0x000000,0xf6f1e3,0xf7f1e1,0xf7f1df,0xf6f2df,0xffe9d5,0xffac98,0xde573e,0xee502f,0xf64e25,0xf24a1c,0xec5124,0xd4542d,0xa73f22,0x6e1304,0x4a0000,0x510000,0x82240d,0xbf4b2b,0xdf5534,0xed4e30,0xf54b2c,0xf44c2a,0xf44d28,0xf54c24,0xf74c24,0xf84a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf94826,0xe55136,0x984231,0x1d0000,0x0b0000,0x000002,0x000200,0x000200,0x000100,0x000000,0x030004,0x100000,0x260000,0xaa5138,0xe25037,0xe54c32,0xcd6248,0xffd0b6,0xffead2,0xf6f1dc,0xf5f4de,0xf1f2e0,0xecebe0,0x35322a,0xaaa49d,0x000000,0x000000,0x000000,0xf5f0e4,0x000000,0xd7d5c8,0x39392e,0x070602,0x1f1d1b,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x070803,0x000100,0xc5c4be,0x000000,0xafbab2,0x39655f,0x75bab7,0x6cbebe,0x67c0c2,0x69bfc2,0x69bfc0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c0c2,0x67c0c2,0x67c0c0,0x69c0be,0x6bbdba,0x6daea8,0x2e4b3f,0x000000,0xf3f3e5,0xf6f1e3,0xf8f4e5,0xf2eedf,0x423e30,0xe4e0d1,0xf2eedf,0x000000,0xf9f2e2,0xf6f0de,0xf9f3de,0xffe7d0,0xf0856b,0xe75036,0xef4c2c,0xf7522c,0xed5026,0xd65631,0x7a2e1a,0x260000,0x1e0000,0x170000,0x140000,0x1b0000,0x3e0200,0x9e3f2d,0xdd5034,0xf14b2a,0xf44c2a,0xf74b28,0xfa4a21,0xfc4a1f,0xfa4a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xfa492a,0xe74f32,0xb44c38,0x2f0000,0x130000,0x060100,0x000100,0x000200,0x000000,0x000000,0x030003,0x150000,0x420000,0xc75940,0xe74e35,0xed4d34,0xd8563e,0xffac93,0xffe6d0,0xf9f1dd,0xfaf7e4,0xf4f2e3,0xf1eee3,0x8d8981,0xc5c0b4,0xf5f0e4,0x000000,0x000000,0x000000,0xdcd7cd,0x434038,0x020000,0x11120d,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1e1f1c,0x000100,0x686962,0x000000,0x000000,0x5f6e67,0x619895,0x6fbfbd,0x69bfc0,0x67c0c2,0x69bfc2,0x69bfc2,0x67c0c0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c0c2,0x67c0c2,0x69bfc0,0x6abfbe,0x70c0bc,0x629f96,0x627b6c,0xf1f6e4,0xf5f3e4,0xf7f2e4,0xf8f4e5,0xebe7d8,0x2f2a1c,0xf2eedf,0x000000,0xf6f1e3,0xf6f2e1,0xf6f1dc,0xfaf2dc,0xffdfc8,0xe1684f,0xec4b2d,0xf54d2d,0xf04f2d,0xe15734,0x97351b,0x290000,0x0b0203,0x030001,0x000000,0x000000,0x050000,0x0f0000,0x3d0100,0xbb4632,0xea5135,0xf24c2e,0xf84a28,0xfc4924,0xfc4a21,0xfa4a26,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf94828,0xed4e32,0xcf533b,0x772312,0x1e0000,0x0c0000,0x010200,0x000100,0x000000,0x020000,0x040000,0x1f0000,0x882b18,0xd55137,0xec4e34,0xef4b32,0xe24d34,0xf4866e,0xffe6cf,0xfef4de,0xf7f1df,0x000000,0x000000,0xb1aea3,0x999486,0xf5f0e2,0x000000,0xf6f1e5,0xcec9bf,0x413c34,0x030000,0x12100c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0c0c0a,0x060702,0xc6c7c0,0x000000,0xdbddd1,0x1a3027,0x72b2b0,0x6dc0c4,0x69bfc2,0x69bec4,0x67bfc4,0x66c0c2,0x67c0c0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c0c2,0x67c0c2,0x69bfc0,0x6cbebc,0x6cbab4,0x579287,0x7b9281,0xf1f4e1,0x000000,0x000000,0xf6f1e3,0xe1dcce,0x464233,0xf7f2e4,0xf6f1e3,0xf3efe1,0xf4f3e1,0xf9f3de,0xfcf0db,0xffd5bf,0xd65639,0xf14929,0xf84c2b,0xe94e32,0xc5543f,0x4f0a00,0x0e0000,0x000000,0x000001,0x000001,0x030000,0x050000,0x090300,0x1a0000,0x762117,0xd75546,0xef4d34,0xfa492a,0xfc482a,0xfa492a,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf84a28,0xf74928,0xf54d2f,0xea5437,0xc04e37,0x400300,0x140000,0x030000,0x000600,0x000700,0x000000,0x0e0000,0x470a00,0xc54e32,0xed5534,0xec4b2d,0xf04c32,0xec4a31,0xe06248,0xffdcc5,0xfff2dd,0xfaf2e0,0xf9f2e2,0xf0ecdd,0xcdc9ba,0x787463,0xf9f6e2,0xf7f2e4,0xc0bbaf,0x282219,0x020000,0x1a1613,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x292927,0x030400,0x5b5a54,0xefeee5,0x000000,0xb0b8ae,0x4a6862,0x74bbba,0x67c0c2,0x69bec4,0x69bec4,0x67c0c2,0x66c0c2,0x67c0c0,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x67c0c0,0x69c0be,0x6cbebc,0x70bfb9,0x508b80,0x8da292,0xf4f5e2,0x000000,0x000000,0xf3efe1,0xdad5c7,0x595446,0xf8f4e5,0x000000,0xf8f4e5,0xf6f2e1,0xfaf2e0,0xffecda,0xffcfb8,0xdc593a,0xf64c2b,0xf64727,0xe85137,0xa64739,0x280000,0x0c0000,0x000100,0x000002,0x020002,0x050002,0x030000,0x020500,0x0e0000,0x340000,0xbe5143,0xe84d31,0xfc482a,0xfa482c,0xf8492c,0xf84a2a,0xf84a28,0xf84a28,0xf84a26,0xfa4928,0xf84a28,0xf84a28,0xf74b28,0xf74928,0xf74a2c,0xf14929,0xe55639,0xae4e35,0x4f1000,0x1f0000,0x140000,0x170000,0x1f0000,0x490900,0xac4934,0xe45634,0xf5512b,0xf24d2c,0xf24c2e,0xf74d30,0xd95337,0xffcab3,0xffecd8,0xfef3e2,0xfaf3e3,0xf9f2e2,0xe2decf,0x443f31,0xeae8d8,0x99978a,0x0a0700,0x020000,0x1c1814,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x141510,0x030200,0xb1aea3,0x000000,0x000000,0x788b87,0x638e8d,0x72bdbd,0x67c2c1,0x69bfc2,0x6abec2,0x69bfc0,0x69bfc0,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x69bfc0,0x69c0be,0x6abfbc,0x6cbdb8,0x4d8681,0x99aba0,0x000000,0xf8f4e5,0xf8f4e5,0xf6f1e3,0xd4d0c1,0x646051,0xf3efe1,0xf6f1e3,0x000000,0xf9f0e1,0xfff0e1,0xffebdd,0xffc1ab,0xdc5437,0xf64a26,0xf74926,0xe25037,0x994536,0x1e0000,0x090000,0x010304,0x020004,0x030004,0x030000,0x030100,0x000300,0x0b0000,0x290000,0xac4e39,0xe65030,0xfa4a26,0xf84a26,0xf74b28,0xf74b28,0xf74b28,0xf74b26,0xf84b24,0xf84522,0xf84723,0xf74b26,0xf64d27,0xf74b2a,0xf74b28,0xf64a24,0xf34f29,0xe24e2e,0xd05133,0xa94026,0x862610,0x8e2912,0xad3d26,0xcd492f,0xe95336,0xf34e2d,0xf64d29,0xf54c26,0xf54c28,0xf64928,0xe4573b,0xffb9a5,0xffecdb,0xfdf0de,0xfaf4e1,0xfaf4e1,0xf4eddf,0x25221a,0x494743,0x030100,0x030100,0x201e1c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0f0c04,0xe1dcd0,0xf7f1e3,0x000000,0x213d3a,0x70a5a5,0x6cbcba,0x66c1c0,0x69bfc2,0x6abec2,0x6abec0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x6fbfbd,0x467f7a,0xa0afa8,0x000000,0x000000,0xf7f2e4,0xf5f0e2,0xd4d0c1,0x676254,0xf8f4e5,0xf7f2e4,0x000000,0xfcf0e2,0xfff0e1,0xffeadd,0xffc0ad,0xdc5437,0xf64a26,0xf74926,0xe25135,0x964233,0x1c0000,0x090000,0x020406,0x000002,0x020002,0x020000,0x030001,0x010400,0x0a0000,0x230000,0xa34933,0xe55232,0xf84a26,0xf74c24,0xf54c26,0xf54c28,0xf54c28,0xf84a26,0xfa4c27,0xfa4b29,0xfa4b29,0xf84c27,0xf74b28,0xf74b2a,0xf74b28,0xf74924,0xf84b24,0xfa4b29,0xf34e2d,0xe45032,0xe55a3e,0xe25439,0xe75134,0xf74f31,0xfa492a,0xf84a28,0xf84a26,0xf74c24,0xf64b22,0xf74926,0xe45538,0xfead98,0xffe9d8,0xfff0de,0xf9f2e0,0xfbf3e1,0xfaf3e5,0x45433f,0x030303,0x0f0f0f,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x252525,0x000000,0x737068,0x000000,0xf9f2e4,0xd7ddd2,0x163632,0x7cb5b4,0x6fbfbd,0x67c2c1,0x69bfc2,0x69bfc2,0x6abec0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x70c0be,0x437d77,0xa3b2aa,0x000000,0x000000,0xf8f4e5,0xf6f1e3,0xd5d1c2,0x5e5a4c,0xf6f1e3,0xf7f2e4,0xf7f1e3,0xfaf1e4,0xfff0e3,0xffebdd,0xffc1ad,0xda5437,0xf44b26,0xf64a24,0xe45032,0xa94a36,0x2d0000,0x0f0000,0x000203,0x000300,0x000200,0x020002,0x030005,0x010304,0x0b0000,0x280000,0xab4d38,0xe25334,0xf54c28,0xf54c24,0xf44d24,0xf24d28,0xf54c28,0xfa4928,0xf94828,0xf24a2c,0xf14b2c,0xf8492c,0xfb4a2b,0xf84b2d,0xf54b2c,0xf74b2a,0xf74928,0xfe4a2c,0xfc4b2e,0xed4829,0xec4f30,0xe25135,0xe75134,0xf1492b,0xfa492a,0xf84a28,0xf74924,0xf64b22,0xf64b22,0xf84a28,0xe25336,0xed9c88,0xffe9d8,0xfff0dc,0xf9f3de,0xfaf2e0,0xfaf3e5,0x615f5b,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1d1d1d,0x020000,0xb0aca4,0xf6f1e5,0xf6efe2,0xbac3b7,0x3b635c,0x7abab7,0x6bbdba,0x68c1c1,0x67c0c2,0x69bfc2,0x6abec0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x6fbfbd,0x47817b,0xa0afa8,0x000000,0x000000,0x000000,0x000000,0xd8d3c5,0x504c3e,0xf0ecdd,0xf7f2e4,0xf7f2e4,0xf9f2e4,0xfff1e3,0xffecdd,0xfec2ad,0xd95537,0xf24b26,0xf44b24,0xe74f2e,0xc7553c,0x480000,0x1b0000,0x000001,0x000300,0x000300,0x020002,0x040005,0x000002,0x130000,0x3e0000,0xc3553f,0xe55232,0xf44d26,0xf54c26,0xf54c26,0xf44d28,0xf54b2a,0xfa492a,0xf54b2e,0xd64229,0xd9472d,0xee4a2d,0xf94c2e,0xf84b2d,0xf74a2c,0xf74b2a,0xf74928,0xf84428,0xf8492e,0xeb472a,0xe54c30,0xa61400,0xe14b2e,0xf24a2c,0xf94828,0xf74926,0xf74924,0xf64b22,0xf64b22,0xf84a28,0xe15235,0xe3927d,0xffe8d5,0xfff0dc,0xf9f3de,0xfaf2e0,0xf9f2e4,0x6d6b67,0x010101,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x080808,0x020000,0xd6d3cb,0x000000,0xf5eee1,0x9faa9d,0x517e76,0x75bbb5,0x6ec1be,0x68c1c1,0x67c0c2,0x69bfc2,0x6abec0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x6fbfbd,0x4d8681,0x98a7a0,0x000000,0x000000,0x000000,0xf8f4e5,0xe7e2d4,0x302b1d,0xf5f0e2,0x000000,0xf8f4e5,0xf6f1e3,0xfef3e4,0xffeddd,0xffccb7,0xda5839,0xf04b25,0xf44d26,0xe94826,0xe45236,0x9e3323,0x250000,0x080005,0x000001,0x000102,0x000002,0x000000,0x020000,0x140000,0x93321e,0xdc5235,0xed4f2a,0xf74c24,0xfc4828,0xfc482c,0xf8492c,0xf44829,0xf84a28,0xe64c2c,0xb03e25,0x750700,0xd74a2c,0xea4929,0xf94e2f,0xfb4a2b,0xf94723,0xfc4926,0xfc4e2b,0xec4b2d,0xde553d,0xb7341c,0xa11800,0xe04a2d,0xf44b2e,0xf94828,0xfa4928,0xf84a26,0xf74c24,0xf74c24,0xfa4b29,0xe25336,0xe4937e,0xffe9d6,0xfff0dc,0xf9f3de,0xfaf2e0,0xf9f2e4,0x71706c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x2d2b27,0xebe8e0,0x000000,0xf9f2e4,0x808e80,0x578b80,0x72bcb5,0x6ec1be,0x67c0c0,0x67c0c2,0x67c0c2,0x69bfc0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x71c1bf,0x518b85,0x8a9992,0x000000,0xf6f1e5,0xf7f2e4,0xf8f4e5,0xefeadc,0x373224,0xe9e5d6,0xf6f1e3,0xf6f1e3,0xf6f1e3,0xfbf2e3,0xffeedd,0xffd5bf,0xd85939,0xed4b24,0xf34f27,0xf24d28,0xee4d2a,0xd7523a,0x6c2017,0x1c0000,0x100000,0x080000,0x0a0000,0x0e0000,0x180000,0x5c1a0e,0xcd4f38,0xea4b2c,0xf44d28,0xfa4a26,0xfd4828,0xfd472a,0xf9472a,0xfb4f30,0xf44b2e,0xe04e32,0x9e341f,0x5e0000,0x921500,0xe15031,0xe74e35,0xee5136,0xe64827,0xec4d2c,0xe64c2e,0xde5037,0xb13e2a,0x6a0000,0xc43f28,0xe95336,0xf44b2e,0xfb4a2b,0xfa4928,0xf84a26,0xf74c24,0xf74c24,0xfa4b29,0xe25336,0xe4937e,0xffe9d6,0xfff0dc,0xf9f3de,0xfaf2e0,0xf9f2e4,0x71706c,0x020202,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x6a6965,0x000000,0x000000,0x000000,0x6b796b,0x629b8e,0x6fbeb5,0x6dbfbd,0x68bebe,0x67c0c2,0x67c0c2,0x69bfc0,0x69c0be,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec0,0x6abec0,0x69c0be,0x6abfbe,0x71c1bf,0x5d9791,0x728179,0x000000,0xf6f1e5,0xf7f2e4,0xf8f4e5,0xf8f4e5,0x5b5648,0xd8d3c5,0xf7f2e4,0xf6f1e3,0xf4f2e5,0xfaf3e5,0xfff0de,0xffdec7,0xdf6241,0xec4d25,0xf04f26,0xf45026,0xf54f23,0xe34c24,0xca5136,0x872a15,0x360000,0x250000,0x250000,0x330000,0x751e12,0xc44f3b,0xeb5238,0xf6492a,0xfa482c,0xfc4828,0xfd4826,0xfc4924,0xfa4f29,0xf44f2e,0xf14e3a,0xdf4b3b,0x790100,0x942310,0x8b1100,0x810500,0xb23a28,0xc24e3c,0xcb5642,0xcb5642,0xc04838,0x9a281a,0x5c0000,0x5d0000,0xc3432c,0xe24c2f,0xf1492b,0xfc4b2c,0xfa4928,0xf84a26,0xf74c24,0xf74c24,0xfa4b29,0xe25336,0xe4937e,0xffe9d6,0xfff0dc,0xf9f3de,0xfaf2de,0xf9f2e4,0x666460,0x020202,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x181818,0x000000,0x959490,0x000000,0xf4f2e5,0xf5f0e4,0x526256,0x69a69d,0x6dc0b9,0x6bc0bd,0x68bebc,0x67c0c0,0x67c0c0,0x69c0be,0x69c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc2,0x69bfc0,0x69c0be,0x69c0bc,0x6ec1bc,0x68a49e,0x576b62,0x000000,0xf6f1e5,0xf6f1e3,0xf7f2e4,0xf8f4e5,0x817d6e,0xc5c0b2,0xf8f4e5,0xf5f0e2,0xf4f2e5,0xf8f4e5,0xfbf0dd,0xffe0c7,0xe36f50,0xeb522d,0xeb4b26,0xf14b23,0xf64e21,0xed4a1d,0xea532d,0xdb5839,0xb54e33,0xa24832,0xa0483a,0xb34c42,0xd35240,0xe25039,0xe84d31,0xed492e,0xf54a30,0xf8492e,0xf74b26,0xf44d26,0xef522c,0xe75132,0xdf4e3a,0xa81b0d,0x920700,0xb62b1c,0xaf2511,0xa41f0a,0x810400,0x670000,0x6d0000,0x680000,0x710000,0x860f03,0x8e2920,0x6e0500,0xc33e26,0xe94e32,0xf54d2d,0xf94828,0xfa4928,0xf84a28,0xf74c24,0xf74c24,0xfb4c2a,0xe25336,0xe4937e,0xffead9,0xfff0de,0xf9f2e0,0xf9f1dd,0xf9f2e4,0x54534f,0x010101,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x201d1e,0x000000,0xadaaa4,0xf2efe3,0xf5f3e4,0x000000,0x3d4e48,0x6faba7,0x6cbebc,0x6bc0bf,0x68bebc,0x67c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x66c0c4,0x66c0c2,0x66c1be,0x67c1bc,0x66beb7,0x72b3aa,0x132b23,0xebede3,0xf4f2e5,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xaaa697,0xa8a395,0x000000,0xf5f0e2,0x000000,0xf7f2e4,0xf9f3de,0xffe9d2,0xfa9378,0xdd4e31,0xee4d2c,0xf74e2c,0xf84c27,0xf44b24,0xf14c28,0xee502f,0xe85233,0xe55335,0xe35437,0xe65239,0xe84a32,0xd64027,0xa8230c,0xd8533b,0xe84f38,0xec4b2f,0xed4f2e,0xe44f2d,0xdc553a,0xd1533b,0x9c250d,0x7f0000,0xc22111,0xcc1c0f,0xca1e0b,0xc71e07,0xc61e09,0xc31e08,0xc11f08,0xc11f06,0xc11a03,0xbe210f,0xac2a1d,0x7f0000,0xd13e27,0xec4b2d,0xf34929,0xf64825,0xfa492a,0xf84a28,0xf74b28,0xf74b26,0xfc4c28,0xe15031,0xf9a895,0xffeadd,0x000000,0xfaf3e5,0xfbf0df,0xf1e8db,0x2f2b28,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1d181a,0x030000,0xbfbbb3,0xf4f2e3,0xf7f4e5,0xf0ece4,0x233333,0x74afaf,0x6cbebe,0x6bc0bf,0x69bebc,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c0c2,0x64c1c4,0x64c1c4,0x66c1be,0x67c1bc,0x66beb7,0x78bdb6,0x1a3931,0xcdd5cc,0xf3f3e5,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xccc7b9,0x6b6758,0xf6f1e3,0xf5f0e2,0x000000,0xf5f3e4,0xf7f4de,0xffebd4,0xffb198,0xda583d,0xf04e33,0xfb4c2e,0xf74b2a,0xf74b28,0xf64a26,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b2a,0xf34728,0xe94c31,0x9a1c04,0x8c1703,0xc03e2d,0xd24834,0xd6482f,0xca3f25,0xad2b15,0x810300,0x870900,0xb01f0a,0xcd1c0b,0xda1707,0xd81803,0xd81901,0xd71903,0xd51a03,0xd41b01,0xd41b01,0xd31600,0xcb1d05,0xb52619,0x830000,0xd63c25,0xf0492d,0xf64928,0xf74926,0xfa492a,0xfa492a,0xf84a28,0xf84a28,0xfc4c2a,0xe35437,0xffb6a6,0xffebe1,0x000000,0xf7f0e5,0xfbf2e3,0xede6d8,0x050300,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x231e1f,0x020000,0xcac7bf,0xf3f1e2,0xf4f2e3,0xebe8e0,0x1f2f2e,0x78b3b4,0x6bbdbc,0x6bc0bf,0x69bebc,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c0c2,0x64c1c4,0x64c1c4,0x66c1c0,0x67c1bc,0x6bc2be,0x75bdb7,0x3b6159,0xb6c3ba,0x000000,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xebe7d8,0x2e291b,0xebe7d8,0xf5f3e4,0x000000,0xf4f4e4,0xf7f4de,0xffedd6,0xffd1b9,0xcd5b42,0xee4f35,0xff4b2f,0xfa4b2b,0xf74b28,0xf64a26,0xf64a26,0xf64a26,0xf64a26,0xf64a26,0xf74926,0xf44324,0xf04d30,0xd64d35,0xa22f1b,0x560000,0x580000,0x640000,0x800000,0xa00d00,0xb71905,0xc8200e,0xd01d0a,0xd81805,0xdd1601,0xdf1600,0xdd1600,0xd81901,0xd71903,0xd51a01,0xd71901,0xd61900,0xcc1e07,0xb12416,0x7f0000,0xd83f27,0xf24c30,0xf84c2b,0xfa4b29,0xfa492a,0xfa492a,0xf84a28,0xf74b2a,0xf8492c,0xe25940,0xffccbb,0xffecdf,0xfbf2e5,0xf6f1e5,0xf7f3e2,0xd2d0c3,0x000000,0x070707,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x110c0e,0x040000,0xd4d0c8,0xf3f1e2,0xf3f1e2,0xf1ede5,0x2e3e3d,0x78b3b4,0x6bbdbc,0x6bc0bf,0x69bebc,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x66c0c4,0x66c0c4,0x66c1c0,0x67c0be,0x6bc2c0,0x74bbb7,0x5a8680,0x889e94,0x000000,0xf7f2e4,0xf7f2e4,0xf7f2e4,0xf5f0e2,0x7d786a,0xc7c3b4,0xf2f0e1,0xf4f4e4,0xf4f4e4,0xf7f3e0,0xffefd8,0xffe3cc,0xe1836a,0xe24b33,0xf8462b,0xfa4b2b,0xf74b28,0xf74b28,0xf64a26,0xf64a26,0xf64a26,0xf64a26,0xf74926,0xfa4928,0xee4628,0xe34d32,0xc54731,0x5d0000,0x8e2f28,0xa62820,0xba2319,0xc71f0f,0xd31d0b,0xd71807,0xdb1806,0xdd1802,0xdd1600,0xdf1600,0xdd1700,0xda1801,0xd71903,0xd81901,0xd81901,0xd81900,0xcd1f08,0xae2616,0x7a0000,0xd84129,0xf34d31,0xf84c2b,0xfa4b29,0xfa492a,0xfa492a,0xf84a28,0xf54b2c,0xee4a2f,0xdb5f47,0xffddca,0xfbf0df,0xf5eee1,0x000000,0xf1f2e2,0xb2b4a6,0x010200,0x1e1e1e,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x030000,0x010000,0xd7d4cc,0xf3f1e2,0xf5f3e4,0x000000,0x425251,0x70abac,0x6dbfbf,0x6bc0bf,0x6bc0bf,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x67bfc4,0x67bfc4,0x66c1c0,0x67c0c0,0x6bc1c2,0x73bcbd,0x6da29e,0x405f57,0x000000,0x000000,0xf6f1e3,0xf6f1e3,0x000000,0xb5b0a2,0x938e80,0xf8f4e5,0xf4f2e3,0xf5f4e2,0xf7f3e0,0xfff0dc,0xffe9d3,0xfdb49d,0xdd563d,0xf04a2b,0xf64c2b,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf84a28,0xf74b2a,0xf14b2c,0xe04e34,0x831405,0x942015,0xc01d14,0xd1160a,0xda1609,0xda1705,0xd71903,0xd71901,0xd81901,0xda1800,0xdc1800,0xdc1700,0xd81901,0xd81803,0xda1801,0xdc1701,0xda1800,0xc91c04,0xa82413,0x6b0000,0xde4a31,0xf34d31,0xf84c2b,0xfa4b29,0xfa492a,0xfa492a,0xf84a28,0xf04d2e,0xe45238,0xf58c74,0xffe2cd,0xf6f0de,0xf6efe2,0x000000,0xf1f4e3,0x93988b,0x020300,0x232323,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0b0708,0x020000,0xd4d0c8,0xf4f2e3,0xf5f3e4,0x000000,0x546464,0x68a3a4,0x6dbfbf,0x6bc0bf,0x6abfbe,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x69bec4,0x69bec4,0x66c0c2,0x67c0c2,0x6bc1c4,0x71bbc0,0x77b3b1,0x143933,0xd5ded2,0xf5f0e2,0x000000,0xf7f2e4,0xf6f1e3,0xe7e2d4,0x3e392b,0xeae6d7,0xf6f2e1,0xf9f2e2,0xf9f2e0,0xfdf0de,0xffeedd,0xffd8c2,0xd25e41,0xeb5332,0xf24d2a,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b26,0xf84b24,0xf84b24,0xf84a28,0xec4e34,0xb43928,0x880800,0xcc1c11,0xde1608,0xe01405,0xdf1503,0xd81803,0xd71901,0xd81901,0xd81901,0xd81900,0xd81901,0xd81803,0xda1703,0xdd1601,0xdd1601,0xdd1800,0xce220a,0xa52412,0x6f0000,0xe34e35,0xf34d31,0xf84c2b,0xfa4928,0xfc482a,0xfa492a,0xf84a28,0xec4f2e,0xd5583c,0xffb59c,0xffedda,0xf5efdf,0x000000,0xf2eedf,0xeff1e3,0x4a4e42,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x191416,0x020000,0xcbc8c0,0xf5f3e4,0xf5f3e4,0x000000,0x6f7f7e,0x5c9898,0x6dbfbf,0x6abfbe,0x69bebc,0x69c0be,0x67c0be,0x66c1be,0x66c1be,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc2,0x6abec4,0x69bec4,0x66c0c2,0x66c0c2,0x68bdc4,0x6cb8be,0x77b9ba,0x416d68,0xabb5ab,0xf3efe1,0xf6f1e3,0x000000,0xf5f1e0,0xf3efe1,0x757062,0xc8c1b3,0xf9f0e1,0xfcf0e2,0xfaf2e0,0xfcf1e0,0xffebde,0xffe3d0,0xf79976,0xd9552d,0xed4f2a,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf74b28,0xf84a26,0xfa4b1f,0xfa4b1f,0xfa4928,0xed4d34,0xce4c3a,0x730000,0xbb1506,0xd71d0c,0xdc1605,0xdd1603,0xdc1703,0xdc1703,0xdc1703,0xda1703,0xd71905,0xd71905,0xd81803,0xdc1703,0xdf1501,0xdf1501,0xdd1800,0xcf230b,0x9e220e,0x830e00,0xe55339,0xf34d31,0xf84c2b,0xfa4928,0xfc482a,0xfa492a,0xf84a28,0xe75130,0xcc6647,0xffd9bf,0xffecda,0xf9f0e1,0xf9f0e3,0x000000,0xdbdbd0,0x070900,0x070705,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x252022,0x020000,0xc4c1b9,0xf5f3e4,0xf5f3e4,0x000000,0x84938e,0x558e8d,0x6fbebf,0x6abec0,0x66bdbd,0x69c0be,0x69c0be,0x67c0c0,0x66c1c0,0x67c0c0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec2,0x69bfc2,0x66c0c2,0x66c0c2,0x65bbc0,0x6bbcc0,0x72bbbc,0x699e9a,0x54665b,0xececde,0xf5f3e4,0xf6f1e3,0x000000,0x000000,0xc0bbaf,0x7a7267,0xf9f0e3,0xfcf0e2,0xfaf2e0,0xfbefe1,0x000000,0xffeada,0xffd4b6,0xc8613d,0xe5532e,0xf54c28,0xf54c28,0xf84c29,0xf74b28,0xf74b28,0xf74b28,0xf84a26,0xfa4a21,0xfc4a21,0xfa4928,0xf04d30,0xdc503b,0xaa2210,0x9f0a00,0xc11909,0xd51907,0xdd1505,0xdc1703,0xdc1703,0xdc1703,0xda1703,0xd81805,0xd81805,0xd81805,0xda1703,0xdd1603,0xdf1501,0xdd1601,0xc91c04,0x981c06,0x9a2711,0xe65237,0xf54d2f,0xf74b2a,0xf84a2a,0xfa492a,0xf84a2a,0xf44c2a,0xdd5634,0xe6987c,0xffead3,0xfff3e3,0x000000,0x000000,0x000000,0xb1b1a8,0x010200,0x1b1b19,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a1818,0x000000,0xb4b1ab,0x000000,0xf7f2e4,0xf9f2e4,0xa2ada3,0x4b7b7a,0x71b9bc,0x6bc1c4,0x66bec0,0x6abfbe,0x6cbebe,0x6abec4,0x69bec4,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x69bfc0,0x6abfbe,0x79b9b5,0x1f3b34,0xccd4c8,0xf3f3e5,0xf7f2e4,0xf5f1e0,0xf6efe2,0xe9e4d8,0x4d483c,0xd7d0c2,0xf9f0e1,0x000000,0xfaf1e2,0xf9f0e3,0xfff2e2,0xffead8,0xebab91,0xd65533,0xf3502c,0xf64f2a,0xf54c28,0xf64d27,0xf54c26,0xf74b26,0xf84a26,0xfc482a,0xfc482a,0xfa4a26,0xf54b2a,0xed5033,0xd4442e,0x740000,0xb12114,0xce180a,0xdc1605,0xda1703,0xda1801,0xd81900,0xda1801,0xdd1603,0xdd1505,0xda1707,0xd81707,0xdc1703,0xdd1603,0xdd1603,0xcc1d09,0x880c00,0xad391e,0xea5133,0xf74a2c,0xf84a2a,0xfa4b2b,0xf94c2e,0xf44c2c,0xe94d29,0xd05837,0xffcfb9,0xffeadb,0x000000,0x000000,0x000000,0x000000,0x5e5c56,0x020300,0x282826,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x222222,0x020000,0xa7a49e,0x000000,0xf9f2e4,0xfdf4e4,0xc0c9bd,0x365f5d,0x75b6b9,0x6abec2,0x66c0c2,0x6cbebe,0x6dbdc0,0x6abec4,0x69bec6,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x72bbba,0x517b74,0x879b92,0xecf0e3,0x000000,0xf9f2e2,0xf7f2e4,0x000000,0xb1aca0,0x857e71,0xfaf3e3,0xf8efe0,0x000000,0xf7f1e3,0xf9f2e4,0x000000,0xffd9c7,0xd87051,0xe75733,0xed4a28,0xf44925,0xf74b26,0xf74b26,0xf74b26,0xf84a2a,0xfc472e,0xfc482c,0xfa4a26,0xf74b26,0xf04828,0xea5137,0xa32414,0x8d0900,0xc31b0b,0xd41805,0xd71903,0xd81901,0xd81900,0xda1800,0xdf1501,0xdf1503,0xdc1605,0xda1705,0xdc1605,0xdc1605,0xde1a08,0xc41805,0x770000,0xc2472e,0xec4f32,0xf84a2a,0xfa492a,0xfa492a,0xfa4d31,0xec4d2e,0xde5432,0xec8b6c,0xffdfcb,0xfcf0e4,0x000000,0xf3ebe2,0x000000,0xcecac5,0x070602,0x050503,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x222222,0x000000,0x898580,0x000000,0xfaf3e5,0xfaf1e2,0xd8ded1,0x0d302b,0x7bb6b6,0x6ec0c2,0x68c1c3,0x6abfbe,0x6cbec0,0x6abec4,0x69bec4,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6fbdba,0x6fa79f,0x1a3931,0xdee4db,0x000000,0x000000,0xf5f0e2,0x000000,0xe6e4d7,0x474334,0xd6cfc1,0xfbf4e4,0xfaf3e3,0x000000,0xf6efe2,0x000000,0xffe9d8,0xffb79b,0xd05e3e,0xe84d2f,0xfa492a,0xfd4826,0xfd4826,0xf74b2a,0xf74a2e,0xfa482e,0xfc482c,0xf84a26,0xf74b26,0xf64e2c,0xe84b30,0xcf4733,0x780000,0xae1a03,0xc51e06,0xd41a07,0xda1705,0xd81803,0xda1801,0xdc1703,0xdd1601,0xdd1600,0xdf1501,0xdf1503,0xdc1607,0xd11909,0xbc1806,0x7e0000,0xd5503b,0xf04c34,0xfc482c,0xfd4828,0xfc4828,0xf24529,0xe85235,0xcf6242,0xffd1b3,0xffebd8,0xfdf1e5,0x000000,0xf5ede5,0x000000,0x8f8b86,0x030100,0x222220,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x030100,0x4f4b46,0x000000,0xf7f1e3,0xfbf2e3,0xebf0e0,0x2d4942,0x74a8a7,0x70bebd,0x67c0c0,0x6abec0,0x6abec0,0x69bec4,0x67bfc4,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6cbebc,0x78bbb5,0x457169,0x9aa6a0,0x000000,0xf6f1e3,0xf6f1e3,0xf5f3e4,0x000000,0xb9b5a6,0x756e60,0xf6efe2,0xf5eee1,0x000000,0xf7f1e3,0x000000,0xfff0e0,0xffe3cc,0xec987b,0xdc5339,0xf44b30,0xfc482a,0xfd472a,0xf84b2f,0xf54a30,0xf8492e,0xfa482c,0xf74b28,0xf54c26,0xf54b2a,0xee4c2e,0xe2523a,0xb8301a,0x900b00,0xb5230b,0xcb1c09,0xd51907,0xd81803,0xda1801,0xda1703,0xdc1701,0xdd1700,0xdf1600,0xdf1503,0xd71809,0xc51c0e,0xa20a00,0xad200e,0xdd4d37,0xf44a34,0xfc472e,0xfd4828,0xf84a2a,0xe94a2b,0xd45539,0xee9f83,0xffe5ca,0xffeedc,0xfcf0e4,0x000000,0x000000,0xe0dad3,0x1a1613,0x060403,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x030100,0x16120d,0xe9e4da,0x000000,0xfaf1e2,0x000000,0x7f938a,0x5d8983,0x75bebc,0x6bc1c2,0x69bfc0,0x69bfc0,0x67c0c2,0x67c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6abfbe,0x76c2bf,0x73aba6,0x223a34,0xe0e4dc,0x000000,0x000000,0x000000,0xf5f3e4,0xefeade,0x6b6358,0xc1b9ae,0x000000,0x000000,0xf6efe4,0x000000,0xf8eadc,0xffecdb,0xffdfcb,0xf0866f,0xdd4f36,0xec482b,0xf74a2e,0xf64b31,0xf64b31,0xf8492c,0xf74928,0xf44b26,0xf24b26,0xf74b2a,0xf44b2e,0xea4f32,0xdf543a,0x8a1501,0x911503,0xbb1f0b,0xcf1c07,0xd51700,0xd81600,0xd81901,0xdb1b03,0xd81600,0xd91700,0xdb1904,0xcf1b0d,0xb21d14,0x720000,0xd4422d,0xed4d34,0xf94c32,0xf9472c,0xf64928,0xec4d2c,0xdd5739,0xe58367,0xffe0c8,0xfff2dd,0xfff3e1,0xfcf0e4,0x000000,0x000000,0x8f8985,0x080401,0x1b1918,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0c0a08,0x020000,0xcbc5bc,0xfaf3e5,0x000000,0xf3f1e2,0xaebbb0,0x3e645b,0x79bebb,0x69bfc0,0x69bfc0,0x67c0c0,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6abec0,0x71bfc0,0x7bb9b9,0x4f756f,0x899a92,0x000000,0xf3ecde,0xf8f4e5,0xf2f0e1,0xf1ece0,0xd7d0c4,0x3c3529,0xe7e0d5,0xf6efe4,0xf3ebe0,0xf6efe4,0x000000,0xfdefe4,0xffe9d9,0xffcdb7,0xe2795f,0xda4f33,0xeb4b2f,0xf24c30,0xee4427,0xf6492a,0xf64928,0xf24b26,0xf24b26,0xf64928,0xf64928,0xf24d2c,0xe75134,0xcb4c37,0x780000,0x9f1300,0xc0220d,0xc91b06,0xd21b05,0xd41b03,0xd41900,0xd41900,0xd51c04,0xd1200e,0xc11f11,0x8c0500,0xa62214,0xeb5238,0xf24d2c,0xf94c2e,0xf94e2f,0xf04f2d,0xd9512f,0xd36f4f,0xffcdb1,0xffe8d1,0xfff5e5,0xfdf2e3,0xf9f0e3,0xf7f0e5,0xd3cec4,0x1a1711,0x030100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x262422,0x040100,0x9e9990,0xf9f2e4,0xfdf4e4,0xf5f4e2,0xd7e0d2,0x0f2f24,0x71b4b0,0x6fc3c4,0x67c0c0,0x66c0c2,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6abec0,0x70bdc3,0x73b7b9,0x77afa7,0x17392d,0xd5d9ce,0x000000,0xfaf3e5,0xf2eedf,0x000000,0xf2ede1,0xa49f93,0x807b6f,0xf1ece0,0x000000,0x000000,0x000000,0x000000,0xffe9df,0xffebd6,0xffd5ba,0xe67a5f,0xdf5237,0xeb4c2d,0xf54b2c,0xf64928,0xf44b26,0xf14c28,0xf14c28,0xf74926,0xf94826,0xf64a26,0xf14c28,0xeb5133,0xcb3e25,0x810300,0x8d0e00,0xb42012,0xc52114,0xcd1f0a,0xcb1600,0xd31d02,0xca1e09,0xb52115,0x9b140b,0x880600,0xd34d34,0xe84c2a,0xf24c24,0xf95029,0xee4e26,0xdb4d29,0xd46544,0xffc8a6,0xffedce,0xfdeeda,0x000000,0x000000,0xf8efe2,0xf1ece0,0x6f6d62,0x010000,0x201e1a,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x57544a,0xf1ece0,0xf7f1e1,0xf5f1e0,0xeef3e4,0x587164,0x5c9690,0x70bebd,0x69c0be,0x66c1c0,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x74c5ca,0x6eb9bb,0x74bbb5,0x5b8e84,0x5c6b63,0xece9e1,0xf2ede1,0xf8f4e5,0x000000,0x000000,0xf2ede1,0x767165,0xaea99d,0xf1ece0,0x000000,0x000000,0x000000,0xfbebe1,0xfcf2dc,0xffead0,0xffd0b6,0xed846a,0xd55336,0xe24c2d,0xef4d28,0xf24b26,0xf14c28,0xf24b28,0xf74928,0xf94828,0xf94826,0xf74924,0xf04723,0xe84c2c,0xd04e34,0x9d210b,0x800000,0xa20e01,0xb91d0b,0xbd1d06,0xb61700,0xa91200,0x8c0500,0x880600,0xd04731,0xe24e30,0xf0502b,0xf55129,0xe94d29,0xd74d29,0xd36445,0xffc3a4,0xffe8cc,0xfdf2d8,0xfbf5e2,0xf8f4e5,0x000000,0x000000,0xadaaa0,0x070300,0x0d0c08,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x070602,0x030000,0xdad5cb,0xf7f0e5,0xf7f2e4,0xf3f3e3,0xa7b7a9,0x37665f,0x77bab5,0x6cbfba,0x67c0be,0x69bfc0,0x69bfc2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x69c0be,0x6abfbc,0x77bab5,0x365956,0x9ba9a2,0x000000,0xf3f1e2,0x000000,0xf3efe3,0xf6f1e5,0xe6e1d5,0x4b463a,0xc3beb2,0xf2eedf,0xf6efe2,0xf9eee2,0xf8efde,0xf4f4db,0xf9f2d7,0xffe9ce,0xffdec5,0xed9c88,0xc6563e,0xe95432,0xf64f28,0xf14a27,0xf44a2a,0xf6492c,0xf7482c,0xf6492a,0xf64a26,0xf74a22,0xf44b26,0xea4e2e,0xe45035,0xcd3d27,0xad200e,0x8d0800,0x750000,0x760000,0x911300,0xba331c,0xda4830,0xed4e32,0xf64e2e,0xf24922,0xee502d,0xd9543b,0xdb7661,0xffcbb3,0xffebd5,0xffecdb,0xfcf0e2,0xfaf3e5,0x000000,0x000000,0xd8d6d2,0x272521,0x050301,0x2e2c2a,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a1816,0x060200,0xa39f97,0x000000,0x000000,0xf8f4e5,0xdee7d9,0x193b32,0x76ada8,0x6fbdb7,0x69c0bc,0x69bfc0,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1be,0x66c1be,0x64c2be,0x6cbebc,0x74a8a7,0x193733,0xcad4cc,0xecebe0,0x000000,0x000000,0x000000,0x000000,0xd9d4c8,0x3e392d,0xd2cdbf,0xf7f1e3,0xfbf2e3,0xfaf4e1,0xf1f5dd,0xf1f5db,0xfbf6da,0xffeed5,0xffe5d2,0xffb7a0,0xdf6e4d,0xe45835,0xe85032,0xe9472c,0xf1492d,0xf6482e,0xf6492c,0xf64928,0xf74a22,0xf74a20,0xf44b26,0xf14b2a,0xe94e30,0xe15137,0xdb563f,0xcf533b,0xd0573b,0xd6563b,0xe45032,0xec4d2e,0xf04a2b,0xf04f2d,0xe24f2a,0xd8593b,0xef8e7c,0xffd1c3,0xffedd9,0xfbf0db,0xfff5e5,0xf7ede1,0xf2eedf,0x000000,0xe1e1dd,0x4e4e4e,0x020000,0x1a1818,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x040000,0x46423e,0xeee7e5,0x000000,0x000000,0xeeefe3,0x7f938a,0x5e8880,0x72bcb7,0x69c0be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1be,0x64c2be,0x5fc4c0,0x64c2be,0x74b9b8,0x669193,0x344747,0xdde0dc,0x000000,0x000000,0xebe8dc,0x000000,0xf2efe3,0xcfcabe,0x3e392d,0xd3ccbf,0xf8efe2,0x000000,0xf7f5e1,0xf3f2dc,0xf7f6db,0xf9f4d8,0xfdefd4,0xffeed4,0xffddc4,0xf9a289,0xd76348,0xe0533a,0xeb4930,0xf4472d,0xf7472e,0xf6492a,0xf44b22,0xf24d20,0xf64b22,0xf64a24,0xf64d29,0xf4512f,0xea4e2c,0xeb512f,0xe85130,0xec4d2c,0xf44a28,0xf24b2a,0xeb5332,0xd85738,0xdc7a5b,0xfeb79f,0xffddce,0xffefdf,0xfff7df,0xf4f4d9,0xfdf5de,0xfdf4e0,0x000000,0xe8eade,0x6a6b66,0x070707,0x0e0e0e,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x292726,0x100e0a,0x030100,0x050301,0x030001,0x0e0c0b,0x1b1918,0x060403,0x030000,0xc1bdbc,0x000000,0x000000,0x000000,0xced4cc,0x19362e,0x7ab8b5,0x6cbebc,0x67c0be,0x66c1be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1be,0x64c2be,0x61c3c0,0x64c2c0,0x6fbcbe,0x80b6b9,0x607d81,0x606b6c,0xe5e7df,0xdddace,0xacaa9d,0x9b988b,0xcfccc0,0xf4f2e5,0xc5c0b4,0x3f3a2e,0xc3beb2,0xf5f0e2,0xf8f4e3,0xf4f3df,0xf7f6df,0xf3f3d8,0xf8f8da,0xfcf2d8,0xffe9d2,0xffdfcb,0xffcfbb,0xfd9a85,0xe06650,0xda503a,0xe14e39,0xe45035,0xe6512c,0xe75126,0xec4e28,0xee4d28,0xef4f2a,0xed4f2a,0xe84f27,0xe8532d,0xe24f2c,0xe24e2e,0xe15031,0xda5437,0xe17155,0xffaf96,0xffdcc4,0xffebd7,0xffeade,0xf9ebdf,0xfaf9e3,0xf5f7dd,0xf7f2db,0xfbf5e0,0xededdd,0x797b6f,0x020300,0x090909,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x232122,0x0e0d09,0x060500,0x020100,0x0c0b02,0x1a1912,0x15110b,0x030000,0x000000,0x000000,0x000000,0x605e5c,0x000000,0xf5ede5,0x000000,0x000000,0x718078,0x588883,0x71bbb6,0x6dc1be,0x67c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0be,0x67c0be,0x69bfc0,0x6abec0,0x6cb9ba,0x7ebebd,0x80b1ae,0x4e6d67,0x4d554b,0x3c392f,0x9e9b91,0xaca99f,0x39362b,0xdcd9ce,0x000000,0xcbcbbf,0x424136,0xb7b7aa,0xefefe1,0x000000,0xf6f2df,0xf5f1dc,0xf7f4dc,0xfef6dd,0xfff1dd,0xffeddb,0xffecdc,0xffeada,0xffe0d0,0xffbeb0,0xe79384,0xd67260,0xd05e42,0xd5583a,0xd65535,0xd75334,0xd75332,0xd65533,0xd15833,0xd15e3a,0xc96142,0xd97b61,0xf4a590,0xffc4b2,0xffe5d5,0xffe9d9,0xffebd9,0xffecdd,0xffece3,0x000000,0xfbf2e3,0xf6f1dc,0xfef6e1,0xeee8d8,0x6d7061,0x010500,0x050503,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x272425,0x050301,0x030200,0x626159,0xb8b8ab,0xdfdfd1,0xeae7da,0xe4e1d7,0xcfccc2,0x96938b,0x201f18,0x010200,0x000000,0xc2c0ba,0x000000,0x000000,0x000000,0xcdd3ca,0x133631,0x73aeaa,0x71bfbe,0x64bcbc,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1be,0x67c0be,0x6abec0,0x6dbdbe,0x70bebb,0x77bab3,0x7aaea3,0x355449,0x7c857b,0xdfdcd2,0x000000,0x000000,0x817e74,0xc7c4ba,0x000000,0x000000,0xd9dbce,0x59584d,0x97968b,0xebe8dc,0x000000,0xf7f1df,0xf5efdb,0xfdf4e0,0xfff0de,0xfdf0e0,0xf7f2e4,0xf5f3e4,0xf9f0e1,0xffecdf,0xffe5d8,0xffe1d0,0xffd0b9,0xffc4a9,0xffb59b,0xffaa92,0xffa98f,0xffb095,0xffb898,0xffc4a7,0xffd9c0,0xffe1cb,0xffe9d9,0xffecdf,0xfbeee5,0xf9efe5,0xfceee1,0xfdf0e2,0xfdefe4,0xfcf0e4,0xf7f1e1,0xf5efdf,0xdfdacc,0x625f52,0x000200,0x030601,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x090607,0x050300,0x98978e,0xe8e8dc,0xf4f4e4,0xf5f4e2,0xf9f5e4,0xf6f2e1,0xf4f3e1,0xf7f4e5,0xdfdfd1,0x76786c,0x010500,0x57594f,0xf0ede0,0xf5eee1,0x000000,0x000000,0x788d86,0x4f7d79,0x75bdbe,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x67c0c2,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x64c2c0,0x66c1c0,0x69bfc0,0x6cbebc,0x6ebdb2,0x76b5a7,0x345948,0x8a9a8c,0xecf0e3,0x000000,0xf0ede2,0xf0ede2,0x747167,0xcdcabf,0x000000,0x000000,0x000000,0xe9e3dc,0x8a877f,0x5e5b51,0xd3cec0,0xf9f2e2,0xf9f0e1,0xf9efde,0xfcf1e0,0xfaf2e0,0xf8f4e1,0xf8f4e1,0xf7f4de,0xfaf2de,0xfeefdb,0xffeed7,0xffeed5,0xffecd3,0xffead3,0xffe8d5,0xffe8d6,0xffe9d6,0xffe7d6,0xffedda,0xffead4,0xffedda,0xffefe0,0xfcf0e4,0xfbeee5,0x000000,0xfeede5,0xfceee1,0xfdf4e0,0xfaf7e1,0xeeecdd,0xbdbdb1,0x363730,0x050501,0x090703,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x141115,0x050301,0x8b8a83,0xf0f0e5,0xf5f3e4,0xf4f3e1,0xf4f3df,0xf6f2df,0xf6f2df,0xf7f3e0,0xf5f4e2,0xf1f2e2,0xecefe0,0x8d8f83,0x010300,0xaaaa9d,0x000000,0x000000,0x000000,0xd7dfd8,0x1b3a34,0x6ca7a5,0x72c2c0,0x69c0be,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c2,0x67c0c2,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x66c1c0,0x68c1c1,0x6abfbe,0x71bdb7,0x7abbb1,0x396958,0x7d927d,0xebf0dc,0xf4f4e4,0x000000,0x000000,0xd5d9cc,0x383f33,0xe3e7dc,0x000000,0x000000,0x000000,0x000000,0xf2ede3,0xbbb9ac,0x484337,0xa0998c,0xede1d5,0xfdf1e5,0xfaf3e5,0xf8f4e3,0xf8f4e1,0xf7f5e1,0xf5f4de,0xf6f2dd,0xf6f2dd,0xf6f2dd,0xf5f6df,0xf5f6df,0xf7f4de,0xf9f0df,0xfdf2e1,0xfbefe1,0xf6eddd,0xf8efe0,0xfbf3e1,0xf9f0df,0xf7f1e3,0x000000,0xf9efe5,0x000000,0xfceee5,0xfbefe3,0xf3f0dd,0xdfe0cb,0x828478,0x030500,0x000201,0x161817,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000001,0x292824,0xe5e4d9,0xf5f3e4,0xf7f3e2,0xf9f2e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf4f3e1,0x000000,0xeeecdd,0x7a776b,0x2a2923,0xdfd8d4,0x000000,0x000000,0x000000,0xa1b3a8,0x2f5c51,0x74b7ae,0x6cbfba,0x66c1be,0x67c2bf,0x66c1c0,0x66c1c0,0x66c0c2,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6abec2,0x6ec0c2,0x71bcbc,0x7dbbb6,0x567e75,0x63796b,0xe6eed9,0xf4f3dd,0xfaf7e1,0xf0f1df,0xe9f2e1,0x829284,0x2a4032,0xb9c8be,0x000000,0x000000,0xf6ebdc,0xfdf4e2,0xf9f5e4,0x000000,0xe4dfd3,0x968e85,0x443730,0xafa29b,0xe7e2d6,0x000000,0x000000,0xf4f2e3,0xf5f4e2,0xf9f5e4,0xf5efdf,0xfbf4e4,0xf3f0dd,0xf1edda,0xf5f1de,0x000000,0xfcf6e4,0xf6f0de,0xf9f2e0,0xfaf3e3,0xfaf3e3,0xf6efe2,0x000000,0xf6efe4,0x000000,0x000000,0xf9efe5,0xebe3da,0xaba8a0,0x2a2b24,0x010200,0x070705,0x1e1e1e,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x252429,0x030303,0x8a8982,0x000000,0xf7f3e2,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf5f1e0,0xf2eedd,0xf9f5e4,0xe3e0d3,0x35342d,0x78726f,0xfaebe5,0xfceee5,0x000000,0xe5eee0,0x5b796b,0x518276,0x72b7b0,0x71c1bd,0x6ec1bc,0x66bab7,0x66bfbc,0x66c1c0,0x64c1c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x6bbcc0,0x75c0c4,0x78bbb9,0x6d9d98,0x2d433b,0xd8ded1,0xf4f5e0,0xededd4,0xf6f2dd,0xf5f6e3,0xd1ded0,0x183328,0x698f84,0x183933,0x8d9997,0xe7e5e1,0xf7f2e4,0xfdf7e5,0xf7f3e2,0xf5f0e2,0xf3ebe0,0xf8eee4,0xe4d5cc,0x948880,0x322f27,0x94938b,0xd1d0c5,0x000000,0xf2efe5,0x000000,0xf2ede3,0x000000,0x000000,0xf7f3e2,0xf6f2e1,0xf8f4e3,0xf9f5e4,0xf6f2e1,0xf8f4e3,0xf5f1e0,0xf3efe3,0x000000,0xf5ede5,0x000000,0xf5ede5,0xdad3ca,0x9e968d,0x312b24,0x020000,0x000000,0x0f0f0f,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x1b1a1f,0x000000,0xadaca5,0xf3f1e4,0xf7f3e2,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf8f4e3,0xf3f1e2,0x000000,0x9e9d92,0x070300,0xafaaa0,0xf6efe4,0x000000,0x000000,0xd4e2d4,0x2b463b,0x6f9994,0x7ab2ad,0x76b7b3,0x72bcb7,0x6abcb9,0x66bfbc,0x66c0c2,0x66c0c2,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x70c4c5,0x75bdbe,0x79b0ae,0x294c47,0xb1beb5,0x000000,0xf5f8e4,0xf3f7e1,0xf7f5e1,0x000000,0x81928a,0x577a75,0x81b9b4,0x75aead,0x40646a,0x44585d,0xc1c9c4,0xefefe3,0x000000,0x000000,0xf9eee2,0xf9ebdd,0xfcf1e0,0xf9f0e3,0xe3ded6,0xa5a39f,0x52504c,0x54534f,0xa19f9b,0xc3c1bd,0xe3e2de,0xefeee5,0xf2efe3,0xf6f1e3,0xf7f2e4,0xf6f1e3,0xf5f0e2,0xf5f0e2,0xf6f1e3,0xeee9db,0x000000,0xeae4dd,0xcec9c1,0xaca7a0,0x635d56,0x0c0600,0x020000,0x020000,0x040200,0x282828,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x323136,0x000000,0xb4b2ac,0xf1eee1,0xf7f3e2,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf5f1e0,0xf7f3e2,0xf4f3e1,0xf7f4e5,0xd8d6c9,0x000000,0x161307,0x949184,0x9a9a8c,0x99998b,0x85877b,0x464e44,0x182e26,0x476562,0x4f7674,0x5b8d8c,0x6eaead,0x6ebab9,0x66bdbd,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69bfc0,0x68bcbb,0x77bbbb,0x608987,0x667c74,0x000000,0xf7f4e5,0x000000,0xeff5e1,0xf5f5e5,0xdce3d7,0x193530,0x7baba8,0x78bcbc,0x79c1c7,0x7bb4be,0x66929a,0x213f3e,0x6a7d77,0xc6cec7,0xebece5,0x000000,0xf8efe2,0xfcf6e4,0xf7f1e1,0x000000,0x000000,0x000000,0xd4d0ca,0xa5a39d,0x6d6b67,0x34322e,0x504d45,0x7f7c6f,0x969283,0xaea99b,0xb8b4a5,0xb7b2a4,0xaca89c,0x9c978b,0x847f73,0x555149,0x2f2c26,0x24201b,0x080400,0x010000,0x030000,0x070300,0x1b1a14,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x232227,0x010101,0xa6a59e,0x000000,0xf6f2e1,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf3f1e0,0xd5d3c3,0xbebeb1,0xbebeb1,0xc0bdb1,0xc0bdb1,0xc1bdaf,0xc0bdb1,0xc4c8c0,0xb7beb9,0xafb5b5,0x859598,0x17363c,0x65989e,0x6eb9bb,0x64babb,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x69c0be,0x71c1bf,0x75b0ae,0x13312c,0xd1d9d2,0x000000,0xf7f3e2,0xf2f5e4,0x000000,0x000000,0xa7b1ab,0x3f6b65,0x76b8b6,0x72bcc1,0x6fbdc5,0x6fbdc7,0x73bbc3,0x7ab8b7,0x558583,0x1b3e3b,0x647974,0xc0c8c1,0xeff1e5,0x000000,0xf1efdd,0x000000,0xf3efe3,0xf3efe3,0xf3efe3,0x000000,0x000000,0xf0e9e0,0xe0d9ce,0xcbc4b9,0xbcb7ab,0xb1aca0,0xa09b8f,0xa29d91,0xaaa59b,0xbcb6ad,0xc3c0b6,0xb3b1ab,0x7d7b77,0x211f1b,0x020000,0x040200,0x171511,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x222126,0x030303,0x82807a,0x000000,0xf6f2e1,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e0,0xf8f4e1,0xf8f4e1,0xf7f3e2,0xf6f1e3,0x000000,0x000000,0xf8f4e5,0xfaf4e1,0xfbf5e2,0x000000,0x000000,0x000000,0x000000,0xb2c4c9,0x244d51,0x77bbbd,0x70c5c3,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6abfbe,0x73bdbb,0x5a8f8b,0x6f857e,0x000000,0xf7f3e2,0xf9f2e2,0x000000,0x000000,0x000000,0x5c6a67,0x699e9a,0x71bcba,0x6dbfc1,0x6ac0c5,0x67c1c5,0x68c1c3,0x74c4c7,0x77bbbd,0x73acab,0x618f8d,0x2a4a46,0x495f57,0x93a59a,0xcfddcf,0xebf5e4,0xecf3e1,0xf0f3e2,0xf1f2e2,0xf6f1e5,0x000000,0xf7f0e5,0xf8eee4,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd3cdc6,0x88857d,0x12100c,0x010200,0x000000,0x171815,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x010101,0x25231d,0xe7e5d8,0xf6f2e1,0xf9f2e0,0xfaf1e2,0xfaf1e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf6f2df,0xf7f2db,0xfbf3df,0x000000,0x000000,0x000000,0xfaf3e5,0xf8f5df,0xf7f4dc,0xf7f4de,0xf8f4e3,0x000000,0x000000,0xbaced0,0x1d4648,0x75b7b7,0x6dbdbe,0x69bfc0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6cbebe,0x76b8b8,0x234f4b,0xbcccc2,0x000000,0xf7f3e0,0xf9f2e0,0x000000,0x000000,0xe1e1e1,0x132428,0x7ab1b1,0x70bebb,0x6ac1bf,0x67c2c1,0x65c3bf,0x67c2bf,0x69bdc0,0x6dbcc2,0x77c4c8,0x75bdbe,0x77b7b6,0x6aa19e,0x4b7b76,0x113b31,0x325444,0x7a9684,0xa7bfae,0xcedcce,0xe3eade,0xecebe2,0x000000,0x000000,0x000000,0x000000,0x000000,0xece7e0,0xb8b2ab,0x67615c,0x070100,0x090500,0x000000,0x151716,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x0e0e0e,0x040300,0xaeada2,0xf4f2e3,0xf7f3e2,0xf9f2e2,0xf9f2e2,0xf9f2e2,0xf9f2e2,0xf9f2e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf7f3e2,0xf9f2e0,0xf9f3dc,0xf8f0da,0xfbefe1,0xfdf1e5,0xfbf2e5,0xf9f2e2,0xf5f5dc,0xf5f5dc,0xf3f0db,0xf6f2e1,0xefe8df,0xb9bab5,0x384848,0x618584,0x7ebab6,0x71bcba,0x6abfbe,0x67c0c0,0x67c0c0,0x66c1c0,0x66c1c0,0x66c1c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x67c0c0,0x6fbdbc,0x689d9b,0x32514b,0xe6f1e4,0x000000,0xf7f4de,0xf9f2e0,0x000000,0x000000,0xc8c8c8,0x435354,0x85b3b1,0x6eb4ae,0x6fbfbb,0x6ac1bd,0x68c2bf,0x67c0c0,0x68bdc2,0x6fc4c9,0x68c1c3,0x66bdbd,0x72c4c1,0x71bfbc,0x7ac1bb,0x75b6ae,0x6ca99b,0x568d7c,0x437365,0x294d43,0x092118,0x2c3834,0x4c4f4c,0x595554,0x625d5a,0x65615e,0x544f4c,0x282421,0x040000,0x070300,0x030000,0x201e1a,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x2a2829,0x000000,0x302f27,0xe0e0d2,0xf2f0e1,0xf2f1dd,0xf7f3e0,0xf9f2e0,0xfbf3e1,0xfdf4e2,0xfcf6e4,0xf6f0de,0xf9f2e0,0xfaf4e1,0xfaf4e1,0xfbf5e0,0xfaf4df,0xfaf2e0,0xfaf2e0,0xf9f2e0,0xf9f2e0,0xf7f4de,0xf2f1dd,0xcfcfbd,0x9d998a,0x463a32,0x79706c,0x858885,0x304842,0x74a59b,0x74bab0,0x6bbbb9,0x6ac0c3,0x67c2c3,0x64c1c2,0x64c1c2,0x64c1c2,0x66c0c2,0x66c1c0,0x66c1be,0x66c1be,0x67c0be,0x67c0be,0x6cc3c1,0x69c0be,0x67c0be,0x79c0ba,0x587b74,0x96a39a,0x000000,0xf4f2e3,0xf7f3e0,0xf9f2e0,0xfaf2e0,0x000000,0xc3c0ba,0x151c1a,0x37534f,0x5f8e87,0x7bb9b7,0x70b8bb,0x70bec6,0x6abdc6,0x67bfc4,0x67c0c0,0x66c1be,0x67c1bc,0x65bfb7,0x63bbb2,0x69bfb4,0x6ec4b9,0x6ac0b7,0x73c6be,0x73bfba,0x75b5b2,0x80b1ae,0x85a4a5,0x738588,0x484e53,0x080808,0x2e2c2a,0x000000,0x020000,0x12100e,0x232120,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x110f0d,0x020000,0x626257,0xe5e5d7,0xf4f5e2,0xf7f5e1,0xfaf3e3,0xfaf1e2,0xfaf1e2,0xf7f1e1,0xf9f2e2,0x000000,0xf9f2e2,0xf9f2e2,0xf7f1e1,0xf7f1e1,0xf7f1e1,0xf5f1e0,0xe4e0cf,0xcfcbba,0x949182,0x4b4b3d,0x010300,0x333229,0xd3c8c5,0x000000,0x000000,0xa4b1aa,0x183a2d,0x62958b,0x76b8b6,0x73c0c1,0x6bc0bf,0x68c1c1,0x64c2c0,0x64c2c0,0x66c0c2,0x66c1c0,0x64c2be,0x64c2be,0x66c1be,0x67c0be,0x6bc2c0,0x69c0be,0x69c0be,0x78bbb7,0x3f574f,0xc0c2b8,0x000000,0xf5f3e4,0xf7f3e2,0xfaf2e0,0xfcf1de,0xfaf1e2,0x000000,0xe4e7df,0xb3c0b7,0x577269,0x264f4a,0x6fa5a7,0x75b8c4,0x70bec8,0x67c0c2,0x66c1c0,0x66c1be,0x67c1bc,0x66c0b8,0x65bdb4,0x6dc3b8,0x6fc5ba,0x6dc0b9,0x6fbdba,0x72b9b5,0x6ca7a3,0x588684,0x32504f,0x2d3c3e,0x8c9294,0xcaccce,0xadadad,0x030303,0x111111,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x110f0b,0x040300,0x545449,0xcfcec1,0xf3f1e2,0xf7f2e4,0xf9f2e4,0x000000,0x000000,0x000000,0x000000,0x000000,0xf3eee5,0xe3ded4,0xcec9bf,0x9e9990,0x6e6b61,0x131106,0x020100,0x000100,0x000100,0x000000,0x000000,0x595554,0xccc5c5,0x000000,0x000000,0xc6cec5,0x3e554b,0x49726d,0x76b0ac,0x76beb8,0x6fbfbb,0x67c1bc,0x66c1be,0x66c1c0,0x66c0c2,0x64c2c0,0x64c2c0,0x64c2c0,0x66c1c0,0x69c2c2,0x6bbfc1,0x6bbcbe,0x76b3b3,0x142c24,0xe7e8de,0x000000,0xf5f3e4,0xf7f3e2,0xfaf2e0,0xfcf1de,0xf7f1df,0xf3f3e3,0x000000,0xf0f0e3,0x000000,0xa0b1ab,0x143734,0x6da6a7,0x6eb9bb,0x67c0c0,0x64c2c0,0x67c0be,0x69c0bc,0x6abcb7,0x6dbbb5,0x77c1ba,0x73b4ac,0x6ea298,0x597e76,0x345049,0x20362f,0x84908a,0xc4cac3,0xe9eae3,0x000000,0x000000,0x666666,0x000000,0x262626,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x12110a,0x020100,0x100f04,0x88877c,0xcac7bd,0xece7de,0xf2ede5,0x000000,0x000000,0xe7e4dc,0xc0bcb7,0x74706b,0x120f09,0x090500,0x030000,0x030100,0x030100,0x0f100b,0x202320,0x000000,0x000000,0x101012,0x030003,0x070506,0x878380,0xddd9d4,0x000000,0xdee4db,0x798e89,0x1d433d,0x639690,0x7fbdb8,0x72bcb7,0x6cbfba,0x69c0be,0x66c1c0,0x66c1c0,0x64c1c2,0x64c1c2,0x66c0c2,0x68c1c3,0x6dc0c4,0x6bbabf,0x73aeae,0x1e342c,0xebede3,0x000000,0xf4f2e5,0xf7f2e4,0xfaf1e2,0xfcf1e0,0xfaf2de,0xf7f5e1,0xf7f5e3,0xfaf2e0,0xf7f1e3,0x000000,0x9eb2ab,0x27514c,0x7db8b7,0x74bbba,0x71bcbc,0x74bbba,0x77b9b7,0x71adab,0x578f8c,0x3a6d69,0x0c362f,0x415c4f,0x929f92,0xc3c8bb,0xece9df,0xf3ebe2,0x000000,0x000000,0xf2efe5,0xbbb9b5,0x000000,0x020202,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x1f1d19,0x030200,0x040300,0x020000,0x231f19,0x504c49,0x5c5b57,0x474642,0x14130f,0x020000,0x000000,0x020000,0x13110f,0x1c1a1b,0x242424,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x211c20,0x090607,0x000000,0x0f100b,0x8b8a83,0xcfd0c9,0x000000,0xbccdc7,0x49605d,0x375a57,0x6b9e9a,0x7bbcb6,0x70c1ba,0x68bfb8,0x6ac1bf,0x66bdbd,0x66c1c0,0x65c3c1,0x67c2c1,0x6ac0c1,0x6cbcbe,0x6da8a6,0x3a5048,0x000000,0x000000,0xf4f2e5,0xf6f1e3,0xf9f0e1,0xfbf0df,0xfcf1de,0xfaf2e0,0xfaf2e0,0xfcf1de,0xf9f3de,0xf5f5e5,0xe4efe2,0x4e635c,0x6c8d88,0x769e9a,0x638a88,0x466966,0x203e3a,0x000704,0x122420,0xa2b0ab,0xcfdacf,0xe9f3df,0xf6f9e4,0x000000,0xf6eddd,0xfaf1e4,0xfbf2e5,0x000000,0xcfcec3,0x282824,0x020202,0x242424,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x211f1d,0x0b0907,0x030100,0x000000,0x040202,0x050505,0x000000,0x111111,0x1d1d1d,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x1a1d1c,0x010302,0x000000,0x050805,0x626861,0xabb3ae,0xcfd6d4,0xa6b4b2,0x334e4c,0x36605b,0x629a92,0x79b9b3,0x7bbcbd,0x72bbbc,0x6dbdbc,0x68bdb9,0x68bdb9,0x6abcb9,0x6cb7b7,0x6ea3a1,0x475a54,0xeceee4,0xf0f0e5,0xf4f2e5,0xf6f1e3,0xf7f1e1,0xf9f0df,0xf9f1dd,0xfaf2e0,0xfaf2e0,0xfaf2dc,0xf9f3dc,0xf7f5e1,0xedf2e3,0x96a098,0x000b06,0x000504,0x000101,0x000807,0x000603,0x000100,0x050501,0xc0bcb7,0x000000,0xf7f5e3,0xf5f4e0,0xf7f3e0,0xfaf3e3,0xf9f2e4,0xf4ede1,0xaaa79c,0x1b1a12,0x030401,0x181818,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x242a2d,0x000707,0x000705,0x000300,0x0c110d,0x585c5b,0x838b88,0x525d5c,0x00120e,0x233c3a,0x55797d,0x709fa2,0x7ab5b3,0x79bcb8,0x76beb8,0x78bdb8,0x7ab8b5,0x79a5a1,0x394840,0x000000,0x000000,0xf1eee1,0xf6f1e3,0xf7f1e1,0xf7f1df,0xf7f1df,0xf9f2e2,0xf9f2e2,0xf9f3de,0xf9f3de,0xfaf7e4,0xeeeee0,0xb4b8b0,0x000301,0x000104,0x222629,0x161819,0x000000,0x1e1f1c,0x040200,0x17150f,0xa09e93,0xd8d6c9,0xe1e1d1,0xe0e2d3,0xd5d7cb,0xa6a59c,0x4d4c48,0x090303,0x030000,0x191617,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x202825,0x141915,0x000000,0x020300,0x040200,0x020000,0x000000,0x000203,0x000206,0x000a0e,0x0f3433,0x325e5a,0x2f5f5a,0x305f5a,0x315b58,0x2d4946,0x162018,0xecebe2,0x000000,0x000000,0xf6f1e3,0xf7f1e1,0xf7f1df,0xf7f1df,0xf7f2e4,0xf7f2e4,0xf9f2e0,0xf9f2e0,0xf3efdf,0x000000,0xa7a49e,0x020000,0x111113,0x000000,0x000000,0x000000,0x000000,0x151312,0x000000,0x060500,0x030200,0x050400,0x020600,0x000300,0x000100,0x030303,0x110c0e,0x2d282c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x222222,0x141414,0x060606,0x000100,0x000203,0x000405,0x000304,0x000303,0x000404,0x000505,0x000301,0x000200,0x000000,0xc6c6bd,0x000000,0xf4f2e5,0xf7f2e4,0xf6f2e1,0xf7f1df,0xf9f2e0,0xf9f2e2,0xf7f1e1,0xf7f1e1,0xf5eee1,0x000000,0x000000,0x706a65,0x060100,0x2e2b2c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x141412,0x060604,0x030401,0x020300,0x030401,0x1a1a1a,0x292929,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x100d0e,0x0d0b0c,0x0c0a0a,0x000000,0x241f1f,0x020000,0x74726c,0x000000,0x000000,0x000000,0xf7f2e4,0xf7f1e1,0xf7f1e1,0xf6f0e0,0xfaf3e3,0xf9f2e4,0x000000,0x000000,0xcbc3bf,0x0a0100,0x070100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x050301,0x030100,0xadaaa4,0x000000,0x000000,0x000000,0xf7f2e4,0xf6f1e3,0xf5f0e2,0xf6f1e3,0xf3efe3,0x000000,0xdbd5ce,0x3e3833,0x040000,0x201c1b,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x222021,0x040200,0x060501,0x97938e,0xdfdcd4,0x000000,0x000000,0x000000,0x000000,0xeeecdf,0xece9df,0xb2afa7,0x2a2620,0x080401,0x15100f,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x222222,0x000000,0x000000,0x25231d,0x85847c,0xa9a8a0,0xb4b3a8,0xaaaa9f,0x88877e,0x2f2e25,0x050400,0x040200,0x1e1b1c,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x0f0f0f,0x020300,0x020300,0x000000,0x010300,0x000000,0x060700,0x000100,0x0a0b06,0x292929,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x262924,0x1f231b,0x0f120a,0x23261e,0x21251d,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+};
+const cm::sprite_span spans[] = {
+{69, 17},{62, 28},{58, 35},{53, 14},{69, 6},{84, 1},{87, 8},{50, 14},{67, 6},{83, 5},{90, 7},{115, 6},{47, 15},{64, 8},{75, 13},{92, 6},{113, 10},{44, 17},{64, 5},{71, 14},{88, 1},{92, 1},{94, 6},{112, 13},{41, 18},{62, 29},{92, 3},{96, 5},{111, 8},{121, 5},{38, 20},{61, 15},{77, 11},{89, 2},{92, 4},{97, 5},{111, 15},{36, 22},{60, 6},{67, 29},{99, 4},{110, 17},{34, 22},{57, 41},{99, 5},{110, 17},{32, 23},{58, 4},{63, 37},{101, 4},{110, 4},{115, 13},{30, 24},{58, 2},{63, 33},{97, 3},{101, 5},{110, 14},{125, 3},{28, 26},{55, 5},{63, 38},{103, 4},{110, 14},{125, 3},{26, 27},{54, 5},{64, 35},{100, 1},{102, 1},{104, 3},{110, 4},{115, 8},{125, 3},{25, 27},{53, 7},{61, 39},{101, 3},{105, 3},{111, 4},{117, 6},{125, 3},{23, 30},{55, 48},{106, 3},{111, 5},{119, 4},{125, 3},{22, 32},{55, 2},{58, 44},{106, 3},{112, 5},{118, 1},{120, 3},{124, 3},{21, 30},{52, 1},{54, 50},{107, 3},{113, 6},{120, 3},{124, 3},{20, 30},{54, 51},{107, 3},{114, 4},{119, 3},{124, 3},{19, 31},{52, 53},{108, 3},{114, 4},{119, 3},{123, 3},{18, 31},{51, 54},{108, 3},{113, 8},{122, 4},{17, 32},{50, 5},{58, 47},{109, 3},{113, 8},{122, 3},{16, 35},{52, 3},{59, 48},{108, 8},{117, 3},{121, 4},{15, 33},{49, 58},{108, 7},{117, 3},{121, 3},{15, 33},{49, 65},{117, 2},{120, 3},{14, 3},{18, 30},{49, 65},{118, 5},{13, 35},{49, 5},{55, 58},{116, 1},{118, 4},{13, 3},{17, 30},{48, 7},{56, 58},{117, 4},{12, 3},{17, 37},{55, 54},{111, 3},{115, 5},{12, 3},{16, 32},{50, 69},{11, 4},{16, 32},{50, 4},{55, 63},{11, 3},{16, 31},{48, 7},{56, 61},{11, 4},{16, 31},{49, 6},{56, 59},{10, 3},{14, 33},{49, 65},{10, 37},{51, 63},{10, 3},{14, 33},{50, 4},{55, 59},{10, 3},{14, 33},{48, 66},{10, 2},{15, 32},{48, 66},{9, 3},{13, 34},{48, 66},{9, 5},{15, 39},{55, 1},{57, 51},{109, 5},{9, 47},{57, 51},{109, 5},{9, 39},{49, 7},{57, 57},{9, 39},{49, 60},{110, 4},{9, 5},{15, 33},{50, 2},{53, 56},{110, 4},{9, 5},{15, 35},{51, 57},{109, 4},{9, 5},{15, 36},{52, 57},{110, 3},{9, 5},{15, 37},{54, 6},{61, 46},{110, 3},{9, 3},{13, 45},{59, 47},{110, 3},{9, 3},{13, 38},{52, 2},{55, 4},{60, 2},{63, 43},{107, 1},{109, 3},{9, 3},{13, 38},{53, 1},{55, 5},{61, 1},{63, 43},{107, 1},{109, 3},{10, 2},{13, 38},{52, 3},{56, 4},{61, 1},{63, 43},{108, 3},{10, 3},{14, 1},{16, 36},{55, 4},{61, 1},{63, 43},{108, 3},{10, 4},{15, 37},{53, 10},{64, 46},{10, 43},{54, 2},{57, 4},{65, 38},{105, 5},{11, 45},{58, 4},{65, 39},{106, 3},{11, 43},{55, 1},{57, 46},{105, 4},{11, 3},{16, 40},{60, 43},{104, 4},{12, 3},{17, 39},{58, 1},{60, 5},{66, 36},{103, 4},{5, 10},{18, 88},{3, 12},{16, 1},{19, 43},{63, 4},{68, 29},{98, 7},{2, 14},{19, 39},{60, 2},{64, 4},{69, 35},{2, 16},{20, 37},{58, 4},{65, 28},{94, 9},{1, 16},{20, 37},{59, 3},{66, 25},{92, 1},{94, 8},{1, 12},{14, 4},{21, 41},{64, 3},{68, 5},{75, 8},{84, 6},{91, 1},{94, 7},{0, 3},{4, 16},{21, 54},{76, 1},{78, 1},{81, 8},{90, 1},{92, 7},{0, 15},{16, 4},{22, 31},{54, 3},{58, 8},{68, 20},{89, 9},{0, 52},{53, 1},{55, 13},{69, 3},{75, 21},{0, 3},{4, 48},{53, 2},{57, 13},{71, 1},{73, 3},{78, 16},{0, 3},{4, 15},{21, 3},{28, 23},{52, 2},{57, 20},{78, 2},{86, 6},{1, 17},{21, 5},{28, 23},{52, 2},{56, 22},{83, 7},{1, 50},{52, 2},{56, 32},{1, 49},{51, 4},{56, 30},{2, 11},{14, 13},{29, 21},{51, 5},{57, 27},{3, 7},{15, 13},{30, 20},{51, 6},{58, 1},{60, 19},{81, 3},{4, 7},{13, 10},{25, 5},{31, 19},{51, 9},{61, 16},{79, 4},{5, 15},{26, 6},{33, 16},{51, 23},{75, 3},{79, 4},{7, 9},{28, 43},{72, 10},{30, 19},{51, 16},{68, 13},{32, 18},{52, 9},{62, 3},{69, 11},{36, 14},{51, 9},{62, 3},{71, 7},{43, 3},{47, 3},{53, 6},{61, 3},{48, 3},{54, 5},{60, 4},{48, 5},{57, 6},{49, 13},{51, 10},{53, 5}};
+const uint32_t row_spans[] = {
+0,1,2,3,7,12,17,24,30,37,42,46,52,59,65,74,82,88,96,103,109,115,120,126,132,137,141,145,150,155,160,163,167,171,175,178,180,184,187,190,193,198,201,204,207,212,216,220,225,229,237,245,252,259,263,268,272,276,280,286,288,294,299,304,310,319,327,334,339,346,354,360,363,366,371,378,385,391,394,397,401,405,409,412,414,415,416,417};
+const cm::sprite_item item = {width, height, data, spans, row_spans, 255, rgb};
 }
@@ -1,159 +1,317 @@
 namespace sprite_noki {
 const int width = 192;
 const int height = 152;
-const cm::pixel data[] = {
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 4},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{2, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{3, 4, 4},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 4},{4, 4, 4},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{3, 4, 4},{3, 4, 4},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 4},{4, 4, 4},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{3, 4, 4},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 4},{4, 4, 4},{4, 4, 4},{3, 4, 4},{3, 3, 3},{3, 3, 3},{2, 3, 3},{1, 1, 2},{1, 2, 2},{1, 2, 2},{1, 1, 2},{1, 1, 1},{1, 1, 1},{1, 1, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 3, 3},{3, 3, 4},{3, 4, 4},{4, 4, 4},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 4},{3, 4, 4},{3, 3, 4},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{3, 3, 3},{4, 4, 4},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 4, 5},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 4, 4},{3, 3, 3},{1, 1, 1},{1, 1, 1},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 4, 3},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{2, 3, 3},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 0},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 4},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 4},{3, 4, 4},{3, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{3, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{2, 4, 4},{1, 4, 4},{2, 4, 5},{2, 4, 4},{3, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 4},{3, 4, 5},{4, 4, 4},{3, 3, 3},{1, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{2, 2, 2},{2, 3, 3},{3, 4, 4},{3, 4, 4},{3, 4, 4},{3, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 4},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{2, 4, 4},{1, 4, 4},{1, 3, 4},{1, 3, 4},{3, 4, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 5},{3, 4, 4},{2, 3, 3},{1, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 2, 2},{3, 4, 4},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 4, 4},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{3, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 2, 2},{3, 4, 4},{4, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 4},{3, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 4},{3, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{3, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 4},{2, 4, 4},{3, 5, 5},{3, 4, 5},{5, 5, 5},{4, 5, 5},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{2, 2, 2},{3, 3, 4},{3, 4, 4},{3, 4, 4},{3, 4, 4},{3, 4, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{5, 5, 5},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 4},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 4},{2, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{2, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{3, 5, 5},{2, 3, 3},{2, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{2, 3, 3},{3, 5, 5},{3, 4, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},
-{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{3, 5, 5},{1, 4, 4},{1, 4, 4},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 5, 5},{2, 4, 4},{2, 4, 4},{3, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{2, 3, 4},{2, 3, 4},{2, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{3, 4, 4},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 4},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 4},{2, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{1, 4, 4},{1, 4, 4},{2, 4, 4},{3, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 4},{2, 4, 4},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 4},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{1, 4, 4},{1, 4, 4},{1, 4, 4},{1, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 4},{1, 4, 5},{3, 5, 5},{2, 4, 5},{2, 4, 4},{2, 4, 4},{3, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 4},{1, 4, 4},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 4, 4},{2, 3, 3},{1, 2, 2},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 4},{2, 4, 5},{2, 4, 5},{1, 4, 4},{2, 4, 4},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 3, 4},{2, 4, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 3, 4},{1, 4, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{1, 4, 4},{1, 4, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{2, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 4},{2, 4, 5},{2, 5, 5},{1, 4, 5},{1, 3, 4},{0, 3, 4},{0, 3, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 5},{2, 4, 5},{1, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{4, 5, 5},{5, 5, 5},{3, 4, 4},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{4, 4, 4},{3, 4, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 3, 4},{0, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{4, 5, 5},{3, 3, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 4, 4},{2, 4, 4},{3, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 4},{1, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 4},{3, 4, 4},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 3, 3},{3, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{1, 5, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{2, 3, 4},{1, 1, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 2},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{2, 3, 4},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 4},{2, 4, 4},{2, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 4},{1, 4, 4},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{2, 4, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{3, 4, 4},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 5, 5},{1, 4, 5},{1, 4, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 5},{2, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},
-{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{2, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 3, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 4},{3, 4, 5},{4, 5, 5},{3, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 4},{2, 4, 4},{2, 4, 5},{3, 5, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 5},{0, 3, 4},{1, 4, 4},{2, 4, 5},{3, 5, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 2, 3},{0, 0, 1},{0, 0, 0},{1, 0, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},
-{4, 5, 5},{4, 4, 5},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 4},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 4},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 2, 3},{0, 0, 1},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 4},{0, 3, 4},{1, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 2, 3},{0, 3, 4},{0, 3, 4},{0, 4, 4},{0, 3, 4},{0, 1, 1},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 4},{3, 5, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{1, 4, 4},{2, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 3},{0, 1, 1},{0, 0, 1},{0, 1, 2},{1, 4, 4},{1, 4, 5},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 4},{2, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 2},{1, 4, 4},{1, 2, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 3},{1, 3, 4},{0, 1, 1},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{1, 2, 3},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 3},{2, 4, 4},{0, 2, 2},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},
-{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 1},{1, 2, 3},{1, 3, 4},{1, 3, 3},{0, 0, 1},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 1, 1},{1, 3, 4},{1, 4, 4},{1, 3, 3},{0, 1, 1},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 1},{1, 1, 2},{2, 4, 4},{1, 4, 4},{1, 3, 3},{1, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 5},{0, 3, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{1, 4, 4},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 4},{2, 4, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 2, 3},{0, 1, 1},{0, 0, 0},{1, 1, 2},{2, 4, 4},{1, 3, 3},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{2, 4, 4},{3, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{0, 4, 5},{0, 4, 4},{0, 4, 4},{0, 4, 4},{1, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{1, 2, 2},{2, 4, 4},{1, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 3, 4},{2, 4, 5},{2, 4, 5},{1, 4, 4},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 2, 2},{0, 1, 1},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{2, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 5, 5},{2, 4, 5},{1, 4, 4},{0, 4, 4},{0, 4, 5},{1, 4, 5},{2, 5, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{3, 2, 2},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 2, 3},{1, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 4},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{2, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 2},{3, 3, 3},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 4},{1, 3, 3},{0, 2, 2},{1, 3, 4},{1, 4, 4},{2, 4, 4},{0, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{0, 2, 2},{0, 1, 1},{0, 0, 1},{0, 2, 2},{2, 4, 4},{2, 4, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 2, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 2, 2},{2, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 5, 5},{1, 4, 4},{0, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 4, 4},{3, 4, 5},{3, 4, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{1, 1, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 5, 5},{3, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{0, 2, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{1, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 4},{1, 4, 4},{1, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 4},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{1, 1, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 4, 4},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 4},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{1, 0, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 5, 5},{2, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{3, 4, 5},{2, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 5, 5},{2, 4, 4},{2, 4, 4},{2, 4, 4},{3, 4, 5},{3, 4, 5},{3, 5, 5},{2, 5, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 4},{2, 4, 5},{2, 5, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{1, 4, 4},{1, 3, 4},{2, 4, 5},{3, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 4},{0, 4, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{5, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 1, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{4, 5, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 4},{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{2, 5, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{1, 4, 4},{2, 4, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{2, 5, 5},{2, 5, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 1, 2},{0, 0, 1},{0, 0, 0},{1, 0, 0},{4, 4, 3},{4, 4, 2},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 4},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 2},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 2},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{3, 4, 4},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 4},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 2},{4, 4, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{3, 4, 4},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 2},{4, 4, 3},{4, 4, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 2},{3, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 4},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 5},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 2},{4, 4, 3},{4, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{1, 1, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{1, 4, 4},{1, 4, 4},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 4},{1, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 2},{4, 4, 3},{4, 4, 2},{5, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{1, 4, 4},{1, 4, 4},{2, 4, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{2, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 3, 1},{5, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 4, 4},{3, 4, 5},{3, 4, 5},{2, 4, 5},{1, 4, 5},{1, 4, 4},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 1, 0},{4, 4, 2},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 2},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{3, 5, 5},{3, 5, 5},{3, 5, 5},{1, 4, 4},{1, 3, 4},{1, 3, 4},{1, 4, 5},{2, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{2, 5, 5},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 4},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 4},{0, 1, 1},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 3, 4},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 4},{2, 4, 5},{2, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{2, 4, 5},{3, 4, 5},{3, 4, 5},{1, 2, 2},{0, 0, 0},{0, 0, 0},{2, 2, 1},{5, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 4, 5},{1, 1, 2},{0, 0, 0},{0, 0, 0},{3, 3, 1},{5, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{2, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 1, 1},{1, 1, 1},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{4, 4, 4},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{2, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{4, 5, 5},{1, 2, 2},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{1, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 2},{3, 3, 3},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{2, 4, 5},{3, 4, 5},{0, 1, 2},{0, 0, 0},{1, 1, 0},{4, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{5, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 1, 1},{1, 1, 0},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 4, 5},{1, 3, 3},{2, 2, 3},{3, 4, 3},{4, 4, 3},{4, 3, 2},{3, 3, 1},{3, 3, 1},{3, 3, 2},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{2, 2, 2},{2, 1, 1},{1, 1, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{4, 4, 4},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{2, 4, 4},{3, 4, 4},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 4},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 2},{3, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{2, 3, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 2},{3, 3, 3},{4, 3, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{2, 2, 1},{3, 3, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{1, 1, 1},{1, 1, 1},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{3, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{4, 3, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 3, 3},{2, 2, 2},{1, 1, 1},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 4},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 3},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 2},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{1, 3, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{1, 3, 4},{0, 1, 1},{0, 0, 1},{0, 0, 0},{0, 0, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{1, 3, 5},{1, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 1, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 0, 1},{0, 1, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 3},{3, 3, 2},{3, 3, 3},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 4},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{1, 1, 0},{2, 2, 1},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 4},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{2, 2, 2},{2, 1, 1},{2, 2, 1},{2, 1, 1},{3, 3, 2},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 2},{1, 1, 1},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 2, 3},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 2, 3},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 4},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{2, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{3, 3, 3},{3, 3, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 4},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{3, 3, 3},{3, 3, 3},{4, 3, 3},{4, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 2},{1, 1, 1},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{1, 1, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 3, 3},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 2},{3, 2, 2},{3, 2, 2},{3, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{1, 1, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 2, 2},{2, 2, 1},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{1, 1, 0},{1, 1, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{2, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 0, 1},{0, 0, 1},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 1},{0, 1, 1},{1, 4, 4},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 1},{0, 1, 1},{1, 4, 4},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},
-{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{1, 4, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{2, 2, 1},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 3, 4},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 3, 3},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{3, 3, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 2, 2},{3, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{2, 2, 2},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 3, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{2, 2, 1},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 2, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{1, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{3, 2, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{1, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{1, 1, 1},{1, 1, 0},{1, 1, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{2, 2, 1},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{3, 3, 2},{2, 2, 2},{3, 3, 2},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 1},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 2, 2},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 2, 2},{2, 2, 1},{2, 2, 2},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{3, 2, 2},{3, 3, 3},{1, 1, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 2, 2},{2, 2, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{2, 1, 1},{1, 1, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 5},{1, 3, 3},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{3, 2, 2},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 1, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{3, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 3, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 3, 3},{3, 3, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 3},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 3},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 4, 4},{0, 1, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 1},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 3, 4},{0, 3, 5},{0, 3, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 3},{3, 3, 3},{2, 2, 2},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{4, 4, 4},{3, 3, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{3, 3, 2},{3, 3, 2},{2, 2, 2},{2, 2, 1},{1, 1, 0},{1, 1, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 2},{3, 3, 2},{3, 3, 3},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 2},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 4, 5},{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{3, 3, 3},{4, 4, 4},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 2, 2},{2, 2, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 2},{3, 3, 3},{3, 3, 3},{4, 4, 3},{3, 3, 3},{3, 3, 3},{3, 3, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{1, 1, 1},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{1, 1, 0},{2, 2, 1},{3, 2, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{1, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 4, 5},{0, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{3, 3, 2},{3, 3, 3},{4, 3, 3},{4, 3, 3},{4, 3, 3},{4, 4, 3},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 1},{0, 2, 3},{0, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 3, 5},{0, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{3, 2, 2},{2, 2, 1},{2, 2, 1},{3, 2, 2},{2, 2, 2},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 1, 1},{0, 2, 3},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 3, 4},{0, 1, 2},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 3, 4},{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{2, 2, 2},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 4, 5},{0, 2, 3},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{3, 3, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 1},{0, 0, 0},{0, 0, 0},{0, 1, 2},{1, 4, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 3, 4},{0, 1, 2},{0, 0, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 4, 3},{4, 3, 3},{3, 3, 2},{3, 3, 2},{3, 2, 2},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{1, 3, 4},{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{2, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{1, 1, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 1},{3, 3, 2},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 2},{2, 2, 2},{1, 1, 0},{0, 0, 0},{0, 0, 1},{0, 2, 2},{1, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 2, 3},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 1, 1},{1, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{3, 3, 2},{3, 3, 2},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 2},{3, 3, 2},{3, 2, 2},{1, 0, 0},{0, 0, 0},{2, 2, 2},{3, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 1},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 2, 2},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 3, 2},{3, 3, 2},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 2},{3, 3, 2},{2, 2, 1},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{2, 2, 1},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 1, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 2},{4, 3, 2},{4, 3, 2},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 2},{2, 2, 1},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{1, 1, 1},{0, 0, 0},{1, 0, 0},{2, 2, 2},{3, 2, 2},{2, 2, 1},{2, 2, 1},{1, 1, 0},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 3},{2, 2, 2},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 1, 1},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 3, 2},{3, 3, 2},{1, 1, 0},{0, 0, 0},{1, 0, 0},{3, 2, 2},{3, 3, 2},{3, 3, 2},{3, 3, 1},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{2, 1, 1},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 2, 2},{2, 2, 1},{3, 2, 2},{2, 2, 1},{0, 0, 0},{1, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{4, 4, 2},{4, 4, 3},{4, 4, 3},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{4, 3, 2},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{2, 1, 1},{0, 0, 0},{1, 0, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 1},{3, 3, 2},{1, 1, 1},{0, 0, 0},{1, 1, 0},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{3, 3, 2},{4, 3, 2},{4, 4, 2},{4, 4, 3},{4, 4, 3},{3, 3, 2},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{2, 2, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{1, 1, 0},{1, 1, 1},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 1, 1},{1, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{1, 1, 0},{0, 0, 0},{1, 1, 0},{4, 3, 3},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{1, 1, 1},{0, 0, 0},{1, 1, 0},{3, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{3, 3, 2},{0, 0, 0},{1, 1, 0},{4, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{1, 1, 0},{0, 0, 0},{0, 0, 0},{1, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{1, 1, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 2, 2},{2, 2, 2},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 2, 3},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
-{0, 0, 1},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 0, 0},{1, 1, 0},{2, 1, 1},{2, 2, 1},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 0},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{1, 1, 0},{0, 0, 0},{1, 0, 0},{3, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 3},{1, 1, 1},{0, 0, 0},{2, 2, 1},{4, 4, 3},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{3, 3, 2},{0, 0, 0},{0, 0, 0},{3, 3, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{4, 4, 2},{2, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 1},{2, 2, 1},{1, 1, 1},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 1},{2, 1, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{2, 2, 1},{1, 2, 2},{1, 2, 2},{0, 1, 1},{0, 0, 0},{0, 0, 1},{1, 3, 3},{0, 3, 4},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},{0, 4, 5},
+const uint8_t data[] = {
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,255,179,179,179,179,255,255,255,255,255,255,255,255,255,179,255,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,173,255,255,179,179,173,179,255,255,255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,143,143,179,179,179,137,143,143,137,143,179,179,179,179,179,179,179,143,136,136,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,173,179,179,179,179,179,179,255,255,255,255,255,255,255,255,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,143,179,143,137,137,143,143,137,179,179,179,173,179,179,179,143,136,137,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,172,179,179,179,255,255,179,255,255,255,255,255,255,255,255,179,172,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,179,173,173,179,179,179,179,179,179,179,179,179,179,179,179,179,179,143,143,143,137,143,143,179,137,173,173,173,173,179,179,143,137,137,179,179,179,173,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,173,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,173,136,173,179,179,179,179,179,173,173,179,179,179,179,179,179,179,137,137,137,143,143,143,143,143,143,143,143,179,179,179,179,173,137,173,179,179,136,100,137,179,179,179,137,179,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,173,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,172,136,172,179,179,179,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,136,137,179,179,179,179,179,179,179,179,179,179,179,179,179,179,137,136,137,143,143,143,179,143,143,179,179,179,179,179,179,179,179,179,179,179,137,100,179,179,179,143,137,143,172,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,172,173,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,137,137,173,179,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,172,179,179,179,179,179,255,179,179,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,172,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,179,173,179,179,179,179,179,179,179,179,179,179,179,179,179,179,143,137,137,143,137,137,179,179,179,179,179,173,179,179,179,179,179,137,143,137,136,136,179,179,173,137,137,136,172,172,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,136,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,179,179,255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,173,173,179,255,255,255,179,255,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,255,255,255,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,179,179,179,179,179,179,179,179,179,179,179,179,179,173,179,179,173,179,136,136,179,255,179,179,179,173,173,172,172,172,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,172,179,179,179,179,136,173,179,179,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,179,179,255,255,255,255,179,172,179,179,179,179,179,255,255,179,179,179,179,179,173,179,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,173,179,255,255,255,255,255,255,255,255,255,255,255,255,179,179,179,136,136,137,137,137,137,143,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,172,172,172,136,129,129,93,44,50,50,44,43,43,44,86,86,86,86,93,130,136,172,179,255,179,179,255,179,179,179,179,179,179,255,255,255,255,179,179,179,179,255,255,255,255,255,255,255,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,255,179,255,179,179,173,173,179,179,179,179,179,255,255,255,255,255,255,255,255,255,
+179,255,255,255,255,255,255,255,255,255,255,255,255,179,179,255,255,255,179,179,179,179,179,179,179,255,255,255,179,179,179,179,179,179,255,179,255,255,255,179,255,255,255,255,255,255,255,255,255,179,173,173,173,179,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,137,137,137,137,137,137,137,143,179,179,179,179,179,179,255,255,255,255,255,172,136,130,86,86,43,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,86,86,129,172,179,172,179,255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,179,172,179,179,179,173,179,255,255,255,255,255,255,255,255,
+179,179,255,255,255,255,255,255,255,255,255,255,255,179,179,179,255,255,255,179,179,179,179,179,179,179,255,255,179,179,179,179,179,179,255,179,255,255,255,179,255,255,255,255,255,255,255,173,179,179,173,137,137,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,179,143,137,137,137,137,137,101,137,137,173,179,173,178,179,179,172,129,43,43,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,86,135,172,179,179,179,179,179,179,143,137,137,137,137,143,137,137,179,179,179,137,137,143,137,137,179,179,255,255,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,255,255,255,255,255,255,179,172,179,179,179,179,179,179,255,255,255,255,255,255,255,
+179,179,179,255,255,255,255,255,255,255,255,255,255,255,179,179,179,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,255,179,255,255,255,255,255,255,255,255,255,255,255,173,173,179,179,143,137,143,179,179,179,255,255,255,255,255,255,255,255,255,255,255,179,179,143,137,143,137,137,137,137,179,179,179,172,93,86,86,43,0,0,0,0,0,0,0,0,0,0,0,36,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,42,36,36,0,0,0,0,0,0,0,0,0,0,86,129,172,255,179,179,137,136,136,136,137,101,101,137,143,179,179,137,137,137,137,137,143,179,179,179,173,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,179,173,179,179,255,179,255,255,179,179,179,179,179,172,136,179,255,255,255,255,255,255,255,
+255,179,179,172,179,255,255,255,255,255,255,255,255,255,179,179,172,179,255,179,179,173,179,179,179,179,179,179,179,179,173,173,173,179,255,179,179,179,179,255,255,255,179,255,255,179,179,136,179,179,137,143,100,64,101,100,136,179,255,255,255,255,255,255,255,255,255,255,179,179,179,137,137,137,137,136,137,172,129,50,43,0,0,0,0,0,0,0,36,42,42,43,43,85,85,85,85,86,86,86,86,86,85,85,85,85,85,85,85,85,85,85,85,85,79,79,79,43,43,42,0,0,0,0,0,0,0,0,7,86,93,136,136,136,143,143,137,100,100,101,101,137,143,143,143,143,137,137,137,137,137,137,136,179,179,179,179,179,255,255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,179,255,255,255,255,255,179,179,179,136,179,179,255,255,255,255,179,172,
+255,255,255,179,173,179,255,255,255,255,255,255,255,179,179,179,179,179,179,179,179,136,179,179,179,179,179,179,179,179,179,173,179,179,255,255,255,179,179,179,255,179,179,255,255,179,172,136,179,179,137,143,100,64,58,58,137,255,255,255,255,255,255,255,255,255,179,179,179,179,179,137,136,137,136,93,50,43,0,0,0,0,0,0,36,36,43,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,43,43,42,0,0,0,0,0,0,7,50,136,179,179,143,137,143,143,137,143,137,143,143,143,143,137,137,137,143,143,137,137,137,173,179,179,179,179,179,179,255,179,179,255,179,179,172,172,179,179,179,179,179,255,255,255,255,255,179,179,179,136,179,179,255,255,255,255,255,179,
+255,255,255,255,179,179,179,179,179,179,179,179,179,179,179,179,179,137,143,179,179,179,179,179,173,179,179,179,179,179,179,143,179,179,179,255,255,179,179,179,179,179,179,255,255,255,179,179,179,179,179,143,65,65,65,101,179,255,255,255,255,255,255,255,179,143,143,179,136,179,255,179,172,129,7,0,0,0,0,0,0,42,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,42,0,0,0,0,0,1,50,136,173,137,137,143,143,143,143,143,137,143,143,137,143,179,137,143,179,143,137,137,173,179,179,255,255,179,179,179,179,255,255,255,179,179,173,179,179,179,179,255,255,255,255,179,179,179,179,179,179,179,255,179,179,255,255,255,
+255,255,255,255,255,255,179,179,173,136,143,179,137,137,143,179,179,143,137,137,143,179,179,179,143,179,179,179,179,143,143,143,136,143,179,179,255,179,179,173,173,137,179,179,179,179,179,179,179,179,179,101,64,65,65,137,179,255,255,255,255,255,255,179,143,100,100,143,137,255,179,129,43,0,0,0,0,0,36,43,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,42,0,0,0,0,0,7,86,130,136,136,136,136,143,143,143,143,143,143,143,179,137,137,137,137,143,179,179,179,179,179,255,255,179,179,179,255,255,255,179,179,179,179,179,179,179,179,255,255,255,179,179,172,179,179,179,255,255,179,172,179,179,255,
+179,255,255,255,255,179,179,179,179,101,64,101,101,101,101,137,179,143,143,137,137,137,137,143,143,143,143,143,143,143,143,143,143,100,100,179,179,179,179,179,179,143,136,137,173,179,179,179,179,179,179,101,64,65,65,101,179,255,255,255,255,255,255,179,137,100,101,143,93,93,43,0,0,0,0,36,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,0,0,0,7,93,143,136,143,143,143,137,143,143,137,179,179,143,137,137,137,137,137,137,179,179,179,179,179,179,179,255,255,179,179,179,255,255,255,255,255,179,172,179,255,179,179,179,179,179,179,179,179,255,179,179,179,179,
+172,179,255,255,255,179,173,179,143,64,64,101,101,101,101,101,137,143,137,137,137,137,137,137,137,179,179,179,137,137,143,143,143,107,100,100,143,143,179,179,179,143,136,179,179,179,179,137,137,179,143,101,65,65,101,101,179,255,255,255,255,255,179,137,101,94,94,87,0,0,0,0,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,0,0,0,0,0,50,136,255,179,179,179,179,143,136,137,179,143,143,137,137,137,137,137,137,137,143,143,137,143,179,179,179,179,179,179,255,255,255,255,255,255,255,255,179,179,179,179,179,179,179,173,179,179,179,179,179,172,
+179,255,255,255,255,179,179,100,101,65,65,101,143,143,101,101,101,101,143,137,137,143,143,137,137,179,179,143,143,137,101,101,107,107,101,64,64,100,143,179,179,100,136,179,179,179,179,100,100,101,101,65,65,65,101,137,137,255,255,255,179,179,179,137,137,50,0,0,0,0,0,36,43,79,85,85,85,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,43,0,0,0,0,43,172,255,179,179,179,179,137,137,143,137,143,143,137,137,101,101,101,101,101,101,101,101,136,179,179,179,179,179,179,255,255,255,179,179,255,179,179,179,179,179,179,179,255,255,255,179,179,179,255,255,
+179,255,255,255,255,255,179,137,100,65,65,65,107,107,101,65,65,65,101,143,101,101,143,143,143,137,137,101,143,143,64,64,64,65,101,65,64,64,65,143,101,100,100,143,179,179,143,101,64,64,64,65,65,65,101,143,137,179,255,255,179,136,93,50,7,0,0,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,43,0,0,0,43,129,179,255,179,179,179,179,179,137,136,137,143,143,101,101,101,101,100,101,101,64,100,101,137,143,143,137,137,179,179,179,179,179,179,179,179,179,179,179,173,179,179,255,255,255,255,179,255,255,
+179,179,255,255,255,255,179,179,137,101,101,65,65,65,65,65,65,65,101,107,101,64,101,143,143,143,101,58,101,107,65,29,22,65,107,65,29,29,29,65,101,107,64,64,143,143,143,107,101,65,65,65,65,65,65,101,143,179,255,255,179,93,43,0,0,0,0,42,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,86,179,179,179,179,179,179,143,137,137,179,143,101,101,65,101,101,101,65,64,65,65,101,101,107,101,101,137,143,179,179,179,179,179,137,179,179,179,255,255,255,255,255,255,255,255,255,179,
+255,255,255,255,255,255,179,179,143,143,101,101,65,65,65,65,65,65,65,65,65,64,64,101,107,65,58,22,23,65,65,29,29,65,107,65,29,29,29,29,65,65,65,64,65,101,65,101,65,65,65,107,65,65,65,101,143,179,255,136,50,0,0,0,0,42,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,85,43,0,0,0,0,50,172,136,143,143,143,143,137,143,143,143,101,64,101,143,143,101,65,29,29,65,65,65,65,65,101,101,101,143,143,143,179,143,136,173,179,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,179,179,179,179,143,101,101,65,65,65,65,65,65,65,65,65,65,29,29,29,29,23,29,29,29,29,29,29,65,65,65,29,29,29,29,29,65,65,29,22,29,65,29,65,65,107,65,65,65,101,143,179,130,43,0,0,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,0,0,86,136,100,137,101,101,65,101,107,101,64,64,101,143,143,143,101,65,29,29,29,65,65,29,65,101,101,101,101,143,143,143,137,173,179,179,179,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,179,173,179,143,143,143,101,101,101,101,101,65,65,29,65,101,65,65,29,29,29,29,29,29,29,29,29,29,29,29,65,107,29,29,29,65,65,29,65,29,29,29,29,29,29,65,65,101,65,101,100,136,50,0,0,0,36,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,93,137,101,101,65,65,29,65,65,65,65,101,137,143,143,101,29,29,65,29,29,29,29,29,65,65,65,65,101,143,143,137,137,179,179,179,173,179,255,255,255,255,255,255,255,
+255,179,179,255,255,179,179,137,100,101,143,101,101,101,101,101,101,65,29,65,101,101,65,65,29,65,29,29,29,65,65,29,29,29,65,65,65,29,29,65,107,71,65,65,29,29,29,29,29,29,29,65,101,101,143,94,44,0,0,0,36,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,86,85,36,0,0,1,94,143,101,65,65,29,29,29,65,65,101,143,143,143,65,29,29,65,65,65,65,29,29,29,29,29,29,65,101,143,143,137,179,179,179,179,179,255,255,255,255,255,255,255,
+255,255,255,179,179,179,179,143,101,101,101,101,101,101,107,101,101,65,65,65,101,101,65,65,65,65,29,29,29,65,65,65,29,29,65,65,29,29,65,65,65,65,65,65,29,29,29,29,29,29,29,65,64,100,94,7,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,36,43,85,85,36,0,0,7,137,101,65,65,29,29,29,29,65,101,107,101,65,65,29,29,29,29,65,65,65,29,29,29,29,29,29,65,65,101,137,143,179,179,179,179,179,179,179,255,255,255,255,
+255,255,255,173,173,179,179,179,137,101,65,65,65,101,143,143,101,101,101,101,101,101,101,65,65,65,29,29,29,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,28,64,57,7,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,36,79,79,0,0,0,8,100,65,29,29,29,29,29,65,65,65,65,29,29,29,29,29,29,65,65,29,29,23,29,29,29,29,29,65,101,101,143,179,179,136,137,179,179,179,179,255,255,179,
+255,255,255,173,136,137,137,143,137,101,65,65,65,65,101,107,107,107,101,137,101,101,101,65,65,65,65,65,65,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,64,58,7,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,43,43,0,0,0,14,65,29,29,29,29,29,71,65,65,23,29,29,29,29,29,65,107,65,29,29,29,29,29,29,29,29,29,65,65,107,143,143,143,101,100,137,179,179,179,255,255,
+179,255,255,179,137,137,143,143,143,143,101,101,65,65,65,64,65,101,143,179,179,143,101,65,65,65,65,65,65,65,65,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,58,7,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,0,0,1,15,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,29,29,29,29,29,29,29,29,29,29,29,29,65,101,107,107,101,101,101,101,137,179,179,179,
+179,255,255,179,179,136,100,137,143,143,101,101,65,65,65,29,23,64,101,143,179,143,101,65,65,65,65,65,65,65,65,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,58,14,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,0,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,101,101,65,107,101,100,137,179,137,
+179,179,179,179,179,143,100,100,101,143,107,101,101,101,65,29,23,23,22,64,101,143,107,101,101,101,65,65,65,65,65,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,58,15,1,0,37,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,1,14,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,29,29,65,65,65,65,65,101,101,101,101,101,101,
+179,173,136,179,179,179,137,100,100,65,65,101,107,101,101,65,29,29,29,28,65,101,101,101,101,65,65,65,65,29,65,29,29,29,29,29,29,29,29,29,29,29,29,65,65,29,29,29,64,15,1,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,65,65,65,65,65,65,65,65,65,65,65,101,
+179,179,179,137,136,143,179,137,101,64,22,65,143,143,143,65,29,29,29,65,65,65,101,101,101,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,58,15,22,22,28,22,7,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,65,65,65,65,29,29,29,29,29,65,65,
+179,179,179,179,137,136,143,143,107,65,29,64,107,143,143,101,29,29,65,65,65,65,101,107,101,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,15,7,1,8,64,65,8,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,0,1,14,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,101,101,101,65,65,29,29,29,29,29,29,65,
+179,179,179,179,179,137,137,143,107,65,65,64,64,101,107,65,65,65,65,65,65,101,101,101,107,65,65,29,29,29,29,29,29,29,29,29,29,29,29,29,65,57,7,0,0,14,64,51,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,1,15,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,143,143,101,101,65,65,65,29,29,29,29,
+179,179,179,179,179,143,137,137,101,101,101,65,64,65,65,65,65,65,65,101,101,101,101,101,107,65,65,29,29,29,29,29,29,29,29,29,29,29,29,65,58,7,0,0,7,57,58,7,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,7,58,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,107,143,143,143,107,101,65,65,65,29,29,
+179,179,179,179,179,179,143,137,143,143,137,101,101,65,65,65,65,65,101,101,101,101,101,101,101,65,65,29,29,29,29,29,29,65,65,65,29,29,29,64,51,0,0,7,57,100,14,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,7,22,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,101,143,143,143,143,101,101,65,65,29,
+179,143,136,136,179,179,179,143,143,143,143,101,101,101,65,65,65,65,101,101,101,101,101,65,65,29,29,29,29,29,29,65,65,65,65,65,29,29,65,58,8,0,1,51,58,57,1,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,8,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,23,65,101,143,143,143,107,65,29,29,
+179,143,137,136,137,179,179,179,143,137,143,143,143,101,101,65,65,101,101,101,101,65,65,65,29,29,29,29,29,29,65,65,65,65,65,65,65,29,65,58,7,0,7,58,64,57,7,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,23,65,65,65,65,107,29,29,29,
+179,179,179,137,137,179,179,143,143,137,137,143,143,143,101,65,65,101,101,101,101,65,65,29,29,29,29,65,65,65,65,65,65,65,65,65,65,65,65,15,1,1,44,100,64,57,50,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,23,23,23,23,29,29,29,29,
+179,179,143,143,101,143,143,64,64,65,65,64,101,107,107,101,65,65,101,101,65,65,29,29,29,65,65,101,101,101,101,101,65,65,65,65,65,65,65,51,7,0,44,100,57,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,0,50,64,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+100,143,137,100,101,101,101,65,64,29,28,28,28,65,101,65,65,65,101,101,65,65,65,29,65,65,101,107,101,101,101,101,65,65,65,65,65,65,65,15,1,0,50,100,50,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,79,85,85,85,85,85,85,85,79,79,43,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+58,101,101,64,65,101,101,65,65,29,29,29,29,65,65,65,65,65,101,101,101,65,65,65,65,101,101,101,101,101,101,65,65,65,65,65,65,65,65,14,0,0,50,86,7,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,42,79,85,85,85,85,85,79,36,0,0,0,42,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,8,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+101,64,65,65,65,65,107,65,65,29,29,29,29,29,29,65,65,65,101,101,101,101,101,101,101,101,101,101,101,101,65,65,65,65,65,65,65,65,101,51,1,0,0,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,43,85,85,85,85,85,79,42,0,0,36,0,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,1,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+143,101,64,28,29,65,107,107,65,29,29,29,29,29,29,29,65,101,101,101,101,101,101,101,101,101,101,101,101,65,65,65,65,65,65,65,65,65,101,51,0,0,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,43,85,85,85,85,85,79,79,79,122,122,42,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,15,59,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,101,64,29,65,65,65,65,29,29,29,29,29,29,29,65,65,101,101,101,101,101,101,101,65,65,65,65,65,65,65,29,28,65,65,65,65,64,94,7,0,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,36,79,85,85,85,85,85,79,85,86,129,128,128,43,0,0,36,79,85,85,85,85,85,85,85,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,101,65,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,101,101,101,101,65,65,65,65,65,65,65,29,65,64,64,57,14,58,64,100,14,0,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,43,43,43,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,36,79,85,85,85,85,85,85,42,42,86,128,128,128,85,0,0,36,79,85,85,85,85,79,36,0,0,0,36,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,1,14,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,143,65,29,29,29,29,29,29,29,29,29,29,29,65,29,28,65,65,65,101,101,65,65,65,65,65,65,65,65,65,64,14,7,1,14,100,100,7,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,42,0,0,0,0,0,36,42,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,79,86,43,0,36,79,85,85,85,85,85,79,0,0,85,128,128,128,128,79,0,0,36,79,85,79,42,0,0,0,0,0,0,36,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,1,8,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,179,143,65,65,29,29,29,29,29,29,29,65,29,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,15,7,0,0,0,50,93,43,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,0,0,0,0,0,0,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,86,43,0,36,79,85,85,85,85,79,36,0,42,128,128,128,128,128,122,42,0,0,36,79,42,0,0,0,0,0,0,0,0,0,0,42,43,85,85,85,85,85,85,85,85,85,85,85,85,36,0,1,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,179,143,107,64,28,29,29,29,29,29,29,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,58,7,0,0,0,86,86,0,0,0,0,36,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,86,43,0,36,79,85,85,85,85,43,0,0,128,171,165,128,128,128,128,86,0,0,0,42,42,0,0,0,0,0,36,0,0,0,0,0,36,42,85,85,85,85,85,85,85,85,85,85,85,42,0,1,15,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+136,137,137,179,143,143,101,65,65,65,29,29,29,29,65,65,65,65,65,65,65,65,65,29,29,65,65,65,65,65,58,8,0,0,0,86,128,0,0,0,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,0,36,42,42,43,43,36,0,0,0,0,0,36,36,43,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,36,122,42,0,36,79,85,85,85,85,36,0,85,171,165,165,165,128,128,128,128,79,0,0,0,0,0,0,36,42,79,85,43,36,0,0,0,0,0,79,85,85,85,85,85,85,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+143,137,101,143,143,179,143,137,101,65,29,29,29,29,65,29,29,29,65,65,65,65,65,65,65,65,65,29,65,101,14,1,0,0,85,129,43,0,0,0,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,42,85,85,85,85,85,79,43,0,0,0,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,85,128,36,0,36,85,85,85,85,43,0,0,128,171,171,165,165,128,128,128,128,86,36,0,0,0,0,42,79,85,85,85,86,43,0,0,0,0,0,79,85,85,85,85,85,85,85,85,85,85,79,0,0,7,22,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,137,100,137,179,179,179,143,65,29,29,29,29,65,65,29,65,65,65,65,65,65,65,65,65,65,28,64,51,1,0,0,42,171,43,0,0,0,0,0,36,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,0,0,0,43,85,85,85,85,85,85,85,85,79,42,36,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,42,128,86,0,0,36,85,85,85,79,36,0,79,171,171,171,171,171,128,128,128,128,128,85,0,0,0,0,43,85,85,85,85,43,0,0,0,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,137,100,143,179,179,179,101,65,28,29,29,65,65,65,65,65,65,65,65,65,65,65,65,65,101,57,7,0,0,42,128,85,0,0,0,0,0,0,43,43,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,0,42,85,85,85,85,85,85,85,85,85,79,85,79,79,42,79,79,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,122,129,86,0,0,36,85,85,85,43,0,0,128,171,171,171,171,171,165,128,128,128,128,85,0,0,0,42,85,85,85,85,85,43,0,0,43,43,43,79,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,8,59,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+136,179,179,143,137,101,137,179,179,179,143,101,65,65,29,65,65,65,65,65,65,65,65,65,65,65,101,57,1,0,0,0,86,86,0,0,0,0,0,0,0,43,43,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,86,171,129,85,0,0,43,85,85,79,0,0,43,171,171,171,171,171,171,171,129,128,128,128,85,42,0,0,36,79,85,85,85,85,79,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,8,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+136,137,143,143,143,101,100,143,179,179,179,143,101,65,29,65,65,65,65,65,29,65,65,65,65,101,57,1,0,0,0,86,171,42,0,0,43,43,0,0,0,43,43,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,85,171,171,129,79,0,0,43,85,79,42,0,36,165,171,171,171,171,171,171,171,171,128,128,128,128,86,0,0,0,43,85,85,85,85,85,0,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,1,57,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+143,100,101,143,143,137,101,101,137,143,137,143,143,65,29,65,65,65,65,65,65,65,65,65,101,101,50,0,0,0,85,171,86,0,0,0,43,85,0,0,43,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,0,43,165,171,129,128,43,0,0,43,85,43,0,0,42,171,171,171,171,171,171,171,171,171,128,128,128,128,128,43,0,0,42,85,85,85,85,85,43,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,0,0,51,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,137,100,137,143,143,107,100,100,100,137,137,143,107,64,65,65,65,65,65,65,65,65,65,101,57,7,0,0,42,171,171,42,0,0,43,85,79,0,0,36,43,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,42,129,171,171,165,128,42,0,0,43,79,0,0,36,86,171,171,171,171,171,171,171,171,171,165,128,128,128,128,86,36,0,0,79,85,85,85,85,79,42,0,0,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,137,100,100,101,107,107,101,101,101,101,143,143,101,65,65,65,65,65,65,65,65,65,58,7,0,0,36,128,171,128,0,0,0,43,86,79,0,0,0,36,42,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,79,85,85,43,0,0,0,86,165,165,171,171,128,42,0,0,43,43,0,0,43,165,171,171,171,171,171,171,171,171,171,165,128,128,128,128,128,43,0,0,43,85,85,85,85,85,43,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,137,101,101,101,107,143,143,101,101,101,143,107,65,65,65,65,65,65,65,65,64,51,0,0,0,85,171,171,42,0,0,0,79,85,85,36,0,0,0,36,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,36,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,79,85,43,0,0,0,79,171,171,171,171,171,86,0,0,0,43,36,0,0,122,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,85,0,0,42,85,85,85,85,85,43,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,143,101,65,65,64,101,143,143,137,100,101,65,65,29,29,29,29,29,65,65,100,8,0,0,42,165,171,171,36,0,0,43,85,85,85,43,0,0,36,42,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,79,0,0,0,42,165,171,171,171,171,171,86,0,0,0,43,0,0,42,165,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,86,0,0,36,85,85,85,85,85,43,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,179,143,107,65,64,58,101,143,179,137,101,64,29,23,29,29,29,29,65,65,14,0,0,0,85,207,171,85,0,0,0,85,85,85,79,79,43,43,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,43,85,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,36,129,171,171,171,171,171,129,43,0,0,0,36,0,0,86,171,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,36,0,0,79,85,85,85,85,43,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,6,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,255,179,179,179,143,101,65,65,65,101,143,143,143,65,29,29,65,65,65,65,64,58,7,0,0,36,128,171,165,42,0,0,42,85,85,85,85,79,79,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,42,122,171,171,171,171,171,171,128,42,0,0,0,0,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,129,42,0,0,43,85,85,85,85,43,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,1,8,59,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,255,255,179,179,143,101,101,101,101,101,101,179,143,107,65,29,65,65,107,101,64,14,0,0,36,128,171,171,85,0,0,0,43,85,79,85,85,79,79,79,79,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,122,171,171,171,171,171,171,171,128,0,0,0,0,0,0,79,165,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,128,128,128,43,0,0,42,85,85,85,85,43,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,43,0,0,8,59,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,255,255,179,179,179,143,143,101,101,101,64,101,143,107,65,29,29,29,65,101,94,7,0,0,42,171,171,170,42,0,0,43,85,85,85,85,85,85,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,86,171,171,171,171,171,171,171,171,79,0,0,0,0,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,43,0,0,42,85,85,85,85,79,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,255,179,179,179,179,179,179,143,101,101,64,101,101,107,101,65,29,29,65,65,58,1,0,0,122,171,171,164,36,0,0,43,85,85,85,85,85,85,85,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,79,171,171,171,171,171,171,171,171,129,42,0,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,85,0,0,42,85,85,85,85,85,36,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,179,179,179,179,179,179,143,137,100,101,107,107,65,65,65,29,29,65,8,1,0,36,171,170,171,85,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,86,171,171,171,170,170,171,171,171,171,86,0,0,0,0,0,36,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,128,128,85,0,0,36,85,85,85,85,79,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,179,179,179,179,179,179,179,179,137,100,101,101,65,65,65,29,29,64,8,0,0,79,171,170,171,42,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,85,171,171,171,171,171,171,170,171,171,129,43,0,0,0,0,0,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,79,0,0,36,85,85,85,85,43,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,136,172,179,255,255,255,255,255,179,179,137,101,65,65,65,65,65,64,57,1,0,0,122,171,170,170,36,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,36,86,165,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,128,128,43,0,0,36,85,85,85,85,85,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,136,172,179,255,255,255,255,255,255,179,143,101,65,64,65,65,65,58,14,0,0,42,164,170,170,171,42,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,36,85,171,171,171,171,171,171,171,171,171,171,171,85,0,0,0,0,0,86,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,128,128,43,0,0,36,85,85,85,85,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+255,179,179,179,173,137,179,179,179,255,179,143,137,137,101,101,65,65,65,58,7,0,0,85,171,170,171,170,36,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,36,122,171,171,171,171,171,171,171,171,171,171,171,165,43,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,43,0,0,43,85,85,79,86,129,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,179,179,136,137,143,179,179,179,143,101,101,137,137,101,65,65,57,7,0,0,128,171,170,171,164,36,0,0,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,43,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,42,36,0,0,0,122,171,171,171,171,171,171,171,171,171,171,171,165,128,0,0,0,0,42,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,128,42,0,0,79,85,85,42,43,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,179,179,179,143,137,137,143,179,143,64,64,137,143,143,143,101,100,50,0,0,42,170,171,170,207,85,0,0,36,79,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,0,0,0,0,86,129,171,171,171,171,171,171,171,171,171,171,171,165,129,85,0,0,0,0,128,171,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,36,0,0,79,85,43,0,0,43,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,136,137,179,179,179,143,101,137,143,137,64,64,101,143,179,143,143,93,1,0,0,91,207,170,170,170,42,0,0,43,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,165,128,128,42,0,0,42,122,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,85,85,42,0,42,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+179,179,137,143,137,143,143,101,100,137,137,101,65,64,101,143,143,143,50,0,0,6,170,171,170,170,171,79,0,0,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,0,0,0,0,42,128,171,171,171,171,171,171,171,171,171,171,171,171,171,129,128,43,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,79,0,0,0,86,43,0,0,86,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,14,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+143,143,143,64,58,58,65,101,101,143,143,101,107,101,101,101,137,137,7,0,0,86,170,170,170,170,171,79,0,0,0,36,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,43,43,0,0,0,0,42,128,165,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,43,0,0,0,42,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,43,86,0,0,43,129,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,0,8,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+64,65,65,29,29,29,29,65,101,143,143,137,143,101,101,137,137,136,7,0,42,171,170,170,170,170,164,42,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,43,85,85,85,85,85,85,85,85,85,85,79,43,43,0,0,0,0,0,85,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,86,36,0,0,42,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,43,0,0,36,0,0,0,128,172,86,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+22,23,29,29,29,29,29,29,28,101,101,137,143,143,101,137,137,50,0,0,85,207,170,170,170,171,85,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,43,86,85,85,85,85,85,85,85,85,79,42,36,0,0,0,0,0,79,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,122,36,0,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,0,128,171,165,85,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+23,29,29,29,29,29,29,29,29,29,65,107,143,143,137,143,137,44,0,0,127,207,170,170,170,171,122,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,86,79,43,86,86,86,79,43,42,36,0,0,0,0,0,0,43,86,172,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,129,85,0,0,0,43,171,171,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,0,0,86,171,171,129,43,0,0,79,85,85,85,85,85,85,85,85,85,85,79,79,85,85,85,85,43,0,0,7,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,64,101,101,101,137,179,50,0,42,128,170,170,170,171,171,42,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,43,129,36,0,42,42,36,0,0,0,0,0,0,36,42,85,86,129,86,86,86,86,86,85,85,128,171,171,171,171,171,171,171,171,171,165,128,86,36,0,0,42,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,43,0,0,0,0,85,165,171,171,171,43,0,36,85,85,85,85,85,85,85,85,85,85,79,36,42,85,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,65,101,101,137,8,0,42,164,171,171,171,207,128,42,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,85,128,43,0,0,0,0,0,0,0,0,43,43,86,79,42,43,42,0,0,0,0,0,0,0,42,86,171,171,171,171,171,171,171,171,129,122,42,0,0,0,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,85,129,171,171,171,165,43,0,36,85,85,85,85,85,85,85,85,85,85,42,0,36,43,85,85,85,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,101,57,87,135,171,164,127,127,128,129,42,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,128,128,86,79,42,0,42,79,86,86,86,86,43,0,0,0,0,0,0,0,0,0,0,0,0,0,42,129,165,171,171,171,171,171,128,86,42,0,0,0,128,171,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,122,42,0,0,42,86,172,171,171,171,171,129,36,0,36,85,85,85,85,85,85,85,85,85,43,0,0,36,79,85,85,85,43,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,23,29,29,29,29,29,29,29,29,29,29,29,64,100,136,86,42,0,0,0,85,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,36,122,128,128,128,128,128,128,128,171,172,171,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,171,171,171,171,171,171,171,86,42,0,0,0,79,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,86,0,0,0,0,0,36,43,86,122,165,171,171,128,0,0,43,85,85,85,85,85,85,85,85,85,36,0,0,0,43,85,85,85,43,0,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,23,23,23,29,29,29,29,29,29,29,29,29,29,65,94,43,0,0,0,0,0,43,36,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,43,128,129,171,129,129,129,129,129,171,129,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,129,171,171,171,171,171,165,122,42,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,0,0,0,0,0,86,171,171,85,0,0,43,85,85,85,85,85,85,85,85,79,0,0,0,0,43,85,85,85,79,0,0,0,14,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,23,23,29,29,29,29,29,29,29,29,29,29,65,15,0,0,0,43,128,128,129,43,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,42,128,128,171,171,171,171,171,171,129,86,43,0,0,0,0,0,0,0,0,0,43,43,86,86,86,128,129,171,171,165,129,171,171,128,85,0,0,0,0,79,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,0,0,0,0,0,0,85,122,43,0,0,43,85,85,85,85,85,85,85,79,43,0,0,0,0,0,0,36,79,85,43,0,0,7,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,51,1,0,0,42,128,171,171,171,79,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,79,128,129,171,171,171,171,171,171,85,0,0,0,0,0,0,0,0,0,85,86,129,165,171,165,165,165,165,171,129,85,85,129,128,42,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,85,43,43,85,0,0,0,0,0,0,0,0,42,36,0,36,79,85,85,85,85,85,85,85,79,0,0,0,0,0,0,0,0,36,43,79,0,0,1,15,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,21,7,0,0,0,85,171,171,171,129,43,0,0,43,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,43,122,129,171,171,171,171,171,171,86,36,0,0,0,0,0,0,36,43,122,165,171,171,171,165,165,171,171,171,85,42,0,0,85,128,0,0,0,42,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,165,171,43,0,0,0,0,0,0,36,0,0,0,43,79,85,85,85,85,85,79,85,42,0,0,0,43,43,0,0,0,0,0,43,43,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,58,8,1,0,0,85,171,171,171,165,129,43,0,0,36,79,79,79,79,79,79,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,0,85,128,171,171,171,171,171,171,86,0,0,0,0,0,0,0,36,122,171,171,171,171,171,171,171,171,171,165,85,36,0,0,0,85,165,86,43,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,129,43,0,0,0,43,0,0,0,0,0,0,43,85,85,85,85,85,85,85,43,0,0,0,42,85,79,43,0,0,0,0,0,43,0,0,1,58,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,29,29,22,21,7,0,0,79,129,171,171,171,171,171,86,0,0,0,43,43,79,79,79,43,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,0,43,128,128,129,171,171,171,171,171,85,0,0,0,0,0,0,0,43,128,171,171,171,171,171,171,171,171,171,171,85,0,0,0,0,42,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,122,0,0,0,43,171,86,43,0,0,0,0,0,43,85,85,85,85,85,43,0,0,0,0,43,86,86,86,43,36,0,0,0,0,0,0,0,15,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,23,29,58,8,1,0,0,128,171,171,171,165,165,129,86,0,0,0,43,43,43,79,43,42,0,43,85,85,85,85,85,85,85,85,85,85,85,85,43,42,0,0,0,0,43,86,128,128,171,171,171,171,171,128,36,0,0,0,0,0,0,0,128,171,171,171,171,171,171,171,171,171,129,129,0,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,43,0,0,0,122,171,171,128,0,0,0,0,0,43,86,85,86,85,43,0,0,0,0,0,43,85,85,85,85,43,0,0,0,0,0,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,23,59,15,1,0,0,128,171,171,171,171,171,129,128,128,42,0,0,43,43,79,79,42,0,0,43,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,0,85,128,128,129,171,171,171,171,171,128,42,0,0,0,0,0,0,0,85,171,171,171,171,171,171,171,171,171,165,129,43,0,0,0,0,86,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,0,85,129,171,129,128,0,0,0,0,0,36,79,85,85,42,0,0,0,0,0,0,43,85,85,85,85,85,43,0,0,0,0,0,0,1,8,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,29,23,58,7,1,0,0,165,171,171,171,171,165,128,128,129,43,0,0,42,79,79,79,42,0,0,43,85,85,85,85,85,85,85,85,79,42,0,0,0,0,0,43,86,128,128,171,171,171,171,171,171,86,0,0,0,0,0,0,36,43,86,165,171,171,171,171,171,171,171,171,171,165,85,0,0,0,36,86,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,42,0,0,0,42,128,171,171,128,79,0,0,0,0,0,0,43,79,36,0,0,42,86,42,0,0,43,85,85,85,85,85,85,43,0,0,0,0,0,0,1,14,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,23,59,51,1,0,0,43,171,171,171,171,171,128,128,128,128,43,0,0,36,43,79,79,42,0,0,43,85,85,85,85,85,85,43,36,0,0,0,0,0,42,86,128,128,128,129,171,171,171,171,171,129,85,0,0,0,0,0,0,42,128,171,171,171,171,171,171,171,171,165,171,171,85,0,0,0,0,122,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,85,0,0,0,42,128,171,171,171,86,0,0,0,0,0,0,0,0,0,0,0,43,171,171,43,0,0,0,43,85,85,85,85,85,86,42,0,0,0,0,0,1,1,8,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,23,22,8,0,0,43,128,171,171,171,171,171,128,128,128,128,122,0,0,0,42,43,43,42,0,0,43,85,85,85,79,43,36,0,0,0,0,36,79,122,128,128,128,129,171,171,171,171,171,171,171,86,0,0,0,0,0,0,42,129,171,171,171,171,171,171,171,171,171,171,171,165,42,0,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,122,0,0,0,0,85,171,171,171,128,42,0,42,43,43,36,0,0,0,0,36,128,171,171,171,171,43,0,0,36,85,85,85,85,85,85,86,85,0,0,0,0,0,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,23,15,1,0,0,86,171,171,171,171,171,171,128,128,128,128,128,42,0,0,0,43,43,43,0,0,43,86,85,85,43,0,0,0,0,36,43,85,128,128,128,128,129,171,171,171,171,171,171,171,129,43,0,0,0,0,0,43,128,171,171,171,171,171,171,171,171,171,171,171,171,122,0,0,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,129,42,0,0,0,42,129,171,171,171,43,0,0,42,43,0,0,0,0,0,0,79,171,171,171,171,171,129,0,0,0,79,85,85,85,43,43,86,129,42,0,0,0,0,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,29,65,15,1,0,0,128,171,171,171,171,165,128,128,128,128,128,128,85,42,0,0,42,43,43,0,0,36,85,85,43,0,0,0,0,0,79,129,128,129,128,171,171,171,171,171,171,171,171,171,172,43,0,0,0,0,0,36,122,171,171,171,171,171,171,171,171,171,171,171,171,165,43,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,42,85,165,165,171,171,171,171,171,171,171,171,171,171,165,171,128,0,0,0,0,86,171,171,171,85,0,0,0,0,0,0,36,0,0,0,0,42,129,171,171,171,171,129,36,0,0,79,85,85,43,0,0,85,172,86,0,0,0,0,0,8,64,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,
+29,29,29,29,29,29,29,29,29,29,29,58,8,0,0,42,171,171,171,171,171,165,128,128,128,128,128,128,128,43,0,0,0,43,43,0,0,0,43,85,43,0,0,0,0,0,79,165,165,171,171,171,171,171,171,171,171,171,171,129,128,0,0,0,0,0,0,86,165,171,171,171,171,171,171,171,171,171,171,171,171,129,42,0,0,0,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,43,128,171,171,128,0,0,86,79,85,79,128,129,85,0,0,0,0,86,171,171,171,171,129,0,0,0,79,85,85,43,0,0,43,171,86,0,0,0,0,7,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,65,65,65,
+29,29,29,29,29,29,29,29,29,29,29,57,1,0,0,86,171,171,171,171,171,165,128,128,128,128,128,128,128,85,0,0,0,43,43,0,0,0,43,86,43,0,0,0,0,0,0,129,171,171,165,171,171,171,171,171,165,86,43,42,42,0,0,0,0,0,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,79,0,0,36,85,128,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,43,129,171,171,128,85,128,171,171,171,171,171,171,86,0,0,0,0,85,171,171,171,171,128,0,0,36,85,85,85,43,0,0,43,171,129,0,0,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,65,
+29,29,29,29,29,29,29,29,29,29,22,15,0,0,36,128,171,171,171,171,171,165,128,128,128,128,128,128,128,128,42,0,0,0,43,36,0,0,43,86,43,0,0,43,0,0,0,128,171,171,171,171,171,171,171,171,122,42,0,0,0,0,0,0,0,43,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,42,129,171,171,165,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,0,42,165,171,171,171,171,171,171,171,171,171,171,122,0,0,0,43,129,171,128,128,129,171,171,171,171,171,171,171,85,0,0,0,0,85,129,171,171,171,86,0,0,42,85,85,85,42,0,0,85,129,129,86,43,0,0,1,51,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,22,8,0,0,85,171,171,171,171,171,171,165,128,128,128,128,128,128,128,128,86,42,0,0,0,0,0,0,0,79,43,0,0,43,43,0,0,86,171,171,171,171,171,171,171,171,86,0,0,0,0,0,0,0,0,86,172,171,165,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,0,85,128,86,42,0,79,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,42,165,171,171,171,171,171,171,171,171,171,171,85,0,0,0,42,85,0,0,42,86,171,171,171,171,171,171,171,86,0,0,0,0,85,171,129,129,171,85,0,0,43,86,79,43,0,0,0,86,129,171,171,128,0,0,0,8,64,29,29,29,29,29,29,29,65,29,29,29,29,29,29,29,29,29,29,
+65,29,29,29,29,29,29,29,23,23,58,7,0,0,86,165,171,171,171,171,171,129,128,128,128,128,86,86,128,128,128,86,0,0,0,0,0,0,0,43,43,0,0,43,43,0,0,85,171,171,171,171,171,171,171,171,128,85,0,0,0,0,0,0,122,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,42,0,0,0,0,0,0,0,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,36,0,85,171,171,171,171,171,171,171,171,171,171,165,85,0,0,0,0,0,0,0,0,85,171,171,171,171,171,171,171,86,0,0,0,0,85,171,171,171,165,43,0,0,43,85,85,43,0,0,0,86,129,171,171,129,0,0,0,1,58,65,29,29,29,29,29,29,65,65,65,29,29,29,29,29,29,29,29,
+65,65,29,29,29,29,29,29,29,23,21,1,0,0,85,171,171,171,171,171,171,128,128,128,122,42,0,42,128,128,128,128,86,43,0,0,0,0,0,43,43,0,0,43,43,0,0,43,171,171,171,171,171,171,171,171,171,129,42,0,0,0,0,85,172,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,36,0,0,0,0,0,0,0,0,42,171,171,171,171,171,171,171,171,171,128,128,128,171,171,171,171,171,171,171,171,171,129,165,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,0,0,0,43,171,171,171,171,171,171,171,122,36,0,0,0,43,171,171,171,128,42,0,0,42,86,43,0,0,0,42,128,128,171,171,171,85,0,0,1,15,64,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+65,65,65,29,29,29,29,29,29,23,15,1,0,0,128,171,165,171,171,171,171,128,128,128,85,0,0,0,85,128,128,128,129,129,86,43,0,0,0,0,43,43,43,86,85,0,0,0,128,171,171,171,171,171,171,171,171,128,42,0,0,0,43,171,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,43,36,0,0,0,0,0,0,42,165,171,171,171,171,171,171,171,171,42,0,36,86,129,129,165,165,129,129,128,43,85,128,171,171,171,171,171,171,171,171,171,171,171,171,43,0,0,0,0,0,0,0,36,128,171,171,171,171,171,171,79,0,0,0,0,0,85,129,171,165,43,0,0,43,86,43,0,0,0,43,128,128,129,171,171,86,0,0,0,8,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+65,65,65,29,29,29,29,29,29,58,8,1,0,0,129,171,171,171,171,171,171,128,128,122,42,0,0,0,122,128,128,128,128,128,128,43,0,0,0,0,0,43,43,43,85,42,0,0,86,171,171,171,171,171,171,171,171,86,0,0,0,85,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,86,36,0,0,0,0,0,79,171,171,171,171,171,171,171,171,128,0,0,0,0,42,79,79,85,79,43,42,0,0,85,165,171,171,171,171,171,171,171,171,171,171,171,122,43,36,0,0,0,0,0,0,85,171,171,171,171,171,171,42,0,0,0,0,0,0,85,165,129,43,0,0,43,79,36,0,0,0,86,128,128,129,171,171,129,43,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+65,65,65,65,29,29,29,29,29,58,8,0,0,42,165,171,171,171,171,171,171,128,128,85,0,0,0,86,128,128,128,128,128,128,128,86,0,0,0,0,0,42,43,43,85,43,0,0,85,171,171,171,171,171,171,171,171,128,85,42,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,42,0,0,0,43,171,171,171,171,171,171,171,171,42,0,0,0,0,0,0,0,0,0,0,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,128,85,0,0,0,0,43,129,171,171,171,171,165,42,0,0,0,0,0,0,36,128,86,0,0,0,79,43,0,0,0,43,128,128,128,128,171,171,165,85,0,0,1,58,29,29,29,29,29,29,29,29,29,29,65,65,29,29,29,29,29,
+65,65,65,65,29,29,29,29,29,58,8,0,0,42,171,171,171,171,171,171,171,129,128,85,0,0,36,122,128,128,128,128,128,128,128,128,42,0,0,0,0,0,42,43,85,79,0,0,42,128,171,171,171,171,171,171,171,171,171,129,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,42,0,0,0,122,171,171,171,171,171,171,171,171,85,36,0,0,0,0,0,0,0,0,0,0,43,85,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,0,85,171,171,171,171,171,171,42,0,0,0,0,0,0,0,128,86,0,0,37,79,0,0,0,0,79,128,128,128,128,171,171,171,86,0,0,1,57,65,29,65,65,65,29,29,29,29,29,65,65,65,65,65,65,65,
+65,65,65,65,29,29,29,29,29,58,8,0,0,42,171,171,171,171,171,171,171,129,128,85,0,0,0,122,128,128,128,128,128,128,128,129,86,0,0,0,0,0,0,43,85,85,36,0,0,86,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,43,0,0,0,128,171,171,171,171,171,171,171,171,128,86,122,122,122,86,86,85,43,43,86,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,36,0,0,0,85,171,171,171,171,171,171,122,42,0,36,36,0,36,85,128,43,0,0,36,43,0,0,0,0,86,128,128,128,128,171,171,171,122,0,0,1,15,65,65,65,65,65,65,29,29,29,29,29,29,65,65,65,29,65,
+65,65,65,65,29,29,29,29,29,58,7,0,0,85,171,171,171,171,171,171,171,171,129,43,0,0,42,128,128,128,128,128,128,128,128,128,128,79,0,0,0,0,0,36,85,85,43,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,43,0,0,42,165,171,171,171,171,171,171,171,171,171,165,171,171,171,171,171,165,165,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,42,0,0,0,86,171,171,171,171,171,171,165,122,85,85,128,128,128,128,129,0,0,0,43,43,0,0,0,42,128,128,128,128,128,171,171,171,86,0,0,1,8,65,65,65,65,65,65,65,65,65,65,29,65,65,65,29,29,29,
+65,65,65,65,65,29,29,29,65,58,7,0,0,85,171,171,171,171,171,171,171,171,128,42,0,0,43,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,0,0,43,85,79,36,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,85,42,42,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,79,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,122,0,0,36,86,43,0,0,0,86,128,128,128,128,128,165,171,171,128,0,0,1,8,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,29,
+65,65,65,65,65,29,29,29,65,58,1,1,0,85,171,171,171,171,171,171,171,171,128,0,0,0,85,128,128,128,128,128,128,128,128,128,128,128,128,85,36,0,0,0,0,43,86,43,0,0,43,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,122,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,85,0,0,36,43,0,0,0,43,128,128,128,128,128,128,165,171,165,129,0,0,1,8,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,29,29,65,58,1,0,0,86,171,171,171,171,171,171,171,171,86,0,0,36,86,128,128,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,0,0,43,79,0,0,0,86,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,164,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,0,0,43,42,0,0,0,43,86,128,128,128,128,128,165,171,171,128,0,0,1,8,64,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,29,29,65,57,1,0,0,85,171,171,171,171,171,171,171,165,85,0,0,42,122,128,128,128,128,128,128,128,128,128,128,128,128,128,128,42,0,0,0,0,0,43,43,0,0,42,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,85,0,0,0,43,0,0,0,0,36,42,85,128,128,128,128,171,171,171,171,43,0,1,7,64,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,29,29,65,57,1,0,0,85,171,171,171,171,171,171,171,165,85,0,0,43,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,0,0,42,43,0,0,0,85,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,42,0,0,42,42,0,0,0,36,0,0,43,128,128,128,128,171,171,171,171,79,0,1,7,64,29,65,65,65,29,65,65,65,65,65,29,29,29,65,65,65,
+65,65,65,65,65,65,29,29,65,21,1,0,0,85,171,171,171,171,171,171,171,129,42,0,0,86,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,43,0,0,0,0,0,42,42,0,0,42,128,171,171,171,171,171,171,128,85,128,171,171,165,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,43,42,0,0,0,85,0,0,42,122,128,128,165,171,171,171,171,79,0,0,1,64,65,29,29,29,29,29,29,29,65,65,29,29,65,29,29,29,
+29,29,29,65,65,29,29,29,65,58,1,0,0,85,171,171,171,171,171,171,171,128,42,0,0,79,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,85,85,43,0,0,0,0,0,0,0,79,171,171,171,171,171,165,85,0,42,129,171,85,85,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,85,0,0,36,43,0,0,0,43,86,0,0,0,85,128,128,171,171,171,171,171,79,0,0,1,22,65,29,29,29,29,29,29,29,29,29,29,29,65,29,29,29,
+29,29,29,29,29,29,29,29,65,58,7,0,0,42,171,171,171,171,171,171,171,129,43,0,0,43,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,0,0,0,0,86,171,171,171,171,128,42,0,0,129,165,0,0,42,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,36,0,0,0,0,0,0,43,128,86,0,0,0,85,128,165,171,171,171,171,165,43,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,64,8,0,0,42,171,171,165,171,171,171,171,129,85,0,0,43,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,122,43,0,0,0,0,0,0,36,43,129,171,171,165,85,0,0,129,171,43,0,36,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,0,0,0,43,86,128,86,0,0,0,85,128,171,171,171,171,171,128,42,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,64,8,0,0,0,128,171,171,171,171,171,171,171,128,0,0,0,85,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,122,43,0,0,0,0,0,0,0,43,171,171,171,165,122,122,129,171,171,128,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,0,0,0,0,0,0,43,86,128,128,86,0,0,0,86,129,171,171,171,171,171,128,0,0,0,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,65,14,0,0,0,128,171,171,171,171,171,171,171,129,0,0,0,85,128,128,128,128,128,128,128,128,79,86,129,128,128,128,128,128,128,128,128,128,128,122,43,0,0,0,0,0,0,0,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,85,0,0,0,0,0,43,128,128,128,128,86,0,0,0,128,165,171,171,171,171,171,129,0,0,1,8,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,65,21,1,0,0,85,171,171,171,171,171,171,171,129,42,0,0,42,86,128,128,128,128,128,128,43,0,0,86,128,128,128,128,128,128,128,128,128,128,128,128,43,0,0,0,0,0,0,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,85,128,128,128,128,128,85,0,0,0,128,171,171,171,171,165,171,128,0,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,58,7,0,0,42,165,171,171,171,171,171,171,171,86,0,0,0,43,122,128,128,128,86,42,0,0,0,42,128,128,128,128,128,128,128,128,128,128,128,128,128,86,42,0,0,0,0,42,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,43,0,0,0,43,86,128,128,128,128,128,86,42,0,0,85,129,171,171,171,171,171,128,43,0,0,1,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,22,7,0,0,0,86,171,171,171,171,171,171,171,165,85,0,0,36,43,86,86,43,0,0,0,0,0,0,86,128,128,128,128,128,128,128,128,128,128,128,128,128,86,43,0,0,0,85,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,171,171,171,171,171,171,171,42,0,36,85,128,128,128,128,128,128,128,86,0,0,0,86,165,171,171,171,171,171,129,42,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,22,14,0,0,0,43,171,171,171,171,171,171,171,171,129,43,0,0,0,0,0,0,0,0,0,0,0,0,43,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,86,85,43,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,42,42,165,171,171,171,171,171,171,128,86,128,128,128,128,128,128,128,128,128,85,0,0,0,86,171,171,171,171,171,171,128,0,0,0,14,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,64,57,0,0,0,42,171,171,171,171,171,171,171,171,171,129,85,0,0,0,0,0,0,0,43,42,0,0,0,86,128,128,128,86,128,128,128,128,128,128,128,128,128,128,128,128,128,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,122,122,128,171,171,85,0,0,86,171,171,171,171,171,171,128,128,128,128,128,128,128,128,128,128,128,43,0,0,0,128,171,171,171,171,171,171,122,0,0,1,15,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,29,58,50,0,0,0,0,85,129,171,171,171,171,171,171,171,171,171,85,43,42,0,36,43,85,128,86,0,0,0,43,128,43,42,42,122,128,128,128,128,128,128,128,128,128,128,128,128,128,85,85,122,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,42,165,171,43,0,0,85,171,128,86,128,171,128,128,128,128,128,128,128,128,128,128,128,86,0,0,0,85,171,171,171,171,171,171,171,43,0,1,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,29,58,14,7,0,0,0,0,42,128,171,171,171,171,171,171,171,171,171,171,129,122,85,86,122,128,128,128,42,0,0,0,43,0,0,0,86,128,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,85,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,36,0,42,171,171,85,0,0,122,129,42,0,86,129,128,128,128,128,128,128,128,128,128,128,128,79,0,0,0,128,171,171,171,171,171,171,129,0,0,1,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,29,65,15,1,0,0,0,0,0,0,42,129,171,171,171,171,171,171,171,171,171,171,165,128,128,128,128,128,128,128,0,0,0,0,0,0,36,122,128,128,128,128,128,128,128,128,128,128,128,128,86,42,0,0,0,42,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,122,85,128,171,171,129,43,43,129,86,0,0,42,86,128,128,128,128,128,128,128,128,128,128,122,42,0,0,43,165,171,171,171,171,171,129,85,0,0,1,14,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,22,58,7,0,0,36,42,0,0,0,0,122,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,128,128,85,42,0,0,0,0,85,128,128,128,128,128,128,128,128,128,128,128,128,128,128,85,0,0,0,0,0,43,85,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,171,128,42,0,0,42,122,128,128,128,128,128,128,128,128,128,128,85,0,0,0,128,171,171,171,171,171,171,128,0,0,0,7,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,29,59,15,1,0,0,79,85,42,0,0,0,42,129,171,171,171,171,171,171,171,171,171,171,171,165,128,128,128,128,128,128,122,79,42,43,86,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,122,43,0,0,0,0,0,36,85,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,43,128,128,128,128,128,128,128,128,128,128,85,42,0,0,42,171,171,171,171,171,171,165,43,0,0,1,15,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,65,57,7,0,0,43,85,85,79,42,0,0,0,43,128,171,171,171,171,171,171,171,171,171,171,171,165,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,171,171,122,43,36,0,0,0,0,0,43,128,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,42,86,128,128,128,128,128,128,128,128,86,43,0,0,0,0,86,171,171,171,171,171,171,86,0,0,1,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,29,64,8,0,0,0,43,85,85,85,43,0,0,0,0,43,165,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,86,86,128,128,129,171,171,129,79,85,86,43,0,0,0,0,0,36,43,122,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,42,0,0,0,0,85,128,128,128,128,128,128,128,128,43,36,0,0,0,0,43,129,171,171,171,171,171,129,42,0,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,64,21,0,0,0,43,85,85,85,85,85,42,0,0,0,0,79,129,129,165,171,171,171,171,171,171,171,171,171,171,171,171,128,128,128,128,128,128,128,128,128,128,128,128,128,128,86,42,0,0,43,128,171,171,129,43,0,0,85,129,86,43,0,0,0,0,0,0,0,85,129,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,43,0,0,0,0,42,86,128,128,128,128,128,128,128,128,79,0,0,0,0,0,85,171,171,171,171,171,171,165,43,0,0,0,8,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,29,21,8,0,0,36,85,85,85,85,85,85,79,42,0,0,0,36,43,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,165,165,128,128,128,128,128,129,85,42,0,0,0,0,128,171,165,43,0,0,0,0,85,85,42,0,0,0,0,0,0,0,0,36,42,85,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,85,0,0,0,0,0,43,122,128,128,128,128,128,128,128,128,86,0,0,0,0,42,86,129,171,171,171,171,171,171,86,0,0,0,1,15,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,29,64,8,1,0,0,43,85,85,85,85,85,85,85,85,43,0,0,0,0,43,86,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,86,0,0,0,0,0,85,129,171,85,0,0,0,0,43,86,43,0,0,0,0,0,0,0,0,0,0,0,0,36,43,43,85,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,128,85,43,0,0,0,0,0,0,85,129,129,128,128,128,128,128,128,122,85,36,0,0,0,86,129,171,171,165,171,171,171,171,128,42,0,0,1,8,58,23,23,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,22,58,7,0,0,42,79,85,85,85,85,85,85,85,85,85,43,0,0,0,0,0,86,165,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,0,0,85,171,171,128,36,0,0,0,42,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,85,128,128,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,129,129,86,42,36,0,0,0,0,0,0,0,85,128,128,128,128,128,128,128,128,128,43,0,0,0,0,43,129,171,171,171,171,171,171,171,129,43,0,0,1,8,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,22,8,0,0,0,43,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,0,0,42,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,43,129,172,129,79,0,0,0,0,36,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,86,86,128,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,129,128,128,86,85,42,42,36,0,0,0,0,0,0,0,0,42,86,128,129,128,128,128,128,128,128,128,128,128,42,0,0,0,0,128,171,171,171,171,171,171,171,128,0,0,0,1,8,64,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,29,58,7,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,0,42,128,128,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,86,0,0,0,36,129,172,128,43,0,0,0,0,0,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,85,86,85,86,86,86,129,171,129,129,171,129,129,129,129,128,129,129,171,129,129,128,86,86,85,43,42,42,0,0,0,0,0,0,0,0,0,0,0,43,86,86,128,128,128,128,128,128,128,128,128,128,128,128,85,42,42,85,122,171,171,171,171,171,171,171,129,85,0,0,1,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,65,15,1,0,0,85,85,85,79,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,0,0,0,36,79,128,128,128,165,171,171,171,171,171,171,171,171,171,171,171,129,36,0,0,43,129,129,79,0,0,0,0,0,0,0,36,79,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,42,0,0,0,0,0,36,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,86,128,86,86,128,128,128,128,128,128,128,128,128,128,128,128,128,128,171,171,171,171,171,171,171,171,171,129,86,0,0,0,0,7,21,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,29,22,7,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,42,0,0,0,0,0,0,0,0,42,43,128,129,165,165,165,171,165,171,171,171,171,43,0,0,0,43,43,0,0,0,0,0,0,0,0,0,0,0,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,128,129,129,86,43,0,0,86,128,128,128,128,128,128,128,128,128,128,128,128,171,171,171,171,171,171,171,171,171,171,86,0,0,0,1,7,15,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,23,15,0,0,0,43,85,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,42,0,0,0,0,0,0,0,0,36,43,85,85,85,122,85,85,122,86,85,36,0,0,0,0,0,0,0,0,0,0,43,43,0,0,0,0,43,86,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,86,128,43,0,0,0,0,85,128,128,128,128,128,128,128,128,128,128,165,171,171,171,171,171,171,171,171,171,128,43,0,0,0,1,7,15,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,22,8,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,43,86,86,43,0,0,0,36,85,79,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,43,85,128,128,128,128,128,128,128,128,128,171,171,171,171,171,171,171,171,171,171,171,128,0,0,0,0,0,7,58,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,22,1,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,43,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,79,79,85,85,43,0,0,0,36,85,85,79,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,43,0,0,0,0,0,0,43,129,129,129,129,171,171,171,171,171,171,171,171,171,171,171,171,171,171,171,165,86,85,0,0,0,0,0,0,7,58,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+29,15,1,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,43,36,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,79,85,85,85,85,85,85,85,43,0,0,0,42,85,85,85,79,42,0,0,0,36,43,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,43,43,0,0,0,0,0,42,85,86,43,43,128,171,171,171,171,171,171,171,171,171,171,171,171,129,85,42,0,0,0,0,0,0,1,0,0,8,64,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+58,8,1,0,0,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,85,43,43,43,43,43,43,43,43,43,36,0,0,0,0,43,85,85,85,85,85,85,85,85,42,0,0,0,43,85,85,79,85,43,0,0,0,0,79,43,0,36,85,85,43,43,42,0,42,0,0,0,0,0,0,0,0,0,0,0,43,43,43,43,43,0,0,0,0,0,0,0,0,0,0,42,0,36,0,0,0,0,0,0,0,0,0,0,0,43,43,43,0,0,0,0,0,0,0,0,0,0,36,43,171,171,171,171,171,171,165,128,128,122,85,42,0,0,0,0,0,0,0,79,43,0,0,7,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+58,7,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,79,42,0,0,0,0,0,36,43,85,86,85,85,85,79,43,0,0,0,0,79,85,85,79,85,85,43,0,0,0,0,42,0,43,128,128,128,128,128,127,128,85,85,42,0,0,0,0,0,0,0,0,0,42,43,43,43,0,36,43,43,86,86,86,86,86,128,128,128,128,43,0,0,0,0,0,0,0,0,0,0,43,43,0,0,0,0,42,0,0,0,0,0,0,0,0,43,43,43,85,79,43,43,0,0,0,0,0,0,0,0,36,43,43,79,86,86,42,0,1,14,65,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+15,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,36,0,0,42,0,0,0,0,36,79,85,85,79,43,36,0,0,0,0,43,85,85,85,85,85,85,85,43,42,0,0,0,0,85,128,128,128,128,128,128,128,128,128,122,43,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,43,86,86,86,86,86,86,86,43,0,0,0,0,0,0,0,0,0,43,43,0,0,0,0,43,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,79,85,85,85,85,43,0,0,7,58,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+14,0,0,36,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,42,85,85,85,85,85,36,36,43,85,43,0,0,0,0,0,36,36,0,0,0,0,0,0,43,85,85,85,85,85,85,85,85,85,79,0,0,0,0,85,128,128,127,127,127,127,127,128,128,122,36,0,86,122,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,0,0,0,0,43,86,85,43,43,0,0,0,0,0,0,0,0,0,0,0,0,0,36,43,43,43,43,79,85,85,85,85,85,85,79,7,0,1,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+14,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,43,85,85,85,85,79,79,85,85,85,43,0,0,0,0,0,0,0,0,0,0,42,43,85,85,85,85,85,85,85,85,85,85,85,43,36,0,0,42,128,164,128,127,127,127,127,128,128,85,0,36,122,128,128,85,42,42,42,43,0,0,0,36,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,43,0,0,0,43,36,0,0,0,0,0,43,85,85,86,43,0,0,0,0,43,42,42,42,42,42,43,43,79,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+7,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,0,42,85,85,85,85,85,85,85,85,85,79,43,0,0,0,0,0,0,0,36,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,85,171,170,164,164,127,127,127,128,85,0,36,122,128,128,128,128,128,128,128,43,0,36,86,122,85,85,42,42,0,0,0,0,0,0,0,0,0,0,0,0,42,129,86,0,0,0,43,36,0,0,0,0,0,0,43,85,85,43,0,0,0,36,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+1,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,79,43,36,36,42,42,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,85,171,171,170,170,170,164,128,42,0,36,122,128,128,127,128,128,128,128,79,0,42,128,128,128,128,128,128,122,85,122,85,0,36,43,85,85,85,170,171,171,171,85,0,0,0,43,36,0,0,0,0,0,0,0,0,0,0,0,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,43,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+1,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,42,0,0,0,42,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,0,164,171,170,170,170,170,171,79,0,36,128,128,128,127,127,127,127,128,43,0,42,128,128,128,128,128,164,170,171,171,128,0,42,171,171,170,170,170,170,170,171,85,0,0,0,43,36,0,0,43,0,0,0,0,0,0,0,0,0,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,86,43,0,0,15,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+1,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,85,85,42,0,42,43,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,79,36,0,0,42,128,171,170,170,170,171,42,0,42,165,171,170,170,170,170,170,171,43,0,42,128,170,170,170,170,170,170,170,171,128,0,42,164,170,170,170,170,170,170,170,170,42,0,0,36,0,0,0,43,85,42,0,0,0,0,0,0,42,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,50,86,7,0,0,15,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+1,0,0,43,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,36,42,79,85,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,43,0,0,0,42,171,170,170,170,171,42,0,36,128,170,170,170,170,170,170,171,43,0,85,171,170,170,170,170,170,170,170,170,128,0,0,128,170,170,170,170,170,170,170,170,79,0,0,0,0,0,0,43,85,85,43,42,36,36,42,43,79,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,50,50,7,0,1,57,22,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
 };
-const cm::sprite_item item = {width, height, data};
+const uint32_t rgb[] = {
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdceef0,0xd8edef,0x000000,0xd9f6f6,0xcde7e8,0xe5f8fb,0xe3f1f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdbeeee,0x000000,0xddeeec,0xe3f2f1,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdde4e8,0x000000,0x000000,0xe5f1f5,0xd7ecee,0xcee5e8,0xdbeff3,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9f1f7,0xd8f1f7,0xd8f3f8,0xcfecf3,0xc9e8ee,0xc8ebf1,0xc6edf2,0xc2edf2,0xc4f0f9,0xcffaff,0xc6f4ff,0xbbf0fd,0xb9f3ff,0xa8e6f2,0xabe7f4,0xb3e9f7,0xc6fbff,0xbdf9ff,0xa1e4f9,0x9be7fc,0x96e7fc,0x8ddcf2,0xa7e8fd,0xd2f9ff,0xd7f2ff,0xd3eefb,0xcfecf7,0xcfedf9,0xc6ebf7,0xc4f5ff,0xafedf7,0x8bd8df,0x8fd5dd,0xc5f0fa,0xe3f8ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdfedee,0xdeedef,0xdfeef0,0xdfeef0,0xe3f0f2,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe1f0f4,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5f7fa,0xcee4e6,0xdef8f8,0xd7f5f5,0xcce8e8,0xe5f8fb,0xe3f1f5,0xe0ecf0,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdcebec,0xe3f6f6,0xdaeeed,0xdeefee,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdef6f8,0xcfedef,0xcceaef,0xd9f1f8,0xe1edf4,0x000000,0x000000,0xdbecf3,0xd5ecf2,0xd7f1f7,0xdaf5fa,0xe0fdff,0xe0feff,0xd5f5fb,0xcef0f5,0xcff4f9,0xc8eff6,0xd3f8ff,0xe1feff,0xe1feff,0xdbffff,0xcff9ff,0xbcecf9,0xb9edfb,0xafe7f5,0xb5f2ff,0xa6ecfd,0x94dff1,0x97e1f5,0xa3ebff,0xa3e7fc,0xace5fb,0xc8f0ff,0xccedff,0xcff3ff,0xbfe3f0,0xc4e7f4,0xcbf3ff,0xc9fbff,0xace8f3,0x98dce5,0xa2e0ea,0xc1ebf7,0xc9e6f1,0xdef2fa,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3f3f5,0xe0f2f4,0xe2f3f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5f1f3,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xddf5f6,0xc9e4e5,0xd2f0f1,0xd7f3f4,0xe1f5f8,0x000000,0x000000,0xe4eff4,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe0f1f2,0xd2e5e4,0xe5f6f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd4eef0,0xcdeef2,0xcbf0f8,0xd0f0f9,0xdaecf5,0xe4f1f9,0xe0f0f8,0xd5e9f0,0xc8e1e7,0xc6e3e8,0xcce9ed,0xd5f3f8,0xdcfaff,0xd8f7fe,0xdbfbff,0xd8faff,0xd4f8ff,0xd4f8ff,0xd5f6ff,0xd2f4ff,0xcaf2fc,0xc2eef8,0xbcebf8,0xb8ecfa,0xb0ebf9,0xa9ebf9,0x9fe8f7,0x9ae5f5,0xa0e6f8,0xb2f3ff,0xbbf6ff,0xb1e4f9,0xb7e1f5,0xbde4f6,0xb6e0f0,0xb7e2f0,0xc8effe,0xcefbff,0xafeaf6,0xa1e2ed,0xa6e4ef,0xb6eefa,0xcefcff,0xc1eaf4,0xbfe5eb,0xccecef,0xdcf3f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5f4f7,0xe2f3f7,0xdcf2f5,0xddf3f6,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2eff1,0xdfedef,0xe1f0f4,0xddeef5,0xd0e3eb,0xd0e7f0,0xdef5fe,0xe4f7ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3fcfd,0xd3f0f1,0xd3f2f3,0xdaf6f8,0xe0f4f8,0xe5f4f9,0xe5f4f9,0xe4f1f6,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdae8e9,0xe5f4f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe1eeee,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd4edee,0xc0e2e7,0xaed7e2,0xb6dce9,0xd6eef9,0xe1f3fd,0xe1f6fe,0xdbf3fa,0xcfebf0,0xc5e3e8,0xc5e3e8,0xcdebf0,0xd0eef4,0xd7f4fb,0xdaf8ff,0xd8f8ff,0xd8fcff,0xcbf6fe,0xaee5ee,0x9fdbe6,0xa3e1ec,0xace9f6,0xb2ecfa,0xb0ebfa,0xadecfa,0xa9ecfa,0xa5ebf9,0xa4eaf9,0xaaeafa,0xb8f3ff,0xbdf3ff,0xb9eafd,0xbae6fa,0xb9e4f7,0xb2e0f1,0xb4e2f3,0xcbf7ff,0xbef4ff,0x86d3de,0x77c6cf,0xa4dfed,0xbceffd,0xc9ffff,0xb7f0f8,0xa7e3e6,0xb3e8e9,0xcaefef,0xdcf8f7,0xdbf4f2,0xd7ece9,0xd8e9e6,0xe4f2ee,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9e5e9,0xd7e6ea,0xd5e9ee,0xd0ecef,0xcdecef,0xd2edf2,0xdff5fc,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9e8eb,0xddedf0,0xe2f5f8,0xe1f6fd,0xd1ecf3,0xb4d9e0,0xb0d8e0,0xb8dce4,0xd5f3fa,0xdef3f8,0xe2f0f4,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2fcfd,0xdafafa,0xcdefef,0xd8f6f8,0xdff5f9,0xdfeff5,0xe0eff5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9e9e9,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdbf7fa,0xc7ebf3,0xaad6e4,0xadd7e6,0xd1edf9,0xe0f5ff,0xe1f9ff,0xdef8ff,0xd8f6fb,0xcfeef2,0xcbebef,0xcae9ee,0xcae8ee,0xd2eef5,0xd9f5fc,0xd7f6fd,0xd2f4fc,0xc0edf5,0xa4e2ea,0x94dae4,0x99deea,0xa5e7f5,0xafeaf9,0xb0e9f9,0xb3effe,0xb2f0ff,0xb1f0ff,0xb6f2ff,0xbbf2ff,0xbbecfe,0xc2efff,0xcdf6ff,0xcdf4ff,0xc8f1ff,0xbdebfe,0xb6e8f9,0xbaefff,0xb5f6ff,0x8adee8,0x7dced8,0xb9f1ff,0xc1f1ff,0xb7eefb,0xabe8f1,0xa2e4e7,0xb1eded,0xbae5e5,0xcceceb,0xd5f3ef,0xd6f0eb,0xd9efea,0xe0f0ec,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe1f3f9,0xd8f4f9,0xc7e7ec,0xbfdce2,0xcbe3eb,0xd7eaf3,0xe4f2fb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdef1f5,0xd2eaf0,0xdafbff,0xc4f2f9,0xb1e4ea,0xb0dee6,0xbfe5ec,0xd6eff5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdff4f6,0xd9f6f6,0xc1e3e3,0xc3e9e8,0xd2f5f6,0xe0fbfe,0xd8ecf0,0xe2f0f6,0x000000,0xe0eff5,0xe2f1f7,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3f2f3,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9eceb,0xcfdfe1,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe4fcfd,0xe0feff,0xdeffff,0xe1ffff,0xdffeff,0xdafcff,0xd0f7ff,0xbeebfb,0xb9e3f3,0xcfecf8,0xdef4fe,0xe1f9ff,0xdff9ff,0xd9f7fc,0xd2f2f6,0xcfeef2,0xcbeaef,0xcae8ee,0xd2eef5,0xd8f4fb,0xd5f2f9,0xceeff7,0xc3ecf5,0xb0e7f1,0xa7e5f0,0xa8e4f2,0xade6f5,0xb1e3f3,0xb1e0f1,0xbaebfc,0xbaedfd,0xb5e8f8,0xc3f4ff,0xc4f0ff,0xbfe5f8,0xc7e7fc,0xdbf8ff,0xd8f4ff,0xd2f3ff,0xbbe6f8,0xace3f2,0xa9edf9,0x95e1eb,0x81d2db,0x92dae5,0xc7fbff,0xc7f3ff,0xb5e4f2,0xabdfea,0xa7e1e6,0xa7dddf,0xb4dcdd,0xc4e5e5,0xd0eeeb,0xd6f1ed,0xdaf0ec,0xdff0eb,0xe4f0eb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe0f8fd,0xd7f3f8,0xd4ecf4,0xd6eaf3,0xdcebf5,0xe2eef8,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2f2f5,0xd7e9ec,0xe2f6fa,0xd9f2f8,0xd9fdff,0xbcf1f6,0x94cdd2,0xb8e6ee,0xd7faff,0xe0f6fe,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdde7e9,0xe0e8eb,0x000000,0x000000,0x000000,0x000000,0xd2e9eb,0xcae8e9,0xc8eded,0xc3ecec,0xc0e6e8,0xddfbfe,0xe4faff,0xe4f2f9,0xe3f0f6,0xd8e9ee,0xd5e8ed,0xd4e5eb,0xd5e5eb,0xdce9f0,0x000000,0x000000,0x000000,0xdde9ec,0x000000,0xdbe9eb,0xe2eff0,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe1f7f7,0xe4f9f9,0xdcefef,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2f2f4,0xdaf1f3,0xcef0f3,0xbdedf1,0xb6ecf1,0xb8ebf4,0xbff0fc,0xc8f8ff,0xbeeeff,0xbaeeff,0xbfedfe,0xc8e8f4,0xd7f0fa,0xdbf5fd,0xdbf6fc,0xd8f6f9,0xd3f1f4,0xd1eff2,0xd3eef2,0xd4eef4,0xd7f0f7,0xd7eef7,0xcde5ee,0xcae4ee,0xc4e4ef,0xbae4ef,0xb9e6f3,0xbde9f7,0xc4edfc,0xccefff,0xcff0ff,0xcbeefe,0xc8edfd,0xd2f8ff,0xc6e9fa,0xd1efff,0xdaf4ff,0xd9edff,0xd5e6fb,0xc9dbef,0xd1e8fb,0xc9eafb,0xb7e5f3,0xb3effa,0x99dbe5,0x97d5df,0xc0f4ff,0x000000,0xddfbff,0xcaeaf9,0xc3e6f2,0xbbe4eb,0xb9e2e6,0xbcdfe1,0xbfdedf,0xc6e4e2,0xd1ece9,0xd8efec,0xdff2ed,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5feff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd1e0e4,0xd6e8ec,0xdff4fb,0xceeef5,0xb9e9ee,0xa2d6db,0xb9e5ec,0xd8faff,0xe0f6fe,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3edef,0xe2ecee,0x000000,0x000000,0x000000,0x000000,0xdff7fa,0xbddddf,0xcdf3f5,0xcbf5f7,0xc0e8eb,0xd3f3f8,0xe3fbff,0x000000,0x000000,0xe0f3fa,0xe0f5fb,0xdaeff6,0xd3e7ef,0xdaedf5,0xd0e2e9,0xdfeff4,0x000000,0xdce9ec,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdcf0f5,0xcde8ec,0xccecef,0xc5e5e7,0xe2fbfb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3f3f6,0xd6eff3,0xc0eaf1,0x96d9e2,0x89d8e5,0x87d5e7,0x8ed9ee,0xa0e4fd,0x9edff7,0xafefff,0xbff7ff,0xbfe6f3,0xcdebf4,0xd4f1f7,0xd8f4f8,0xd6f5f6,0xd4f1f1,0xd6eff0,0xdaf0f2,0xdef1f7,0xe0f0f9,0xdae9f4,0xd0deea,0xcedde9,0xcadbe8,0xc6dbe8,0xc6dbe8,0xbed1df,0xbacbda,0xb7c5d5,0xafbdcd,0x8396a4,0x899eac,0x708694,0x354957,0x4a5b6a,0x455262,0x363e4f,0x272e3f,0x272e3f,0x3e4757,0x4f5d6c,0x596f7c,0x52727e,0x4f727c,0x66838f,0x96abb9,0xb1baca,0xc0c4d5,0xe5ebfb,0x000000,0xdaecf5,0xdaf0f7,0x000000,0xd9f4f7,0xd1ecee,0xd2ecec,0xd7eeed,0xdff1ef,0xe5f3f0,0x000000,0x000000,0x000000,0x000000,0xe4f1f5,0xe3f2f9,0xe3f5fd,0xe4fbff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5fbff,0xe4fdff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2ecf1,0xe3eef4,0x000000,0xe5f0f7,0x000000,0xe3f5fe,0xceecf3,0xbde2e8,0xbfe5eb,0xd0f2f8,0xe1f8ff,0xe5f6fd,0xe3f6fb,0xe4f5fb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0xe4ecec,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe0eeef,0xdfeef0,0x000000,0x000000,0x000000,0xdff5fa,0xcbebef,0xc0e6ea,0xccf6fa,0xc4ecf1,0xc7e8ef,0xd9f2fa,0x000000,0x000000,0x000000,0xdef5fc,0xdcf4fc,0xe2faff,0xdbf5fd,0xd3ebf2,0xdbeff3,0x000000,0xe5f4f7,0x000000,0x000000,0x000000,0xe4f0f2,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd6f4fd,0xbae0e8,0xb7e4ea,0xb7e1e7,0xdafbff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xddf4fa,0xc3eef6,0x9ce5f0,0x83dcec,0x83dff4,0x88e1fc,0x93e4ff,0x84d2f0,0x89d7ef,0xaef1ff,0xc6f2ff,0xd2f2ff,0xd5f3fb,0xd3f0f3,0xd8f6f5,0xe3fefb,0x000000,0x000000,0x000000,0x000000,0x000000,0xc4cad6,0xb1b7c3,0xa2a8b4,0x6d747e,0x5b616b,0x272b35,0x10121d,0x00010b,0x000006,0x000006,0x000006,0x000008,0x000009,0x000006,0x000005,0x000005,0x000004,0x000004,0x000004,0x000003,0x000003,0x000004,0x000008,0x000009,0x00000a,0x000000,0x08000b,0x221b26,0x292630,0x50535a,0x60696f,0x889a9d,0xcadfe1,0xd2e9eb,0xc5dcde,0xe1f5f5,0x000000,0x000000,0x000000,0x000000,0xe5f3f2,0xe0f1f3,0xdaeff4,0xd4eff6,0xcdeef6,0xcef5fc,0xd1fcff,0xd1faff,0xd2faff,0xd6ffff,0xd2f7ff,0xd3f0fd,0xdffaff,0xdbf9ff,0xceeef8,0xceeff9,0xdbfdff,0xdbfdff,0xd6f6ff,0xdaf3ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdffaff,0xcdedf2,0xbbdce0,0xdbf5fb,0xd8f0f6,0xd7f3f9,0xc8e2e8,0xd1e7ed,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0xe1ebeb,0xe3edee,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe4f7f8,0xcee6e7,0xdef6f8,0x000000,0x000000,0x000000,0xdaf8fe,0xcbf0f5,0xc1eaef,0xc8f0f6,0xcfeff7,0xd3ecf5,0xdff1fa,0x000000,0x000000,0xd4eef5,0xcde8f1,0xdbf9ff,0xcdedf5,0xd8f6fc,0xd9f1f4,0x000000,0xe3f3f5,0x000000,0x000000,0x000000,0xe4f1f3,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd1e4f0,0xcce9f7,0xd6fdff,0xb4e4f0,0xa9e1ec,0xace4ee,0xc9f6ff,0xd8fbff,0xe3fdff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xcff3fd,0xaff0fb,0x8cdfee,0x83dff4,0x85e2fd,0x8de3ff,0x88deff,0x78d6f1,0x82d3eb,0xa5d7ee,0xbcddf0,0xc9e7f3,0xc8e4e8,0xcce6e4,0xd8ece7,0xe4efed,0xc6cacc,0x94959a,0x424249,0x41404a,0x110f1a,0x000003,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x050405,0x070707,0x09090a,0x0a090a,0x0a0809,0x070204,0x080103,0x090003,0x090003,0x080003,0x080103,0x070103,0x060304,0x060304,0x0a0506,0x0b0406,0x090002,0x050000,0x000000,0x050000,0x000000,0x000000,0x000000,0x041212,0x1b2c2d,0x27393a,0x556766,0xa3b3b2,0xb7c5c4,0xe3f0ef,0xe4f3f1,0xdef0f0,0xd5eef0,0xcaecf1,0xbde8ef,0xb1e7ee,0xa2e1e6,0x9ee2e9,0x97dde8,0x94ddea,0x9ce7f6,0x98e0ef,0xa5e5f5,0xbdf4ff,0xc0ecff,0xc3f0ff,0xaae2f1,0xa1e2ee,0x9fe6ef,0x9ddde8,0xb1e1ee,0xd3f3ff,0xe5f6ff,0x000000,0x000000,0xdfedf8,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3f0f6,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdffafe,0xc2e0e4,0xcbeaef,0xdafcff,0xc7eff4,0xbfe6eb,0xcdedf3,0xe4faff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0xe1eced,0xe0ecee,0xe0ecef,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd4f0f1,0xc9e8ea,0xd6f2f5,0x000000,0x000000,0xd7f5fb,0xd3f9fe,0xc6eff5,0xc6edf4,0xd9faff,0xddf7ff,0xd4e8f2,0xddf0f9,0xe2f9ff,0xd5f0f9,0xcdecf5,0xcceef7,0xc7ebf4,0xcaebf2,0xd8f0f4,0x000000,0xe4f3f5,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xbcdce9,0xbae2f1,0xcaf7ff,0xb4ebfa,0xa7ecfa,0x93deee,0xa2ebff,0xb6f8ff,0xceffff,0xd1f2f8,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd4f3fd,0xc1f5ff,0xa1e6f5,0x8addef,0x90e9ff,0x8de1ff,0x89defc,0x82ddf6,0x8ddbf1,0xc8f3ff,0xe1faff,0xd9f0fb,0xb3c8cc,0x7a8c89,0x6a7671,0x60615f,0x2a2525,0x0f090b,0x000000,0x090308,0x0b050a,0x000000,0x000000,0x000000,0x120d07,0x130f07,0x110d04,0x151108,0x1c180f,0x27231a,0x2a261d,0x2e2a21,0x2f2921,0x322b23,0x3e352e,0x433931,0x443831,0x443831,0x443831,0x443831,0x443831,0x41362f,0x3d312a,0x392e27,0x362a23,0x261b14,0x22170f,0x22170f,0x150b04,0x0a0400,0x030100,0x000100,0x000300,0x000300,0x000502,0x000704,0x000704,0x0c1815,0x586563,0x8b9998,0xcbdedd,0x000000,0xd7fcff,0xb6e7ed,0xa8e5eb,0x97dee3,0x8cdbe2,0x84d8e4,0x80d9e8,0x7ad9e9,0x77d5e6,0x82d9eb,0xa0ecff,0xbbf5ff,0xb6efff,0x94d9eb,0x8cdcea,0x87dde9,0x8cdfeb,0x9de0ef,0xb2e6f6,0xc8eaf9,0xdaf6ff,0xd6f3ff,0xc9e4f2,0xdaf3ff,0xe4f8ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2f3f8,0xcfe0e6,0xe2f0f6,0xe2edf3,0x000000,0xe3edf3,0x000000,0x000000,0xe4f9fd,0xdef7fc,0xdcf9ff,0xd9fdff,0xbfebf0,0xb3e1e5,0xb2dbe0,0xd4f2f8,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0xe5f3f3,0xd6e6e8,0xcfe2e4,0xdff1f4,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdcf8f9,0xc7ecec,0xbee2e4,0xdcf4fb,0x000000,0xd6f6fc,0xcaeff5,0xbae3e9,0xc2eaf0,0xceeef6,0xdaf5fe,0xd7edf7,0xd2e8f2,0xd8f1fa,0xd6f3fc,0xd0f3fc,0xbde3ed,0xbde3ed,0xbfe0e9,0xddf3f9,0x000000,0xe5f2f7,0xdfedf0,0xdcebed,0xddeced,0x000000,0x000000,0x000000,0xe2f0f3,0x000000,0x000000,0xe1f5fa,0xc5e7ee,0xa9dce5,0xb4ecf8,0xc5f6ff,0xaae4f4,0x98eafa,0x65cbe1,0x45bbdf,0x50c3e8,0x66c3dc,0x89c8d7,0xe5ffff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe0fcff,0xd9fcff,0xc5f4ff,0x9bdeeb,0x99e5f6,0x96e1f6,0x8dd6eb,0x8ad2e2,0xa1d9e7,0xb6cfdc,0x8a949f,0x464f55,0x1e2627,0x000000,0x000000,0x010000,0x060000,0x030000,0x090000,0x120a06,0x1f1913,0x221c16,0x272118,0x322d20,0x4c4737,0x5d5947,0x5d5946,0x5f5a47,0x625e4b,0x686350,0x696451,0x696451,0x67624f,0x675f4d,0x655b49,0x665b49,0x665b49,0x665b49,0x665b49,0x665b49,0x665b49,0x665b49,0x675c4b,0x675c4b,0x665b49,0x5d5140,0x574c3a,0x544837,0x4e4433,0x433b2c,0x3d3628,0x292618,0x0e0e01,0x080900,0x070900,0x040900,0x000100,0x000000,0x000000,0x000000,0x172826,0x536a6b,0x6e8f92,0xb2dde1,0xa3d9df,0x98d9de,0xa5eff6,0x98e9f5,0x82dbea,0x73d5e5,0x6ed3e4,0x74d5e6,0x7fd6e9,0x98dff5,0xa4e6fc,0x9fe8fb,0xa3f1ff,0x9beeff,0x8ce0f1,0x84d6e8,0x89d3e6,0x99d6e8,0xafe5f6,0xa6d9e9,0xa1d3e2,0xbaeaf8,0xcbf6ff,0xd8faff,0xdef7fe,0xe4f8ff,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5f5f8,0xdff0f3,0xdeeff1,0xe1f2f5,0xe1f3f7,0xdef3f7,0xd8f1f4,0xcfe9ed,0xdaf1f5,0xe0f4f8,0xe5f5fa,0xdceaf0,0x000000,0x000000,0x000000,0x000000,0x000000,0xdef8ff,0xc2eaef,0xb9e8eb,0x9bcdcf,0xc1e9ec,0xdcf0f6,0x000000,0x000000,0x000000,0x000000,0xd8e9ec,0xbddbde,
+0x000000,0x000000,0x000000,0xddf0f2,0xd0e3e7,0xdcecf2,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xddf9ff,0xd5f8fe,0xcaf2f5,0xbee7ea,0xcaeef4,0xdbfeff,0xdaffff,0xc9f2f8,0xacd8de,0xbde7ee,0xc2e7ef,0xc8e8f1,0xdaf8ff,0xd7f4fe,0xd5f3fd,0xd5f8ff,0xcaf3fc,0xc0edf6,0xb6e5f0,0xc3ecf6,0xe2fdff,0x000000,0x000000,0x000000,0xe2f5f7,0xdff4f5,0xe2f8f9,0x000000,0xe0f8fc,0xdaeef4,0x000000,0x000000,0xe2f9ff,0xb9dee4,0x9dd2da,0xb6eef9,0xccfaff,0xa9e2f3,0x93eeff,0x52cae5,0x27b6e1,0x22add9,0x36a1c1,0x8dd3e8,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5ffff,0xe0ffff,0xd5f6fe,0xe2fdff,0xdaf9ff,0xafdee9,0x9fd5e1,0xace3f1,0x88bcc9,0x6997a0,0x3f5f65,0x1e282d,0x161417,0x070605,0x000000,0x000000,0x000000,0x120500,0x211109,0x25160d,0x34281e,0x483f33,0x554d40,0x575041,0x595141,0x5a523f,0x5c543e,0x605841,0x605841,0x5f573f,0x5f573f,0x5f573f,0x5f573f,0x5f573f,0x5e553d,0x5f543d,0x5f533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x60533c,0x5f513a,0x5f513a,0x5e5039,0x5c4f39,0x5b4f3a,0x5f5440,0x615845,0x4e4734,0x3b3422,0x3a3424,0x383526,0x1d1b0f,0x060700,0x000000,0x000000,0x000000,0x03110e,0x001413,0x173537,0x3e6569,0x85b6bb,0xc6ffff,0xc2ffff,0x9de6f4,0x88deec,0x8ceaf8,0x85e6f4,0x87e4f3,0x95e6f8,0x96e3f5,0x9ae9fa,0x97e9f8,0x97eafa,0x9ef3ff,0x8adff0,0x84d5e6,0x95dced,0xa7e7f9,0xaeedff,0xa1dfef,0xa0deec,0xa5dde9,0xb3e0eb,0xc9ecf6,0xd4ecf5,0xdff2f9,0xdeeef3,0xddecef,0xe5f4f8,0x000000,0xdff2f6,0xe4f7fb,0x000000,0xddeff3,0xd3e7eb,0xc9e1e5,0xc3dfe3,0xcdebef,0xd8f6f9,0xdffafe,0xe0f5fa,0xe2f3f9,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9f4fb,0xc4ebef,0xcafafc,0xa6d9da,0xc2ecee,0xd3e8ed,0x000000,0x000000,0x000000,0x000000,0x000000,0xc9eaed,
+0x000000,0x000000,0x000000,0x000000,0xe5f4f9,0xd8e8f2,0xdaeaf5,0xe4f5fc,0xdcf3f7,0xdbfbff,0xdeffff,0xddffff,0xc2eafa,0xb9e7f9,0xbdecfc,0xc8f2fc,0xbce8ef,0xafe3e9,0xb2e8ee,0xbaecf2,0xc1f1f8,0xbdeef4,0xbaeaf1,0xbbe9f0,0xb9e5ec,0xbfe9f1,0xc6eff7,0xc7f1f9,0xc9f5fd,0xbff0f8,0xb7eef7,0xace9f4,0xb5edf7,0xd1faff,0xdef8ff,0x000000,0x000000,0xe0f8fc,0xd0f1f3,0xc8eced,0xcff4f7,0xc5e9f1,0xd2effb,0x000000,0x000000,0x000000,0xcfecf4,0xc0e6f0,0xc5edf9,0xd6f9ff,0xbcf2ff,0x8deeff,0x4acae8,0x28bde8,0x48d2fd,0x7edcfd,0xbff5ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xd3f7fb,0xa9eeed,0xabf9f9,0xbcfcff,0xa8d8e0,0xd6f1fc,0x000000,0xdef5ff,0xbbd4dd,0x8aa1aa,0x13272d,0x000304,0x000000,0x000000,0x020000,0x080000,0x0a0100,0x241a0c,0x382c1d,0x544335,0x5f4e3f,0x605041,0x615241,0x635644,0x645845,0x645845,0x625642,0x61543e,0x5d4f38,0x5d4f38,0x5e4f37,0x5e4f37,0x5f5039,0x60513a,0x61523b,0x64553d,0x63533c,0x63533c,0x62523b,0x62523b,0x63523b,0x63523b,0x63523b,0x63523b,0x63523b,0x63523b,0x63523b,0x63523b,0x63523a,0x605037,0x605037,0x5f4f36,0x5e4e35,0x605139,0x61523b,0x655741,0x695c46,0x645741,0x645743,0x645946,0x5b5241,0x4d4536,0x302a1c,0x201b0d,0x0c0800,0x010000,0x040701,0x000000,0x000000,0x01181b,0x48646a,0x9ab9c4,0xbae2ef,0xa9e2eb,0x99e2ea,0x97f0f6,0x98f7fd,0x95f0f8,0x99f2fb,0x98f2fb,0x89e3eb,0x8de6ee,0x9aeff8,0x97e5f1,0xa9eefd,0xb5f4ff,0xa5e2f2,0xafefff,0xb6f8ff,0xabebf9,0xabe5f3,0xadddec,0xc0e5f4,0xd9f2fe,0xe5f6ff,0x000000,0x000000,0xe5eef5,0xe0ecf3,0xd8eaf0,0xe1f3f9,0x000000,0x000000,0x000000,0xe0f3fa,0xd3edf3,0xc8e5eb,0xc8e8ed,0xd3f1f6,0xdbf3f9,0xe0f3f9,0x000000,0x000000,0x000000,0x000000,0xe4feff,0xd0f2f6,0xbde7e9,0xc7f5f6,0xbce7e8,0xcdf0f2,0xdef3f6,0x000000,0xe1f2f3,0xe4f6f6,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe3f9ff,0xd5f3fc,0xb8e5ed,0x96d8e1,0xa5effc,0xbafeff,0x9bdef5,0x98ddf7,0xa5e6fd,0xc1f6ff,0xc3f8ff,0xa9e9f3,0xa1e4ed,0xa4e1eb,0xade8f2,0xbaf4ff,0xc9ffff,0xbff7ff,0xafe6f0,0xb5e9f3,0xb7eaf3,0xbaedf6,0xbbf1fa,0xafeaf2,0xa6e7f0,0xa1eaf4,0x92d9e5,0xa9e6f2,0xbce9f6,0xddf8ff,0x000000,0xd5f8fe,0xc2eaed,0xbee5e8,0xb7e1e6,0xb0dee8,0xc4edfb,0xdaf6ff,0xe3f9ff,0xdcf4ff,0xdcf9ff,0xd6fbff,0xc8effc,0xd7faff,0xbef6ff,0x7ae3fb,0x37c0e1,0x25bde7,0x49d0fb,0x8ee5ff,0xcffeff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe1ffff,0xb0ebf7,0x64c2c8,0x6dcfd4,0xaaf1fb,0xb2e0ec,0x000000,0xe2edf6,0x969ea5,0x373e42,0x121618,0x040503,0x030000,0x000000,0x0c0100,0x231507,0x403121,0x473827,0x5d4d3a,0x62523e,0x64513d,0x64513d,0x63523d,0x62523c,0x62523b,0x61523b,0x62523b,0x63533c,0x64533b,0x65533a,0x66533a,0x66533a,0x66533a,0x66533a,0x66533a,0x66533a,0x66533a,0x66533a,0x66533a,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x655139,0x645238,0x645238,0x645237,0x645237,0x635237,0x635238,0x635238,0x635239,0x635239,0x63523a,0x62523c,0x62533e,0x665844,0x635642,0x5d503d,0x443827,0x2f2416,0x150d02,0x070300,0x000000,0x000404,0x00080b,0x142028,0x596e76,0x8cb1b7,0x99d0d3,0x95dfe0,0x8adede,0x87dbde,0x93e8ec,0x95eaef,0x95e9ee,0x95e7ec,0x9be9ee,0x9fe6ee,0xadecf7,0xbbf4ff,0xabe5f4,0xa0e3f4,0x99e1f2,0x9ae0f1,0xacefff,0xbaf4ff,0xb6e6fa,0xc9effe,0xdefbff,0xe5fcff,0x000000,0x000000,0xdcf1fb,0xd0e9f1,0xddf3fb,0x000000,0x000000,0x000000,0xe5f8ff,0xe0f6ff,0xdbf5fc,0xd7f3fa,0xd3eef5,0xd8edf4,0xdff1f7,0xe5f4fa,0x000000,0x000000,0x000000,0xe3ffff,0xd0f2f5,0xb9e1e2,0xbfe7e8,0xc5e8e9,0xd9f4f6,0x000000,0x000000,0xd9eded,0xc9dede,0xd2e8e7,0xe4f9f9,0x000000,
+0xe2f3f8,0x000000,0x000000,0x000000,0x000000,0xe0f1fe,0xd7f4ff,0xd4ffff,0xbcffff,0x61d5e7,0x39b8ce,0x70dcf8,0x7ee1ff,0x7adefa,0x7edaf4,0x94e0f8,0xb5f9ff,0xaef4ff,0xa2e9fa,0x9ee5f7,0x9ae2f5,0x96ddf1,0x9ee4f8,0xabefff,0xa6e6f9,0xb1ecfd,0xaee8f7,0xaae7f3,0xa8e9f3,0xb0f6ff,0xa1ecf6,0x94e6f1,0x93e8f7,0x7dd2e5,0x7cc8dc,0xb5efff,0xccfdff,0xccfdff,0xc0ecf1,0xcff1f4,0xccf1f7,0xb0e7f2,0x9dd4e2,0xb1d7e7,0xc1dfee,0xcfedfa,0xc9effb,0xbceffe,0xb3e9f8,0xccf8ff,0xb8f9ff,0x69dcf9,0x2dbde2,0x2dc3ef,0x45c9f3,0x7ed5f5,0xc8f6ff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xccffff,0x87d7f1,0x50b4ca,0x7fdaee,0xb2eaff,0x7a98aa,0x778691,0x282d32,0x000000,0x000000,0x030000,0x090300,0x1d1408,0x382a1c,0x5a4836,0x66523e,0x6b5742,0x65513c,0x614e37,0x614e37,0x65513a,0x655139,0x645239,0x635238,0x635238,0x635238,0x645238,0x655238,0x665137,0x665137,0x665137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x675137,0x665137,0x665137,0x665337,0x655235,0x665336,0x665336,0x665336,0x665337,0x655236,0x665337,0x655236,0x645238,0x635038,0x635039,0x66543d,0x65533c,0x6a5943,0x635441,0x5d503f,0x453b2f,0x1c180f,0x090b06,0x000605,0x000002,0x000000,0x000000,0x0e3534,0x639896,0xace9e7,0xa2e0e1,0xabeaed,0xadedf0,0xa8e8ec,0xa5e5e8,0xafeff4,0xa8e8ee,0xa4e1ea,0xc0f6ff,0xc6ffff,0xa4ebfc,0x8edcf0,0x83d3ea,0x8ddcf5,0x93dffa,0x9ae0f9,0xa4e2f6,0xb8f0ff,0xc3f8ff,0xcbfdff,0xc9fbff,0xc4f3fd,0xcaf2fc,0xdbf9ff,0x000000,0x000000,0xe4f5ff,0xdceffb,0xd8edf6,0x000000,0x000000,0x000000,0x000000,0x000000,0xdae8ee,0xccdbe1,0xdeeef3,0x000000,0xe0f5fa,0xddf7fb,0xd7f6f9,0xd6f5f7,0xd9f3f5,0xddf2f4,0xddeff1,0xdcedf0,0x000000,0xd7eeed,0xd2e9e8,0xd1e8e7,0xd4e8e9,
+0xccdee3,0xe2eff4,0x000000,0x000000,0x000000,0xd6e7f3,0xb3d7e7,0xb3f3ff,0x86eaff,0x2cbcd5,0x21bbd8,0x4dcfef,0x67dbfd,0x65d6f6,0x66d2f2,0x67ccec,0x87e4ff,0xa2f7ff,0x92e2f9,0x95e4fb,0x93e2f9,0x8fdef6,0x8fddf5,0x8bd7ee,0x96ddf3,0xb5f5ff,0xc2ffff,0xb4f9ff,0x92ddeb,0x90e2f0,0x8fe8f8,0x88e8fa,0x8bf1ff,0x7feaff,0x58c1d9,0x66c5da,0xaaffff,0xa5f2ff,0xbaf9ff,0xcef8ff,0xd6ffff,0xaceffa,0x87cdda,0xc6f8ff,0xc6ecfc,0xd4f7ff,0xc1efff,0x99dff1,0x87d5e8,0xb7feff,0xa1faff,0x54d9fb,0x30c9f2,0x45daff,0x5fdfff,0x7bd4f3,0xb9ebff,0x000000,0x000000,0x000000,0x000000,0x000000,0xdbffff,0xa1e1fd,0x7dcef0,0x5bb1ce,0x68afc7,0x527589,0x000917,0x000006,0x000000,0x090500,0x030000,0x0b0100,0x352819,0x5d4d3c,0x665340,0x6a543e,0x685038,0x654d35,0x654e37,0x644f36,0x655037,0x665138,0x655137,0x645236,0x645236,0x645236,0x645236,0x655236,0x665136,0x675136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x675136,0x675237,0x675337,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675336,0x675337,0x665137,0x665138,0x665138,0x665138,0x655139,0x614e37,0x61513c,0x5f513f,0x5e5547,0x4e4a40,0x21211b,0x090b08,0x020807,0x000100,0x000000,0x000200,0x315653,0xa7cdcd,0x000000,0xcef7fa,0xc8f3f6,0xc7f3f7,0xbcedf2,0xabe6eb,0x98d3db,0xa7dce7,0xb7effe,0xacf2ff,0xa0efff,0x8fe1f8,0x88dcf5,0x81d7f2,0x84daf3,0x84d7ed,0x84d6e9,0x8fe0f1,0x9aebf9,0x96e6f3,0x93deea,0xa7e8f2,0xbef2fd,0xd4f6ff,0xdcf7ff,0xd8f5ff,0xd6f3ff,0xe1fdff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe0f2f7,0xd9edf2,0xdaf1f5,0xe1fcff,0xe4ffff,0xe2f8fa,0xe0f1f4,0xd6e5e8,0xdcebed,0xe3f5f6,0xe4f9f9,0xe3f9f9,0xe0f7f6,0xcfe4e4,
+0xdff4f7,0x000000,0x000000,0x000000,0x000000,0xe3f4ff,0xc1ebf9,0x7ccddd,0x5ed3e9,0x3cd1f0,0x30cbee,0x58ddff,0x83faff,0x85f5ff,0x66d9ff,0x4dd0f6,0x4ed0f4,0x77e4ff,0x8aeaff,0x8be2f9,0x8ee0f5,0x95e7fd,0x9aecff,0x94e2f8,0x99e2f8,0xb3f4ff,0xb6f7ff,0xb0fbff,0x94e8fb,0x80dff6,0x77e0fa,0x72e4ff,0x6ee7ff,0x70eeff,0x59dbf5,0x3bc3db,0x4bcfe5,0x53c9dd,0x8beafd,0xc0ffff,0xb9f7ff,0x7fd4de,0x86dbe5,0xc7ffff,0xcdfcff,0xd3faff,0xb9efff,0x64c1d8,0x50c2da,0x6de2f8,0x5cdffa,0x33cff7,0x28caf9,0x3bd1ff,0x5eddff,0x80dcfa,0xaae2f5,0x000000,0x000000,0x000000,0xe5fafa,0xd3fef8,0xb5edf1,0x8fcbe7,0x90caee,0x1d506c,0x000618,0x00060d,0x070302,0x080200,0x0d0500,0x1d1207,0x4a3d2e,0x574736,0x64513e,0x6a543e,0x674f37,0x654c31,0x664d31,0x674e34,0x675036,0x655036,0x665137,0x665137,0x655236,0x645236,0x645236,0x645236,0x645236,0x655236,0x665136,0x675136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x685136,0x675136,0x675237,0x675337,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675336,0x675337,0x665137,0x665138,0x665138,0x665138,0x655037,0x644f35,0x634f37,0x604e38,0x60523f,0x5e5546,0x555044,0x3b382f,0x23231d,0x0d100c,0x030a06,0x000100,0x000000,0x202c2d,0xc9d7d9,0x000000,0xdff1f5,0xdcf2f8,0xd3f4fa,0xbaeff4,0xa5e1e8,0xa7dce7,0xb0e7f5,0xa0e2f2,0xa5eeff,0x9de8fa,0x92e3f5,0x83dcef,0x7cddef,0x74daee,0x6cd6eb,0x65d4e8,0x65d5e9,0x66d7e8,0x6bd7e6,0x79dde7,0x85dae4,0xb6f5ff,0xbef3ff,0xc3f6ff,0xc0f0fd,0xc3eff7,0xdcffff,0x000000,0x000000,0x000000,0xe3ecf8,0xe2f0fa,0x000000,0xe1f5fa,0xd7ecf0,0xd8edf2,0xd8f0f5,0xd3f0f3,0xe0fdff,0xe5fbfe,0x000000,0x000000,0x000000,0xe5f1f3,0xdbebec,0xe1f4f4,0x000000,0x000000,
+0xdbf1f3,0x000000,0x000000,0x000000,0x000000,0x000000,0xd9ffff,0x8fddee,0x57c6dc,0x45d0ee,0x38cced,0x40cae9,0x72f3ff,0x78f2ff,0x65e5ff,0x46dcff,0x31c7f0,0x4bccf0,0x6ee1ff,0x88f0ff,0x7de2f9,0x75dbf4,0x8beeff,0x94edff,0x95e7ff,0x93e1fe,0x92e4ff,0x77d4f1,0x88efff,0x85f3ff,0x46c0e5,0x2eb9e1,0x22b3da,0x40cdee,0x52e4ff,0x3bdaf7,0x20c2e0,0x22bddd,0x49d0ee,0x89eeff,0x77d3ea,0x5ac5d8,0x63ccde,0x94e9fd,0xb3f8ff,0xbffaff,0xa5edff,0x77e3ff,0x41c4e2,0x2cb9d6,0x2ac2e3,0x20c5ef,0x28cdfc,0x30c9fb,0x58dbff,0x87eaff,0xa2e3f5,0xd8f5fd,0x000000,0x000000,0xd9f3f0,0xa3d0c8,0x7aadab,0x426d7f,0x0d3047,0x00000b,0x00060c,0x000000,0x180b00,0x36291d,0x56493a,0x625341,0x6c5b47,0x67533e,0x654e37,0x654d33,0x694f33,0x6b5234,0x6b5233,0x6a5235,0x695236,0x685237,0x675337,0x675337,0x655236,0x655236,0x645236,0x645236,0x655236,0x655236,0x665136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x675237,0x675337,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675337,0x665136,0x665137,0x665138,0x665138,0x665137,0x665035,0x644f35,0x645037,0x62513a,0x5f513e,0x5d5342,0x5a5245,0x524c42,0x413c34,0x29251f,0x17130e,0x050300,0x000000,0x1a1c1c,0x989d9d,0xe2eaec,0x000000,0xdcf6fb,0xcbfcff,0xbbf5fa,0xbaecf6,0xbcf1fe,0xa1e3f1,0x8dd5e4,0x9ee4f3,0xa8f3ff,0x92ebfe,0x7de3f9,0x6ee3fc,0x5edaf4,0x54cee8,0x51cce5,0x55d5ed,0x57d9ef,0x43c5d9,0x55cee1,0x76dbef,0x8be3f8,0x9ff1ff,0xa4f1ff,0x99dfef,0xa4deec,0xcdf5ff,0xdcf8ff,0xdef6ff,0xd5ebf9,0xd2e9f5,0xd5eff9,0xd4f0fa,0xc9e6ee,0xd1edf4,0xdef9fe,0xd1ecf0,0xcce4e7,0xd7eaed,0xddeaee,0x000000,0x000000,0x000000,0x000000,0xe4f1f3,0x000000,0x000000,
+0xdff1f4,0xe5f4f7,0x000000,0x000000,0x000000,0x000000,0xe1fdff,0xb8efff,0x86d8ec,0x6edef5,0x54d8f0,0x45d5ed,0x3fd3ee,0x43d5f4,0x3dd0f4,0x38d2fb,0x39d3fd,0x3dcef6,0x4ed7fc,0x6befff,0x55d9f8,0x30bbdb,0x5addfa,0x81eeff,0x96faff,0x8bf3ff,0x6bdcff,0x2eabd6,0x53d5ff,0x7bf9ff,0x34bfef,0x0fb8ea,0x04b2e1,0x30c9f0,0x57ecff,0x39ddff,0x17c8f1,0x08c4f2,0x06b9e7,0x28bce7,0x4dd3fb,0x64ecff,0x3bbfe1,0x4bc2e3,0x83eeff,0x9ffdff,0x8fefff,0x7aeaff,0x5cdcff,0x40cff5,0x33cdf3,0x32d1f8,0x2accf6,0x2ecdfe,0x3fcdfb,0x71deff,0x9de8fc,0xc9eff7,0x000000,0x000000,0xd8e9e7,0x6f8682,0x314843,0x000703,0x000000,0x060800,0x171304,0x2a200d,0x453622,0x604f3c,0x65523e,0x67533e,0x68533c,0x665037,0x664e35,0x694f34,0x6a5033,0x695131,0x685131,0x685132,0x695235,0x675236,0x675337,0x675337,0x675337,0x675336,0x665336,0x665336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x665134,0x665134,0x665134,0x665134,0x665134,0x665134,0x665134,0x665134,0x665134,0x665134,0x665135,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665137,0x665137,0x665136,0x665136,0x655035,0x645036,0x645238,0x61513a,0x5f513d,0x5c5040,0x5e5245,0x5d5247,0x4f463c,0x272118,0x050200,0x000000,0x000000,0x000000,0x737e7b,0xd9e9e8,0xddf9fa,0xcafafb,0xbef2f6,0xbce7ef,0xbff0fb,0xb2f9ff,0x97e3f0,0xa5e5f4,0xb8fbff,0xa3f8ff,0x77e0ff,0x52d3f7,0x44c8ec,0x6bddfe,0x69d9f9,0x5ad9fa,0x46d3f6,0x21bee3,0x33d1f5,0x48d9fa,0x52d8f6,0x65dffc,0x76e8ff,0x7ae5ff,0x73d1f0,0x91dbf2,0xabe8f9,0xbdf3ff,0xc4f4ff,0xc2eefc,0xbfeaf9,0xbeeafb,0xb1dceb,0xc7edf7,0xdffeff,0xe4faff,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe2eff0,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xe5fcff,0xcdf6ff,0xb2f2ff,0x9cf5ff,0x74e5f7,0x51d9ed,0x39cfe7,0x3ad1ef,0x3cd5f8,0x3fd8ff,0x3cd7ff,0x2ccaf4,0x2dc8f2,0x3ccef7,0x30c3ea,0x1ebbe1,0x20b9db,0x4fd8f3,0x64e6ff,0x43c9f5,0x21b0e3,0x0da6dc,0x15b0e6,0x3bceff,0x2ccaff,0x05c3f8,0x00bdee,0x1dc3ee,0x52efff,0x2ed3fc,0x0abde9,0x00c5f7,0x00b3e7,0x04b5e7,0x28cafb,0x3cdaff,0x33ccf8,0x26bae4,0x3dcaf3,0x54d8ff,0x4ccef6,0x54dbff,0x44d2ff,0x3dd5ff,0x44dfff,0x4fe8ff,0x25c0e8,0x1dbdee,0x35c7f6,0x63d5f7,0x9ceaff,0xcef5fe,0x000000,0xacb7b7,0x495150,0x000503,0x000000,0x000000,0x080400,0x2b230b,0x473c22,0x564a30,0x615138,0x645038,0x68523a,0x685239,0x685238,0x695238,0x685136,0x6a5035,0x695134,0x685132,0x675231,0x675132,0x685334,0x675336,0x675337,0x675337,0x675336,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655035,0x655035,0x645036,0x635137,0x62513a,0x61503e,0x625141,0x615242,0x6b5e4f,0x5f5547,0x403a2e,0x131207,0x000000,0x000000,0x000000,0x495855,0xbad7d6,0xafe2e4,0xaae6ec,0xb0e8f5,0xa5e8f7,0x8ce9f8,0x81e4f6,0x92e8fe,0xa1f8ff,0x83e8ff,0x53c8ef,0x2cb4db,0x54d7fc,0x82e7ff,0x89e9ff,0x6ee3ff,0x3ccaf1,0x0eb8e6,0x16cbf9,0x26d3fb,0x2ed2f7,0x3dd6f9,0x44d5fa,0x4ad8ff,0x55d6fe,0x64d0f0,0x79d7f0,0x96ecff,0x9eeafb,0xaaedfe,0xb7f3ff,0xb1e9fc,0x96c8d9,0xb4e0eb,0xd1f3fb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xdef5ff,0xd9ffff,0xc6fcff,0xb9fbff,0x92e9f8,0x68ddf1,0x4fd6ee,0x4ad7f5,0x48d9fc,0x45d6ff,0x3cd5ff,0x24cdfb,0x1bc2f1,0x35cbfc,0x3dcffe,0x35d2fd,0x1ec3eb,0x15c1e6,0x15c3eb,0x09b3e7,0x0ab5f0,0x00b1ee,0x01b3f0,0x0ebaf2,0x10c4f8,0x00c8f9,0x00c3f0,0x0fc6f0,0x35deff,0x33d5fb,0x2dd6fc,0x0bc7f3,0x01c3f3,0x05bff0,0x08baeb,0x17c1f2,0x1bc3f3,0x20c9fb,0x0cb7e9,0x02afe1,0x0cbaec,0x24d1ff,0x0fb9ed,0x1abff2,0x3edbff,0x56e8ff,0x33c3ec,0x23bdef,0x41d1ff,0x57c8ea,0xa4efff,0xd6f4ff,0xaaafb3,0x212224,0x0e0c0c,0x0a0806,0x020000,0x120d00,0x2d2711,0x52492f,0x5d5236,0x5e5236,0x625238,0x665138,0x695239,0x685238,0x685238,0x685237,0x695237,0x685136,0x685135,0x665234,0x655233,0x665233,0x675335,0x675335,0x675336,0x675336,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655035,0x655035,0x645035,0x645036,0x645037,0x65513b,0x66513d,0x65513d,0x64513e,0x665744,0x5e5341,0x524b3c,0x070400,0x000000,0x000400,0x000906,0x617e7f,0x9edce1,0x7ccdd9,0x84ddf2,0x72dcf6,0x59dcf7,0x4ad7f5,0x54dcfe,0x68efff,0x4fd8ff,0x31bbe2,0x34bfe1,0x62daf8,0x9becff,0xacf7ff,0x89f0ff,0x51d6fa,0x1ec7f7,0x12ccff,0x19d1fe,0x17cbf3,0x22cff7,0x21cdf4,0x17c5ef,0x2cd1fb,0x4dddff,0x5edfff,0x6ee4ff,0x73ddf6,0x8de9ff,0xa8f6ff,0xb0efff,0xaadfec,0xb7e5ee,0xcaeff5,0xe0faff,0xe5f7fb,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0xdfeff9,0xc0dee9,0xc4f5fd,0xaae9f2,0xabf1fe,0x96ecfd,0x75e3f8,0x63e0fa,0x5ce0fe,0x56dcff,0x58deff,0x43d6ff,0x21cefe,0x14c4f4,0x37d1ff,0x52e4ff,0x4ce5ff,0x30d8fd,0x0ecbf1,0x07c9f6,0x12cbff,0x0bc4ff,0x00b6f5,0x00b4f2,0x12c8ff,0x08c2f5,0x00c6f4,0x00c8f4,0x0ac5f2,0x18c5f0,0x2fd0f8,0x58fcff,0x16cbf8,0x01bceb,0x0abff0,0x20d1ff,0x2dd9ff,0x11bef2,0x1bcdff,0x11caff,0x00baf2,0x00bbf4,0x00bbf6,0x02bdf8,0x0bbbf3,0x29cbfd,0x4adcff,0x4fdaff,0x3eccf9,0x5adbff,0x62c4e0,0x80bdce,0x475b62,0x090607,0x000000,0x130a08,0x1b120e,0x362d25,0x534a3a,0x5b523c,0x5f563b,0x605638,0x615437,0x645338,0x685239,0x695239,0x685238,0x685237,0x685237,0x685237,0x675136,0x665136,0x655235,0x645234,0x655234,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x675139,0x68503a,0x674f38,0x67513a,0x64513b,0x645440,0x665b49,0x564f3f,0x272213,0x050400,0x000200,0x000f11,0x6ea8ae,0x8cdfed,0x71d5ee,0x58d2f2,0x3ed4f7,0x1ac0e7,0x15bcea,0x23c9f9,0x2acdfb,0x37d1fb,0x3ecbef,0x62d7f6,0x92e1ff,0xa1ebff,0x99fdff,0x57dcff,0x15c2f5,0x0ac9ff,0x20ddff,0x14cbf8,0x12c2ed,0x10c1ed,0x01bdea,0x15cefc,0x2dd6ff,0x29c6f3,0x2bc1ea,0x3bc6ea,0x5ad6f4,0x8ef6ff,0xacffff,0x9ee0ec,0xace1e9,0xc4eef3,0xd1f0f4,0xd5ecf0,0xd1e3e7,0xe2eff3,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0xe0eeef,0xe5f2f5,0x000000,0x000000,0xe2feff,0xc4f3fe,0x94dde7,0x79d3e1,0x79dcf0,0x82eeff,0x71e5ff,0x6be3ff,0x68e1ff,0x66dfff,0x6de5ff,0x4ed6ff,0x22cdfe,0x15c7f5,0x34d2f6,0x50e3ff,0x52e4fe,0x43e1fc,0x20d8fa,0x0fd0fb,0x21d7ff,0x10c7ff,0x00baf5,0x05c5ff,0x30dfff,0x1fceff,0x0ecefd,0x10d2ff,0x18cdfd,0x1fcafb,0x29cdfe,0x34daff,0x16c9fc,0x16c9fb,0x2dd2ff,0x4feeff,0x4ceeff,0x22caff,0x2edbff,0x17ceff,0x00c1fc,0x00c1fe,0x00befe,0x00bdfd,0x02bcf9,0x18c4f8,0x3fdafe,0x55e0ff,0x60ddfe,0x84e8ff,0x6baebf,0x264950,0x000503,0x000000,0x070000,0x1f110b,0x3f322a,0x5a4d42,0x645745,0x62563f,0x62573b,0x615638,0x625437,0x645338,0x685239,0x695239,0x685238,0x685237,0x685237,0x665136,0x665137,0x665137,0x645236,0x645236,0x655236,0x675336,0x675336,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x675335,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x665234,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x685138,0x695038,0x695038,0x685138,0x655039,0x66543f,0x584a37,0x685d4d,0x5d5446,0x1f190f,0x090702,0x000000,0x00171b,0x6cacb8,0x9ff8ff,0x68deff,0x3ed5fb,0x1bc6f5,0x13c6ff,0x05b9f5,0x0fc0f5,0x39ddff,0x49d8ff,0x64dbff,0x8debff,0x94efff,0x89f8ff,0x39c4f3,0x03b7f1,0x00c2fe,0x20dbff,0x2bdaff,0x2dcdfe,0x2ccfff,0x19cfff,0x06c3f8,0x0ec5fc,0x0abff5,0x00b3e7,0x0bbaea,0x1abde7,0x52dfff,0x81f2ff,0x8fe6f8,0x9de0ea,0xb9ebf0,0xcdf3f6,0xdaf7f9,0xd4ebee,0xdcedf2,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0xe2f7fc,0xd7f3fa,0xdbfdff,0xd9ffff,0x99e8f7,0x75daec,0x64d8f0,0x5fdcf8,0x59d9f7,0x4fcdec,0x5ad3f4,0x75e9ff,0x6ddfff,0x4dcbf5,0x2ec9f6,0x20c2ec,0x41d4f1,0x57e2f9,0x57e2f8,0x4ae0fa,0x2eddff,0x25ddff,0x2adbff,0x12c7fe,0x00bcf3,0x09c8fd,0x29d7ff,0x2cd9ff,0x1dd8ff,0x12d0fe,0x15ccfd,0x24d5ff,0x22ceff,0x07b5eb,0x0fc6fc,0x27dcff,0x32d9ff,0x38daff,0x31d9ff,0x22cfff,0x25d7ff,0x0ec7ff,0x01c5ff,0x00c2ff,0x00bdff,0x00bbff,0x00bafd,0x08bdf6,0x24c6ed,0x38c0dd,0x61c9e1,0x5ca3b4,0x00222a,0x000000,0x060200,0x170a00,0x433327,0x5e4e41,0x5e4e40,0x635342,0x655540,0x64553c,0x63553a,0x625437,0x645437,0x655338,0x675238,0x685238,0x685238,0x685237,0x675237,0x675338,0x675239,0x675339,0x665338,0x665338,0x675337,0x665136,0x665235,0x665234,0x665234,0x665234,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x675336,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x685238,0x695239,0x6a5239,0x6a5238,0x695239,0x634e36,0x36230d,0x1e0e00,0x3b2d1c,0x5e5244,0x574d43,0x201814,0x000000,0x000102,0x16434c,0x89d3ea,0x68d5f7,0x32c8f2,0x1cccff,0x0fc8ff,0x00bcfc,0x00b8f1,0x11bdf1,0x32c4f7,0x59d9ff,0x76ebff,0x6fe5ff,0x49cffe,0x1ab7ed,0x00bbf9,0x00bcfa,0x05c0f6,0x19c4f6,0x4ae1ff,0x45dfff,0x1ed2ff,0x06c8ff,0x00b6f5,0x00b5f5,0x00b7f6,0x00baf6,0x03bcf3,0x1ec4f3,0x4cd8fb,0x6edef8,0x84d9ea,0xafedf8,0xc7f6fc,0xd6fcff,0xccf0f6,0xd1f3fb,0xe0fdff,0xe1f9ff,0xe2f1fa,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0xc5e5ea,0xb7dee6,0xc7ecfa,0xd3ffff,0xb5fbff,0x81dff6,0x61daf4,0x49d5f1,0x3fd3f1,0x3bcbea,0x55d6f5,0x80f6ff,0x84f5ff,0x68dcff,0x50cef3,0x4fcef1,0x5ad3ef,0x58d2ec,0x5bddfa,0x4eddfd,0x37d6fb,0x33dbff,0x2bd7ff,0x16c7fa,0x10c7fb,0x14cbfe,0x1eceff,0x1bcefe,0x0bc8f5,0x00c1ee,0x00beee,0x12d1ff,0x13cfff,0x02bff6,0x02c2fa,0x17d7ff,0x15d1ff,0x0fcaff,0x11ceff,0x0ecdff,0x0bcbff,0x05c8ff,0x00c5ff,0x00c2ff,0x00baff,0x00b9ff,0x00bbff,0x00bbfa,0x0fb6e4,0x36b8d7,0x4795a7,0x0a3038,0x000000,0x040000,0x170800,0x4b3a28,0x6d5b48,0x66523f,0x64513c,0x64513b,0x66533a,0x655338,0x655338,0x655337,0x665337,0x665337,0x675338,0x675238,0x675237,0x675237,0x675337,0x675338,0x675239,0x675239,0x675339,0x675338,0x675338,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675238,0x685239,0x685239,0x685239,0x665138,0x5e4a33,0x200e00,0x170600,0x170700,0x201206,0x53463e,0x4d433f,0x050200,0x000000,0x000107,0x144b61,0x5cbade,0x2bbeed,0x0fc1f8,0x07c2fe,0x00befb,0x00b7f0,0x0abbf2,0x2fc9ff,0x3eceff,0x3bccfe,0x25bff1,0x0cb5ec,0x00b5f1,0x00b7f9,0x00bcfd,0x00baf2,0x0db8ea,0x41d4ff,0x2ec5f9,0x04bdf6,0x00bdfd,0x00b2f7,0x00b5fc,0x00b7ff,0x00b7fe,0x00b5f7,0x07bcf6,0x37dbff,0x4dd7fc,0x66d0ed,0xa0f0ff,0xbffaff,0xc1f6ff,0x9bd6e2,0xa6e5f3,0xb7f6ff,0xc1f7ff,0xdbfcff,0xe5f8ff,0x000000,0x000000,0xe2f3f3,
+0x000000,0x000000,0x000000,0xbee3ea,0xabdbe4,0xb1e2f0,0xabe3f6,0xa3e8fe,0x84ddf5,0x60d5ef,0x49d2ee,0x41d8f6,0x3cd4f3,0x4cd5f6,0x58d9fb,0x6ae9ff,0x7bf4ff,0x7aecff,0x7be3ff,0x85e1fc,0x7ddef9,0x68defb,0x4ed6f7,0x3ad2f7,0x2dcff8,0x1fc6f2,0x26cfff,0x30daff,0x28d3ff,0x1dcafa,0x1acdfb,0x13cdfb,0x07c6f4,0x00b9e8,0x11d6ff,0x0ed2ff,0x00bef6,0x00baf3,0x04cbff,0x05cdff,0x00c5ff,0x01c9ff,0x00c8ff,0x00c8ff,0x00c8ff,0x03cbff,0x01c7ff,0x00b9ff,0x00b8ff,0x00baff,0x00b9f5,0x1db4e1,0x2f99b7,0x023342,0x000408,0x0c0300,0x1f0d02,0x4e3c29,0x68553e,0x65513a,0x655038,0x655037,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675338,0x675239,0x675239,0x675239,0x675239,0x675338,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675338,0x675239,0x675239,0x675239,0x66523a,0x66533a,0x614f38,0x3d2d16,0x150500,0x0e0000,0x160800,0x32251f,0x362e29,0x0d0d08,0x000305,0x000516,0x125e7e,0x3bc1ef,0x15bef6,0x05bef9,0x00bcf8,0x00b7f1,0x17ceff,0x40e6ff,0x3de0ff,0x1fc9ff,0x00b0e8,0x00b8f4,0x00bbfb,0x00b9fd,0x00bdff,0x00bcf5,0x1dcdff,0x4feaff,0x31d0ff,0x03c0fc,0x00bdff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00b7ff,0x00b6f8,0x06baf1,0x1fc1ef,0x41caf2,0x77e6ff,0x9ef4ff,0xacf9ff,0x9beeff,0x79d2eb,0x6bc9e0,0x8ce1f6,0xbcf8ff,0xd1f8ff,0xe1f8ff,0x000000,0x000000,
+0xd9eef1,0x000000,0x000000,0xd4f9ff,0xa8e0ea,0x97dfea,0x9feefd,0x9ae6fb,0x93e6ff,0x83e6ff,0x68ddf9,0x4fd9f7,0x3fd3f3,0x3fd2f6,0x2dc2eb,0x1eb5e5,0x3bc8f6,0x67deff,0x92efff,0xb9f6ff,0xbdfdff,0x89edff,0x50d3ef,0x38d3f2,0x2cd2f5,0x2acdf6,0x3ad9ff,0x40daff,0x3bd7ff,0x31d5ff,0x2dd8ff,0x27d8ff,0x1fd7ff,0x08c7f7,0x17daff,0x15d9ff,0x00bcf4,0x00bbf5,0x00c1fc,0x06cfff,0x00c9ff,0x00c4ff,0x00c4ff,0x00c4ff,0x00c5ff,0x00c5ff,0x00c3ff,0x00bbff,0x00bafb,0x00baf5,0x0fb6e7,0x289cc0,0x003048,0x00000d,0x090000,0x34261f,0x534434,0x675740,0x655339,0x655237,0x665137,0x665137,0x655035,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665138,0x665138,0x665138,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675338,0x665138,0x665138,0x675239,0x665339,0x665339,0x6a593e,0x6a593f,0x55452e,0x332512,0x0b0000,0x070000,0x120900,0x0c0d02,0x000500,0x00050c,0x00142a,0x0d79a2,0x1ab0e4,0x09bcf5,0x00bcf8,0x00baf5,0x04c1fd,0x0dc4ff,0x0cc5ff,0x00bffb,0x00b9f6,0x00bdfd,0x00bdff,0x00bbff,0x00bdfe,0x00bcf7,0x12cbff,0x27d4ff,0x18c9ff,0x00bbfa,0x00bcfe,0x00bbff,0x00bbff,0x00b9ff,0x00baff,0x00b8ff,0x00b8fe,0x00b8f6,0x01b8ef,0x08b8e9,0x28c5ef,0x58d8f9,0x76e6ff,0x7be7ff,0x76e5ff,0x54cfee,0x5acfea,0x7edef7,0x98dff6,0xc7f1ff,0xdeffff,0xc9f3ff,
+0xcfeaec,0x000000,0x000000,0xd8fdff,0xbcf4ff,0x85d3df,0x7dd5e4,0x8ce2f7,0xa4fdff,0xa9ffff,0x78e5ff,0x59d8f6,0x4ad4f5,0x46d6fb,0x35cefa,0x0eb4eb,0x0dafe6,0x2ab8e4,0x59c8ec,0xa9f1ff,0xb6faff,0x96f9ff,0x63e0fa,0x44d6f2,0x3ad7f7,0x3ad6fc,0x44deff,0x41d7ff,0x3dd5ff,0x35d6ff,0x2fd7ff,0x2ad7ff,0x23d7ff,0x09c6fa,0x08cbff,0x0ed3ff,0x00bef7,0x00bcf6,0x00bcf8,0x00c3ff,0x00c8ff,0x00c4ff,0x00c1ff,0x00c2ff,0x00c1ff,0x00c1ff,0x00bfff,0x00bbfd,0x00baf6,0x0bbaec,0x26aed6,0x04526f,0x000316,0x000002,0x2d1617,0x55463b,0x60523f,0x625239,0x635236,0x645135,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x655236,0x655236,0x665337,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655137,0x655138,0x655138,0x655137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675338,0x665137,0x665138,0x665137,0x675338,0x665337,0x655337,0x645337,0x65553a,0x62523b,0x3a2a17,0x190900,0x0d0200,0x090700,0x010500,0x000102,0x000715,0x003354,0x1899c7,0x10baf0,0x00bbf6,0x00baf7,0x00bcfb,0x00bcfd,0x00bdfe,0x00beff,0x00c0ff,0x00c1ff,0x00c0ff,0x00beff,0x00beff,0x00baf7,0x00baf6,0x00bcfa,0x00b8f8,0x00bafb,0x00bcff,0x00bbff,0x00bbff,0x00b9ff,0x00baff,0x00b9ff,0x00b8ff,0x01c0ff,0x09c6ff,0x00bbf1,0x0abdee,0x25c1ea,0x42cef6,0x4dd1ff,0x50d4ff,0x4bd6fe,0x64edff,0x63defc,0x63c9e5,0x97e0fc,0xb4f2ff,0x9de2f5,
+0xd9f7fa,0xd0edf4,0xd6f4fe,0xd9fbff,0xd3ffff,0xabeffe,0x76cbdd,0x61c4da,0x75e1fb,0x87f6ff,0x7cedff,0x68dcfc,0x67e0ff,0x65e4ff,0x4bdcff,0x13bff9,0x00aeed,0x00afea,0x0dafe0,0x44c1e5,0x6cd9f6,0x83f4ff,0x7af1ff,0x60ddfa,0x55dcfb,0x4fe1ff,0x4ae4ff,0x38d6ff,0x2ed0ff,0x2cd2ff,0x2ad4ff,0x26d5ff,0x1ed4ff,0x03c2f9,0x00bff9,0x01c7ff,0x00bef9,0x00bbf7,0x00bbf7,0x00b9f6,0x00bcfb,0x00c0ff,0x00bdff,0x00c0ff,0x00beff,0x00bdff,0x00bdff,0x00bdfb,0x05b7ed,0x20abd5,0x0d6889,0x001026,0x000210,0x25171d,0x604c49,0x65564a,0x5f513d,0x5e4e34,0x635135,0x655235,0x665234,0x665234,0x665235,0x665136,0x655236,0x655236,0x645236,0x645236,0x665337,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645237,0x645237,0x655236,0x655136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655035,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665135,0x675336,0x675336,0x665336,0x645234,0x635236,0x65543b,0x67553f,0x594735,0x281a0c,0x0f0900,0x080400,0x030000,0x000107,0x000e24,0x005b7f,0x19b8e8,0x00baf3,0x00bbf9,0x00bcfd,0x00b8fb,0x00b5fa,0x00baff,0x00bcff,0x00bcff,0x00beff,0x00bdff,0x00bfff,0x00c0ff,0x00bfff,0x00beff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00b8fd,0x09c2ff,0x28ddff,0x13c8ff,0x12c2f6,0x1bc4ef,0x2bcdf7,0x32cdfe,0x30c6f9,0x3acdfb,0x52e1ff,0x4ddafe,0x4dd0f1,0x57cbe8,0x65d0ea,0x6fdbf1,
+0xd6f7fa,0xb9e0e7,0xaad4dd,0xc4edfa,0xd3ffff,0xc5ffff,0x94e5fa,0x59bdd7,0x4fc3e1,0x42c3e7,0x48caef,0x6de5ff,0x7becff,0x73e1ff,0x63e3ff,0x31d8ff,0x00b8f5,0x00b6f4,0x00b7ee,0x18b6df,0x40cbec,0x55d4f5,0x59d2f1,0x64d9f7,0x5ddaf9,0x4bdbff,0x3cdaff,0x2dd6ff,0x21d0ff,0x16c6fa,0x1bcdff,0x16cbff,0x06c1fb,0x00bffd,0x00beff,0x00bfff,0x00befe,0x00bcfc,0x00bafa,0x00bafa,0x00b9f9,0x00befd,0x07bdfb,0x1ac1fe,0x1bc1ff,0x09befc,0x00b8f5,0x01b8f0,0x1bb6e5,0x197ea0,0x00152c,0x000110,0x2c2027,0x554241,0x634f47,0x625344,0x61523d,0x625137,0x645236,0x655234,0x665234,0x665234,0x665234,0x655236,0x655236,0x645236,0x645236,0x645236,0x655337,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665136,0x665235,0x665234,0x675335,0x675335,0x675335,0x655234,0x665336,0x665338,0x65513a,0x65513e,0x5c4c3c,0x2c2115,0x0c0300,0x080000,0x000000,0x000611,0x001b31,0x17a1c5,0x0bbaeb,0x00bbf7,0x00bcff,0x00bbff,0x00b8fe,0x00baff,0x00b9ff,0x00baff,0x00bcff,0x00beff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b9fd,0x00b7f4,0x1acaff,0x20caff,0x22cafc,0x21caf2,0x22c9f2,0x22c9fa,0x25c9fe,0x2bcbfe,0x2ecdfd,0x33d5ff,0x30d0f7,0x36cdf1,0x40d1f1,0x4fdbf6,
+0xcef1f6,0xbfecf3,0xb3e8f1,0xaae4ef,0x98d7e5,0xafefff,0xbcffff,0x8ce4ff,0x5acdf1,0x22b9e1,0x11b1d6,0x41cbeb,0x88fcff,0x98f5ff,0x8cf5ff,0x4ae2ff,0x0dc1f3,0x05c4fa,0x09c5f9,0x1fcbf8,0x33cff7,0x48d7fb,0x56d8f9,0x6ae2ff,0x61defe,0x3fd4f8,0x28d1fa,0x17cfff,0x09c9fe,0x00c0f9,0x00c1fe,0x00c0ff,0x00bdff,0x00bdff,0x00beff,0x00bfff,0x00bfff,0x00c0ff,0x00bdff,0x00bdff,0x00bcfd,0x07bef4,0x23beec,0x289dc6,0x00729d,0x0085b7,0x12b2e5,0x17b4e3,0x1795ba,0x002e44,0x000005,0x1b1a20,0x594a49,0x69534c,0x654f42,0x62503e,0x63533d,0x645339,0x645236,0x655234,0x665234,0x665234,0x655234,0x655236,0x645236,0x645236,0x645236,0x645236,0x655337,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665235,0x665234,0x665233,0x675334,0x685335,0x685235,0x675134,0x675135,0x685136,0x675138,0x66513c,0x62503e,0x615345,0x34271c,0x0f0100,0x030000,0x000000,0x000007,0x004155,0x15aacf,0x04b8f3,0x00bbff,0x00bbff,0x00bcff,0x00baff,0x00baff,0x00baff,0x00bcff,0x00beff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b5f4,0x0ebdf5,0x35d7ff,0x40daff,0x40d8fb,0x38d4f9,0x29cdfd,0x1bc7fd,0x13c5fb,0x0fc6fb,0x0ec8fb,0x11cafb,0x17ccf9,0x22cff8,0x32d6f9,
+0xcff4f9,0xc2eef6,0xc2f5ff,0xb8f2ff,0x9ad9e9,0x89cadf,0xaaf3ff,0xb0ffff,0x7cecff,0x37d3fb,0x17bfe6,0x20b6d7,0x6ceaff,0xa3ffff,0xa1ffff,0x50e1ff,0x10bbe6,0x12c6f6,0x1aceff,0x2cd7ff,0x30d0fa,0x42d4fa,0x56dbfe,0x6fe8ff,0x63e2ff,0x39d1f5,0x21cef8,0x0ecdfd,0x02caff,0x00c1fe,0x00bdfd,0x00bcff,0x00bcff,0x00bcff,0x00beff,0x00bfff,0x00c0ff,0x00c1ff,0x00c2ff,0x00bfff,0x00b7f3,0x26bfe9,0x057a97,0x00243d,0x001833,0x003d63,0x2cb4dc,0x4ac4e7,0x004b64,0x00030c,0x0e0e0e,0x4b423f,0x62524b,0x654f42,0x664f3e,0x614f3a,0x62523a,0x655338,0x665336,0x655234,0x665234,0x665234,0x655234,0x645236,0x645236,0x645236,0x645236,0x645236,0x655337,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665234,0x665233,0x665232,0x675334,0x685235,0x695235,0x685134,0x685134,0x695136,0x695038,0x67513b,0x665240,0x604f40,0x5c4d41,0x25160b,0x0b0000,0x020000,0x000704,0x00151c,0x00647d,0x1db4e7,0x07bafb,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00bbff,0x00bdff,0x00beff,0x00c0ff,0x00c0ff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b6f8,0x13c5ff,0x44e5ff,0x4de0ff,0x5ae2ff,0x55dcfd,0x44d3ff,0x2fcbfc,0x17c4f6,0x0bc3f6,0x05c2f6,0x03c2f7,0x04c3f7,0x0cc7f8,0x1dcffa,
+0xcef1f8,0xc6e8f3,0xcef3ff,0xc9f1ff,0xbef1ff,0x92d6eb,0x82d3eb,0x91e8ff,0x7de8ff,0x49d7ff,0x37d4fc,0x20bcdf,0x34c4e2,0x6be5ff,0x72edff,0x4addff,0x27c8f1,0x2bd0fc,0x34d7ff,0x3bd6ff,0x43d5ff,0x4ed7fe,0x5bdbff,0x6de5ff,0x66e6ff,0x44daff,0x27d1fc,0x11cdff,0x05ccff,0x00c6ff,0x00bdfe,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00bfff,0x00c2ff,0x00c5fe,0x00bff8,0x00c2ff,0x21bff1,0x228aa4,0x001b29,0x00010e,0x000113,0x005975,0x47b8d5,0x2f7c91,0x00060f,0x040703,0x47382d,0x66594d,0x615244,0x624f3c,0x65513b,0x625239,0x635438,0x655538,0x665336,0x655234,0x665234,0x665234,0x655234,0x645236,0x645236,0x645236,0x645236,0x645236,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665234,0x665233,0x665232,0x675334,0x685235,0x695235,0x695235,0x695236,0x6a5237,0x6a5239,0x69523c,0x685341,0x645244,0x645447,0x56473b,0x312317,0x0c0100,0x000200,0x000906,0x000e1a,0x00668a,0x28b8ed,0x06bafa,0x00bdff,0x00bcff,0x00bbff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b9ff,0x03bbfb,0x25ccff,0x48daff,0x80f7ff,0x8df6ff,0x7ee5ff,0x63d7fd,0x44d4fa,0x2ecff9,0x1bc5f5,0x12c4f8,0x0cc4fa,0x0bc4fa,0x0fc6f8,
+0xccedf5,0xcaedf8,0xd7fbff,0xd6fbff,0xc7f6ff,0xaaecff,0x92e1f6,0x85d9f3,0x7bdcfa,0x69ddff,0x51d6fb,0x40d2f3,0x32c6e3,0x48d2ec,0x49d5f0,0x3fd8fa,0x32d1f8,0x3ad6ff,0x46ddff,0x4dddff,0x53dcff,0x5bdcff,0x60dcff,0x68e2ff,0x62e6ff,0x4ae5ff,0x2ddbff,0x14d2ff,0x05cdff,0x00c5ff,0x00b8f7,0x00bcfd,0x00c3ff,0x04c3ff,0x05c3ff,0x03c3ff,0x00c5fd,0x00c6fa,0x00c1f3,0x1ac5f9,0x25a2cc,0x002d40,0x000a13,0x000b17,0x001e30,0x3497af,0x419fb4,0x002b33,0x000000,0x291b0e,0x675240,0x645443,0x5f503d,0x63503a,0x645239,0x645539,0x645538,0x655537,0x665336,0x655234,0x665234,0x665234,0x655235,0x655236,0x645236,0x645236,0x645236,0x645236,0x665337,0x665337,0x665337,0x665337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x655236,0x665337,0x665337,0x665337,0x665337,0x655236,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665235,0x665234,0x665233,0x675334,0x685235,0x685236,0x685236,0x695236,0x6a5237,0x6a5239,0x69523b,0x67523e,0x655242,0x635244,0x605042,0x574739,0x291a0c,0x0d0300,0x010200,0x000305,0x002a40,0x248eb6,0x27c4fc,0x04beff,0x00bfff,0x00beff,0x00c0ff,0x00bfff,0x00c0ff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b9ff,0x00b9fd,0x0ebef9,0x2ec9f9,0x6ae9ff,0x9bffff,0xa3fdff,0x99f5ff,0x7bedff,0x5addff,0x36c4ee,0x2ac5f5,0x1ecbff,0x15ccff,0x0ec9ff,
+0xccedf5,0xc2f0f8,0xbdeffa,0xc3f2ff,0xd4ffff,0xbefaff,0xadf1ff,0x99e3f7,0x9beaff,0x9defff,0x81e2fd,0x62def8,0x4edbf4,0x4bdff6,0x3cd7f0,0x2bcfee,0x31d5f7,0x40d9ff,0x4edeff,0x55deff,0x5bddfe,0x64deff,0x66dfff,0x5ddbff,0x57e4ff,0x3adfff,0x1ad2ff,0x09cfff,0x00c7fc,0x00c1f8,0x00bef6,0x08c4fe,0x19d0ff,0x1ed2ff,0x1ed2ff,0x1ad1ff,0x0ecbff,0x01c7fa,0x0ec2f2,0x2fb7e3,0x1a7093,0x000010,0x000313,0x002c45,0x3690ac,0x58bcd6,0x0e5d6b,0x000502,0x1c1304,0x53412e,0x695440,0x63523d,0x60503a,0x625039,0x655339,0x655539,0x635437,0x655337,0x665337,0x655236,0x665136,0x665136,0x665136,0x655236,0x655236,0x655236,0x665337,0x655236,0x665337,0x665337,0x655236,0x665337,0x665337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665136,0x665136,0x655236,0x655236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x645236,0x665337,0x665337,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x675337,0x665136,0x665135,0x665235,0x675336,0x675337,0x675337,0x675337,0x685237,0x695237,0x695238,0x68523a,0x67523c,0x65523e,0x655240,0x645240,0x645340,0x594838,0x332618,0x080000,0x000503,0x000813,0x002943,0x1993c1,0x1ec0fb,0x03bcff,0x00c1ff,0x00c1ff,0x00c0ff,0x00c1ff,0x00bffd,0x00befc,0x00befc,0x00bdfd,0x00bdfe,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00b8ff,0x00bafd,0x0cbbf7,0x26c5f8,0x5ce3ff,0x8af1ff,0xa1f7ff,0xb0ffff,0x9bf7ff,0x77deff,0x54d2f9,0x29c9f6,0x1bcfff,0x14d0ff,
+0xd0f0f8,0xb2e7ed,0x9fdce3,0xa1d9e4,0xbef5ff,0xbff7ff,0xb4f0ff,0xa8ecfb,0xa9eeff,0xafefff,0xaaf6ff,0x7de3fa,0x5fdbf2,0x4fdbf3,0x3dd5f0,0x2dcfed,0x35d5f6,0x46d9fd,0x55deff,0x5addfe,0x5ddcfe,0x60deff,0x5de0ff,0x49d6ff,0x3cd9ff,0x13c4f5,0x00b8e9,0x00c0f3,0x00bef2,0x01bff4,0x15ccff,0x23d4ff,0x29d7ff,0x29d6ff,0x27d5ff,0x21d2ff,0x17cdfe,0x0ecafc,0x23c9f7,0x34a6cc,0x003250,0x00000f,0x00031b,0x1a7192,0x44b2d4,0x2b8aa3,0x001721,0x000100,0x45331e,0x695640,0x65513b,0x62503a,0x625139,0x625137,0x655338,0x645338,0x645337,0x655337,0x665337,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x665136,0x675337,0x665136,0x675337,0x675337,0x675337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x645236,0x645236,0x645236,0x635236,0x635236,0x635236,0x635236,0x635236,0x635236,0x635236,0x635236,0x645236,0x645236,0x645236,0x645236,0x645236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675237,0x685237,0x685238,0x675238,0x67523a,0x66523b,0x66533c,0x66533c,0x65533d,0x655440,0x5b4c3c,0x1d1105,0x070200,0x000002,0x000005,0x003b60,0x28b4e8,0x07b6f5,0x00bdff,0x00c1ff,0x00c3ff,0x00c2ff,0x00c0fb,0x00bffa,0x00bffb,0x00befc,0x00befe,0x00bfff,0x00beff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00b9ff,0x00b8ff,0x00b6fc,0x00b4f2,0x10b2eb,0x36b6ea,0x67d1fe,0xa1ffff,0x92f0ff,0x8ff7ff,0x7bf9ff,0x24c5f4,0x05bdf3,0x03c3ff,
+0xd7f9ff,0xb1e9ed,0xa2e4e9,0x98dbe1,0xa7e5ef,0xc3f9ff,0xc0f6ff,0xb3f0fe,0xaeeffe,0x9dddef,0xacf2ff,0x9ff2ff,0x85e7ff,0x6de1fd,0x4fd3f1,0x3aceed,0x41d7f7,0x4dd7fb,0x5addff,0x5cdcff,0x56d9ff,0x48d5ff,0x3dd6ff,0x29d1ff,0x10c4fb,0x00b8ee,0x00bbf0,0x00bcf0,0x05bdf0,0x18c8fb,0x29d3ff,0x2fd6ff,0x2fd6ff,0x2cd5ff,0x28d3ff,0x24d1ff,0x1ccdfd,0x17ccfc,0x2dc9f5,0x349cbf,0x002e4c,0x000013,0x052545,0x2e99be,0x42bddf,0x34859c,0x001c23,0x212316,0x64523b,0x614e37,0x635039,0x635038,0x645239,0x645237,0x645236,0x645236,0x645236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x645236,0x645236,0x635236,0x635236,0x635236,0x635236,0x635236,0x615135,0x615135,0x635236,0x635236,0x635236,0x645236,0x645236,0x645236,0x645236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675237,0x675237,0x675338,0x675338,0x675339,0x665339,0x665339,0x66533a,0x63523b,0x62533f,0x423727,0x0f0900,0x000000,0x00040d,0x001330,0x0379a5,0x13b7f1,0x01c1ff,0x00c1ff,0x00c2ff,0x00c2ff,0x00c1fb,0x00c1fb,0x00c2fd,0x00c2fe,0x00c1ff,0x00c0ff,0x00bfff,0x00beff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00b9ff,0x00b9ff,0x00b8ff,0x00b7ff,0x00b5f8,0x05aae7,0x21b7ee,0x48d5ff,0x42ccfa,0x4ad8ff,0x55f0ff,0x16caff,0x00b6f6,0x00b6f9,
+0xccfaff,0xc1fbff,0xb4f8fe,0x91dce6,0x94deec,0xbfffff,0xc2ffff,0xa1edff,0x95eaff,0x87e2fa,0x81e1fa,0x86e8ff,0x93fbff,0x8bfbff,0x5dd9fa,0x48d5f5,0x4bdbfc,0x4fd7fa,0x5addff,0x5bdcff,0x52dbff,0x37d0ff,0x1ac3f8,0x00baf2,0x00b6ef,0x00baf0,0x10c5f7,0x1fcbfb,0x2ed3ff,0x3ad9ff,0x40dcff,0x40dcff,0x39d7ff,0x31d5ff,0x2ad3ff,0x27d2ff,0x22cffe,0x1fcefe,0x35caf5,0x0a6b8b,0x000f2b,0x00021e,0x1a405e,0x4ebadb,0x48bbd5,0x4c848f,0x475754,0x595242,0x64523a,0x635039,0x635039,0x635138,0x645238,0x645237,0x645236,0x645236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675238,0x675238,0x655137,0x655237,0x645237,0x635237,0x625237,0x625237,0x625237,0x625237,0x625237,0x615135,0x605034,0x5f4f33,0x625237,0x645338,0x655338,0x655338,0x645236,0x665337,0x665337,0x675337,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675337,0x675337,0x675337,0x665338,0x635238,0x60513a,0x5b4f3b,0x383021,0x030200,0x000608,0x000619,0x00496c,0x0da8d9,0x02c0fb,0x00c1ff,0x00c2ff,0x00c2ff,0x00c2fd,0x00c3fd,0x00c3fe,0x00c3ff,0x00c3ff,0x00c4ff,0x00c2ff,0x00c0ff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bbff,0x00baff,0x00baff,0x00b8ff,0x00b6f8,0x00afef,0x01adea,0x05afe9,0x04b0e7,0x05b8f1,0x00b7f9,0x00b5fb,0x00b7fc,
+0xb7fbfa,0xbaf5fa,0xb2f3ff,0x95e9fc,0x79d4ed,0x91e8ff,0x8ae8ff,0x49b8d7,0x33b4d5,0x40d2f7,0x2cc6e9,0x2dc3e2,0x4edbfa,0x6ae9ff,0x6eecff,0x51deff,0x45d7f7,0x4cd8fa,0x55deff,0x54dbff,0x4bdcff,0x2bd1fc,0x09beee,0x00b6ed,0x00b6ec,0x1ac4f6,0x3dd8ff,0x4dddff,0x4fdafc,0x55e1ff,0x54e1ff,0x4edeff,0x43d9ff,0x38d8ff,0x2fd4ff,0x2bd2ff,0x26cffe,0x24cefe,0x34c5ee,0x1f7b99,0x001e33,0x000315,0x1f4758,0x5fbdcf,0x4ca3ad,0x536a5f,0x645742,0x62523b,0x635039,0x635039,0x635039,0x635138,0x645238,0x655237,0x655236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x665337,0x655337,0x655337,0x655337,0x655337,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675136,0x675137,0x68523a,0x68523a,0x67543c,0x6b5940,0x65543a,0x625238,0x625238,0x625238,0x625238,0x625238,0x625238,0x625238,0x635339,0x64553a,0x66563c,0x65543c,0x66543c,0x65533a,0x645237,0x665337,0x665337,0x675338,0x675238,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675238,0x675338,0x675337,0x675337,0x665338,0x645237,0x625238,0x5e5038,0x524933,0x161302,0x000600,0x00020b,0x1c677e,0x29bbe1,0x00baec,0x00c1fd,0x00c2ff,0x00c2ff,0x00c2fe,0x00c2fd,0x00c3fe,0x00c3ff,0x00c3ff,0x00c4ff,0x00c4ff,0x00c2ff,0x00c1ff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bcff,0x00bbff,0x00baff,0x00b7fe,0x00b6fd,0x00b6fc,0x00b6fa,0x00b7f6,0x00b8f8,0x00b8fe,0x00b9ff,0x00b7fa,
+0x77d5da,0x9ef1ff,0x88dff4,0x5ac4e0,0x68daf9,0x67d4f2,0x63d6f7,0x45cbf2,0x1db7e3,0x0abbe9,0x00b4e2,0x03b7e0,0x17bee5,0x3ccef9,0x5ae5ff,0x43d6fa,0x42d6f8,0x4adafb,0x50ddfe,0x50dbfe,0x49dcff,0x2fd1f8,0x1cc9f5,0x15cbfb,0x1fceff,0x45dfff,0x5ae5ff,0x64e6ff,0x60e0fd,0x5de0fc,0x57deff,0x4ddaff,0x43d6ff,0x3cd8ff,0x36d9ff,0x32d7ff,0x2cd2ff,0x29cffe,0x3ac5ee,0x146984,0x000f20,0x000813,0x3a5f66,0x78bbc3,0x427978,0x4f513f,0x695037,0x665139,0x64513a,0x635039,0x635038,0x635037,0x655238,0x655137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x665338,0x665338,0x665338,0x665338,0x665337,0x665337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675136,0x685138,0x664f39,0x6a543f,0x624f3a,0x503f2a,0x5b4b34,0x63533b,0x625239,0x625239,0x625239,0x625239,0x625239,0x625239,0x5a4a31,0x4d3d24,0x473720,0x503f29,0x5c4b34,0x65533b,0x655339,0x655338,0x665337,0x655137,0x655138,0x655138,0x665339,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675238,0x675338,0x675338,0x675338,0x665337,0x655338,0x635439,0x675b43,0x453f2a,0x0d0e01,0x000000,0x003141,0x1791b2,0x12bdec,0x00c2fd,0x00c2ff,0x00c1ff,0x00c2ff,0x00c4ff,0x00c5ff,0x00c5ff,0x00c4ff,0x00c4ff,0x00c4ff,0x00c4ff,0x00c2ff,0x00c2ff,0x00c0ff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bdff,0x00bdff,0x00bcff,0x00baff,0x00baff,0x00baff,0x00bafe,0x00b9fd,0x00b9ff,0x00b9ff,0x00b8fc,
+0x32afc5,0x52d3f2,0x54dcfe,0x2bbcdf,0x3bc9ea,0x54d8f4,0x4fd1f1,0x44d2fe,0x26c4f8,0x05baf1,0x00b9ef,0x00bbef,0x09bff1,0x1cc6f6,0x3bddff,0x3ad9ff,0x3dd6fb,0x46d8f9,0x4ddbfb,0x4ddbfb,0x4ddbfc,0x4ad8fd,0x45d7fd,0x3ed7fe,0x44dbff,0x56e2ff,0x61e5ff,0x63e5ff,0x60e2ff,0x57ddfb,0x51dbfc,0x49d8fd,0x3fd4fa,0x3cd7fe,0x39d9ff,0x37daff,0x31d4ff,0x30d1ff,0x43c7ef,0x0b556e,0x000412,0x000810,0x435e61,0x4e6d6e,0x0d201c,0x3f382d,0x64503e,0x65513c,0x65513a,0x655139,0x655139,0x655138,0x655138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675339,0x665339,0x665339,0x665338,0x665338,0x655236,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x685137,0x695039,0x674f3b,0x6b5543,0x493626,0x1f0e00,0x33220f,0x564630,0x66563e,0x63533b,0x62523a,0x63533b,0x64543c,0x58482f,0x271700,0x180800,0x150500,0x150500,0x2c1b07,0x4a3924,0x5d4c33,0x68573c,0x625034,0x645237,0x645238,0x645238,0x645238,0x655238,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675238,0x675338,0x665338,0x645339,0x65573e,0x5a4e38,0x292010,0x080000,0x000a15,0x004768,0x2fb6e7,0x08bff9,0x00bffd,0x00bffc,0x00c2fe,0x00c4ff,0x00c6ff,0x00c9ff,0x00c6ff,0x00c2fd,0x00c7ff,0x00c3ff,0x00bfff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00b9fe,0x00b8fe,0x00b7fe,0x00b7fe,
+0x57cde8,0x31b9dd,0x2dc5ee,0x21c5ee,0x2bcdf3,0x44d7f7,0x64f2ff,0x4bddff,0x21c1f8,0x07bff9,0x00bcf8,0x00bbf6,0x00bdf6,0x09c3f8,0x17cafb,0x26cffc,0x3ad8ff,0x47d8fa,0x4dd8f7,0x4fdafa,0x55ddfe,0x5fe0ff,0x62e3ff,0x57dfff,0x54dfff,0x56ddfe,0x5be1ff,0x5de2ff,0x5ae2ff,0x53ddff,0x4adafd,0x3fd7fc,0x36d3f9,0x32d4f9,0x36d9ff,0x38daff,0x37d8ff,0x36d8ff,0x57dcff,0x29738a,0x00121e,0x00060c,0x001111,0x000501,0x010000,0x26190f,0x634f42,0x66523e,0x66513a,0x665139,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675238,0x665137,0x665137,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675338,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675137,0x695038,0x69503a,0x68503e,0x675142,0x382619,0x0e0000,0x130200,0x473723,0x675741,0x63533d,0x62523b,0x62523b,0x66553f,0x5a4a33,0x35250e,0x110000,0x180700,0x1c0c00,0x110000,0x0e0000,0x190900,0x4e3d24,0x66543b,0x635137,0x635137,0x635138,0x645239,0x645239,0x655139,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x67523a,0x675239,0x675239,0x675239,0x675238,0x665338,0x655339,0x64533a,0x64553d,0x4d3e2c,0x170800,0x000001,0x001633,0x1e89b7,0x12b8f0,0x00bcf9,0x00bdf9,0x00c2fd,0x00c5ff,0x00c7ff,0x00cbff,0x00cbff,0x00bffa,0x00bffb,0x00c1ff,0x00c2ff,0x00c0ff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00baff,0x00b9ff,0x00b6fd,0x00b5fb,0x00b6fd,0x00b7ff,
+0xa9f1ff,0x69d2f1,0x32b9e1,0x10b5e2,0x14c0ed,0x2ecbf4,0x58ecff,0x66f9ff,0x2ecdff,0x0ec5ff,0x00c2fe,0x00bffa,0x00baf4,0x00bdf4,0x00c0f4,0x12c4f6,0x3adcff,0x57e4ff,0x5cdfff,0x56dafb,0x58d9fb,0x64deff,0x66e1ff,0x57d9fd,0x50d8fb,0x4edafd,0x50deff,0x53e2ff,0x53e3ff,0x4cdfff,0x40daff,0x32d7ff,0x25d0fb,0x24d2f8,0x2ed9fc,0x37d8fa,0x37d8fa,0x30d9fd,0x52e2ff,0x257b8f,0x000612,0x000a0e,0x000503,0x000300,0x0b0500,0x49372c,0x6b5345,0x67523e,0x67523b,0x665139,0x665138,0x665138,0x665138,0x675138,0x675138,0x675138,0x675138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x655037,0x68543a,0x655037,0x655037,0x675239,0x675239,0x665138,0x675239,0x675239,0x675239,0x675238,0x675338,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675137,0x695039,0x6a503c,0x685040,0x685246,0x3c291f,0x0e0000,0x160600,0x4b3a28,0x63533f,0x63533f,0x63533f,0x62523e,0x675642,0x584733,0x564632,0x584733,0x8c7c68,0x80705d,0x352411,0x040000,0x0a0000,0x1e0d00,0x56442d,0x67553e,0x624f38,0x624f37,0x64523a,0x64513a,0x645039,0x655039,0x67523b,0x6c5740,0x6c5740,0x6c5740,0x69553d,0x67523b,0x67523b,0x67523b,0x67523b,0x67523b,0x67523a,0x675239,0x675239,0x675239,0x675239,0x675239,0x665339,0x66533a,0x66543b,0x5f503b,0x261a0e,0x000000,0x000317,0x065b81,0x1db0e6,0x02baf7,0x00bcf7,0x00c0fb,0x00c4fe,0x00c5ff,0x04cdff,0x08d0ff,0x02c9ff,0x00c6ff,0x00c3ff,0x00c5ff,0x00c0ff,0x00c1ff,0x00beff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bbff,0x00b9ff,0x00b6fe,0x00b4fb,0x00b5fd,0x00b8ff,
+0xdeffff,0xb7fdff,0x6ad4f6,0x1fb5e1,0x16c0f2,0x1dc5f8,0x21c6fa,0x3bdbff,0x31d7ff,0x0dc6ff,0x06c8ff,0x02c5ff,0x00bdf8,0x00bef7,0x00bff6,0x0bc3f7,0x21cbfa,0x48deff,0x5ae4ff,0x52d9fb,0x56d8fb,0x5fdafe,0x63dfff,0x56d9fd,0x4dd7fb,0x47d9fd,0x41d8fc,0x41d8fc,0x45deff,0x40dcff,0x2fd3fe,0x20d0fb,0x12c5ee,0x10bde0,0x2dcded,0x47d2f0,0x45d0ed,0x36d4f2,0x3ccae4,0x54afc1,0x00353f,0x00080a,0x000602,0x050800,0x271e13,0x644f42,0x6f5746,0x67513c,0x66513a,0x665139,0x665138,0x665138,0x665138,0x675138,0x685138,0x685138,0x675138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x675239,0x675239,0x675239,0x67523a,0x67523a,0x66523a,0x66523b,0x66523b,0x68543c,0x67543c,0x68553d,0x68553d,0x65513a,0x66523b,0x66523b,0x68553e,0x66523b,0x66523b,0x66523b,0x66523a,0x665339,0x675338,0x675338,0x675238,0x675238,0x675238,0x675237,0x675237,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665137,0x675138,0x69503a,0x69503d,0x685041,0x685247,0x3c2920,0x0e0000,0x1f0e00,0x564634,0x62523f,0x62523f,0x635340,0x635340,0x645441,0x5b4b37,0x62523e,0x7c6b57,0xb2a28e,0x9c8c78,0x998974,0x4b3b26,0x130300,0x0c0000,0x241300,0x56432e,0x685640,0x5f4d36,0x62503a,0x63503a,0x624f39,0x6a5640,0x68533e,0x56422c,0x56422c,0x58442f,0x624e38,0x68533e,0x68533e,0x66523d,0x66523d,0x67523c,0x67523a,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x665339,0x665339,0x695943,0x4a3f30,0x030503,0x000310,0x002f4d,0x1496c7,0x0fbbf5,0x00bdf7,0x00c3fd,0x00c5ff,0x00c1fd,0x01c9ff,0x07ceff,0x0dd2ff,0x0cd0ff,0x03cbff,0x00c9ff,0x00c6ff,0x00c3ff,0x00c0ff,0x00beff,0x00bdff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00b9ff,0x00b6fe,0x00b3fb,0x00b4fc,0x00b8ff,
+0xe5fdff,0xe1ffff,0xbbfbff,0x59d0f5,0x1bb9eb,0x05bcf9,0x00befe,0x00b8f5,0x09c1fd,0x02c0fc,0x0cceff,0x0cceff,0x03c4ff,0x02c5fe,0x09caff,0x13cfff,0x15cbfb,0x15c2ec,0x2bcdf2,0x46d9fd,0x4ed7fa,0x56dafd,0x5bdfff,0x51dbfe,0x49dafe,0x41d9ff,0x39d5fc,0x31cff5,0x33d4fb,0x2dd4fd,0x1dcbf4,0x15cdf3,0x1accee,0x22c0dc,0x37b9d3,0x23829d,0x005a76,0x23a1bc,0x46c3da,0x61bccc,0x17535b,0x000202,0x000500,0x16160b,0x4e4335,0x675241,0x6a513e,0x67513b,0x66513a,0x665139,0x665138,0x665138,0x665138,0x675138,0x685138,0x685138,0x675138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x675239,0x675239,0x675239,0x67523a,0x66533b,0x66533c,0x66523d,0x66523e,0x624f39,0x5d4a35,0x46341f,0x473621,0x402f1b,0x41301d,0x4c3a27,0x54422f,0x614f3b,0x65533e,0x65533d,0x66533c,0x66533b,0x66533a,0x67523a,0x67523a,0x685239,0x675137,0x675136,0x685237,0x675136,0x675136,0x675136,0x675136,0x675136,0x675136,0x665137,0x665138,0x665139,0x66513a,0x68503b,0x68503e,0x675042,0x665147,0x3a2820,0x0c0000,0x1d0d00,0x584736,0x635340,0x635340,0x635340,0x645441,0x665542,0x63533f,0x3d2d18,0x32220d,0x7c6c55,0x9c8c75,0x9b8b73,0x9f8f78,0x5f4e3a,0x150500,0x080000,0x1e0d00,0x55442e,0x65543e,0x604f3a,0x614f3a,0x5f4d38,0x513d2a,0x2a1703,0x120000,0x120000,0x150200,0x2d1907,0x4d3a28,0x5c4937,0x675341,0x665240,0x66523f,0x67523b,0x675239,0x675239,0x675239,0x675239,0x675239,0x675239,0x665339,0x665339,0x64543e,0x5d5141,0x221f19,0x00040c,0x000720,0x00537d,0x1bbcf0,0x00bdf5,0x00c5ff,0x00c7ff,0x00c0fd,0x00c3ff,0x05ccff,0x0cd0ff,0x08cdff,0x00c6ff,0x00c7ff,0x00c5ff,0x00c1ff,0x00c0ff,0x00beff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00b9ff,0x00b6fe,0x00b4fc,0x00b5fd,0x00b8ff,
+0x000000,0xe5f9ff,0xd4ffff,0x9bf4ff,0x3fc4ef,0x0dbcf5,0x09cdff,0x00c1fe,0x00bdf9,0x03c3ff,0x0fceff,0x0ecdff,0x0ccbff,0x0bcaff,0x11ceff,0x14cfff,0x1dd6ff,0x12c8f4,0x0bb8e0,0x3cd9ff,0x46d9fd,0x4cd9fd,0x50deff,0x4ddfff,0x45dcff,0x3cd9ff,0x34d5ff,0x2bcef8,0x29d0fa,0x25d0fa,0x1dc8f0,0x23cdf0,0x3ad1ef,0x3eb6cb,0x005567,0x001f32,0x00091c,0x0e6878,0x75d6e3,0x6cb7bf,0x144649,0x000200,0x000200,0x282316,0x5f5241,0x67533f,0x664f39,0x655038,0x655139,0x665138,0x665138,0x665138,0x665138,0x675138,0x675138,0x675138,0x675138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x665138,0x67523a,0x66523a,0x66533a,0x65533b,0x64533c,0x64533e,0x655442,0x5d4b3b,0x3f2d1b,0x2b1a07,0x180800,0x130400,0x0d0000,0x100000,0x150400,0x1a0900,0x2c1c0d,0x473726,0x594735,0x614f3c,0x65533f,0x66543f,0x66523d,0x67523c,0x66513a,0x675138,0x675137,0x675136,0x675136,0x685136,0x685136,0x675136,0x675137,0x675138,0x665138,0x67543c,0x67533d,0x65513c,0x66513e,0x513b2b,0x543f32,0x6c584f,0x402e27,0x090000,0x1d0d00,0x574735,0x62533f,0x61523e,0x625340,0x61523f,0x665744,0x52432f,0x170800,0x170800,0x6a5b41,0x9d8e73,0x96876c,0x97886e,0xa2927b,0x4f3f2a,0x000000,0x100100,0x221300,0x50422d,0x62533f,0x574734,0x3b2a18,0x170600,0x100000,0x0f0000,0x0e0000,0x0f0000,0x110000,0x1c0a00,0x332114,0x564436,0x635142,0x695644,0x6c5842,0x675239,0x665138,0x675239,0x675239,0x675239,0x675239,0x665339,0x665339,0x64533b,0x625542,0x403930,0x0a0c10,0x00081b,0x00385b,0x20b0df,0x00bdf2,0x00c4fe,0x00c4ff,0x00c0ff,0x00c3ff,0x00c8ff,0x03caff,0x00c4ff,0x00bfff,0x00c0ff,0x00bfff,0x00c0ff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00b9ff,0x00b8ff,0x00b5fd,0x00b6fe,0x00b8ff,
+0xdcffff,0xd5f6ff,0xcbf4ff,0xbcf9ff,0x9fffff,0x46d7ff,0x22d2ff,0x06c1f5,0x00bdf5,0x0bc8ff,0x13cfff,0x11ceff,0x10cdff,0x15cfff,0x1ad2ff,0x17cdff,0x1ed1ff,0x25d6ff,0x1fcaf6,0x37daff,0x3edaff,0x3cd4fa,0x3ad2f7,0x48e1ff,0x43dfff,0x37d7ff,0x2fd3ff,0x27cffb,0x23cef8,0x21cbf5,0x29c6ed,0x44c7ea,0x137590,0x003443,0x000002,0x00070d,0x00090b,0x3c6e6c,0x629995,0x204945,0x00110d,0x010600,0x0a0400,0x3c3223,0x5d503c,0x615139,0x635136,0x635136,0x655237,0x675338,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x675338,0x675338,0x665137,0x675238,0x665138,0x655139,0x655139,0x64523a,0x63523a,0x63533c,0x63553f,0x5f513f,0x4e4033,0x1f1004,0x070000,0x0c0000,0x0b0000,0x0a0000,0x0c0000,0x0c0000,0x0a0000,0x0b0000,0x080000,0x0d0000,0x190800,0x402e21,0x564436,0x604e3e,0x63503f,0x64513e,0x64503a,0x655139,0x655036,0x665136,0x675136,0x685136,0x685136,0x675137,0x665138,0x665139,0x65513a,0x624f39,0x62503d,0x635140,0x574434,0x110000,0x100000,0x69584f,0x45352d,0x060000,0x1c0f00,0x554834,0x61543d,0x5f533d,0x615440,0x625542,0x574a38,0x261905,0x080000,0x3f3316,0xab9e7f,0x9f9172,0x96896a,0x95876a,0xa19376,0x8c7e63,0x2d2007,0x090000,0x060000,0x231904,0x514632,0x362a18,0x140600,0x0c0000,0x0e0000,0x0d0000,0x0c0000,0x0b0000,0x0a0000,0x060000,0x050000,0x160700,0x2e1d11,0x4b3928,0x614e38,0x675239,0x634f35,0x655035,0x665137,0x675338,0x675338,0x665338,0x665338,0x645339,0x61523b,0x5d5446,0x1a1819,0x000413,0x001836,0x209bc3,0x00bcec,0x00c1f9,0x00bffd,0x00c0ff,0x00c1ff,0x00bfff,0x00baff,0x00bafe,0x00bcff,0x00bdff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,0x00b7ff,0x00baff,
+0xb4e8f0,0xb5edf8,0xbcf4ff,0xbef3ff,0xaff6ff,0x79eaff,0x2fbfe4,0x13b9e5,0x0ec1f3,0x13cbff,0x14cfff,0x0fcdff,0x0eccff,0x15cdff,0x1cd0ff,0x1bcdff,0x1eceff,0x23d2ff,0x2ad4ff,0x3cdeff,0x3cdaff,0x32d0f6,0x2ac9ef,0x35d8ff,0x33d8ff,0x2ed3ff,0x2ad1ff,0x23d0fe,0x22ccf8,0x28c8f2,0x3dc2e9,0x48a6c4,0x001d31,0x000307,0x000100,0x000000,0x60675f,0x596f65,0x001106,0x000000,0x000300,0x0a0400,0x1a0e04,0x463a29,0x5c4f38,0x605137,0x615135,0x635236,0x645236,0x665337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665136,0x675338,0x665138,0x655139,0x64513a,0x63523a,0x61513a,0x61523c,0x685b46,0x504434,0x180c02,0x0e0100,0x110400,0x0d0000,0x0a0000,0x0c0000,0x0b0000,0x0a0000,0x060000,0x0b0000,0x0e0000,0x0d0000,0x100000,0x150400,0x29180e,0x443327,0x554335,0x685645,0x5f4d38,0x635038,0x645036,0x665136,0x675136,0x685136,0x685136,0x675138,0x665139,0x65513a,0x64523b,0x5f4e39,0x5f4e3c,0x625241,0x39291a,0x090000,0x010000,0x72625b,0x392a22,0x070000,0x1b0f00,0x554a34,0x61553e,0x60543d,0x605440,0x615543,0x4b3f2d,0x110500,0x0b0000,0x94896a,0xc2b795,0xb8ac8a,0x9f9272,0x948767,0x918464,0x9a8e6f,0x75694f,0x120800,0x060000,0x060000,0x2b220f,0x241a09,0x100400,0x0d0100,0x0d0000,0x110400,0x180b01,0x22150d,0x120500,0x0a0000,0x080000,0x090000,0x0e0000,0x1d0b00,0x3f2c16,0x675239,0x675338,0x665136,0x665136,0x675337,0x675337,0x665337,0x665337,0x655338,0x64533a,0x615544,0x1f1b18,0x00010b,0x000b1f,0x076b8c,0x05b6e4,0x00bef7,0x00befe,0x00beff,0x00bfff,0x00bdff,0x00baff,0x00baff,0x00baff,0x00bcff,0x00beff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bbff,0x00bbff,0x00baff,0x00b9ff,0x00b9ff,0x00baff,0x00baff,
+0x88d1dd,0x81daeb,0x89dff4,0xbefdff,0xb0edff,0xa4f2ff,0x7ce0ff,0x43c3e7,0x32cbf7,0x1ac8fd,0x13cfff,0x0bd0ff,0x09ccff,0x13ccff,0x1cd0ff,0x1accff,0x1bccfd,0x20cfff,0x2ad3ff,0x41ddff,0x44dcff,0x34d2f9,0x22c7ed,0x17c4ea,0x16c5ee,0x1fcbf8,0x23d0ff,0x22d5ff,0x24cbf9,0x39c1ed,0x3195b9,0x0b455b,0x00080d,0x010a00,0x020300,0x636351,0x898b7d,0x030900,0x000000,0x000000,0x020000,0x090000,0x291b10,0x504230,0x5c4e36,0x625337,0x635235,0x635236,0x645236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665138,0x655139,0x64513a,0x63523b,0x605039,0x655640,0x514431,0x25190a,0x050000,0x0c0200,0x0d0200,0x0b0000,0x24180a,0x2e2113,0x302216,0x34251b,0x3b2c23,0x22120a,0x160500,0x0b0000,0x0b0000,0x090000,0x0b0000,0x1e0c04,0x200e04,0x433224,0x5f4e3b,0x614f38,0x634f35,0x655035,0x665035,0x685136,0x695037,0x685038,0x66513a,0x65513b,0x61513a,0x60513c,0x665744,0x483929,0x1a0c00,0x080000,0x24160d,0x8a7c75,0x2a1c15,0x090000,0x1d1100,0x584c37,0x635840,0x60543d,0x625643,0x5f5241,0x1c1000,0x0b0000,0x5f5338,0xd0c5a4,0xbdb290,0xbeb28f,0xb3a684,0x988b6a,0x958867,0x9a8e6f,0x91876c,0x4e442d,0x010000,0x010000,0x0d0500,0x120900,0x100500,0x130700,0x1d1100,0x372b19,0x4f4334,0x5b4e43,0x463931,0x1c0f0a,0x070000,0x090000,0x090000,0x080000,0x160300,0x59442b,0x69553a,0x665136,0x665136,0x675337,0x675337,0x665337,0x665337,0x665338,0x67523a,0x675645,0x353128,0x000707,0x00060e,0x002e46,0x079fcf,0x00b7f4,0x00beff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00baff,0x00bbff,
+0xa4ebf9,0x81daec,0x7cd5eb,0x9fe6ff,0xb2efff,0xbaf6ff,0xacf2ff,0x81dffd,0x59d4f9,0x20beee,0x11c7fd,0x04c9fe,0x00c5fa,0x0dc8fd,0x1bcfff,0x19cbfe,0x15c6f7,0x18c9f7,0x2ad3ff,0x3fd9ff,0x48deff,0x3cd9ff,0x2dd1f8,0x1ecbf2,0x1acaf4,0x1bc8f6,0x1dc9f8,0x11c0ed,0x24bee9,0x4fbde7,0x084e6d,0x001521,0x000200,0x000000,0x5e5d3c,0xaaab92,0x2f3020,0x000000,0x090702,0x020000,0x070000,0x120600,0x35271b,0x524432,0x5d4e36,0x625236,0x635234,0x645236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665138,0x655139,0x64513b,0x63523c,0x60513d,0x4e412f,0x2f2414,0x140b00,0x050000,0x000000,0x130900,0x322617,0x594d3b,0x605240,0x615240,0x615241,0x605041,0x58483a,0x47362b,0x160400,0x0c0000,0x0f0000,0x120000,0x120000,0x110000,0x3b2a1c,0x655441,0x614f39,0x634f36,0x655035,0x665035,0x685137,0x695038,0x685039,0x66513a,0x64523c,0x61523d,0x5f513e,0x584a39,0x281a0b,0x120500,0x0f0300,0x5c5044,0x90847b,0x1c0f08,0x070000,0x1e1202,0x594d39,0x635841,0x5f533d,0x5c503d,0x453927,0x0f0300,0x180c00,0x9b9073,0xcabf9e,0xc0b692,0xbdb28e,0xbbaf8c,0xa39674,0x998d6a,0x968a6a,0x91876a,0x7e765c,0x1a1300,0x070000,0x080100,0x0a0200,0x0f0400,0x271b06,0x534731,0x625641,0x625644,0x64584a,0x66594f,0x43352f,0x160906,0x0c0000,0x0a0000,0x0c0000,0x150200,0x554127,0x69553a,0x655035,0x665136,0x675337,0x675337,0x665337,0x665337,0x675338,0x6a5239,0x675340,0x4d483b,0x040b04,0x000606,0x001d2e,0x078bb8,0x03b2f0,0x00bcfe,0x00bbff,0x00baff,0x00b9ff,0x00baff,0x00b9ff,0x00b9ff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00baff,0x00b9ff,0x00baff,0x00bcff,0x00bcff,0x00baff,0x00baff,0x00b9ff,0x00baff,0x00baff,0x00baff,
+0xd2ffff,0xbaf3ff,0x93d5e7,0x78c5de,0x8ed8f4,0xbff8ff,0xccffff,0xbfffff,0x94f0ff,0x3ac1eb,0x10b9e9,0x01c1f4,0x00c2f7,0x0bc7fd,0x1acfff,0x1ccdff,0x19cafb,0x1bccfa,0x23cffb,0x35d4ff,0x43dcff,0x45dfff,0x41deff,0x37daff,0x33d9ff,0x2cd2ff,0x28cdfc,0x19bae2,0x31b7db,0x2a7b9f,0x00051d,0x000304,0x000000,0x2f2f0b,0xb4b58f,0x3f4329,0x000000,0x060700,0x060500,0x070400,0x040000,0x221810,0x4a3d31,0x4f402e,0x5e4d36,0x635236,0x645234,0x655236,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665138,0x65513a,0x65533d,0x645442,0x5d5040,0x170d00,0x000000,0x0c0600,0x080100,0x010000,0x3f3427,0x615544,0x645642,0x62523d,0x63523c,0x63523b,0x63523c,0x64533f,0x685645,0x524132,0x362619,0x1e0e02,0x100000,0x0d0000,0x180700,0x453424,0x685643,0x63503a,0x634f37,0x655036,0x665035,0x685137,0x685138,0x675139,0x64513b,0x63533e,0x60523f,0x5d503f,0x3c2f21,0x040000,0x060000,0x302415,0x928778,0x7e7367,0x0b0000,0x060000,0x201506,0x5c503e,0x635743,0x615541,0x4e4230,0x1d1100,0x130700,0x54492f,0xc5ba9b,0xc1b795,0xc1b793,0xc1b692,0xc0b491,0xafa37f,0x968b67,0x928765,0x918767,0xa0987b,0x615a41,0x0b0400,0x090200,0x080000,0x0c0200,0x463b24,0x695e46,0x61553e,0x5d523d,0x5d5141,0x4c3f33,0x160901,0x190b07,0x190b06,0x170800,0x0d0000,0x271400,0x604b32,0x675338,0x655035,0x665136,0x675337,0x675337,0x665337,0x665337,0x675337,0x6b5137,0x69533c,0x645b4a,0x0f1206,0x000804,0x000e1b,0x006992,0x10b1ec,0x00b9fb,0x00baff,0x00b9ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00baff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00b9ff,0x00baff,0x00baff,0x00baff,
+0xbff0fe,0xd0feff,0xc0f8ff,0x81cfe7,0x7acbe5,0xa8e8ff,0xc5f9ff,0xd3ffff,0xc1ffff,0x7fe2ff,0x44c9f2,0x11b6e4,0x07bdef,0x0fc6fb,0x1fd5ff,0x1ed0ff,0x21d1ff,0x25d4ff,0x27d2fd,0x24c9f3,0x36d6ff,0x46e1ff,0x43deff,0x3ddcff,0x3ddcff,0x3dd9ff,0x42d5ff,0x52d8fa,0x1b819d,0x00273f,0x000510,0x000000,0x29280c,0xa7a77f,0x4e502a,0x0b0e00,0x020500,0x0b0b04,0x0b0905,0x0c0905,0x030000,0x342b23,0x4a3d31,0x4f3f2d,0x5e4c34,0x635135,0x655234,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x655138,0x66533b,0x64533f,0x5d4e3e,0x2e2216,0x0b0200,0x060000,0x090400,0x050000,0x271e14,0x594e3f,0x605240,0x63533f,0x64533d,0x645239,0x645238,0x645239,0x64513a,0x66543e,0x5c4a37,0x5d4d3b,0x5a4b3b,0x584839,0x382718,0x503f2d,0x5d4c38,0x64513c,0x65513a,0x655038,0x655037,0x675137,0x675137,0x675138,0x65513a,0x64533e,0x635442,0x615544,0x433829,0x150900,0x060000,0x180d00,0x877d6b,0x9f9584,0x746a5b,0x070000,0x060000,0x23170a,0x5f5243,0x625645,0x685c49,0x392d1b,0x110500,0x080000,0x918669,0xcabf9e,0xc0b693,0xc1b793,0xc2b792,0xc1b691,0xbeb28d,0xa09570,0x918863,0x928a67,0x9f9878,0x676044,0x060000,0x090200,0x0a0200,0x302610,0x584d37,0x635840,0x5c5139,0x5c513b,0x594e3c,0x3b2f22,0x090000,0x110500,0x443730,0x44362a,0x3c2c1c,0x5a4731,0x655037,0x675338,0x665136,0x665136,0x675337,0x675337,0x665337,0x665337,0x675336,0x6c5134,0x695236,0x625641,0x373527,0x090d07,0x000813,0x004264,0x21b2e8,0x00b8f9,0x00b9ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00baff,0x00baff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00b9ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,
+0x83c8d8,0xbcf5ff,0xcfffff,0xa3ecff,0x80d1e9,0x7dcde6,0x9addf5,0xcffbff,0xdcffff,0xcafcff,0xa7f3ff,0x67ddff,0x34caf6,0x22cfff,0x18ceff,0x1ed1ff,0x21d1ff,0x2ad6ff,0x2dd8ff,0x25d1fa,0x1ec7f1,0x2ecffa,0x37d7ff,0x26c8f5,0x33cffb,0x3bcaf6,0x5bd3fa,0x3b95af,0x001929,0x00070d,0x000300,0x000400,0x747854,0x777a53,0x000000,0x030400,0x000000,0x171510,0x15110e,0x060100,0x0c0500,0x3f332c,0x4b3b30,0x513f2d,0x5e4a33,0x645035,0x655234,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655137,0x655139,0x64513b,0x665542,0x4c3d2e,0x130800,0x0a0200,0x080300,0x080300,0x362f25,0x584e41,0x5d503f,0x635340,0x64533e,0x65533d,0x655139,0x655138,0x655137,0x655138,0x645239,0x65533c,0x65543f,0x645440,0x665542,0x665541,0x63523b,0x64513a,0x665138,0x675138,0x675138,0x675138,0x665138,0x665138,0x66523a,0x66543e,0x645442,0x5f5141,0x473b2e,0x170c01,0x0b0000,0x110700,0x6f6653,0xc0b8a2,0xaca48e,0x625947,0x020000,0x070000,0x392d22,0x615448,0x5d5143,0x524635,0x190d00,0x000000,0x463b20,0xc4b99a,0xc4b997,0xc1b793,0xc1b793,0xc2b792,0xc1b68f,0xc1b68e,0xb2a880,0x968d65,0x918963,0x958f6c,0x6f6a4b,0x2e280e,0x030000,0x050000,0x201702,0x4d432d,0x635942,0x5c523b,0x5c523d,0x5b513e,0x4d4235,0x100500,0x080000,0x34281f,0x695b4e,0x655544,0x66523c,0x665138,0x665137,0x665136,0x665136,0x675337,0x675337,0x665337,0x665337,0x685335,0x6d5230,0x6b5232,0x62543b,0x4e4838,0x090a05,0x000710,0x00334d,0x2fafdc,0x0abbfb,0x00b9ff,0x00b9ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00baff,0x00b9ff,0x00baff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00b9ff,0x00baff,0x00bcff,0x00bcff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00b9ff,
+0x89d4e3,0x96daee,0xabefff,0xaff8ff,0x9fefff,0x77cfe7,0x78cae2,0xafebff,0xc9f7ff,0xdcffff,0xc0f6ff,0xa3faff,0x65e0ff,0x2bcaf5,0x14c5f5,0x20d1ff,0x20cefd,0x2dd5ff,0x34dcff,0x29d6fe,0x14c1ea,0x23c9f4,0x34d6ff,0x33d5ff,0x42d7ff,0x5ad5fb,0x3590ad,0x001727,0x000000,0x000600,0x0c1400,0x707754,0xbcc39d,0x242908,0x000000,0x000000,0x28251f,0x413d3a,0x120d0b,0x020000,0x180f0a,0x473a33,0x4c3b30,0x533f2e,0x5b4730,0x655035,0x665234,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655137,0x645139,0x63513c,0x675644,0x3a2b1d,0x0b0100,0x0a0200,0x040000,0x2b241b,0x5e5549,0x625647,0x625341,0x64533f,0x65523e,0x65513b,0x67523a,0x675238,0x665136,0x655136,0x655237,0x65533a,0x64533c,0x64533d,0x65543e,0x64533c,0x645239,0x645037,0x665035,0x675137,0x675138,0x68523a,0x655139,0x645139,0x64523a,0x64533e,0x615242,0x3f3125,0x160b02,0x070000,0x090000,0x58503f,0xbfb8a1,0xc0b9a0,0xa59f86,0x514936,0x050000,0x080000,0x43372d,0x64584c,0x564a3d,0x2f2214,0x040000,0x1f1300,0xbbaf93,0xcbc09f,0xc7bd9a,0xc0b691,0xc1b792,0xc1b791,0xc1b78f,0xc1b88e,0xc1b88e,0x9f966d,0x8d865e,0x8f8a64,0x8f8b69,0x7f7a5e,0x130d00,0x0a0200,0x0e0500,0x3a301c,0x665d47,0x5d533e,0x5a513c,0x5e5442,0x63584b,0x190f04,0x050000,0x170b01,0x504336,0x675846,0x65533c,0x665138,0x665137,0x665136,0x665136,0x675337,0x675337,0x665337,0x665337,0x685334,0x6d522e,0x6c522f,0x645339,0x524a39,0x14140f,0x00080e,0x001324,0x1f90b1,0x0db6f1,0x00baff,0x00b9ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00baff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00baff,
+0xaef0fb,0x7ccee1,0x7ed3e9,0xa6f2ff,0xb2ffff,0x8ae3f7,0x75d4ea,0x71d2eb,0x81d9f2,0xa9efff,0x9ddef2,0xadf7ff,0x90f3ff,0x39c5eb,0x19beeb,0x1ecaf9,0x24d0ff,0x32d6ff,0x38dbff,0x2fd8ff,0x20caf3,0x25cdf8,0x2fd3ff,0x3ad9ff,0x52daff,0x6ecfeb,0x1b5767,0x000203,0x000300,0x000000,0x505a31,0xc0c89f,0x747b57,0x070c00,0x050700,0x000000,0x474440,0x534e4b,0x100907,0x050000,0x281e1a,0x52453e,0x4f3e33,0x54412f,0x59442e,0x665136,0x655033,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655137,0x645139,0x63513c,0x645340,0x1e0f01,0x0a0000,0x0a0100,0x040000,0x3d3326,0x665949,0x60513f,0x64533f,0x65523e,0x66523d,0x65513a,0x675239,0x675338,0x665136,0x665136,0x655136,0x655237,0x635137,0x635239,0x65533a,0x645239,0x645037,0x655037,0x665035,0x675137,0x665138,0x67523a,0x65533b,0x65543d,0x64533d,0x665542,0x544537,0x110400,0x0a0000,0x080000,0x413829,0xb7b09a,0xbcb599,0xaba588,0xa0997f,0x433b28,0x050000,0x080000,0x40352b,0x63584c,0x4a3e32,0x120500,0x000000,0x322710,0xc3b89b,0xc4b998,0xc1b794,0xc1b792,0xc1b791,0xc1b790,0xc1b88f,0xc1b88e,0xc4ba91,0xa69d74,0x898359,0x8f8a63,0x8e8a67,0x969174,0x423d28,0x0c0600,0x0c0300,0x2a200c,0x655b47,0x5d533f,0x5a513d,0x5c5241,0x61574a,0x33281e,0x0f0400,0x050000,0x372a1e,0x685948,0x64513b,0x655037,0x655035,0x655035,0x665136,0x675337,0x675337,0x665337,0x665337,0x685334,0x6d522e,0x6c522f,0x65553a,0x524a39,0x1e1f1a,0x000406,0x000207,0x1b7c91,0x16b6e8,0x00b8fb,0x00b9ff,0x00b8ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00baff,
+0xcafeff,0x8ddbeb,0x74cde0,0x87dcef,0x95eeff,0x87ebff,0x7ae7fe,0x58cbe5,0x4dbbd5,0x72cde5,0x8bdaef,0x96e1f3,0xa7ffff,0x6deaff,0x2abfe5,0x1abde9,0x2bd2ff,0x35daff,0x36dbff,0x36dcff,0x33daff,0x2ad1fd,0x2dcffb,0x3ad0fc,0x5fd7fc,0x40869e,0x001e26,0x000000,0x040100,0x31360c,0xc4cc9c,0xbec59b,0x1c2203,0x000100,0x090a02,0x24221b,0x57524c,0x504944,0x140b07,0x050000,0x1a0e0a,0x493a32,0x4d3c30,0x554230,0x59442e,0x675338,0x655034,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655137,0x64513a,0x63513c,0x5e4d3b,0x201203,0x070000,0x030000,0x2b2012,0x534736,0x60513e,0x62503c,0x64513c,0x65513b,0x65513a,0x665139,0x665137,0x665137,0x665137,0x665136,0x665136,0x655136,0x645036,0x645238,0x645238,0x645238,0x655138,0x645037,0x665137,0x665137,0x655139,0x624f38,0x64533c,0x60513b,0x62533f,0x615240,0x251607,0x040000,0x100600,0x221a0d,0x9d9580,0xbfb89e,0xbbb496,0xb6af92,0x9d967e,0x312a18,0x050000,0x090000,0x3c3229,0x554a3f,0x120600,0x010000,0x201400,0x796e55,0xc6bb9d,0xc0b693,0xbfb590,0xc0b68f,0xc1b78f,0xc1b88e,0xc1b88d,0xc1b88d,0xc4ba8f,0xb4ab80,0x918b60,0x8d885f,0x8d8965,0x969274,0x75705a,0x1a1402,0x0c0400,0x130a00,0x4f4532,0x5d5340,0x5c523f,0x5c5240,0x605546,0x54493d,0x251a11,0x020000,0x190d01,0x5d4e3e,0x65533c,0x655037,0x655035,0x655035,0x665136,0x675337,0x675337,0x675337,0x665337,0x685235,0x6d5130,0x6c5231,0x64533a,0x524a3a,0x1e1f19,0x000101,0x000403,0x004b5a,0x14a9d7,0x00b7f8,0x00b8ff,0x00b9ff,0x00bbff,0x00bdff,0x00bdff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00baff,
+0xdbf9ff,0xb3e9f2,0x8fdceb,0x62c6dc,0x58cae4,0x6ae2fe,0x6de6ff,0x72e7ff,0x70dff9,0x70d5f0,0x7cdcf7,0x7fdbf5,0x94f6ff,0x89fbff,0x57d8f5,0x36c9ef,0x2ecffa,0x2bd7ff,0x2ad7ff,0x32d7ff,0x35d7ff,0x2ed2ff,0x31cdf8,0x41c9f0,0x4cafd0,0x00223a,0x00030d,0x000000,0x201900,0x818154,0xd3d6a6,0x8b8e6a,0x000000,0x000000,0x070500,0x3e392f,0x5f584e,0x544a41,0x170b03,0x050000,0x160601,0x29180f,0x362316,0x564230,0x5a452f,0x665138,0x655036,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655138,0x64513a,0x63513e,0x5e4e3d,0x201203,0x060000,0x120700,0x413423,0x534532,0x5d4d38,0x62513a,0x66523c,0x65513a,0x665139,0x665138,0x665138,0x665138,0x665138,0x665137,0x665136,0x665136,0x655136,0x655237,0x645238,0x655339,0x645238,0x645238,0x655238,0x645239,0x614f38,0x564530,0x574734,0x645643,0x5d503e,0x392c1a,0x100300,0x0d0100,0x090000,0x7e755e,0xb7af92,0xb7af90,0xbab394,0xb9b397,0x8f8a75,0x221b0f,0x080000,0x0c0301,0x4c423c,0x41362d,0x0a0000,0x000000,0x3d311b,0xb8ad91,0xc1b795,0xc0b690,0xbfb58d,0xc0b78c,0xc1b88c,0xc1b88b,0xc1b88a,0xc3b98b,0xc3b98b,0xb8b082,0x9d976a,0x8e895f,0x8d8963,0x938f70,0x89846d,0x322c1a,0x030000,0x0d0500,0x342c1b,0x5d5341,0x5e513f,0x5e513f,0x605443,0x5b5042,0x3a2f25,0x050000,0x0f0300,0x564836,0x66543d,0x655037,0x655035,0x655035,0x665136,0x675337,0x675337,0x675337,0x675337,0x695236,0x6e5134,0x6c5136,0x64533c,0x554e3d,0x292922,0x000100,0x000203,0x002e3e,0x149dcb,0x02b5f6,0x00b8ff,0x00b9ff,0x00bbff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00baff,
+0x000000,0xcbf0f6,0xbfffff,0x80e1f7,0x53cbe7,0x50d4f3,0x55dcfb,0x68e7ff,0x8dffff,0x90f7ff,0x74d3f2,0x6bc9e6,0x6cd0eb,0x86f7ff,0x76f7ff,0x4ce2ff,0x2cd1ff,0x1ecffd,0x1acefd,0x21cefb,0x2bd4ff,0x2fd6ff,0x3dd4fd,0x48c1e3,0x1a6782,0x000007,0x0a0108,0x100400,0x706546,0xd4cfa0,0xbab98a,0x312f11,0x000000,0x020000,0x141005,0x534c40,0x5f5548,0x5d5043,0x26170c,0x080000,0x0f0000,0x0f0000,0x251002,0x55402e,0x604b36,0x655038,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655138,0x64513a,0x63513e,0x584838,0x150700,0x050000,0x241707,0x574936,0x5b4c37,0x605039,0x625139,0x66523b,0x66513a,0x665139,0x67523a,0x665138,0x675239,0x675239,0x665138,0x675338,0x665136,0x665136,0x655137,0x655238,0x645238,0x645238,0x645238,0x655339,0x635239,0x61513a,0x5b4c38,0x5b4c3b,0x625445,0x35281a,0x0b0000,0x120600,0x140900,0x544b2d,0xd0c8a6,0xc0b893,0xbeb793,0xbcb595,0xbab49a,0x736d5c,0x070000,0x0e0504,0x140b0c,0x443936,0x231810,0x0a0000,0x0b0000,0x857a61,0xc3b898,0xc1b792,0xc0b68d,0xc0b78b,0xc1b88b,0xc1b88a,0xc1b889,0xc1b888,0xc3b988,0xc3b988,0xbdb585,0xaaa475,0x8d885d,0x8d8962,0x8f8b6a,0x959077,0x585340,0x000000,0x060000,0x251c0e,0x5d5342,0x60523f,0x61533f,0x605440,0x605544,0x42382b,0x050000,0x090000,0x504230,0x66543d,0x655037,0x665137,0x665136,0x675337,0x675337,0x665136,0x665136,0x665136,0x685136,0x6c5036,0x6c5139,0x64533e,0x5d5646,0x4e4f46,0x050e0b,0x000205,0x00172a,0x0f8dbb,0x09b3f4,0x00b7ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00bcff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00bdff,0x00b9ff,
+0x000000,0xd0ecf1,0xbdeff8,0xa4f3ff,0x79e4fc,0x4bd3f2,0x33c7eb,0x27b8dd,0x57d6fb,0x9ffdff,0x9fedff,0x8dddfa,0x69c8e3,0x5ad5f0,0x48dcfe,0x29d3ff,0x15c9ff,0x12c5fb,0x0dc4f7,0x0bc9f6,0x14d0f9,0x29dbff,0x48ddff,0x4eb6d0,0x0e4759,0x000000,0x030000,0x372712,0xbdaf8b,0xd3ca9a,0xbcb68a,0x1b1600,0x040000,0x0d0a00,0x353023,0x574e3f,0x605343,0x605040,0x3c2b1c,0x110000,0x180500,0x251005,0x362112,0x543f2d,0x614c37,0x66513a,0x665139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655137,0x64513a,0x63513d,0x504030,0x0e0000,0x070000,0x2b1e0d,0x60513c,0x605039,0x604e37,0x624f38,0x65513a,0x66513a,0x66513a,0x665139,0x665139,0x675239,0x675239,0x675239,0x675338,0x665136,0x665136,0x665137,0x675339,0x665339,0x645237,0x655338,0x655339,0x64533a,0x63533d,0x635541,0x6d6050,0x4f4234,0x0e0200,0x0e0200,0x000000,0x403518,0xb7ae8a,0xc7bf96,0xbfb78d,0xbeb78f,0xbdb795,0xbab49a,0x696353,0x000000,0x0f0608,0x140a0e,0x352a29,0x140803,0x0f0300,0x2d2010,0xb8ad92,0xc1b794,0xbfb58c,0xc0b78a,0xc0b789,0xc1b889,0xc1b889,0xc1b888,0xc1b886,0xc1b985,0xc1b985,0xbfb885,0xb2ac7b,0x8b875a,0x8e8a62,0x8f8b69,0x908b71,0x68634f,0x020000,0x060100,0x1d1509,0x5e5444,0x61533f,0x62533d,0x60543d,0x5f5440,0x413729,0x060000,0x030000,0x423422,0x65533c,0x655037,0x675338,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x685137,0x6c4f38,0x6c513c,0x64533f,0x5b5343,0x515247,0x101712,0x000307,0x000d22,0x0b7ead,0x10b3f4,0x00b6ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00bcff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00bdff,0x00b9ff,
+0x000000,0xe2f7fd,0xccf1f9,0xb6f1fc,0xa2faff,0x6eeaff,0x3dcdf1,0x22b8e0,0x29b0d9,0x63c7ed,0xaffeff,0xb8ffff,0x8fe5ff,0x5bd1f0,0x24b9df,0x04b5e7,0x00b2e9,0x05b6ea,0x13c4f5,0x0bc7f3,0x0dc6f0,0x23ccf4,0x4bd1f0,0x196b7b,0x000c12,0x000000,0x010000,0x7d6c4b,0xe9dbaf,0xc9bf91,0x706741,0x0e0700,0x060100,0x120e00,0x544e3e,0x605543,0x635541,0x5d4c37,0x503d2a,0x433022,0x443023,0x4f3a2c,0x4d3827,0x533e2b,0x614c37,0x66513b,0x66513a,0x665139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x665137,0x655138,0x64513a,0x5f4e3a,0x362717,0x0d0000,0x090000,0x403321,0x665741,0x5d4c34,0x5f4d36,0x624f38,0x645039,0x66513a,0x66513a,0x66513a,0x67523a,0x675239,0x675239,0x675239,0x675338,0x675337,0x665136,0x665137,0x655037,0x645037,0x635136,0x655338,0x645238,0x64533b,0x62533e,0x675947,0x594c3d,0x26190d,0x0f0300,0x0a0000,0x221700,0xb2a887,0xd3cba2,0xc3bc8f,0xc0b88b,0xbfb88f,0xc1ba99,0xada78e,0x433c2e,0x000000,0x0e0507,0x150a0e,0x1a0f0e,0x0c0000,0x150900,0x716553,0xc5ba9d,0xbeb48f,0xbeb489,0xc0b789,0xc1b889,0xc1b888,0xc1b888,0xc1b887,0xc1b985,0xc1b984,0xc1b984,0xc1b985,0xbab483,0x959062,0x8c885f,0x8e8a67,0x918d71,0x938f79,0x1d190a,0x080300,0x090200,0x53493b,0x635540,0x61523a,0x60533a,0x5e533e,0x44392a,0x080000,0x010000,0x392a19,0x63503a,0x675239,0x685439,0x685438,0x675337,0x665136,0x665136,0x665136,0x665136,0x685137,0x6c4f39,0x6c513d,0x63513f,0x5a5242,0x515346,0x191f19,0x000409,0x00051c,0x005d8e,0x19b2f4,0x00b6ff,0x00b9ff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bcff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bcff,0x00bdff,0x00beff,0x00beff,0x00bdff,0x00baff,
+0x000000,0x000000,0xe1fcff,0xc7edf6,0xb9f6ff,0x8eecff,0x54cdee,0x32bfe8,0x34c2ec,0x49c4eb,0x72d6fa,0xb0faff,0xaef9ff,0x87ecff,0x41c7ef,0x0fbcec,0x05beed,0x21caf2,0x3bddff,0x34daff,0x2acaf8,0x2dbbe2,0x45b1ca,0x003034,0x000300,0x040000,0x261300,0xad9e6b,0xe1d59f,0xb6ac82,0x241c00,0x080100,0x060100,0x211c0d,0x5d5644,0x625641,0x62543c,0x615036,0x55432a,0x4d3a26,0x4e3b29,0x533e2c,0x4e3926,0x543f2a,0x624e37,0x655039,0x66513a,0x665139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675137,0x675138,0x665138,0x655139,0x64513c,0x5d4c3a,0x251608,0x090000,0x0b0000,0x4c3e2d,0x65543f,0x64523a,0x5f4d36,0x624f38,0x65513a,0x66513a,0x66513a,0x67523b,0x67523a,0x675239,0x675239,0x675239,0x675338,0x675337,0x665136,0x665137,0x655037,0x645037,0x635238,0x635238,0x645239,0x685640,0x665644,0x5f5141,0x211406,0x130600,0x010000,0x2a1e0d,0x84795f,0xcec4a1,0xc8c096,0xc2bb8d,0xbfb78a,0xbeb78f,0xc6c0a0,0x99927b,0x221a0d,0x030000,0x0b0103,0x0f0507,0x120602,0x150800,0x190c00,0x948874,0xc4b99b,0xbeb48f,0xbeb489,0xc0b789,0xc1b889,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc1b885,0xc1b885,0xc1b987,0xbcb786,0xa5a073,0x8c865e,0x8f8a67,0x918b6f,0x9e9983,0x2c2818,0x070200,0x090200,0x453b2d,0x635540,0x605139,0x5f5139,0x5e513c,0x463b2d,0x080000,0x030000,0x392a19,0x63503a,0x675239,0x665137,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x685137,0x6c4f39,0x6c513d,0x63513f,0x595141,0x545549,0x212520,0x020509,0x00031a,0x004375,0x22b1f4,0x00b6ff,0x00baff,0x00baff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00beff,0x00bdff,0x00beff,0x00c0ff,0x00c0ff,0x00c3ff,0x00c3ff,0x00c0ff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bcff,
+0x000000,0x000000,0x000000,0xd1eef6,0xbcebf6,0xa4edfe,0x7fe0f8,0x5dd3f4,0x4dcff4,0x53d6fb,0x57ccef,0x7bd4f2,0xb4ffff,0xa7ffff,0x6de9ff,0x32d7ff,0x15c8f4,0x25d0f9,0x3bddff,0x53eeff,0x51dcff,0x42b5de,0x16677f,0x00070a,0x000100,0x1c1000,0xa69467,0xe2d696,0xd4cb8e,0x605732,0x000000,0x080200,0x0c0700,0x403a2a,0x605844,0x574c35,0x615338,0x645436,0x5b4a2d,0x4d3a22,0x4e3b25,0x4d3923,0x4c3721,0x5e4932,0x655039,0x66513a,0x66513a,0x665139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x675138,0x675139,0x665139,0x65513c,0x64513f,0x5b4a3b,0x1a0c00,0x0d0100,0x160900,0x5d4f3d,0x62513b,0x635039,0x614e36,0x645039,0x65513a,0x66513a,0x665139,0x67523a,0x675239,0x675239,0x665138,0x665137,0x675338,0x675337,0x665136,0x665137,0x645037,0x645238,0x635239,0x62523a,0x63523b,0x62523e,0x574839,0x302214,0x030000,0x000000,0x140800,0x8a7e68,0xc6bb9d,0xc1b791,0xc2b98d,0xc0b88a,0xc0b88c,0xc1b993,0xc9c2a5,0x8b8370,0x191006,0x080000,0x060000,0x0d0202,0x050000,0x080000,0x4e422f,0xb6aa92,0xbfb495,0xbeb48e,0xbfb58a,0xc0b789,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b987,0xbfb98a,0xb6b185,0x959068,0x8e8865,0x8f896b,0x99937c,0x322e1d,0x060100,0x0b0400,0x302516,0x655742,0x62523a,0x605139,0x5e503b,0x493d2f,0x080000,0x060000,0x362816,0x66543d,0x68543a,0x634f34,0x655035,0x665136,0x665136,0x665136,0x665136,0x665136,0x685137,0x6c4f39,0x6c513d,0x63513f,0x5a5242,0x5b5c50,0x373c35,0x05070a,0x000115,0x003e6c,0x26afee,0x03b9ff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00beff,0x00bdff,0x00beff,0x00c0ff,0x00c0ff,0x00c6ff,0x00c6ff,0x00bfff,0x00bdff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00bfff,0x00beff,
+0x000000,0x000000,0x000000,0xd4f5fc,0xb9e8ef,0xbaf6fe,0xb0f7ff,0x9eefff,0x71d4ee,0x55d1f1,0x52d5f6,0x4bc2de,0x75e4fc,0x85f0ff,0x79f2ff,0x48dfff,0x16c2ec,0x09c0f5,0x09baf5,0x39cfff,0x63dcff,0x4fa7d3,0x002441,0x00020d,0x000000,0x463712,0xcebd83,0xd6cb81,0xc2bb79,0x251e00,0x010000,0x060000,0x2c261a,0x5e5947,0x5e5741,0x5b5138,0x5f5236,0x605233,0x5f4f30,0x544327,0x4f3d23,0x4e3a22,0x564129,0x634d37,0x67513a,0x67513a,0x67513a,0x665139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665137,0x675138,0x675139,0x66513c,0x665240,0x69584a,0x3e2f22,0x120500,0x0c0000,0x221405,0x635441,0x5e4d36,0x604d34,0x634f36,0x655139,0x665139,0x665138,0x665138,0x675238,0x665137,0x665137,0x665137,0x665136,0x665136,0x665136,0x665136,0x675338,0x665339,0x65533a,0x625138,0x63533c,0x63533f,0x534433,0x241609,0x060000,0x180b00,0x130700,0x7f745d,0xc5ba9c,0xc3b892,0xc1b88b,0xc0b786,0xc1b888,0xc3ba8e,0xc5bc98,0xcbc2a9,0x554c3c,0x0c0300,0x0b0200,0x080000,0x0d0100,0x070000,0x030000,0x8f846b,0xbeb394,0xbeb490,0xbfb58d,0xc0b78b,0xc0b789,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b887,0xc1ba8c,0xbbb58a,0xa09a73,0x908b67,0x8e8869,0x979178,0x3e3928,0x040000,0x070100,0x291e0f,0x675843,0x65533b,0x625139,0x5f503b,0x4f4335,0x0f0400,0x060000,0x332513,0x67553e,0x68543a,0x624e33,0x634f34,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6e503a,0x6c513d,0x645340,0x575040,0x56574b,0x343831,0x050806,0x000412,0x00254a,0x20aae0,0x0cc3ff,0x00bfff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00bcff,0x00beff,0x00c3ff,0x00c9ff,0x00c9ff,0x00c9ff,0x00c2ff,0x00bfff,
+0x000000,0x000000,0xe5fbff,0xccf0f6,0xbce9ee,0xc1f0f5,0xbef1f8,0xbff5ff,0xa0e8f9,0x70d8f1,0x5bd4f0,0x4ac8e0,0x63dff4,0x6cdff3,0x6ce7fd,0x50e3ff,0x24ccf5,0x0bc7ff,0x04bcfb,0x1fbdf8,0x4ac3f8,0x3f8bb4,0x000e2a,0x000007,0x010000,0x8c7b4e,0xd5c582,0xdad283,0xb3ae6d,0x1c1700,0x000000,0x030000,0x393328,0x5e5946,0x5b543c,0x5c5238,0x5e5235,0x605233,0x615132,0x5f4e30,0x564428,0x564228,0x5f4a31,0x654e37,0x664f39,0x664f39,0x675139,0x665138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675137,0x685138,0x68503a,0x67503e,0x665243,0x5d4c41,0x1c0e04,0x0a0000,0x120500,0x3c2e1e,0x60513d,0x604e37,0x614e35,0x634f36,0x655037,0x665138,0x665138,0x665137,0x675337,0x665136,0x665136,0x655035,0x655035,0x665136,0x665136,0x665136,0x665338,0x665339,0x65533a,0x61513a,0x695a46,0x594b39,0x312314,0x0f0200,0x180b00,0x160a00,0x52462f,0xbeb394,0xcdc39c,0xbfb688,0xbeb583,0xc0b783,0xc1b886,0xc5bb8f,0xc3b997,0xa89e87,0x291f12,0x090000,0x0d0301,0x090000,0x0c0000,0x100500,0x594d34,0xc0b597,0xbeb490,0xbfb58f,0xc0b68d,0xc0b78b,0xc0b789,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc0b88b,0xbeb78d,0xaba47d,0x98926e,0x8e8867,0x938e73,0x5c5846,0x0a0600,0x0a0300,0x251b0c,0x645440,0x635039,0x624f38,0x604f3b,0x5a4e3f,0x1c1105,0x040000,0x352715,0x66543d,0x68543a,0x634f34,0x655035,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6e503a,0x6c513d,0x63513f,0x625a4a,0x57584c,0x343831,0x070907,0x000510,0x001d3c,0x189ecd,0x0abffc,0x00bdff,0x00bbff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00beff,0x00c0ff,0x00c5ff,0x00c7ff,0x00c9ff,0x00c5ff,0x00beff,
+0x000000,0xddf2f5,0xd1eff2,0xc1e7eb,0xc3ebf0,0xc4e8ef,0xc7eaf3,0xd5f9ff,0xcaf9ff,0xb0f2ff,0x89e0f4,0x64d0e3,0x65dbf0,0x73ecff,0x6befff,0x40d8f9,0x22ccf5,0x1dd4ff,0x0dc6fe,0x0ebcef,0x33bfea,0x00496a,0x00071c,0x000000,0x1c0f00,0xcebd87,0xd5c77e,0xd3cc81,0x747137,0x000000,0x060000,0x0a0400,0x463f35,0x595340,0x5a533a,0x5c5237,0x5f5336,0x615334,0x635334,0x635234,0x625033,0x624e33,0x655036,0x665037,0x685139,0x685139,0x675138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675136,0x685137,0x685039,0x68503c,0x685040,0x624d40,0x37261c,0x0b0000,0x060000,0x261a0f,0x544637,0x5e4e3b,0x614e37,0x645037,0x665138,0x665138,0x665138,0x665138,0x665137,0x675337,0x665136,0x665136,0x665136,0x655035,0x665136,0x665136,0x665136,0x655137,0x665339,0x64533b,0x645441,0x584a39,0x251809,0x110400,0x110400,0x140800,0x756950,0xc1b796,0xc6bc92,0xc4bb8a,0xbdb47f,0xbeb57e,0xc0b880,0xc0b783,0xc7be92,0xc0b695,0x706651,0x070000,0x0a0000,0x0d0201,0x080000,0x090000,0x241903,0x988d6f,0xd2c7a5,0xc1b791,0xc1b790,0xc1b88e,0xc1b88b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc0b88c,0xc0b88f,0xb7b089,0xa49d79,0x8f8867,0x979175,0x595542,0x090500,0x0a0300,0x201506,0x5f503b,0x604e37,0x604e37,0x61513c,0x4e4335,0x0d0400,0x040000,0x362a17,0x65543d,0x614e34,0x634f34,0x675337,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6e503a,0x6c513d,0x63513f,0x5b5343,0x535447,0x525650,0x0e0e0f,0x000511,0x001b34,0x108db7,0x05b8f5,0x00b9ff,0x00baff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bbff,0x00b9fe,0x00bbff,0x00bdff,0x00c2ff,0x00c0ff,
+0x000000,0xd5f2f4,0xc3eaeb,0xc6eff2,0xd2f6fc,0xd8f1fb,0xdff3ff,0xe3f8ff,0xe0faff,0xd3f7ff,0xb9f0fc,0x86dbec,0x61cce1,0x5ed8f3,0x55e0ff,0x36d3f5,0x22cdf4,0x22d5ff,0x16c9fa,0x13c0eb,0x31b9dc,0x003954,0x000715,0x000000,0x504124,0xe3d393,0xd6c87b,0xcec781,0x363300,0x000000,0x0c0705,0x1a1410,0x544d43,0x59513e,0x5b5339,0x5d5236,0x605336,0x625335,0x635234,0x645234,0x645235,0x645035,0x655035,0x675138,0x685138,0x685138,0x675138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x655236,0x655236,0x665137,0x675137,0x685138,0x68503a,0x68503d,0x685041,0x624d41,0x2f1e15,0x0b0000,0x090000,0x3e3126,0x5a4c3c,0x5f4e3b,0x624f38,0x655037,0x665138,0x665138,0x675239,0x675239,0x675338,0x665136,0x655136,0x655137,0x655137,0x655137,0x655137,0x655137,0x655137,0x655138,0x66543c,0x675641,0x625342,0x281a0c,0x0c0000,0x010000,0x150900,0x695e44,0xc7bd9d,0xc0b68f,0xc3b989,0xbfb680,0xc1b981,0xc3ba81,0xc0b87f,0xc0b784,0xcac096,0xaba181,0x372d1a,0x080000,0x090000,0x0b0000,0x040000,0x020000,0x756b52,0xb9af8e,0xc6bc97,0xc3b991,0xc1b88f,0xc1b88d,0xc1b88b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b88a,0xc0b88c,0xc0b88f,0xbbb38c,0xa9a27d,0x8d8765,0x9b9679,0x4f4b37,0x060100,0x0a0300,0x1f1507,0x5f503c,0x614f39,0x5f4d37,0x5f503c,0x463b2d,0x060000,0x050000,0x372b19,0x64543d,0x614e34,0x655137,0x675337,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6d503a,0x6b513d,0x62523f,0x5b5343,0x545548,0x51544d,0x0f0d11,0x000412,0x000d24,0x077da4,0x13c3ff,0x00baff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00c3ff,0x00c6ff,0x00c2ff,
+0x000000,0xc5ebeb,0xa0cfce,0xb5dfe2,0xd6f5fd,0x000000,0x000000,0x000000,0x000000,0x000000,0xdef9fc,0xb7f2ff,0x82dcf3,0x57d0eb,0x3acae9,0x2acbec,0x22cdf2,0x20cef9,0x24ccf6,0x22b8dd,0x208baa,0x00061c,0x000006,0x191104,0x867850,0xe0d087,0xdccf7d,0xbab372,0x1a1600,0x020000,0x0e0807,0x271f1c,0x61594f,0x5c533f,0x5c5238,0x5e5236,0x615336,0x635236,0x645236,0x645236,0x645236,0x655236,0x665137,0x675138,0x685138,0x685138,0x675138,0x665137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x655236,0x645236,0x645237,0x655238,0x665138,0x675139,0x69523c,0x68503e,0x685143,0x463228,0x130200,0x110200,0x1d1007,0x5a4c40,0x604f3f,0x614f3b,0x634f38,0x655037,0x675239,0x675239,0x675239,0x675239,0x675338,0x655136,0x655237,0x645238,0x645238,0x645238,0x645238,0x645238,0x66533b,0x65533d,0x63523c,0x554532,0x352517,0x0d0000,0x040000,0x1d1200,0x796e52,0xbcb18f,0xcbc09b,0xc7be93,0xc5bc89,0xc3ba83,0xc4bb84,0xc0b880,0xc1b982,0xc1b887,0xcec49c,0x8f8568,0x190e00,0x080000,0x080000,0x0a0000,0x0b0000,0x3b3124,0xc5baa0,0xc3b895,0xc1b791,0xc1b88f,0xc1b88f,0xc3b98f,0xc1b88b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xbfb78b,0xbdb68c,0xbdb68e,0xb2ab86,0x928c69,0x9f997d,0x4c4734,0x060100,0x080200,0x1d1407,0x5d503f,0x5f503c,0x604f3c,0x625341,0x5f5547,0x100700,0x050000,0x382c1a,0x63533c,0x645238,0x685439,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6d513a,0x6b513d,0x63533f,0x5d5442,0x575647,0x52524b,0x120e13,0x000312,0x00091f,0x0b79a0,0x16c3ff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,0x00bfff,0x00bfff,0x00bfff,
+0x000000,0xcef7f6,0xa5d6d5,0xb6e0e3,0xd1f1fa,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0xc6fbff,0x9beeff,0x70dffc,0x4acded,0x31c3e4,0x2ac9ed,0x25cdf6,0x30ccf4,0x2ea8c9,0x015069,0x00010e,0x000000,0x392e14,0xbeaf7c,0xdbca7b,0xdacc7a,0xcac387,0x302b07,0x040000,0x0f0808,0x2f2622,0x64594f,0x5e533e,0x5e5238,0x5f5235,0x625336,0x645236,0x645236,0x645236,0x655236,0x655236,0x665136,0x675137,0x675138,0x675138,0x675137,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x645236,0x635236,0x635237,0x635238,0x645238,0x66523c,0x685340,0x675243,0x624e43,0x2c1810,0x120100,0x110200,0x36271e,0x655547,0x614f3d,0x634f3a,0x655038,0x665138,0x675239,0x675239,0x675239,0x675338,0x665338,0x645237,0x635238,0x635238,0x635239,0x635239,0x63523a,0x64533c,0x64533f,0x695746,0x554436,0x261609,0x130500,0x080000,0x201400,0x72674c,0xbeb391,0xc5bb93,0xc0b68d,0xbeb488,0xbeb583,0xc1b984,0xc3ba85,0xc0b784,0xc1b886,0xc3b98d,0xccc19f,0x635840,0x080000,0x090000,0x090000,0x0a0000,0x0f0400,0x736958,0xd2c8aa,0xc1b791,0xc1b88f,0xc1b88e,0xc3b98f,0xc3b98e,0xc1b88b,0xc1b88a,0xc1b889,0xc1b889,0xc1b889,0xc1b888,0xc0b787,0xc1b887,0xc1b887,0xc1b888,0xbfb789,0xc1b98d,0xbab289,0xbfb891,0xa19b78,0x9f997d,0x46402c,0x080200,0x040000,0x1f180c,0x5c5143,0x5f5242,0x615342,0x675a4a,0x766e60,0x110a00,0x050000,0x3b2e1c,0x63533c,0x645238,0x685439,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x695238,0x6c513a,0x6a513c,0x64533e,0x5e5441,0x595545,0x545249,0x140f13,0x000311,0x00071d,0x0d769e,0x17c3ff,0x00baff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bcff,0x00bcff,0x00bdff,0x00beff,0x00bcff,0x00bfff,
+0x000000,0xd7fefd,0xc9f7f7,0xc2eaef,0xb5dee7,0xa8dde9,0xb3e9f6,0xbfeaf7,0xd1f0fb,0x000000,0xdcfaff,0xb1f5ff,0x8be4fd,0x83dffe,0x74d9fa,0x61d4f6,0x45cbf0,0x2dcbf5,0x3ac9f1,0x429bba,0x013244,0x000101,0x000000,0x7f744b,0xd5c487,0xdcca79,0xe0d081,0xbdb47c,0x1d1700,0x020000,0x110709,0x3d2f2c,0x6a5b4f,0x63533e,0x625238,0x635236,0x645235,0x655236,0x655236,0x655236,0x655236,0x665136,0x665136,0x665136,0x665137,0x665137,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x655236,0x635236,0x625236,0x625336,0x615337,0x625239,0x63533e,0x665546,0x67554c,0x301f18,0x0a0000,0x0c0000,0x291913,0x615045,0x655243,0x66513e,0x665039,0x665037,0x685238,0x675238,0x675338,0x675338,0x665338,0x655337,0x645338,0x635439,0x62543a,0x62543b,0x62533c,0x62533d,0x5e4e3c,0x5d4d3f,0x45352c,0x190903,0x0a0000,0x030000,0x1a0e00,0x8b7f67,0xc6bb9b,0xc4ba92,0xc4ba8f,0xc0b78c,0xc0b78b,0xbfb687,0xc0b787,0xc1b889,0xc1b88b,0xc1b88c,0xc1b792,0xbbaf95,0x372b1b,0x0e0300,0x070000,0x0a0000,0x050000,0x605648,0xd2c8af,0xc6bc98,0xc1b88e,0xc1b88d,0xc0b78c,0xc3b98e,0xc3b98d,0xc3b98c,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc0b786,0xc0b785,0xc0b784,0xc0b784,0xc0b786,0xc2ba8a,0xc4bc8f,0xc0b991,0xb9b28f,0xa09a7e,0x38321e,0x060100,0x020000,0x3c362b,0x595144,0x5b5244,0x53493b,0x6c6355,0x9d978b,0x0c0500,0x050000,0x3e311d,0x66553e,0x665339,0x665338,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x685238,0x6b5139,0x6a513b,0x64533c,0x5f543e,0x5c5542,0x575145,0x171111,0x00030e,0x00061b,0x0c749c,0x14c0ff,0x00b9ff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00beff,
+0xe5f4f8,0xcef3f4,0xccf8fa,0xd8fbff,0xbee9f5,0x92d2e1,0x97ddec,0xafeaf8,0xc7f6ff,0xd6f8ff,0xc6f8ff,0x8be7fc,0x71daf4,0x7dd5f5,0x84d9fb,0x83e1ff,0x69d9fc,0x42cdf2,0x49c5e7,0x42879f,0x04262f,0x000100,0x050900,0xa49a63,0xddcb83,0xdcc976,0xe2d286,0xb5ac77,0x1b1500,0x0b0200,0x12070a,0x3c2d29,0x6c5a4e,0x65533d,0x645237,0x645235,0x655234,0x655236,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x665136,0x665136,0x665136,0x665136,0x655236,0x635236,0x625336,0x605336,0x615439,0x61543b,0x5f513d,0x695b4f,0x4a3b34,0x170803,0x0d0000,0x0f0000,0x42312b,0x645246,0x675342,0x67513c,0x685139,0x685137,0x675136,0x675237,0x675337,0x675337,0x665337,0x645338,0x635438,0x62553b,0x62553c,0x62553d,0x635640,0x6b5e4a,0x4b3d2d,0x281a0e,0x1b0d04,0x090000,0x070000,0x130700,0x80755e,0xc6bb9c,0xc1b791,0xc7be92,0xc4ba8d,0xc0b78b,0xc0b78b,0xc0b78a,0xc0b78b,0xc0b78c,0xc0b68d,0xc1b791,0xbdb292,0x998d78,0x100400,0x0c0000,0x050000,0x000000,0x2a1f13,0xbab09a,0xc4bb9b,0xbfb58e,0xc1b88c,0xc1b88c,0xc0b78b,0xc3b98d,0xc4ba8e,0xc3b98c,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b887,0xc0b784,0xc0b783,0xc0b783,0xc0b784,0xc1b987,0xc1ba8b,0xc2bb91,0xb2ab88,0x989276,0x302a15,0x040000,0x050100,0x4e493e,0x575146,0x585145,0x2c2518,0x2e281c,0x757165,0x110b00,0x070000,0x3e311d,0x66553e,0x665339,0x655137,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x685238,0x6b5139,0x69523a,0x64533b,0x60543c,0x5e543f,0x585143,0x181310,0x00020c,0x00071c,0x046b95,0x0db9fe,0x00baff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00c0ff,0x00beff,0x00bcff,0x00bcff,
+0xe5f4f9,0xd1f6f9,0xd3fdff,0xdefcff,0xd6f9ff,0xb1eaff,0x92d5ec,0x96d9ec,0xadedff,0xbdf9ff,0x99e9fc,0x4bc9de,0x48cde5,0x80e5ff,0xa0f3ff,0x9defff,0x90ebff,0x6fdcf8,0x5cc0d5,0x205c69,0x001713,0x000600,0x272c00,0xcac07d,0xe3d180,0xdbc873,0xeadb8f,0x7c733f,0x000000,0x0c0300,0x201518,0x4e3e3a,0x6c5a4e,0x65533c,0x645236,0x655235,0x655234,0x665136,0x675337,0x665136,0x665136,0x655035,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x675337,0x675337,0x685438,0x675337,0x675337,0x665136,0x665136,0x665136,0x655236,0x635236,0x615336,0x615438,0x61553b,0x61553d,0x605440,0x584b3f,0x1b0e07,0x0e0000,0x110301,0x332320,0x61514a,0x655347,0x675341,0x68523c,0x685138,0x685137,0x675136,0x675336,0x675336,0x675336,0x665336,0x645338,0x62543a,0x5b5037,0x5a5038,0x60553f,0x524733,0x3e3321,0x150a00,0x050000,0x0a0000,0x0a0000,0x6f644f,0xa89d81,0xc5ba99,0xc0b68f,0xc0b78b,0xc4ba8c,0xbfb687,0xc0b78a,0xc0b78b,0xc0b78c,0xc0b68d,0xc0b68e,0xc0b68f,0xbbb08c,0xb1a688,0x685c49,0x000000,0x000000,0x040000,0x020000,0x8b826d,0xd5ccae,0xbab28c,0xbfb58c,0xc1b88c,0xc3b98c,0xc1b88b,0xc3b98c,0xc3b98c,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b887,0xc0b784,0xc0b783,0xc0b883,0xbfb883,0xc0b986,0xc1ba8a,0xc2bb90,0xb7b18e,0x9d977b,0x1e1904,0x000000,0x0d0900,0x4f4c41,0x5a564b,0x413c31,0x0b0700,0x0f0a00,0x3f3b30,0x110b00,0x080000,0x3e311d,0x66553e,0x665339,0x655137,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x685238,0x6a5239,0x69523a,0x64533a,0x60543b,0x5f543d,0x595141,0x1a1411,0x000008,0x000218,0x006790,0x11beff,0x00bbff,0x00baff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00beff,0x00bcff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00c1ff,0x00bfff,0x00bfff,0x00c1ff,0x00c0ff,0x00bfff,0x00beff,
+0xdbeff6,0xb1dbe2,0xb1e4ef,0xc9f7ff,0xbff3ff,0xb7fbff,0x9cebff,0x7dd0e8,0x88d9ee,0xa7f1ff,0x81def3,0x41c9e0,0x30bed8,0x66d5f4,0x9af4ff,0xb3ffff,0xaaf8ff,0x99ecff,0x529baa,0x00171c,0x000500,0x011200,0x7d8048,0xeee396,0xe1ce77,0xd9c670,0xd0c076,0x382f00,0x000000,0x090100,0x281d1f,0x43342f,0x554336,0x62503a,0x645237,0x655236,0x665135,0x675337,0x675337,0x675337,0x655035,0x655035,0x655035,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x685438,0x675337,0x675337,0x665136,0x665136,0x665136,0x655236,0x635236,0x615336,0x5f5338,0x60543b,0x635842,0x695d4c,0x3e3127,0x0d0000,0x0c0000,0x221411,0x53443f,0x62524a,0x625042,0x65513e,0x67513b,0x675138,0x675138,0x665137,0x675338,0x665337,0x665338,0x655339,0x63533b,0x60533b,0x60553f,0x615843,0x493f2b,0x201703,0x0a0000,0x000000,0x080000,0x191000,0x5e553a,0xcec5a5,0xc7bd99,0xbdb38a,0xbeb488,0xc0b788,0xc1b889,0xbfb687,0xc0b789,0xc0b78b,0xc0b78d,0xc0b68e,0xc0b690,0xbbb18d,0xaba17f,0x978d71,0x332814,0x050000,0x0c0100,0x241a0b,0x847b65,0xc6bda0,0xbcb490,0xbcb38a,0xbfb68a,0xc1b88b,0xc3b98c,0xc1b88a,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b887,0xc1b885,0xc1b984,0xc1b984,0xc0b985,0xc1ba88,0xc2bb8d,0xbfb890,0xbeb898,0x948d75,0x0f0900,0x010000,0x0d0900,0x524e45,0x59554a,0x221e13,0x000000,0x262318,0x676359,0x010000,0x0c0200,0x3e301e,0x66553e,0x665339,0x655137,0x665136,0x675337,0x675337,0x675337,0x675337,0x675338,0x685238,0x6a5239,0x685239,0x645339,0x61543a,0x5f543c,0x5a5241,0x312b28,0x00040e,0x000013,0x005b82,0x11bdff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00c1ff,0x00beff,0x00bfff,0x00c1ff,0x00c2ff,0x00c8ff,0x00c9ff,
+0xddfdff,0xb3e7f6,0x99dff2,0x9cf0ff,0x87e4ff,0x85e8ff,0x90f8ff,0x71daf7,0x64c6df,0x92e3fb,0x85def7,0x64defb,0x43c7e6,0x4bc4e1,0x68d2ed,0x91eaff,0xaff8ff,0xb1ecff,0x295764,0x000000,0x000000,0x131c00,0xb5b373,0xe3d482,0xe0cc72,0xd9c570,0xe1d18b,0x4e441b,0x000000,0x0d0401,0x0e0203,0x080000,0x1d0b00,0x594732,0x66533a,0x655138,0x665137,0x675338,0x675337,0x675337,0x655035,0x655035,0x655035,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x675337,0x675337,0x665136,0x675337,0x665136,0x665136,0x665136,0x655236,0x635235,0x615335,0x5f5337,0x60543c,0x645846,0x4f4336,0x1c0f09,0x0b0000,0x0b0000,0x433530,0x5b4d44,0x5d4d40,0x614f3f,0x64503d,0x67513b,0x67513a,0x66513b,0x67523c,0x64523a,0x62513a,0x64543e,0x62533e,0x625540,0x635744,0x534836,0x3f3523,0x120900,0x0a0000,0x0c0300,0x000000,0x251c01,0x938b6b,0xbdb590,0xc6be95,0xc0b78c,0xbfb689,0xbfb687,0xbfb686,0xbfb787,0xbfb787,0xbfb788,0xc0b88a,0xc0b88d,0xc0b890,0xc0b892,0xaca382,0xa39a7c,0x463c23,0x090000,0x110700,0x060000,0x685f47,0xbfb698,0xbdb592,0xbdb68d,0xbeb68a,0xc0b78a,0xc1b88b,0xc3b98c,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc1b887,0xc0b784,0xc0b783,0xc1b985,0xc0b986,0xc1ba8b,0xc3bc92,0xc6bf9c,0xaca48a,0x4e4734,0x000000,0x050000,0x0a0500,0x5e5a54,0x3e3a30,0x050100,0x000000,0x6b685b,0x6f6b62,0x000000,0x0c0200,0x423423,0x665540,0x66533a,0x655137,0x665136,0x675336,0x675336,0x675336,0x675336,0x675338,0x685239,0x6a5239,0x685239,0x645339,0x61543a,0x5f553b,0x5b5241,0x2b2422,0x00030c,0x000011,0x005a7d,0x12bcfa,0x00bbff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00bcff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00c0ff,0x00c2ff,0x00c5ff,0x01cfff,0x00cdff,
+0xacebff,0xabfeff,0x88f0ff,0x45c1e2,0x25abd0,0x26acd7,0x3ac0ea,0x50d2f5,0x66daf8,0x9af4ff,0x90e7ff,0x7ae5ff,0x72e7ff,0x64dcf7,0x69d8f0,0x7bd7ee,0x8dd2e8,0xa7d4e7,0x132f3c,0x000000,0x000800,0x7d7e4d,0xbfb871,0xd8c771,0xe0cb72,0xdeca78,0xd7c788,0x524727,0x000000,0x060000,0x120705,0x26170e,0x3d2c1c,0x594733,0x66533c,0x655139,0x665138,0x665137,0x665137,0x665137,0x665136,0x655136,0x655236,0x655236,0x655236,0x655236,0x655236,0x675337,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x665136,0x655236,0x635234,0x615335,0x5f5338,0x60543e,0x5b4f40,0x2b1e16,0x040000,0x0b0000,0x241713,0x5f514a,0x625447,0x625343,0x63513f,0x64513d,0x67523d,0x67523d,0x65513d,0x685643,0x635340,0x5d4f3c,0x625543,0x5a4e3d,0x493e2d,0x403625,0x140b00,0x090000,0x090100,0x080000,0x2c240c,0x8a8366,0xb9b290,0xd3cca6,0xc3bd93,0xbeb78b,0xbfb789,0xbeb687,0xbeb686,0xbeb686,0xbdb686,0xbeb887,0xbeb887,0xbfb98b,0xc0b990,0xc3bb96,0xb4ac8a,0x8c8467,0x473f26,0x030000,0x090000,0x140b00,0x393015,0xcac2a3,0xc9c19d,0xc1b991,0xbdb68b,0xbfb78b,0xc1b88b,0xc1b88b,0xc2b98c,0xc2b98b,0xc2b98b,0xc2b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc0b786,0xc0b785,0xc0b784,0xc0b783,0xc0b883,0xc1ba88,0xc1ba8c,0xc4bd94,0xc9c1a0,0x989079,0x261f0f,0x000000,0x080300,0x231f1c,0x68635f,0x141005,0x060300,0x393626,0xb0ad9e,0x656259,0x000000,0x0a0000,0x453728,0x665541,0x66533a,0x655137,0x665136,0x675336,0x675335,0x675335,0x675336,0x675239,0x68523a,0x6a523a,0x68523a,0x64533a,0x61543a,0x5f553b,0x5a513f,0x19110f,0x000001,0x00000d,0x004b68,0x0fb5ef,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bfff,0x00bfff,0x00c2ff,0x00c3ff,0x00beff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00c0ff,0x00c1ff,0x00c4ff,0x00c8ff,0x00c6ff,
+0x42b5dd,0x42c7fb,0x37cdff,0x12b8eb,0x06b6e7,0x05b4e7,0x0fb8e9,0x26c4ee,0x58dfff,0x99ffff,0x9af1ff,0x81daf5,0x87e8ff,0x79e4fb,0x75def4,0x83dcf3,0x8ccfe6,0x91bad0,0x081d2b,0x000000,0x282510,0xc0b880,0xd0c375,0xdac970,0xd9c66e,0xdac77b,0xbfaf79,0x30240f,0x040000,0x120906,0x3f342e,0x57483c,0x615040,0x63513f,0x64513d,0x65513b,0x665139,0x665138,0x665138,0x665138,0x655137,0x655236,0x645236,0x645236,0x645236,0x645236,0x655236,0x675337,0x665136,0x665136,0x665136,0x655035,0x665136,0x665136,0x665136,0x665136,0x655236,0x635234,0x615336,0x5f533a,0x625643,0x483c32,0x1b0e0a,0x080000,0x110301,0x443730,0x64584c,0x615543,0x61543f,0x62523d,0x63513d,0x65523f,0x655240,0x625140,0x625343,0x645748,0x53483a,0x4a4033,0x352b1f,0x110800,0x0f0600,0x020000,0x000000,0x120c00,0x635e46,0x948f73,0xc6c1a0,0xc3be99,0xbfbb93,0xbeba8f,0xbdb98b,0xbdb888,0xbcb786,0xbcb786,0xbcb786,0xbcb786,0xbdb887,0xbdb888,0xbdb88b,0xbeb892,0xbcb595,0xa19a7f,0x6d654f,0x1d1403,0x090100,0x000000,0x2c2408,0x938b6b,0xcbc39f,0xc0b891,0xbdb68c,0xbfb78c,0xbfb78b,0xc0b88c,0xc0b88b,0xc0b88b,0xc1ba8b,0xc1ba8b,0xc2ba8b,0xc1b889,0xc1b889,0xc1b889,0xc1b888,0xc1b887,0xc0b785,0xc0b784,0xc0b783,0xc0b882,0xc1b984,0xc0b987,0xc1ba8c,0xc3bc92,0xc3bb99,0xaca48c,0x3b3424,0x000000,0x0c0602,0x1c1716,0x16120e,0x050100,0x191604,0x878471,0xcbc8b7,0x615d53,0x000000,0x080000,0x4a3d2f,0x655440,0x645139,0x655137,0x665136,0x665234,0x675335,0x675334,0x675335,0x675239,0x68523b,0x6a513b,0x68523b,0x64533a,0x61543a,0x60543a,0x5c523f,0x271e1c,0x000005,0x000007,0x002940,0x02a5d8,0x00c2ff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00c0ff,0x00c9ff,0x00c9ff,0x00c3ff,0x00c0ff,0x00c1ff,0x00c0ff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00c0ff,0x00c0ff,0x00bfff,0x00c0ff,0x00bdff,
+0x0ea9df,0x06aff3,0x00b7fd,0x00bdfb,0x00c0fa,0x00c1fb,0x00bcf4,0x03b6e9,0x18b7e4,0x59daff,0x70dcfd,0x85e4ff,0x9efbff,0x87ecff,0x7cdef5,0x8cddf7,0x9ed9f2,0x3c5c74,0x00010d,0x070800,0x726948,0xe9dc9a,0xdaca75,0xdcca70,0xdac772,0xdac781,0x756436,0x040000,0x090000,0x2b231d,0x5e5349,0x5f5142,0x61503f,0x62503e,0x63503c,0x64503a,0x66513a,0x665139,0x665138,0x665138,0x655138,0x645237,0x645236,0x645236,0x645236,0x645236,0x645236,0x665337,0x665136,0x665136,0x655035,0x655035,0x665136,0x665136,0x665136,0x665136,0x655236,0x635234,0x615336,0x5f533b,0x615544,0x2d2018,0x0b0000,0x120402,0x2d1f1b,0x64584f,0x64584a,0x615644,0x625643,0x625542,0x615341,0x615242,0x5e4f41,0x5e5143,0x4f4337,0x2e2419,0x1c1308,0x0e0600,0x070000,0x030000,0x020000,0x100a00,0x4d4839,0x8f8b78,0xc5c1a9,0xbeba9e,0xb9b695,0xbbb893,0xbcb992,0xbcb98f,0xbdbb8e,0xbebb8c,0xbcb888,0xbcb888,0xbcb888,0xbcb888,0xbcb889,0xbdb88b,0xbdb78f,0xbab493,0xaca68b,0x867f69,0x1b1302,0x080000,0x060000,0x0e0700,0x8b8465,0xc4bc99,0xbbb38c,0xbbb38b,0xbdb68c,0xc0b88d,0xc0b88d,0xc0b88c,0xc0b88c,0xc0b88b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b986,0xc0b784,0xc0b883,0xc0b882,0xbfb884,0xc1ba89,0xc2bb8e,0xc2ba92,0xc8c1a0,0x928b73,0x130c00,0x050000,0x080300,0x060200,0x000000,0x141100,0x8b8872,0xc4c1aa,0xb5b29e,0x524e44,0x000000,0x0a0100,0x4b3e30,0x63533f,0x645139,0x655137,0x665136,0x665234,0x675335,0x675334,0x675335,0x675239,0x68523b,0x6a513b,0x68523b,0x635239,0x605338,0x5f5338,0x5e5340,0x372d2b,0x020208,0x000005,0x002e42,0x0aaada,0x00b4f4,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bfff,0x00c1ff,0x00beff,0x00c1ff,0x00c4ff,0x00c2ff,0x00c1ff,0x00c0ff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00bdff,0x00bdff,0x00baff,
+0x00b1f2,0x00b6ff,0x00b8ff,0x00bbff,0x00bffe,0x00bffe,0x00befc,0x00bcf8,0x00b8ef,0x10baec,0x35caf3,0x6be6ff,0x9affff,0x8befff,0x8ce3ff,0xa8ecff,0xaddaf7,0x2e415c,0x000007,0x171500,0x888049,0xe7da8a,0xdbca6e,0xdcc86f,0xdcc778,0xddc88b,0x8b7951,0x090000,0x0b0200,0x40382d,0x615748,0x5e503e,0x61503e,0x62503e,0x63503c,0x64503a,0x66513a,0x665139,0x665138,0x665138,0x655138,0x645237,0x645236,0x645236,0x645236,0x645236,0x665337,0x665337,0x675337,0x675337,0x665136,0x665136,0x665136,0x675337,0x675337,0x675337,0x665337,0x645436,0x615336,0x61543d,0x625645,0x1c0f08,0x070000,0x150803,0x6b5e57,0x594c41,0x3b2f22,0x766c5e,0x786f61,0x736a5d,0x524a3e,0x393127,0x272017,0x1c140c,0x160e06,0x050000,0x0b0400,0x0a0200,0x080000,0x181209,0x444036,0x7e7a6f,0xc6c3b5,0xc4c1ae,0xc6c3ad,0xcac7ae,0xcccaae,0xb8b697,0xc5c3a1,0xc4c29c,0xbebc92,0xbdbb8e,0xbbb88a,0xbbb88a,0xbbb88a,0xbbb88a,0xbcb88c,0xbbb68e,0xbdb795,0xa7a086,0xa79f8b,0x5e5747,0x020000,0x0f0700,0x020000,0x453e25,0xcac3a3,0xc2ba94,0xb9b188,0xbcb58b,0xbfb78d,0xc0b88e,0xc1b98f,0xc0b88d,0xc0b88c,0xc0b88b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b986,0xc0b986,0xc0b986,0xc0b986,0xc0b988,0xbfb98a,0xbfba8f,0xbfb994,0xd4ceaf,0x7f7861,0x090200,0x090300,0x050000,0x0c0800,0x000000,0x716f57,0xb8b69b,0xbfbc9f,0xb1ad96,0x3c362c,0x000000,0x160b02,0x554739,0x62523e,0x645139,0x655137,0x665136,0x665234,0x675335,0x675334,0x675335,0x665138,0x655039,0x644c36,0x604a33,0x605036,0x5f5237,0x5f5338,0x5d523f,0x302624,0x000002,0x000003,0x00384b,0x1ab9e8,0x00bafa,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00c1ff,0x00c2ff,0x00c3ff,0x00c2ff,0x00c1ff,0x00c0ff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00baff,
+0x00b4fa,0x00b5ff,0x00b6ff,0x00b8ff,0x00bcff,0x00bfff,0x00beff,0x00bfff,0x00bfff,0x00bcf5,0x04b8ea,0x21b9e2,0x5bdfff,0x6de5ff,0x79dfff,0x94e4ff,0xb5ebff,0x3d5672,0x000003,0x1e1d00,0xb1ab69,0xd6cb76,0xd7c86e,0xdcca77,0xe0cd86,0xd0bd8a,0x463615,0x080000,0x0c0300,0x443c2e,0x645a48,0x61523f,0x63523e,0x63513e,0x64513d,0x65513b,0x665139,0x665138,0x665138,0x665138,0x655137,0x645236,0x645236,0x645236,0x645236,0x645236,0x665337,0x675337,0x675237,0x685237,0x665136,0x665136,0x675337,0x675338,0x665338,0x665338,0x665338,0x645338,0x615239,0x584a36,0x2b1e0f,0x070000,0x000000,0x372a21,0xa4988c,0x24180b,0x000000,0x241b0e,0x271f12,0x20190d,0x100a00,0x000000,0x000000,0x030000,0x060000,0x080100,0x1b140d,0x231c15,0x554e47,0x7d7971,0x97948c,0x78746c,0x6b685d,0x646152,0x706d5b,0x6e6b56,0x5d5b44,0x59563c,0x868466,0xb6b491,0xc0be97,0xbcb98f,0xbbb88d,0xb9b78c,0xb9b78b,0xbab78b,0xbdb98f,0xbdb894,0xb3ad8f,0x948d77,0x6a6253,0x1a1205,0x120900,0x0f0600,0x2d2514,0xa39b80,0xc4bc99,0xbfb78f,0xbeb68b,0xc0b88e,0xc2b98f,0xc2b98f,0xc2b98f,0xc0b88c,0xc0b88b,0xc0b88b,0xc1ba8b,0xc1ba8b,0xc2ba8b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b887,0xc0b987,0xc0b988,0xbfb989,0xc0ba8c,0xbfba8e,0xc3be97,0xbab494,0xc1bba0,0x3b3420,0x030000,0x0d0700,0x070200,0x0d0900,0x625f49,0xb4b195,0xc1be9f,0xc0bc9c,0xb8b39a,0x332d23,0x010000,0x1f130a,0x5e4f42,0x65523f,0x65513a,0x665138,0x675136,0x675135,0x685336,0x675335,0x645035,0x624f38,0x513d29,0x210b00,0x321e08,0x62523a,0x685b41,0x605439,0x5e533f,0x3e3330,0x040107,0x000005,0x003144,0x08a2d0,0x00bdfb,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bfff,0x00c0ff,0x00c1ff,0x00c0ff,0x00bfff,0x00bfff,0x00bfff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00b9ff,
+0x00b5fc,0x00b4ff,0x00b4ff,0x00b6ff,0x00b9ff,0x00bcff,0x00bcff,0x00bdff,0x00bfff,0x00bdfe,0x00bbf8,0x00b5ee,0x15bff1,0x2ecef9,0x4ddbff,0x71e5ff,0x85dafb,0x11435e,0x000000,0x363c12,0xb8b26e,0xdbd285,0xdfd386,0xe2d58f,0xe9dba1,0xb0a279,0x281a01,0x090000,0x0e0300,0x473c2d,0x665a46,0x61523c,0x64533d,0x63523b,0x64513b,0x655139,0x665138,0x665137,0x665137,0x665137,0x655236,0x645235,0x645234,0x645234,0x645234,0x655234,0x675336,0x685236,0x695236,0x695236,0x685135,0x665136,0x675338,0x665338,0x665339,0x66533a,0x65533b,0x63523b,0x62523e,0x463728,0x130500,0x0e0000,0x090000,0x64574a,0x998c7e,0x382c1c,0x000000,0x020000,0x000000,0x000000,0x070100,0x000000,0x000000,0x110902,0x2a231c,0x413a33,0x746e66,0x514b44,0x221c16,0x28241d,0x221e18,0x0e0a04,0x060200,0x0b0700,0x0c0800,0x0d0a00,0x100d00,0x070500,0x242207,0x706d4d,0xcecba7,0xbcb992,0xbbb890,0xb5b38b,0xb8b68d,0xb9b78e,0xbeba93,0xbbb694,0xa59f84,0x807967,0x292114,0x100700,0x0e0300,0x190e00,0x7f7560,0xbcb293,0xbeb58f,0xc0b78c,0xc0b78b,0xc2b88c,0xc4b98e,0xc4b98e,0xc3b98e,0xc1b88b,0xc1b88b,0xc1b88a,0xc2b98b,0xc2b98b,0xc2b98b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc0b989,0xc0ba8b,0xc0ba8d,0xbab58b,0xbdb991,0xccc7a5,0xc4bfa4,0x918c78,0x0f0b00,0x020000,0x0c0700,0x020000,0x5b5741,0xada98e,0xc0bb9c,0xbbb694,0xc0ba98,0xb6b096,0x362f25,0x030000,0x23160e,0x625144,0x665240,0x67503b,0x68503a,0x685038,0x685136,0x695237,0x685239,0x68553e,0x5e4d3a,0x2c1b0a,0x100000,0x1b0900,0x493b25,0x675b42,0x605538,0x60543e,0x4c403a,0x0a0408,0x000108,0x002236,0x0c9dc8,0x00bbf6,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00baff,0x00b6ff,
+0x00b5fd,0x00b5ff,0x00b3ff,0x00b4ff,0x00b5ff,0x00b6ff,0x00b9ff,0x00b9ff,0x00baff,0x00bcff,0x00bcff,0x00bdff,0x00bcf9,0x02bef4,0x17c4f5,0x35cbf8,0x51c9f0,0x3e92b1,0x4d7d84,0xa7b491,0xd7d299,0xb7b073,0x8c8448,0x8a814c,0x978d62,0xab9f81,0x291d0b,0x0a0000,0x0e0300,0x483c2c,0x675a44,0x61523a,0x64533a,0x635239,0x645239,0x655138,0x665137,0x665136,0x665136,0x665136,0x655236,0x645234,0x645234,0x645234,0x645234,0x655234,0x665234,0x685235,0x695235,0x6a5235,0x695134,0x675135,0x675338,0x655339,0x65533a,0x65533b,0x64533d,0x62523f,0x574738,0x26170d,0x0e0000,0x160700,0x4c3e2f,0x998d7c,0x948876,0x7e725f,0x524733,0x2f2411,0x180e00,0x251d0c,0x4f4839,0x625b50,0x787168,0x7c746c,0x665e57,0x3e3730,0x17100a,0x000000,0x030000,0x0e0904,0x030000,0x060000,0x0a0502,0x0f0a04,0x060100,0x020000,0x0b0700,0x181500,0x0f0c00,0x393416,0xaca886,0xb3af8c,0xbdba96,0xb9b792,0xb8b591,0xb9b691,0xb9b591,0xa09b7c,0x7d765d,0x292111,0x100700,0x0c0200,0x170d00,0x8e8270,0xcdc2a8,0xbdb28f,0xbfb58b,0xc1b789,0xc2b88a,0xc4b98c,0xc4b88d,0xc4b88d,0xc4b98d,0xc2b88b,0xc1b88a,0xc1b88a,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b889,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc1b88a,0xc0b88a,0xc1ba8d,0xc0ba90,0xbfba93,0xc0bc99,0xa49f82,0x847f6b,0x241f11,0x000000,0x030000,0x221d11,0x6d6858,0xcdc9b3,0xbdb89d,0xbdb797,0xbfb996,0xc3bd99,0xa49c82,0x211810,0x080000,0x261810,0x625144,0x675240,0x68503c,0x69503b,0x69503a,0x695038,0x6a5239,0x68523b,0x6a5744,0x423324,0x100300,0x0d0000,0x1b0d00,0x4f4430,0x625840,0x5f5538,0x5e533b,0x3d3027,0x080001,0x05040b,0x000e22,0x00759d,0x03b9f0,0x00bbfd,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00b9ff,0x00b6ff,
+0x00b3fc,0x00b4ff,0x00b4ff,0x00b4ff,0x00b3ff,0x00b2ff,0x00b5ff,0x00b7ff,0x00b8ff,0x00b9ff,0x00bbff,0x00bbff,0x00beff,0x00beff,0x00befc,0x06bcf6,0x17b7e9,0x36b4dc,0x73c3d5,0xb0c7b8,0x7d7756,0x201a00,0x000000,0x000000,0x000000,0x5e5642,0x1f1509,0x0c0100,0x0d0100,0x473a2a,0x665841,0x625239,0x645338,0x635237,0x645237,0x655137,0x665136,0x665136,0x665136,0x665136,0x655236,0x645234,0x645234,0x645234,0x645234,0x655234,0x665234,0x685334,0x695234,0x6a5234,0x695133,0x685135,0x675238,0x655339,0x64533a,0x64533b,0x64543f,0x5f4f40,0x423329,0x100100,0x070000,0x211305,0x807360,0x9e927c,0x9d927b,0x9f937b,0xa2977e,0x9b9178,0x8a816a,0x99917d,0xbeb6a5,0xd4ccc0,0xc2bab1,0x60574f,0x040000,0x020000,0x050000,0x070000,0x060000,0x0a0301,0x080100,0x090203,0x0b0303,0x0c0401,0x120b02,0x090300,0x030000,0x050100,0x000000,0x494326,0xc1bb9c,0xbab695,0xbebb9a,0xbfbc9c,0xb8b595,0xbbb796,0xbbb797,0x736d52,0x241d08,0x080000,0x080000,0x0e0500,0x534837,0xb9ae96,0xc7bc9e,0xbfb58d,0xc1b789,0xc2b888,0xc3b888,0xc4b98b,0xc3b78b,0xc3b78b,0xc3b88b,0xc2b88a,0xc1b88a,0xc1b88a,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc1b88a,0xc2b98e,0xc2ba93,0xb9b28f,0x726d4f,0x110c00,0x0a0500,0x000000,0x090400,0x040000,0x1e1911,0x4b473b,0x716c5b,0x837d66,0xb9b294,0xc3bb99,0xc9c19d,0x898065,0x190f07,0x150907,0x32241a,0x695849,0x67523f,0x68503c,0x69503c,0x69503b,0x69503a,0x68503a,0x67513c,0x635140,0x23170b,0x090000,0x0c0200,0x160c00,0x4c4331,0x615841,0x5e5538,0x5e533a,0x3c3025,0x080000,0x070006,0x000517,0x006284,0x12b8e9,0x00bafa,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00baff,0x00b9ff,0x00b8ff,
+0x00b4fe,0x00b5ff,0x00b5ff,0x00b3ff,0x00b2ff,0x00b1ff,0x00b2ff,0x00b6ff,0x00b6ff,0x00b8ff,0x00baff,0x00bcff,0x00bdff,0x00beff,0x00beff,0x00bdfe,0x09b8f2,0x33bdec,0x52a9c5,0x334b4b,0x090200,0x050000,0x040000,0x0b0700,0x010000,0x362f1f,0x1e150b,0x0e0400,0x0c0000,0x433626,0x675841,0x625238,0x645338,0x635237,0x645237,0x655237,0x655137,0x655137,0x655236,0x655236,0x655236,0x645235,0x645234,0x645234,0x645234,0x655234,0x665233,0x685334,0x695233,0x6a5233,0x685133,0x675135,0x675338,0x64533a,0x63533b,0x64543d,0x685945,0x5b4c3e,0x25160d,0x0b0000,0x000000,0x403322,0x90846d,0xa79b81,0xc1b69a,0xaba083,0xa89e80,0xafa789,0xa8a085,0xa9a28b,0xbdb5a3,0xa49c90,0x322a21,0x140c04,0x060000,0x090100,0x080000,0x080100,0x0a0301,0x0d0604,0x0a0201,0x0d0405,0x0e0504,0x090100,0x040000,0x040000,0x0f0a00,0x231e05,0x4c472b,0xa6a082,0xc3be9e,0xb9b595,0xc1bd9d,0xc3bfa1,0xc4c0a4,0xb5b196,0x847e66,0x2e2812,0x040000,0x0d0500,0x000000,0x5d5442,0xc6bca4,0xc5ba9c,0xc1b792,0xc1b88d,0xc2b889,0xc4b988,0xc4b988,0xc4b98a,0xc3b88a,0xc3b88a,0xc3b88a,0xc2b88a,0xc1b88a,0xc1b88a,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc0b787,0xc0b787,0xc0b78a,0xcbc29b,0x938b6a,0x120d00,0x050000,0x070100,0x030000,0x050000,0x090504,0x050100,0x000000,0x080300,0x150f00,0x6d654d,0xc0b89a,0xc7be9d,0x6c6349,0x130901,0x110402,0x382a20,0x6a5a4a,0x675240,0x68503d,0x68503d,0x69503c,0x69503b,0x674f3b,0x654f3d,0x5a493a,0x140900,0x080000,0x0d0500,0x0e0600,0x322a1d,0x574f3d,0x5b533b,0x574e38,0x52483d,0x150907,0x060000,0x000311,0x00516b,0x17a9d3,0x01baf8,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00baff,0x00b9ff,0x00b9ff,
+0x00b5ff,0x00b5ff,0x00b5ff,0x00b6ff,0x00b5ff,0x00b1ff,0x00b2ff,0x00b4ff,0x00b5ff,0x00b7ff,0x00b8ff,0x00baff,0x00bcff,0x00bcff,0x00bcff,0x00bafe,0x15bcf9,0x3fb6eb,0x175d80,0x000001,0x060000,0x0d0700,0x39341a,0x898565,0x8b8668,0x9c9582,0x40372c,0x040000,0x0c0000,0x3f3122,0x645640,0x625239,0x635238,0x635238,0x645238,0x645238,0x645238,0x645238,0x645237,0x645236,0x645236,0x645236,0x645235,0x645234,0x645234,0x655234,0x665233,0x685334,0x695233,0x695233,0x675133,0x665235,0x655339,0x63533b,0x62533d,0x63553f,0x695a48,0x332416,0x0d0000,0x0d0000,0x2f2218,0x918570,0xa4987d,0xc0b596,0xc0b694,0xc4b996,0xc4bb98,0xc0b998,0xbeb79a,0xb2ab93,0x69614f,0x31291d,0x000000,0x080000,0x070000,0x070000,0x090100,0x0b0301,0x0b0302,0x130b09,0x170f0c,0x322926,0x4b423b,0x655e51,0x7e7764,0x7e775e,0x989275,0xa6a283,0xbfba9b,0xc8c2a2,0xb6b190,0xb0ab89,0xc4c09f,0xbdb99a,0x8f8a70,0x5a5542,0x0a0400,0x010000,0x040000,0x100900,0x534c35,0xbfb79b,0xc8bf9e,0xc1b791,0xc3b98e,0xc3b98b,0xc3b98a,0xc4b989,0xc3b888,0xc3b888,0xc3b889,0xc3b889,0xc3b889,0xc2b88a,0xc1b88a,0xc1b88a,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc0b785,0xc0b785,0xc0b787,0xccc499,0x8e8763,0x100a00,0x120d00,0x0b0500,0x16110b,0x100b09,0x151011,0x000000,0x000000,0x0a0400,0x010000,0x070000,0x554d36,0x857d61,0x423922,0x0b0000,0x0d0100,0x41332a,0x69584a,0x665241,0x67503e,0x68503d,0x68503c,0x68503c,0x67503d,0x5a4635,0x392a1c,0x0c0100,0x0c0300,0x0e0501,0x010000,0x010000,0x180f06,0x21190c,0x50473a,0x5b534b,0x3a322d,0x0e0402,0x000308,0x002738,0x118bae,0x0dbdf9,0x00bcff,0x00bdff,0x00bbff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,0x00bcff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bbff,0x00b9ff,0x00baff,
+0x00b5ff,0x00b4ff,0x00b4ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b4ff,0x00b4ff,0x00b5ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00bbff,0x00bcff,0x00bdff,0x04b8f6,0x27b8ef,0x1b77a4,0x001332,0x00030f,0x0a0200,0x25200a,0x8e8a6a,0xcecaa5,0xc3bf9d,0xbeb8a2,0x4f473a,0x030000,0x0c0000,0x3c2f20,0x635540,0x5f5039,0x615138,0x615037,0x63523a,0x63523a,0x63523a,0x63523a,0x625138,0x635238,0x635236,0x635236,0x635236,0x635235,0x645235,0x645235,0x655234,0x675335,0x675334,0x675334,0x655233,0x645236,0x625238,0x62553f,0x615542,0x605344,0x413426,0x100300,0x0e0200,0x150900,0x4d4232,0x9d9279,0xaea485,0xc4bb97,0xc0b690,0xc0b690,0xbfb692,0xbcb595,0xbcb599,0x676049,0x0e0700,0x0b0300,0x0b0200,0x080000,0x050000,0x040000,0x060000,0x0a0100,0x19100b,0x574e46,0x696156,0x9d9486,0xb5ad9c,0xc1b9a4,0xb3ab91,0xb9b293,0xb6b08e,0xb3ae8c,0xc2bd9b,0xb0aa89,0x686240,0x6c6744,0xafaa87,0x9e9a79,0x262205,0x090400,0x030000,0x010000,0x000000,0x60593f,0xbcb597,0xc6bf9b,0xbeb58e,0xc2b98d,0xc3b98a,0xc3b98a,0xc3b989,0xc4b989,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b889,0xc2b88a,0xc2b88a,0xc2b88a,0xc3b98b,0xc3b98b,0xc3b98b,0xc2b889,0xc2b888,0xc2b888,0xc2b888,0xc2b887,0xc0b784,0xc0b783,0xc0b784,0xc5bd8f,0xa8a179,0x5d5739,0x36301a,0x474133,0x575149,0x0e0806,0x0a0505,0x090304,0x000000,0x000000,0x000000,0x090200,0x170f00,0x332b16,0x1b1200,0x0e0400,0x1b0f0c,0x52453c,0x67574a,0x655242,0x65513f,0x66503e,0x66503e,0x67523f,0x6b5745,0x524131,0x190b00,0x0b0100,0x0e0501,0x100604,0x080000,0x050000,0x0d0401,0x040000,0x1d150f,0x3e3833,0x514b46,0x19110c,0x000303,0x00121c,0x157290,0x20bef7,0x00bbff,0x00bbff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00c0ff,0x00beff,0x00bbff,0x00b9ff,0x00baff,
+0x00b6ff,0x00b6ff,0x00b4ff,0x00b3ff,0x00b5ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b6ff,0x00b7ff,0x00baff,0x00bffe,0x00c1f9,0x19b8e8,0x1785ad,0x002a46,0x000110,0x000001,0x0b0400,0x6a6643,0xc7c499,0xc3c098,0xb8b491,0xa7a389,0x3b3422,0x060000,0x0a0000,0x352a1b,0x5a4c3a,0x554731,0x584932,0x5a4a33,0x604f3a,0x61503d,0x63513f,0x63513f,0x61513c,0x615138,0x635237,0x635236,0x635236,0x635237,0x635237,0x635237,0x635237,0x655337,0x655336,0x655335,0x635234,0x625337,0x60533a,0x665b47,0x564d3f,0x3b3029,0x150b05,0x0d0300,0x0b0100,0x3e3521,0x867e64,0xaba485,0xc0b996,0xc1b992,0xc0b891,0xbeb590,0xc1b998,0xbbb499,0x6a634d,0x1b1400,0x000000,0x0b0300,0x090100,0x070000,0x030000,0x030000,0x1d130a,0x3b3028,0x857b70,0xbbb19f,0xbeb59e,0xcbc3a6,0xbeb697,0xb9b291,0xb8b090,0xc3bb99,0xbeb794,0xbcb693,0x706a48,0x292100,0x030000,0x040000,0x6e6946,0x948e6b,0x161000,0x030000,0x140e00,0x383212,0x686240,0xb9b38f,0xc6c099,0xc2bb91,0xc1b98d,0xc3bb8b,0xc4bb8a,0xc4bb8a,0xc4ba8a,0xc4b989,0xc3b888,0xc4b989,0xc4b989,0xc4b989,0xc4b98a,0xc3b88a,0xc3b88a,0xc3b88a,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b888,0xc3b888,0xc2b888,0xc2b887,0xc0b784,0xc0b882,0xc0b883,0xbeb684,0xc0ba8d,0xc7c19c,0xb2ac8f,0xb6b09d,0xbeb7ac,0x4c4641,0x120c0a,0x080203,0x040000,0x090401,0x010000,0x100800,0x1b1308,0x0b0300,0x0a0100,0x0c0300,0x302621,0x554840,0x5b4d42,0x635244,0x635141,0x665241,0x685443,0x5f4c3c,0x615041,0x2c1d10,0x0f0300,0x0e0600,0x100804,0x362d2b,0x2a201f,0x110605,0x0c0101,0x0a0000,0x050000,0x0d0806,0x383430,0x342f2a,0x000200,0x00050c,0x00344c,0x20a5d9,0x07b8fc,0x00baff,0x00bbff,0x00baff,0x00bcff,0x00bbff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00bfff,0x00bfff,0x00c2ff,0x00c7ff,0x00c5ff,0x00c2ff,0x00c0ff,0x00bbff,0x00baff,0x00bbff,
+0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b7ff,0x00b8ff,0x00bcf7,0x03bbeb,0x29afd6,0x004864,0x000c1a,0x000000,0x040000,0x544d37,0xb7b388,0xc2c08e,0xb9b68c,0xb4b08d,0xb2ad91,0x49442e,0x000000,0x070000,0x23180b,0x4e4232,0x50422f,0x50422e,0x51422d,0x564633,0x5c4c3b,0x5b4a3b,0x645444,0x645442,0x62523b,0x625238,0x625237,0x625237,0x625238,0x625239,0x625239,0x625238,0x635439,0x635439,0x625438,0x615338,0x605339,0x5f543e,0x5b5341,0x2f281c,0x100803,0x0a0200,0x040000,0x150f00,0x6d674c,0x9e9978,0xc1bc99,0xbfb994,0xbfb890,0xbeb78f,0xbfb894,0xc5bd9f,0x7d765f,0x130b00,0x010000,0x000000,0x0b0300,0x090100,0x080000,0x000000,0x1f1506,0x817766,0xc0b6a4,0xbeb49e,0xbfb699,0xc0b795,0xc0b891,0xc0b890,0xc0b892,0xc0b795,0xc7be9e,0xb7af90,0x6e6749,0x1d1600,0x0d0500,0x110900,0x0a0300,0x5d5733,0xb3ae88,0x7e7852,0x47411c,0x656039,0xbeb98f,0xbfba8f,0xbeb98d,0xc1bb8e,0xc0ba8c,0xc1ba8a,0xc3bb8a,0xc4bb8a,0xc4bb8b,0xc4ba8b,0xc5ba8b,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b98a,0xc3b88a,0xc3b78a,0xc3b78a,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc2b887,0xc0b784,0xc0b883,0xc0b883,0xbfb884,0xbeb888,0xbfb88e,0xb9b290,0xc9c1a9,0xb1a99a,0x373028,0x0c0602,0x0a0301,0x0a0400,0x444039,0x080300,0x030000,0x0d0600,0x0f0700,0x0f0700,0x060000,0x382f2a,0x594d46,0x5f5248,0x605145,0x605042,0x615041,0x615041,0x645445,0x392b1f,0x140700,0x0d0300,0x050000,0x211a15,0x584e4b,0x574c49,0x332825,0x090000,0x0a0001,0x0e0607,0x080403,0x151210,0x2c2824,0x020100,0x000204,0x00192b,0x2392bf,0x0baae8,0x06c1ff,0x00bcff,0x00b9ff,0x00bbff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00c1ff,0x00caff,0x00cbff,0x00c9ff,0x00c8ff,0x00bfff,0x00bbff,0x00b9ff,0x00baff,
+0x00b6ff,0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b4fd,0x00b4ef,0x0fa9d7,0x1881a4,0x001a2f,0x000000,0x020000,0x50493c,0xaea78d,0xbeba8d,0xb7b582,0xb7b48a,0xb7b490,0xc1bd9e,0x6a654d,0x000000,0x050000,0x120800,0x463a2e,0x4b3d2e,0x4d3e2d,0x4e3f2d,0x4d3e2d,0x453627,0x150600,0x4a3a2d,0x645545,0x61523c,0x615239,0x625238,0x625238,0x625239,0x62523a,0x62523a,0x62523a,0x61523b,0x62543c,0x61543d,0x5e523b,0x605540,0x453c29,0x1d1706,0x070200,0x040000,0x000000,0x322e1b,0x848168,0x8f8c6c,0xacaa85,0xbfbb95,0xbdb991,0xbfba90,0xc1bb94,0xbab392,0x676046,0x050000,0x0c0400,0x0e0600,0x090100,0x090100,0x0c0400,0x000000,0x3b3320,0x9c947a,0xc6bd9f,0xc4bc9c,0xc1b996,0xc1b792,0xc2b990,0xc2b98e,0xc3ba90,0xc0b691,0xbdb394,0xc6bca3,0x59503a,0x000000,0x060000,0x130a00,0x0d0500,0x342d0d,0xaea883,0xc0bb93,0xc3bd94,0xccc79d,0xcdc89d,0xc0bb8e,0xc0bb8c,0xc0bc8b,0xc1bb8b,0xc2bb8b,0xc2bb8b,0xc3bb8b,0xc4ba8c,0xc4ba8c,0xc4ba8c,0xc5ba8b,0xc4b989,0xc4b988,0xc4b988,0xc4b989,0xc4b98a,0xc3b88a,0xc3b78a,0xc3b78a,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc2b888,0xc1b887,0xc0b986,0xc0b986,0xc0b987,0xc0b989,0xbdb68a,0xb9b28c,0xc4bc9e,0x827a65,0x000000,0x0e0700,0x000000,0x3e392e,0xc3bfb0,0x797666,0x332f21,0x020000,0x0b0500,0x080100,0x050000,0x130b08,0x4b413b,0x5e5249,0x5f5246,0x605244,0x615243,0x5e4f41,0x35281b,0x130800,0x0a0100,0x050000,0x0c0500,0x463f38,0x60574e,0x61574d,0x63584f,0x433832,0x1d1311,0x040000,0x080203,0x060302,0x0c0907,0x040302,0x020404,0x000714,0x0b6689,0x20afe1,0x03bff8,0x00c1ff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00c1ff,0x00c4ff,0x00c4ff,0x00c5ff,0x00c9ff,0x00beff,0x00baff,0x00b9ff,0x00b9ff,
+0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b2fb,0x13b3ed,0x1b96c2,0x003352,0x000e1d,0x000503,0x120a00,0x998f7e,0xbcb397,0xbbb788,0xb8b582,0xb6b287,0xb3af8b,0xaca888,0x79745b,0x090200,0x040000,0x0e0400,0x43372d,0x483b2d,0x4b3d2d,0x4e4130,0x433525,0x281a0c,0x090000,0x443629,0x645546,0x60523d,0x61523a,0x62523a,0x62523a,0x62523b,0x62523c,0x62523c,0x62523d,0x5e503c,0x635642,0x655846,0x403422,0x2b210f,0x110900,0x0b0600,0x020000,0x000000,0x312e1a,0x79775d,0x959374,0xa5a37d,0xb8b68d,0xbcb991,0xbdb991,0xbcb790,0xcfcaa6,0x8a8367,0x1d1601,0x090200,0x050000,0x050000,0x020000,0x0c0400,0x0d0500,0x000000,0x958d73,0xcdc5a5,0xc4bc97,0xc4bd95,0xc1b990,0xc2b98e,0xc3ba8f,0xc1b88c,0xc2b990,0xbcb38f,0xafa589,0xaca28e,0x160d00,0x050000,0x080000,0x000000,0x0c0300,0x5f5838,0xc1ba95,0xbcb68d,0xbeb98e,0xbfba8e,0xbfba8c,0xbeb989,0xbfba89,0xc1bc89,0xc1bc89,0xc0ba89,0xc2bb8b,0xc3bb8c,0xc4ba8d,0xc4ba8d,0xc4ba8c,0xc5ba8b,0xc6ba8a,0xc6ba89,0xc6ba89,0xc6ba8a,0xc4b98a,0xc4b98b,0xc3b78b,0xc3b78a,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc2b889,0xc1b888,0xc0b987,0xc0b987,0xbfb989,0xbfb98a,0xbeb78c,0xb6af88,0x989070,0x413921,0x030000,0x020000,0x080200,0x837e6a,0xbdb9a1,0xb8b49d,0x898573,0x0d0800,0x090300,0x080100,0x050000,0x0d0602,0x3e352f,0x61574e,0x5f5348,0x675a4d,0x695b4c,0x392c1d,0x0b0000,0x090000,0x060000,0x040000,0x0f0803,0x4a423b,0x5b5245,0x5c5243,0x5d5345,0x60564b,0x443b36,0x0c0402,0x070100,0x040000,0x060301,0x050301,0x020201,0x00050d,0x002d48,0x2191bb,0x14bcef,0x00c6ff,0x00c1ff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00bdff,0x00baff,0x00baff,0x00b9ff,
+0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b4ff,0x00b4ff,0x00b4ff,0x00b4ff,0x00b4ff,0x01b0f9,0x28afe9,0x005580,0x000b28,0x000310,0x0e0c04,0x908572,0xc8bca6,0xc1b798,0xc0ba8b,0xbdba87,0xb8b388,0xaea984,0x948e6e,0x928c72,0x292110,0x000000,0x100600,0x362b20,0x4b3e31,0x4e4131,0x504333,0x352819,0x130600,0x0a0000,0x443629,0x645546,0x60523e,0x61523c,0x62523c,0x62523c,0x62523d,0x62523e,0x62523f,0x60503f,0x625343,0x4d3f30,0x2c1f10,0x100400,0x060000,0x050000,0x060100,0x141100,0x535038,0x878568,0x9b9978,0xa7a580,0xb8b68b,0xbbb88c,0xbbb88e,0xbdb992,0xbdb895,0x8f896b,0x332c17,0x080100,0x080000,0x080000,0x040000,0x040000,0x050000,0x170f00,0x6d654b,0xd0c8a8,0xbcb490,0xc1b992,0xc3bc92,0xbfb78c,0xc0b88d,0xc1b98e,0xbfb78d,0xbeb58f,0xbcb292,0xa89e85,0x392f1f,0x000000,0x090000,0x060000,0x180e00,0x796f58,0x9f9777,0xc0b993,0xbdb68c,0xbeb78c,0xbeb78b,0xbeb78a,0xbfb989,0xbfb988,0xc0ba89,0xc0ba89,0xc1ba89,0xc2bb8b,0xc3bb8c,0xc4ba8d,0xc4ba8d,0xc4ba8c,0xc5ba8a,0xc6ba89,0xc6ba88,0xc6ba89,0xc6ba8b,0xc4b98b,0xc4b98c,0xc3b78b,0xc3b78b,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b888,0xc3b888,0xc3b889,0xc2b889,0xc1b889,0xc0b988,0xc0ba8a,0xc0ba8c,0xbeb98d,0xbeb890,0xa59e7a,0x302809,0x0b0200,0x000000,0x000000,0x5f5940,0xaba588,0xb8b393,0xb0ab8d,0x8d8972,0x191403,0x060100,0x090300,0x090200,0x0e0702,0x201710,0x4e443b,0x5f5348,0x64574a,0x302213,0x090000,0x090000,0x0a0100,0x0b0400,0x0a0400,0x0f0802,0x4b443b,0x5a5142,0x5d5341,0x5e5442,0x615848,0x5f564c,0x3c342e,0x0e0903,0x090501,0x060300,0x040200,0x040200,0x000408,0x000a1e,0x003759,0x21a4d3,0x0ebff8,0x00bfff,0x00c2ff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbff,0x00baff,0x00baff,0x00bbff,
+0x00b8ff,0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b4ff,0x00b4ff,0x00b4ff,0x00b4ff,0x00b3ff,0x0eaef7,0x2a94cc,0x001b43,0x000620,0x03030b,0x191205,0xb7ac94,0xccbfa5,0xc3b896,0xc2bb8d,0xc0ba89,0xb7b085,0xaca57f,0x968f6d,0xa29b80,0x403925,0x000000,0x0e0500,0x291f14,0x4e4336,0x524739,0x4f4536,0x2e2315,0x090000,0x090000,0x43362a,0x635547,0x60523f,0x60523d,0x61523e,0x645441,0x625240,0x605040,0x5d4d3d,0x574739,0x2b1c10,0x0c0000,0x0a0000,0x0b0000,0x0b0000,0x110900,0x3a361f,0x7f7d62,0x8d8b6c,0x969571,0xbfbe96,0xbbba8e,0xbbba8a,0xbcba8a,0xbdba90,0xc3c09b,0x7f7a5b,0x0d0600,0x000000,0x060000,0x090100,0x0b0200,0x040000,0x1b1302,0x39321b,0x716a4e,0xb8b190,0xbdb591,0xbeb790,0xbfb88f,0xc0b88d,0xc0b88c,0xc0b88d,0xc0b88e,0xc0b890,0xccc4a2,0xbbb296,0x59503b,0x0a0000,0x060000,0x050000,0x1c1409,0x7f7664,0xbfb79d,0xc4bc9a,0xc1b991,0xc1b98e,0xc0b88b,0xbfb78a,0xbfb789,0xc0b989,0xc0b988,0xc1ba89,0xc1ba89,0xc1ba89,0xc3bb8b,0xc3bb8c,0xc4ba8c,0xc4ba8c,0xc4ba8b,0xc5ba89,0xc5ba88,0xc5ba88,0xc5ba8a,0xc5ba8d,0xc4b98d,0xc4b98d,0xc3b78c,0xc3b88b,0xc4b98b,0xc4b98b,0xc4b98b,0xc3b889,0xc3b889,0xc3b889,0xc3b889,0xc2b889,0xc1b889,0xc1ba8a,0xc1bb8c,0xc1bc8f,0xbfba90,0xb2ad87,0x3d3716,0x000000,0x120b00,0x170f00,0x332c15,0xa29c7d,0xc9c2a0,0xbcb692,0x9b9575,0x524c34,0x000000,0x070100,0x090300,0x070200,0x090300,0x000000,0x332a1f,0x4f4439,0x221608,0x070000,0x090000,0x312713,0x746c5a,0x241e0f,0x000000,0x100a01,0x453e35,0x574e3f,0x5e5442,0x5f5642,0x615845,0x5f5748,0x595247,0x48433a,0x090600,0x000000,0x020000,0x050200,0x030204,0x00010f,0x00021d,0x00577f,0x18a3d7,0x02bbf9,0x00c0ff,0x00beff,0x00beff,0x00beff,0x00bfff,0x00beff,0x00beff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,
+0x00b8fe,0x00b7ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b3ff,0x00b0ff,0x20abf4,0x317aae,0x000d2f,0x000012,0x060103,0x48402e,0xbfb698,0xc4b998,0xc4ba93,0xc4ba8d,0xc4ba8b,0xb2a97d,0x999068,0x968e6a,0x9a9274,0x3f3821,0x000000,0x0a0100,0x1c1409,0x383025,0x4e463b,0x4e463b,0x2a2217,0x040000,0x080000,0x42362d,0x625549,0x5f5241,0x5f523f,0x615342,0x695a4a,0x5d4e40,0x46372a,0x27170b,0x150600,0x0c0000,0x040000,0x090000,0x150900,0x2f250c,0x726b4d,0x8e8b6a,0x94936f,0x9a9973,0xb2b189,0xbdbb8e,0xbbba89,0xbab984,0xb8b886,0xbbb990,0xa5a281,0x5c573d,0x050000,0x0e0800,0x080100,0x030000,0x0b0200,0x050000,0x2f2714,0x9c957b,0xc1bb9a,0xc1bb94,0xbeb98f,0xbdb78d,0xbfb98d,0xbfb88d,0xbfb78c,0xbfb78c,0xb9b188,0xc0b892,0xc3bb9b,0x5c543e,0x010000,0x0b0200,0x060000,0x0b0200,0x817a6b,0xc4bda4,0xbeb696,0xbfb891,0xc1b98e,0xc2b98c,0xc2b98a,0xc2b98a,0xc2b98a,0xc2b98a,0xc2ba89,0xc2ba89,0xc2ba89,0xc2ba89,0xc2b989,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b989,0xc3ba87,0xc2b885,0xc2b886,0xc2b888,0xc2b88d,0xc2b78e,0xc3b98e,0xc3b98d,0xc3b98c,0xc3b98b,0xc3b98b,0xc3b98b,0xc2b88a,0xc2b88a,0xc3b88a,0xc3b889,0xc1b788,0xc1b889,0xc0b988,0xbfb98a,0xc2be91,0xc5c199,0x706b49,0x050000,0x030000,0x000000,0x282109,0x8d866c,0xc9c2a2,0xbfb895,0xc6c09e,0x746e51,0x070000,0x000000,0x150f03,0x0d0800,0x030000,0x080300,0x010000,0x050000,0x0c0200,0x120700,0x0b0000,0x473c24,0xbfb79d,0xcbc4ab,0x413c26,0x070100,0x030000,0x060000,0x433b2c,0x665c4b,0x615844,0x615844,0x5f5745,0x5c5647,0x656054,0x272419,0x030100,0x000000,0x030100,0x030002,0x04010d,0x00061b,0x000926,0x00436d,0x1db3ef,0x00baff,0x00bcff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bfff,0x00bfff,0x00bfff,0x00c0ff,0x00c1ff,0x00c0ff,0x00bfff,0x00bdff,
+0x00bcff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b3ff,0x0bb0fe,0x168fd2,0x002e5b,0x000013,0x000003,0x271f1a,0x968e76,0xbcb491,0xc2b992,0xc2b88d,0xc3b88a,0xc4b98b,0xa89e72,0x8c8259,0x89815c,0x999171,0x847d64,0x100900,0x030000,0x0d0600,0x221d12,0x454036,0x4b453c,0x282219,0x040000,0x080000,0x41362e,0x62554b,0x5d5141,0x5f5340,0x5a4c3d,0x493a2e,0x1b0d02,0x110200,0x0d0000,0x0f0100,0x0b0000,0x24180a,0x534734,0x83795f,0x9a9171,0x908965,0x94916b,0xaaa981,0xb9b88f,0xbbba8e,0xbbb98a,0xbbb987,0xbab984,0xb3b382,0xb9b892,0x747155,0x040000,0x020000,0x100a02,0x0a0200,0x000000,0x090000,0x2e2617,0x9f9781,0xc7c1a2,0xbfb994,0xc0bb90,0xbfba8d,0xbfba8d,0xbeb98c,0xbfb98c,0xbeb78c,0xbfb88e,0xc2ba92,0xc3bb97,0xb3ac8f,0x251d0a,0x000000,0x0e0600,0x090100,0x3e3628,0xc0b9a4,0xbdb698,0xc3bd97,0xc3bc91,0xc1ba8c,0xc2b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3ba87,0xc1b886,0xc0b787,0xc1b88b,0xc1b790,0xc1b791,0xc3b990,0xc1b88d,0xc4ba8e,0xc4ba8d,0xc3b98c,0xc3b98c,0xc1b88b,0xc2b88b,0xc3b88a,0xc2b689,0xc1b787,0xc0b787,0xbfb787,0xb9b384,0xbab58a,0x827f59,0x0e0b00,0x000000,0x040000,0x000000,0x666046,0xc8c1a4,0xc6be9e,0xbfb798,0xa39b7f,0x261e08,0x000000,0x272014,0x463f35,0x373227,0x1c190b,0x000000,0x000000,0x040000,0x000000,0x1b1100,0x8a8067,0xc3b99c,0xc9c2a2,0xc8c2a3,0xb8b398,0x4a4530,0x030000,0x000000,0x22190a,0x5e5443,0x615844,0x625945,0x5e5642,0x5c5644,0x5c5748,0x676457,0x58574a,0x030200,0x030100,0x050200,0x060108,0x00020f,0x000518,0x000727,0x006ba3,0x00b1f5,0x00bbff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bfff,0x00c0ff,0x00bfff,0x00c1ff,0x00c1ff,0x00c0fd,0x00c0fc,0x00bdf9,
+0x00c1ff,0x00bcff,0x00bbff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b5f9,0x12aef0,0x005a90,0x000829,0x00000f,0x000000,0x655f51,0xc0ba9b,0xbbb58c,0xbfb78b,0xc0b789,0xbfb486,0xbfb487,0x9f9569,0x91885e,0x938a64,0x938b6a,0x968e74,0x27210c,0x050000,0x0e0800,0x18130a,0x3b362e,0x4b473e,0x29231c,0x060000,0x090000,0x3b3029,0x64594f,0x5c5242,0x5f5443,0x3f3325,0x180b00,0x0b0000,0x0a0000,0x100200,0x201307,0x443729,0x685c49,0x8e8369,0x958b6a,0x9a916b,0x9f9970,0xaeab81,0xbbbb91,0xbbbb90,0xbbba8e,0xbdbb8d,0xbbb98a,0xb5b484,0xc6c59b,0xa19f81,0x494531,0x040000,0x010000,0x040000,0x050000,0x060000,0x372d22,0x928a78,0xc5bea4,0xbcb692,0xc0bb91,0xc0bb8f,0xc0bb8d,0xbfba8d,0xbfba8e,0xbeb98c,0xbdb88b,0xbdb88c,0xbdb78e,0xc4be9a,0x847d61,0x140c00,0x050000,0x0e0600,0x171001,0x8c8570,0xb9b396,0xbdb792,0xbeb98e,0xbfb98b,0xc1ba8a,0xc2ba88,0xc3ba88,0xc3ba88,0xc3ba88,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc0b789,0xc0b78b,0xc6bc95,0xc4b997,0xcbc09f,0xc3b894,0xc1b790,0xc5bb91,0xc5bb8f,0xc4ba8e,0xc4ba8e,0xc3b98d,0xc2b88b,0xc3b88b,0xc2b689,0xc2b787,0xc1b787,0xbcb483,0xb7b182,0xb1ad84,0x34300e,0x000000,0x0f0b00,0x050200,0x201c03,0xa9a487,0xcbc4a5,0xc6be9f,0xbcb399,0x3e3524,0x090000,0x100700,0x261e16,0x302920,0x151004,0x060300,0x000000,0x000000,0x030000,0x060000,0x514830,0xcbc2a2,0xcec6a1,0xc2bc95,0xbcb793,0xbbb799,0xa29e88,0x191406,0x040000,0x150c00,0x564c3b,0x635945,0x5f5641,0x59513d,0x4c4632,0x353120,0x646152,0xa5a496,0x252318,0x000000,0x090702,0x050000,0x000308,0x000610,0x000922,0x00689a,0x00b0f0,0x00bbfe,0x00beff,0x00beff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bfff,0x00beff,0x00c0fd,0x00c2fc,0x00c2fa,0x00c0f7,0x00bdf3,
+0x00c1ff,0x00bfff,0x00bdff,0x00bbff,0x00bbff,0x00baff,0x00b8ff,0x00b8ff,0x00b8ff,0x00bafd,0x00b6f3,0x27b7ee,0x025d88,0x00071e,0x000005,0x0b0700,0x97917c,0xbfb995,0xbbb589,0xbfb789,0xc0b788,0xbdb285,0xafa478,0x958a5f,0x91885f,0x908861,0x8f8865,0x9b9478,0x666049,0x211b0a,0x060100,0x0f0a01,0x242019,0x423e38,0x312c26,0x0d0601,0x0b0200,0x201510,0x5d5249,0x594f41,0x413728,0x110500,0x0d0000,0x0f0200,0x090000,0x0e0100,0x54483b,0xa89c8a,0xa1957d,0xada281,0xaea57e,0xbcb388,0xbdb88b,0xbbb88c,0xbab98d,0xbcbb8f,0xbbb98f,0xbdba90,0xbcb990,0xd1cfa8,0xd8d6b5,0x3d3a24,0x000000,0x090300,0x050000,0x090100,0x0b0200,0x22180e,0x867d6d,0xcac2ab,0xbdb698,0xbfba92,0xc0bb8f,0xc0bb8d,0xc0bb8d,0xbfba8d,0xbfba8e,0xbfba8e,0xbeb98c,0xbeb98c,0xb9b48a,0xb6b08d,0x3e371c,0x000000,0x0c0400,0x010000,0x625a4a,0xc4bda4,0xc0ba99,0xc1bc93,0xbfba8c,0xc0ba8a,0xc1ba89,0xc2ba88,0xc2ba88,0xc2ba88,0xc2ba88,0xc3b989,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xbfb688,0xc4ba8f,0xc4ba93,0x7a704e,0x382d10,0x5d5236,0xbbb090,0xbdb28f,0xc1b790,0xc5bb92,0xc4ba90,0xc4ba90,0xc3b98f,0xc2b88d,0xc2b88b,0xc3b88a,0xc4b98a,0xc2b888,0xb8b080,0xbeb78a,0xaaa57e,0x130f00,0x030000,0x020000,0x0c0900,0x77735a,0xcfc9ab,0xbfb998,0xc1ba9a,0x675e45,0x060000,0x120900,0x0b0300,0x010000,0x050000,0x0b0600,0x1c1806,0x0e0a00,0x020000,0x0d0700,0x000000,0x221a00,0xb1aa86,0xcac49c,0xc2bd94,0xbeba93,0xbab697,0xada891,0x1d1708,0x020000,0x150c00,0x554b3a,0x635946,0x605743,0x4a422e,0x150f00,0x000000,0x514f3e,0xc7c6b6,0x717063,0x030200,0x060300,0x050000,0x000208,0x000c16,0x003d55,0x23b5e5,0x04befc,0x00bcfe,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bcff,0x00bdff,0x00bdff,0x00bfff,0x00c0ff,0x00bdfe,0x03c6ff,0x12d1ff,0x14cfff,0x18d1ff,0x1ad2ff,
+0x00c2fe,0x00c0ff,0x00bfff,0x00beff,0x00bdff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00bcfb,0x00b7ed,0x2fb1dd,0x004c6a,0x00040f,0x010000,0x2a2415,0xbab499,0xbeb790,0xbdb689,0xbfb789,0xc0b789,0xbcb085,0xa59970,0x938960,0x918860,0x928962,0x918965,0x918a6b,0x878167,0x403a26,0x000000,0x050100,0x130f09,0x34302d,0x3e3837,0x140c0b,0x0c0300,0x120703,0x4b413a,0x5d5247,0x362c20,0x080000,0x0e0300,0x0e0200,0x100400,0x0d0000,0x4d4134,0xbdb19c,0xbcb194,0xbfb590,0xc0b78c,0xc2bb8d,0xc1bb8c,0xbebb8c,0xbcba8c,0xbebc90,0xbebb93,0xc5c29d,0xc6c3a3,0xafac91,0x8c8975,0x060100,0x000000,0x060000,0x070000,0x070000,0x170e04,0x6a6151,0xb6ad96,0xbfb89b,0xbdb793,0xbeb98e,0xc0bb8d,0xc0bb8d,0xc0bb8d,0xbfba8d,0xbfba8e,0xbfba8e,0xbeb98c,0xbdb88b,0xbeb98f,0xafa986,0x2f280e,0x080100,0x090100,0x160e01,0xa79f8d,0xc4bda2,0xc3bd9a,0xc3bd94,0xbfba8c,0xc0ba8a,0xc1ba8a,0xc1ba8a,0xc1ba8a,0xc1ba89,0xc2ba89,0xc2b98a,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98b,0xc1b88c,0xc5bb93,0xa79c7a,0x261b00,0x060000,0x070000,0x6a5f44,0xc1b799,0xd3c8a6,0xc5bb95,0xc3b991,0xc3b991,0xc1b78f,0xc2b88f,0xc2b88d,0xc2b88b,0xc2b889,0xc1b889,0xbeb687,0xc6bf94,0x9f9975,0x100a00,0x0b0600,0x000000,0x3a3621,0x9a967c,0xbcb798,0xc5bf9e,0x8b8464,0x0a0300,0x0a0400,0x726c52,0x514b30,0x595339,0x504b35,0x8d8974,0xa09b85,0x615d46,0x130f00,0x040000,0x030000,0x140f00,0x7e7a55,0xc6c299,0xc1be94,0xbab68f,0xbbb797,0xa09c83,0x0a0500,0x020000,0x140b00,0x554b3a,0x615845,0x615846,0x463e2e,0x040000,0x000000,0x3d3b2b,0xc3c2b1,0x797867,0x000000,0x030000,0x080208,0x00000f,0x002c3e,0x1983a1,0x17c1f4,0x00bffe,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00bfff,0x00c0ff,0x00c2ff,0x00c2ff,0x00bfff,0x00bfff,0x0ccbff,0x1cd4ff,0x20d3ff,0x29d8ff,0x31deff,
+0x00c5ff,0x00c0fc,0x00c0ff,0x00bfff,0x00beff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bcf9,0x07b4e6,0x1c87ad,0x001228,0x000000,0x090000,0x68604d,0xcdc5a7,0xbbb38b,0xbeb689,0xc1b88c,0xc2b78d,0xbbaf87,0x9d906a,0x948863,0x938963,0x928963,0x8f8863,0x908968,0x969073,0x666149,0x040000,0x050100,0x090501,0x201b1b,0x403a3c,0x170f0f,0x0c0302,0x090000,0x3b302b,0x665c53,0x3b3128,0x090000,0x0c0200,0x100502,0x110603,0x0b0000,0x190e00,0xaba089,0xccc1a2,0xc1b890,0xbbb285,0xc2bb8c,0xc7c191,0xbcb888,0xbfbc8d,0xc1be91,0xb4b189,0x7d7958,0x3f3b21,0x211e0b,0x201c10,0x040000,0x010000,0x030000,0x050000,0x0b0400,0x736a5c,0xbbb29c,0xc0b89b,0xbab391,0xbdb78f,0xbeb98c,0xbfba8b,0xbfba8b,0xbfba8c,0xbfba8d,0xbfba8d,0xbfba8d,0xbfba8d,0xbfba8d,0xc8c39a,0x8b8563,0x140d00,0x070000,0x090100,0x332b1e,0xbfb8a6,0xbcb59a,0xbcb694,0xc4be97,0xc1bb90,0xc1bb8e,0xc0ba8d,0xbfb88c,0xc0ba8d,0xc0ba8c,0xc1ba8c,0xc2b98c,0xc2b98c,0xc3b98a,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98b,0xc3b98e,0xc5bb94,0xcbc09f,0x514529,0x000000,0x0b0000,0x1f1300,0x695e44,0xa3987a,0xbfb592,0xc3b893,0xc3b992,0xc1b790,0xc1b78f,0xc1b88e,0xc1b88c,0xc1b88a,0xc2b98b,0xc4bc8f,0xc9c199,0x948c6c,0x070000,0x000000,0x030000,0x393320,0xaba68e,0xc5c0a4,0xc0ba9c,0x9d9779,0x655f40,0x898565,0xc5c09f,0xc8c39f,0xc3be9c,0xbdb89a,0xc8c3a8,0xcdc8ae,0x726d55,0x110c00,0x030000,0x0f0a00,0x0b0700,0x706d4b,0xc7c59e,0xbfbd93,0xb9b58e,0xbdb999,0x908b72,0x010000,0x000000,0x1f1607,0x5c5241,0x605645,0x635a4a,0x352d20,0x060000,0x000000,0x2d2a1c,0xb5b4a1,0x9e9d88,0x171602,0x000000,0x020001,0x00000f,0x00354b,0x33a2c5,0x0fbdf2,0x00c0fe,0x00bfff,0x00bdfd,0x00bcfd,0x00bcfd,0x00bdff,0x00c0ff,0x00c3ff,0x00c7ff,0x00c4ff,0x00c0ff,0x00befe,0x00befc,0x10ceff,0x19d2ff,0x12c8ff,0x18cbff,0x24d2ff,
+0x07c8ff,0x00c3fc,0x00c2fd,0x00c0ff,0x00bfff,0x00bdff,0x00bcff,0x00bcff,0x00bbff,0x00baf8,0x10abde,0x0f5d80,0x000010,0x000000,0x20160a,0x8f8771,0xc5bd9e,0xbbb38b,0xbfb78b,0xc3b98f,0xc3b790,0xbbad89,0x9a8c69,0x968966,0x958966,0x938a66,0x8f8865,0x8c8663,0x979172,0x878267,0x322e19,0x000000,0x070300,0x0d080a,0x241e23,0x1e1518,0x0c0303,0x070000,0x271e1a,0x5d534e,0x342b24,0x020000,0x0a0100,0x2a201e,0x170c09,0x0a0000,0x0e0300,0x958b74,0xcfc6a7,0xc1b991,0xc0b88b,0xc1ba8a,0xc1bb8b,0xbfba8a,0xbdb989,0xc2be8f,0x837f56,0x1e1a00,0x060200,0x060100,0x090300,0x080100,0x050000,0x060000,0x070000,0x30281a,0xaba38e,0xbeb69a,0xbcb492,0xbdb68e,0xbeb78c,0xbfb98a,0xc0ba8a,0xc0ba8b,0xc0ba8c,0xc0ba8c,0xc0ba8c,0xc0ba8c,0xc0ba8c,0xc2bc8f,0xcdc89f,0x7a7452,0x0e0700,0x070000,0x080000,0x251d11,0xb1a999,0xc7c0a8,0xd4ceb0,0xb3ae8a,0xa49f79,0xbab48d,0xcac49d,0xbeb891,0xc1bb92,0xbfba90,0xc0ba8f,0xc1b98f,0xc2b98d,0xc2b98b,0xc3b989,0xc3b989,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98d,0xc4ba91,0xccc29e,0xa79c7e,0x281c04,0x050000,0x120600,0x0e0300,0x352a0d,0xb6ab8a,0xc3b894,0xc3b991,0xc1b78f,0xc1b88f,0xc1b88e,0xc1b88d,0xc1b88c,0xc1b88d,0xc1b88f,0xcdc4a1,0x857d60,0x080000,0x0b0300,0x060000,0x413a29,0xaea894,0xc1bca5,0x98937a,0x9e997f,0xaaa589,0xcbc7a7,0xc1bd99,0xbfbb95,0xbdb992,0xbcb792,0xbcb795,0xcdc7a9,0x655f47,0x120b00,0x020000,0x070100,0x040000,0x58553b,0xafad8c,0xb7b48d,0xb9b58e,0xbab694,0x7a755b,0x010000,0x000000,0x2d2415,0x645a4a,0x5e5445,0x5d5447,0x251c14,0x030000,0x000000,0x535143,0xb0af99,0xadad92,0x707152,0x38371f,0x080400,0x00050f,0x001229,0x1c7da2,0x1ebff3,0x00bffa,0x00bffd,0x00bffe,0x00bffe,0x00befd,0x00bffd,0x02c3ff,0x08c9ff,0x09caff,0x06c8ff,0x00c1ff,0x00bffd,0x00c2fe,0x0dcfff,0x0ed0ff,0x00c2fb,0x00c1fa,0x05c3fd,
+0x13ceff,0x07c8ff,0x00c6ff,0x00c2ff,0x00c0ff,0x00befe,0x00bdff,0x00bdff,0x00b7fa,0x00b8f6,0x16a2d5,0x003758,0x000009,0x000000,0x5f5546,0xc1b8a0,0xc2ba9a,0xbeb58e,0xc1b88e,0xc4b891,0xc5b893,0xb9aa89,0x9a8b6b,0x968969,0x95896a,0x93896b,0x928a6b,0x928b6c,0x928d6e,0x8e896d,0x736f58,0x221f0e,0x000000,0x000000,0x070104,0x150d0f,0x0f0606,0x080000,0x0e0503,0x544b48,0x3a322e,0x0c0300,0x070000,0x403635,0x2e2321,0x090000,0x090000,0x6d644d,0xd0c7a8,0xc2ba92,0xc3bc8f,0xc1ba8a,0xbfb988,0xc3be8d,0xbdb887,0xcbc696,0x7d794f,0x000000,0x080300,0x070000,0x050000,0x070000,0x080100,0x090100,0x0d0500,0x7d765f,0xd8d1b3,0xbeb693,0xbab28a,0xbdb68b,0xc0b88b,0xc0b989,0xc0b989,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc0ba8c,0xc2bc8f,0xd0caa1,0x7e7856,0x0c0500,0x050000,0x0b0300,0x020000,0x595144,0x8c8472,0x78715a,0x292207,0x191200,0x4d4729,0xa9a383,0xc5bf9d,0xc4be9a,0xc0bb95,0xc1bb93,0xc0b990,0xc1b98e,0xc2b98b,0xc3b989,0xc3b989,0xc1b888,0xc1b889,0xc4bb8b,0xc3b98a,0xc3b98a,0xc3b98b,0xc1b88c,0xc3b991,0xc7bd9a,0x9d9276,0x3d3118,0x030000,0x0f0400,0x302506,0xb6ab88,0xc3b991,0xc3b98f,0xc1b88e,0xc1b88e,0xc1b88e,0xc1b88e,0xc1b88d,0xc3b990,0xc1b792,0xc9bf9f,0x594f36,0x030000,0x0c0300,0x070000,0x292113,0x5f5848,0x181300,0x0c0700,0x27220d,0x757157,0xc4c1a0,0xbebb95,0xbfbb93,0xbeba91,0xbfba91,0xbdb791,0xd0c9a9,0x6e674f,0x130b00,0x000000,0x0c0500,0x010000,0x615e48,0xc0bea0,0xacaa84,0xb1af87,0xb9b593,0x656046,0x020000,0x000000,0x382f20,0x6a6051,0x554a3d,0x443a30,0x120904,0x090100,0x000000,0x5d5a4d,0xb0af98,0xbaba9b,0xc8c9a4,0x939274,0x010000,0x00040a,0x000419,0x002c4e,0x27b4e3,0x0cbff7,0x03c1fd,0x01c5ff,0x04c7ff,0x08c9ff,0x0bc9ff,0x11ceff,0x1ad6ff,0x18d3ff,0x13cfff,0x0ecdff,0x08ccff,0x04caff,0x05cbff,0x01c9ff,0x00bcf6,0x00bbf5,0x00baf5,
+0x1dd0ff,0x11cbff,0x0acaff,0x00c3fe,0x00c0fd,0x00bdfb,0x00befd,0x00beff,0x00b2f3,0x03b2ef,0x219fd2,0x001b3b,0x00000c,0x030000,0x736958,0xbbb299,0xbeb594,0xc0b690,0xc2b88f,0xc4b891,0xc6b994,0xb0a180,0x9a8b6c,0x978a6d,0x9a8d72,0x968b73,0x79715a,0x7d765e,0x948d74,0x888369,0x8c886f,0x76735d,0x131000,0x000000,0x000000,0x070000,0x0b0200,0x0b0201,0x070000,0x443b39,0x3c3331,0x060000,0x0b0201,0x2c2223,0x3a302f,0x070000,0x0a0000,0x655b46,0xbfb697,0xc0b890,0xc4bd90,0xc1ba8a,0xc0ba89,0xc4bf8e,0xbfba89,0xc1bd8c,0xada87f,0x656045,0x0a0500,0x090300,0x040000,0x070000,0x060000,0x100900,0x867f6a,0xbeb897,0xc2bc94,0xc0ba8e,0xbfb78a,0xbfb78a,0xc1ba8c,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8a,0xc1ba8b,0xc3bc8f,0xc9c39a,0xa8a280,0x383118,0x000000,0x0c0300,0x080000,0x090100,0x090100,0x050000,0x040000,0x040000,0x000000,0x3e371f,0xc6bfa3,0xc6c0a0,0xc1bb99,0xc1ba95,0xc0b991,0xc1b98e,0xc2b98b,0xc3b989,0xc3b989,0xc1b889,0xc4ba8c,0xc4ba8c,0xc3b98b,0xc1b889,0xc3b989,0xc3b98a,0xc1b88a,0xc5bb92,0xb9af8c,0x9a8f70,0x1a0f00,0x150b00,0x776d47,0xbeb48a,0xc3b98c,0xc3b98a,0xc1b88b,0xc1b88c,0xc1b88c,0xc1b88d,0xc3b98f,0xc4ba92,0xc5bb97,0xbcb193,0x6a5f48,0x110600,0x080000,0x090000,0x020000,0x090200,0x010000,0x000000,0x000000,0x57543c,0xc6c4a3,0xb8b68e,0xc0bc92,0xc0bb90,0xbfba8f,0xbfba92,0xc6bf9e,0x797158,0x140c00,0x070000,0x0c0500,0x0a0400,0x5f5c47,0xc6c4a7,0xbfbe98,0xb6b48e,0xb5b190,0x454127,0x050000,0x000000,0x32291b,0x605648,0x61574b,0x30261d,0x090000,0x0b0300,0x080300,0x6d6a5d,0xa5a58d,0xbfbf9f,0xbcbc96,0xa7a586,0x090200,0x000000,0x000615,0x000721,0x1c8fb6,0x1cbced,0x0ac1fa,0x04c7ff,0x0acbff,0x0ecdff,0x10cdff,0x14cfff,0x1bd4ff,0x26dfff,0x21daff,0x14d0ff,0x0bcbff,0x03c7ff,0x00c3fd,0x00c1fa,0x00c1fa,0x00c1f9,0x00c2fa,
+0x24d2ff,0x1bd0ff,0x13ceff,0x0ac9ff,0x01c3ff,0x00bffb,0x00bffc,0x00bdfc,0x00b7f6,0x0fb2ee,0x0f80b0,0x000d2a,0x020009,0x000000,0x675e49,0xbfb69a,0xbeb593,0xbeb58e,0xc0b68d,0xc2b78f,0xc6ba95,0xac9f7e,0x998c6e,0x968a6f,0x8b7f68,0x342a17,0x090100,0x2f2713,0x908a73,0x948f75,0x8f8c71,0x939077,0x7f7c67,0x444032,0x0f0a01,0x0f0803,0x0a0200,0x0a0201,0x080000,0x261e1d,0x473e3e,0x120a09,0x100807,0x372e2e,0x483e3d,0x0c0200,0x050000,0x423825,0xbfb79b,0xbdb690,0xc4bd91,0xc0ba8b,0xbdb786,0xc3be8d,0xbeb988,0xb8b383,0xcbc59c,0xa6a084,0x231d0c,0x020000,0x030000,0x080200,0x000000,0x655e4b,0xd6d0b4,0xbfba92,0xc1bb8d,0xc0ba8b,0xc0b989,0xc0b989,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc2ba8b,0xc2ba8a,0xc2ba8a,0xc2ba8a,0xc1b98c,0xc2ba91,0xbeb894,0x878164,0x1e1704,0x080000,0x050000,0x060000,0x070000,0x070000,0x070000,0x060000,0x000000,0x2e2613,0xc3bca2,0xc7c1a2,0xc1ba98,0xc1ba95,0xc0b991,0xc1b98e,0xc2b98c,0xc2b98b,0xc2b98c,0xb1a87c,0x9b936a,0xa29972,0xc1b890,0xc9c098,0xbdb48a,0xc1b88c,0xc1b88d,0xc2b992,0xc1b897,0xc0b798,0xbfb696,0xb2a987,0xb8af89,0xc2b98f,0xc2b98b,0xc2ba8a,0xc1b88b,0xc1b88c,0xc1b88c,0xc1b88d,0xc1b88e,0xc1b790,0xc0b692,0xc5ba9b,0x9b9078,0x0f0400,0x020000,0x040000,0x0a0200,0x080000,0x020000,0x151003,0x090500,0x36331d,0xb7b595,0xbfbd95,0xbcb88d,0xbfba8d,0xbfba8d,0xbfba91,0xc6be9d,0x847b62,0x1d1404,0x0d0500,0x030000,0x090300,0x46432f,0xb7b599,0xcdcca8,0xbdbb96,0xa19d7e,0x2c270f,0x070100,0x000000,0x2d2419,0x655c50,0x352c21,0x050000,0x090100,0x0e0703,0x1f1a11,0x868372,0x9a997e,0xb6b694,0xc0bf99,0xc7c3a3,0x574e41,0x0a0001,0x05000a,0x00081e,0x197598,0x26b5e3,0x0dc1f7,0x00c3fe,0x04c6ff,0x09c9ff,0x0bcaff,0x0ac7ff,0x05c2fd,0x0cc8ff,0x0dc9ff,0x07c3fe,0x03c1fc,0x00c0fa,0x00c1fb,0x00c3fc,0x00c8ff,0x09cfff,0x0acdff,
+0x2ad5ff,0x21d2ff,0x1ad0ff,0x12ccff,0x0ac9ff,0x00c0fa,0x00c1fc,0x00bef9,0x02baf6,0x17afe8,0x005886,0x00061f,0x040004,0x110900,0x938a71,0xc1b898,0xbab28d,0xbeb68c,0xc0b88d,0xc0b88e,0xc5bc96,0xaaa07e,0x988e70,0x93896f,0x6b614b,0x070000,0x060000,0x060000,0x5f5942,0x89846a,0x928e72,0x8b886e,0x9b9881,0x959280,0x777367,0x28221b,0x070000,0x080100,0x080101,0x0e0706,0x2f2726,0x362e2c,0x2d2522,0x5d5552,0x59504c,0x140b05,0x030000,0x181000,0x9f987e,0xc7c19f,0xc1bc93,0xbeb98c,0xc4bf8f,0xc3be8d,0xbfba8a,0xb9b383,0xc8c298,0x9c9678,0x26200b,0x040000,0x060000,0x080100,0x433d28,0xc7c1a6,0xb0aa88,0xc0bb91,0xc1bb8d,0xc2bb8c,0xc0b989,0xc1b889,0xc2b98a,0xc2b98a,0xc2b98a,0xc2b98a,0xc3b98a,0xc3b98a,0xc4b98a,0xc4b989,0xc3b98a,0xc1b88a,0xbeb68a,0xcdc69f,0xcec8a6,0x8d866a,0x443d26,0x211908,0x020000,0x070000,0x080000,0x070000,0x070000,0x000000,0x322b18,0xb5ae92,0xbcb594,0xc1ba96,0xc2ba93,0xc1b98f,0xc2bb8f,0xc0b88c,0xc4bc90,0xc0b890,0x423a16,0x0d0500,0x1d1500,0x726a50,0xb0a88d,0xb0a88a,0xb4ad8e,0xb4ad8f,0xafa88c,0xa9a289,0x8d866e,0x484227,0x534d2e,0xa49d7b,0xbfb893,0xc1bb92,0xc0ba8f,0xc1b98f,0xc3ba8f,0xc2b98e,0xc3b98e,0xc3b98f,0xc3b990,0xc0b68f,0xc0b693,0xc6bb9f,0x483d25,0x090000,0x140b00,0x0e0700,0x050000,0x090300,0x040000,0x0b0700,0x1b1804,0x8b896a,0xc1bf98,0xb7b588,0xbdb98b,0xbeb98c,0xbfba91,0xc2ba99,0x524931,0x0b0300,0x191103,0x0f0700,0x0b0400,0x0b0800,0x615e45,0xa6a481,0xb9b694,0xb4b095,0x433e2c,0x030000,0x020000,0x302921,0x615a51,0x302920,0x000000,0x080100,0x100a01,0x403c2b,0x8f8d75,0x929172,0xafad8a,0xc3c19b,0xcbc6a7,0x7b7161,0x120603,0x030001,0x000218,0x003154,0x1f9fcc,0x0abdf3,0x00c1fc,0x00c1fd,0x00c1fd,0x00c0fa,0x00baf3,0x00b8f1,0x00bcf6,0x00bcf5,0x00bcf6,0x00bdf6,0x02c0fa,0x01c2fb,0x0bcbff,0x12cfff,0x14cfff,0x11cdff,
+0x25cfff,0x22d0ff,0x1dd0ff,0x18ceff,0x0cc8ff,0x00c1fa,0x00c1f9,0x00bff8,0x06bbf3,0x1face2,0x003c67,0x00061c,0x060000,0x160e00,0xaca384,0xc4bc98,0xbbb38b,0xbeb78c,0xbfb88c,0xbfb88d,0xc4bd95,0xa69f7d,0x9a9274,0x827a62,0x2b230f,0x0b0300,0x020000,0x171000,0x837d65,0x938e73,0x918d70,0x8f8c70,0x939077,0x93907b,0x888474,0x322d23,0x020000,0x040000,0x080102,0x0b0404,0x100907,0x3c3632,0x433d37,0x4b433d,0x5a514a,0x292118,0x040000,0x000000,0x756f58,0xc3bf9f,0xc1be96,0xbdb98c,0xbfba8a,0xc1bc8a,0xc0ba88,0xbab382,0xc7bf94,0x7c7553,0x140d00,0x050000,0x090100,0x544d35,0x9a9377,0xc0ba99,0xbeb892,0xc0bb8f,0xc1bb8c,0xc2bb8c,0xc1ba8b,0xc2b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc4b989,0xc4b989,0xc4b989,0xc4b98a,0xc3b98a,0xbfb78a,0xc2bc91,0xbfba92,0xbcb691,0xb3ad8d,0x7a7459,0x201804,0x140c00,0x0c0400,0x070000,0x070000,0x000000,0x4e4734,0xcac3a6,0xbcb692,0xc0b992,0xc2ba91,0xc1b98e,0xc3bc90,0xbcb58a,0xcdc59d,0x8a825f,0x000000,0x020000,0x0d0600,0x050000,0x302916,0x4e4731,0x4d462f,0x5a533e,0x524c38,0x35301e,0x1f1a06,0x040000,0x000000,0x655f40,0xb3ae8b,0xc0bb94,0xbdb78e,0xbbb48a,0xc1b98e,0xc2b98d,0xc3b98d,0xc3b98e,0xc2b88d,0xc0b78c,0xc3b991,0xc6bc99,0x877c5f,0x3f351a,0x1a1200,0x100a00,0x020000,0x0a0400,0x040000,0x0e0900,0x000000,0x595739,0xc8c69f,0xb6b487,0xbeba8c,0xbeb98c,0xc2bc94,0xbcb494,0x2e250c,0x090100,0x060000,0x040000,0x090200,0x050000,0x030000,0x5b5837,0xb4b090,0xafaa95,0x3c362a,0x010000,0x080100,0x3f3934,0x4e4942,0x1c1710,0x030000,0x060000,0x171207,0x6f6c55,0x929071,0x92906c,0xadaa84,0xc1bd97,0xc4bd9e,0xa49985,0x2e221b,0x020000,0x000519,0x002345,0x1a8fbb,0x02b4e8,0x00c0f9,0x00bffa,0x00bff9,0x00bef7,0x00bdf5,0x00bdf5,0x00c5fd,0x00c4fc,0x01c2fa,0x08c5fd,0x0ec9ff,0x0ac6fd,0x04bff6,0x06bdf4,0x12c8ff,0x16cdff,
+0x28d2ff,0x24d1ff,0x20d0ff,0x1acdff,0x0fc9ff,0x01c2f9,0x00c1f7,0x00bff5,0x08bbf0,0x22a6db,0x003760,0x000517,0x070000,0x282006,0xbab28c,0xc4bd93,0xc0ba8d,0xbcb689,0xbdb88a,0xbeb98b,0xc1bc92,0xa7a27f,0x999477,0x69634c,0x181100,0x060000,0x0d0500,0x6b6450,0x969077,0x938e72,0x918d70,0x8f8c6f,0x928f74,0x908e76,0x93907c,0x6a6559,0x090300,0x050000,0x070000,0x090202,0x080100,0x211b16,0x3e372f,0x463e33,0x5b5347,0x4a4135,0x090200,0x000000,0x5f5a45,0xb9b699,0xbfbc97,0xbdb98c,0xc1bc8a,0xc0bb86,0xc1ba85,0xc4bc88,0xbbb383,0x989069,0x6b6441,0x3e3616,0x625a3a,0xd5ceac,0xc5be99,0xc3bd95,0xc0bb90,0xc0bb8d,0xc1bb8b,0xc2bb8c,0xc1ba8b,0xc2b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc3b98a,0xc2ba8b,0xc0ba8c,0xbeb98c,0xbeb98d,0xbeb990,0xccc6a1,0xc1bb9d,0xaea691,0x251e10,0x070000,0x090100,0x000000,0x4b4331,0xccc6a7,0xc3bd97,0xc2bb91,0xc2bb8f,0xc1ba8d,0xc1ba8d,0xc4bd93,0xc4bc97,0x3b3214,0x020000,0x090000,0x120a00,0x0c0500,0x010000,0x000000,0x000000,0x020000,0x000000,0x020000,0x040000,0x0b0800,0x090600,0x686445,0xbbb693,0xbeb891,0xc1bb91,0xc0ba8f,0xc0b88c,0xc2b98b,0xc1b789,0xc1b68a,0xc2b88b,0xc2b88a,0xc1b88b,0xc3b990,0xc8be99,0xbab190,0xa49d7e,0x918b70,0x524d37,0x070100,0x020000,0x050000,0x000000,0x3f3d21,0xb2b08a,0xbfbb90,0xc0bb8d,0xbfba8d,0xc1bb92,0xb5ad8d,0x261d03,0x020000,0x0f0600,0x000000,0x100900,0x0c0700,0x0b0600,0x1b1800,0x9c977a,0x746f5e,0x070000,0x010000,0x120b0d,0x514c48,0x2c2823,0x080400,0x030000,0x020000,0x2f2b1d,0x878468,0x93906b,0x938f66,0xaba67d,0xc2bc95,0xc2ba99,0xbeb29b,0x63584c,0x000000,0x000416,0x001435,0x1e8cb8,0x07baeb,0x00ccff,0x0acdff,0x0ecdff,0x0bceff,0x09ceff,0x07cdff,0x07cbff,0x07c8fe,0x11ceff,0x1ad5ff,0x1cd4ff,0x11c8fe,0x0ec4f9,0x15caff,0x17ccff,0x18ceff,
+0x26cffe,0x21cdfe,0x1ecdff,0x1accff,0x12caff,0x04c5fa,0x00c1f5,0x00bff3,0x0bbcef,0x24a3d6,0x003259,0x000515,0x080000,0x2e2609,0xc2ba91,0xbdb689,0xb9b384,0xbbb587,0xbdb889,0xbeb98a,0xc0bb90,0xa9a582,0x908c6f,0x58533d,0x140e00,0x040000,0x1d1607,0x847d67,0x969076,0x979276,0x8e8b6d,0x8f8c6f,0x908e72,0x8f8d73,0x94917b,0x8a8576,0x211b13,0x030000,0x050000,0x070000,0x090200,0x120c05,0x241e13,0x494235,0x595142,0x534b3c,0x110a00,0x000000,0x25210d,0x9b997d,0xc1bf9b,0xc0bd91,0xc2bd8b,0xc2bc86,0xc1ba84,0xc5bc87,0xc8bf8e,0xd1c89d,0xbfb78e,0xb0a780,0xaba37c,0xc2ba92,0xbdb68c,0xbeb78c,0xbeb98b,0xbfba8b,0xc1bb8b,0xc2bb8c,0xc1ba8b,0xc2b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc3b98a,0xc2ba8a,0xbfb98a,0xbeb98a,0xbeb98a,0xbeb98b,0xc0bb91,0xbeb894,0xc3bca0,0x2b2411,0x070000,0x090000,0x050000,0x837b66,0xd3cdab,0xc2bc93,0xc2bb8f,0xc2bb8e,0xc1ba8c,0xc1b98d,0xc1b98f,0xc8c09a,0x655c3d,0x1e1500,0x150b00,0x0b0200,0x0e0700,0x000000,0x000000,0x080000,0x040000,0x000000,0x000000,0x070300,0x3a3620,0x69654a,0xb3af8e,0xbfba94,0xbeb890,0xc0ba8f,0xc0b88c,0xc1b88b,0xc1b889,0xc2b889,0xc3b889,0xc4b98a,0xc2b889,0xc1b889,0xc0b78a,0xc1b88e,0xbeb58f,0xbcb491,0xc1bb9b,0x7d775e,0x050000,0x070100,0x0b0500,0x000000,0x524f34,0xbcb994,0xbeba8f,0xc2bc8e,0xc0ba8d,0xc4bd94,0xc4bb99,0x362c0f,0x0c0200,0x0c0300,0x020000,0x060000,0x0d0700,0x110c00,0x110d00,0x888366,0x686354,0x000000,0x050001,0x1f181b,0x514c49,0x181410,0x060300,0x010000,0x040100,0x4d4a39,0x8c896a,0x938f67,0x928e63,0xa6a075,0xc3bb95,0xbfb695,0xc2b69c,0x7f7466,0x000000,0x000213,0x001030,0x2287b1,0x1dc7f6,0x10d6ff,0x1ed8ff,0x22d8ff,0x1ed8ff,0x18d5ff,0x12d1ff,0x0bc9fd,0x06c1f5,0x0fc9fd,0x1bd3ff,0x1dd3ff,0x22d6ff,0x24d7ff,0x22d6ff,0x1ed2ff,0x1acfff,
+0x25cefd,0x20ccfc,0x1ecdff,0x1bccff,0x15ccff,0x09c9fd,0x01c7fa,0x00c0f4,0x0cbbee,0x219fd1,0x002e53,0x000413,0x090000,0x31290d,0xc0b88f,0xbcb588,0xbbb486,0xbbb587,0xbcb788,0xbdb889,0xbdb98e,0xb2ae8b,0x918d71,0x58533d,0x070100,0x060000,0x160f00,0x847d67,0x918b70,0x8d886b,0x8f8c6e,0x8d8b6d,0x8f8d71,0x8e8c71,0x918e77,0x9c9887,0x686257,0x0f0802,0x070000,0x080100,0x090300,0x050000,0x080000,0x393124,0x564f40,0x595141,0x201909,0x020000,0x110c00,0x6e6b51,0xc6c3a1,0xbbb78d,0xc2bd8d,0xc0ba86,0xc1ba85,0xc3bb86,0xc0b785,0xc2b98b,0xc6bd91,0xc3ba90,0xc5bb91,0xc9c096,0xc4bb91,0xbdb68a,0xbeb78b,0xbeb98a,0xbfba8b,0xc0ba8b,0xc1ba8b,0xc2b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc4b989,0xc4b989,0xc4b989,0xc4b98a,0xc3b98a,0xc2b98b,0xc1ba8b,0xc0ba8b,0xbfba8a,0xbfba8b,0xbeb98d,0xbfb993,0xc3bc9d,0x3a321b,0x080000,0x090000,0x0b0300,0x9f987c,0xccc6a0,0xc2bc91,0xc2bb8e,0xc2bb8d,0xc2b98c,0xc2b98c,0xc2b98e,0xcac199,0xa9a07c,0x7c7453,0x847c5e,0x867e62,0x81795f,0x6f674d,0x766e53,0x675e45,0x494028,0x4a422b,0x787159,0x9c977d,0xc3bea1,0xcec8a8,0xbbb58f,0xbeb78f,0xbfb88e,0xc0b88c,0xbfb78a,0xc0b789,0xc1b788,0xc3b888,0xc3b889,0xc3b889,0xc3b989,0xc3b98a,0xc1b88b,0xc3b98e,0xc2b990,0xc2b993,0xc2ba97,0xb5ae91,0x201805,0x060000,0x090300,0x000000,0x686448,0xcac7a2,0xc0bb90,0xc4bf91,0xc0b88c,0xc2b98f,0xcec39d,0x867a57,0x392f0d,0x150c00,0x1e1500,0x1c1400,0x130c00,0x1d1700,0x524d2a,0x999476,0x383223,0x0c0601,0x010000,0x1b1517,0x35302e,0x0a0603,0x030100,0x020000,0x010000,0x787563,0x918d6e,0x8e8a63,0x8e895e,0x989268,0xbdb68f,0xc2b897,0xc2b69b,0x827767,0x000000,0x000211,0x000e2b,0x076187,0x3bd4ff,0x25d9ff,0x2ed7ff,0x31d8ff,0x28d4ff,0x1bccff,0x17cbff,0x17cdff,0x11c7fa,0x0fc5f7,0x13c8fb,0x17ccfe,0x20d3ff,0x21d3ff,0x1bcdff,0x19ccff,0x1acfff,
+0x28cffd,0x25cffe,0x22cfff,0x1fceff,0x18cdff,0x0eccff,0x09cdff,0x00c6f9,0x0fbced,0x249cc9,0x002c4c,0x000816,0x0d0400,0x575033,0xcac39a,0xbbb487,0xbeb889,0xbbb586,0xbcb787,0xbcb787,0xbbb78a,0xb7b38f,0xa19d81,0x4c4831,0x030000,0x060000,0x231c0b,0x8b856e,0x908a6e,0x8e896b,0x8e8b6b,0x8e8b6c,0x8f8c6e,0x8f8c6f,0x908d73,0x928d79,0x8e8879,0x514b40,0x050000,0x050000,0x090300,0x0b0400,0x060000,0x1e160a,0x554d40,0x61594b,0x3b3426,0x080200,0x070200,0x46432d,0xcecbad,0xbcb792,0xc1bb90,0xc1ba89,0xc2ba86,0xc3ba86,0xc3b987,0xc4ba8b,0xc4ba8d,0xc1b88c,0xc3b98e,0xc6bc91,0xc3ba8f,0xbfb78c,0xbeb78c,0xbfba8d,0xbfba8c,0xc0ba8c,0xc1ba8b,0xc2b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc3b98b,0xc2b98c,0xc2b98c,0xc1ba8b,0xc0ba8a,0xc0ba8b,0xbeb98c,0xbcb68d,0xc6c09c,0x433c1e,0x020000,0x030000,0x241c02,0xb8b190,0xc7c197,0xc2bc8e,0xc2bb8c,0xc2bb8c,0xc2b98b,0xc1b88b,0xc3b98d,0xc5bb91,0xbeb58d,0xb9b18b,0xbcb390,0xc1b897,0xbdb493,0xc2b999,0xc0b797,0xbcb293,0xb7ae8f,0xb8af91,0xbfb799,0xbeb898,0xc2bb9a,0xbfb893,0xbcb58c,0xbfb78c,0xbfb78b,0xbfb78a,0xc0b789,0xc2b88a,0xc3b889,0xc3b888,0xc3b888,0xc4b989,0xc3b989,0xc3b98a,0xc3b98c,0xc4ba8f,0xc3b98f,0xc3b991,0xc2b993,0xbfb696,0x393118,0x050000,0x080100,0x000000,0x787355,0xcac5a0,0xbfba8f,0xc4bd90,0xc1b88c,0xc2b88d,0xc1b68d,0xbbb088,0x867c55,0x6d643d,0x776e48,0x87805b,0x88815d,0x9b9571,0xa8a27e,0xa6a083,0x140e00,0x060000,0x080101,0x3f393a,0x2c2725,0x040100,0x020000,0x050200,0x272418,0x888470,0x8f8b6a,0x8e8a62,0x8d885d,0x969065,0xbbb38c,0xc4bb98,0xbfb497,0x7b715f,0x000000,0x00010e,0x000d27,0x00496c,0x44d4fa,0x29d3ff,0x31d3ff,0x32d3ff,0x2acfff,0x20c9fd,0x20ccff,0x28d6ff,0x25d5ff,0x1fd0ff,0x19cbfc,0x1fd1ff,0x20d1ff,0x1acbfb,0x19cafb,0x19cbfd,0x17ccfd,
+0x2cd1fd,0x2ad1fe,0x27d1ff,0x23d0ff,0x1ccfff,0x14d0ff,0x0fd1ff,0x0aceff,0x1dc5f1,0x2896ba,0x00273f,0x00030e,0x0c0300,0x554e33,0xd0caa2,0xbcb589,0xbfb98a,0xbcb787,0xbcb786,0xbcb784,0xbbb788,0xbab691,0xa09c7f,0x26210c,0x000000,0x060000,0x413b2a,0x908b73,0x8e896c,0x8e8a69,0x8d8a68,0x8e8b6a,0x8e8b6b,0x8f8c6c,0x908c6f,0x918c74,0x908b77,0x8b8675,0x534e3e,0x0f0900,0x060000,0x0b0400,0x070000,0x0c0400,0x332b21,0x5a5248,0x50483e,0x1d170c,0x040000,0x000000,0x89856f,0xc2bc9f,0xc1ba96,0xc1b98e,0xc3b989,0xc4b989,0xc4b989,0xc4ba8c,0xc4ba8d,0xc3b98d,0xc3b98e,0xc5bb91,0xc3ba91,0xc0b88f,0xbfb88f,0xbfba8e,0xc1bb8e,0xc0ba8d,0xc1b98c,0xc2b98b,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc4ba8e,0xc4ba8e,0xc2b98d,0xc2b98c,0xc2b98b,0xc1ba8b,0xc0b98a,0xc2bb8d,0xcac399,0x5d552f,0x292000,0x312607,0x756b4a,0xbcb38e,0xc5be92,0xc2bb8b,0xc2bb8b,0xc2bb8b,0xc2b98b,0xc1b88a,0xc3b98c,0xc4ba8e,0xc5bb91,0xc5bb92,0xc3ba93,0xc0b691,0xc6bc97,0xc5bb97,0xc1b794,0xc0b693,0xbeb491,0xc5bc99,0xbfb694,0xb9b28e,0xc0b994,0xc2ba93,0xc2bb90,0xc1b98e,0xc1b88b,0xc1b88b,0xc2b88a,0xc3b88a,0xc2b889,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc4b98a,0xc5ba8e,0xc6bb90,0xc4b88f,0xc4b890,0xc4b891,0xcbc09c,0x8a8162,0x2f270b,0x181000,0x514a2d,0xb3ad8c,0xc7c29b,0xc0b990,0xc4bd92,0xc1b88d,0xc2b88c,0xc1b78b,0xc3b98d,0xc4bc90,0xc6be92,0xc2bb8f,0xc9c296,0xcfc79c,0xc4bd94,0xc1ba96,0x827c61,0x000000,0x090100,0x1c1515,0x585152,0x2a2524,0x000000,0x030100,0x0f0d04,0x767465,0x99967e,0x8e8a68,0x8f8a61,0x8e885b,0x958f62,0xb9b187,0xc7bf99,0xc4bb9a,0x9d957f,0x0f0a04,0x00010a,0x000c21,0x00405e,0x43cdf1,0x22cbf5,0x2cd2ff,0x2bd0ff,0x2dd2ff,0x2ed3ff,0x2fd4ff,0x2cd3ff,0x29d1ff,0x29d4ff,0x28d6ff,0x2eddff,0x29d8ff,0x21d1fe,0x1fcefd,0x1ccdfe,0x19cdff,
+0x35d6ff,0x33d6ff,0x2fd6ff,0x29d3ff,0x20d1ff,0x15cffe,0x11d1ff,0x0ed0ff,0x34d8ff,0x3097b5,0x001629,0x07121b,0x0c0300,0x645e43,0xcbc59d,0xbdb68a,0xbeb888,0xbcb786,0xbcb784,0xbcb782,0xbbb786,0xb9b58f,0x878265,0x040000,0x020000,0x030000,0x524d3a,0x908b72,0x8e8a6a,0x8e8a67,0x8f8b67,0x8f8b68,0x8f8b68,0x908c6a,0x908c6b,0x908c6f,0x918d73,0x918c75,0x928d78,0x58533f,0x1c1604,0x090200,0x090100,0x090100,0x0c0300,0x352c25,0x5c544d,0x362f26,0x000000,0x030000,0x353121,0xa6a089,0xc6bea0,0xc2b991,0xc3b98c,0xc4b98b,0xc4b98b,0xc3b98c,0xc4ba8d,0xc3b98d,0xc3b98e,0xc4ba90,0xc3b98f,0xbfb78e,0xbeb78d,0xbeb98c,0xc1bb8e,0xc2bb8e,0xc2bb8d,0xc2b98b,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98c,0xc4ba8e,0xc3b98d,0xc3b98d,0xc3b98c,0xc3b98b,0xc2b98a,0xc0b988,0xc1ba8a,0xc5bd8f,0xb8b084,0xa49b72,0xafa57e,0xc3b892,0xc1b88f,0xc4bc8e,0xc2bb8a,0xc2bb8a,0xc2bb8a,0xc2b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98c,0xc3b98d,0xc3b98f,0xbfb58c,0xc1b88e,0xc4ba91,0xc1b790,0xbfb58e,0xbcb28b,0xc1b791,0xc2b992,0xc0b890,0xc0b88f,0xc1b98f,0xc1b98e,0xc0b88b,0xc2b98c,0xc3b98b,0xc3b88a,0xc3b88a,0xc2b889,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc3b889,0xc3b78a,0xc6ba8e,0xc4b88e,0xc5b88f,0xc5b88f,0xc2b68e,0xc2b894,0x857c5a,0x766d4c,0xc9c19f,0xc0b994,0xc4bd96,0xc1b991,0xc4bb92,0xc2b98e,0xc1b88c,0xc1b88b,0xc2b98b,0xc2b98b,0xc1ba8b,0xc1ba8b,0xc1ba8b,0xc3bc8d,0xc6bf94,0xb6b08c,0x565036,0x000000,0x020000,0x1c1513,0x3f3938,0x110c0b,0x030000,0x010000,0x26241a,0x858371,0x918e73,0x918c68,0x928c62,0x918a5d,0x979062,0xb9b186,0xc4bd94,0xb6af8a,0xa19a80,0x161107,0x000106,0x000c1d,0x00435e,0x40c8eb,0x20c8f3,0x25cfff,0x25cfff,0x28d0ff,0x2dd3ff,0x30d4ff,0x2cd0ff,0x28cfff,0x29d1ff,0x2ed9ff,0x31deff,0x29d6ff,0x24d1fe,0x22d0fe,0x21cffe,0x1cccfd,
+0x3ddaff,0x3cdbff,0x38dbff,0x32d9ff,0x28d6ff,0x1ad1fe,0x13d0fd,0x0fcefc,0x27c8ef,0x40a2bc,0x001524,0x00050d,0x140b05,0x7a7459,0xc6c099,0xbdb68a,0xbdb687,0xbcb785,0xbcb783,0xbcb781,0xbbb785,0xb8b48d,0x7a7659,0x020000,0x020000,0x1e1809,0x726d59,0x928e73,0x8f8b6b,0x8f8b67,0x8f8b66,0x8f8b66,0x8f8b66,0x908c68,0x908c68,0x908c6a,0x908c6c,0x908c6e,0x908b70,0x948f76,0x554e39,0x080100,0x090100,0x090100,0x090100,0x100802,0x362e29,0x504943,0x050000,0x040000,0x0b0700,0x726c5a,0xc8c0a6,0xc2b994,0xc3b98e,0xc4b98d,0xc4b98d,0xc4b98d,0xc5ba8e,0xc4b98d,0xc4b98e,0xc4b98e,0xc2b88d,0xbfb78c,0xbeb78b,0xbeb98a,0xbfba8a,0xc0ba8a,0xc1ba8a,0xc2b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98c,0xc3b98c,0xc1b88a,0xc1b88a,0xc3b98a,0xc1b889,0xc3b989,0xc1b887,0xc2ba88,0xc2ba88,0xc5bc8c,0xb3aa7d,0xbfb58a,0xc4ba90,0xc3ba8f,0xc2bb8c,0xc2bb8a,0xc2bb89,0xc2bb89,0xc2ba89,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b98a,0xc1b889,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88b,0xc1b88b,0xc0b78b,0xc1b88c,0xc2b98e,0xc1b88c,0xc1b88c,0xc1b88c,0xc1b88b,0xc1b88b,0xc3b98c,0xc2b88a,0xc3b88a,0xc3b88a,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc2b688,0xc2b689,0xc3b78c,0xc5b88e,0xc5b88d,0xc3b68b,0xc4ba90,0xc5bb93,0xc3ba94,0xc2b993,0xbeb58f,0xc2b992,0xc2b991,0xc3ba91,0xc3b98e,0xc3b98d,0xc3b98c,0xc4ba8d,0xc2b98b,0xc2b98b,0xc2bb8b,0xc1ba8a,0xc2bb8b,0xcdc69b,0x968f6d,0x2a230c,0x050000,0x070000,0x2d2521,0x221b18,0x020000,0x030000,0x000000,0x474538,0x7d7b65,0x8c896a,0x938f69,0x948d63,0x938b5e,0x978e61,0xb9b185,0xc8c297,0xc0bb93,0xa19c7e,0x181205,0x000203,0x000d1b,0x00425c,0x3ac2e5,0x1bc5f1,0x1ecdff,0x20cfff,0x26d2ff,0x2dd7ff,0x2dd5ff,0x2ad1ff,0x28d0ff,0x2cd5ff,0x2ed9ff,0x2dd9ff,0x28d5ff,0x26d2ff,0x2bd7ff,0x2dd8ff,0x2ad4ff,
+0x3ad8ff,0x3cdbff,0x38dbff,0x33dbff,0x2ad9ff,0x1dd3ff,0x14d0fc,0x0dccf9,0x27c7ed,0x3092aa,0x001725,0x000810,0x0c0300,0x5c553b,0xcac49c,0xbdb68a,0xbdb687,0xbcb785,0xbcb783,0xbcb780,0xbbb785,0xb4b189,0x676347,0x000000,0x020000,0x2e2919,0x847f6a,0x918d71,0x8f8b6a,0x8f8b67,0x8f8b65,0x8f8b65,0x8f8b65,0x908d67,0x908c67,0x908c68,0x908c69,0x8f8b6a,0x8e896b,0x969074,0x888169,0x241d0a,0x100900,0x090100,0x090100,0x090100,0x0e0600,0x453e38,0x37312b,0x020000,0x080300,0x272011,0x9c947c,0xbfb694,0xc3b990,0xc4b98f,0xc4b88e,0xc4b88e,0xc4b88e,0xc4b88e,0xc6ba8f,0xc2b68c,0xc0b58b,0xc0b78c,0xbfb78b,0xbfb98a,0xc0ba8a,0xc0ba8a,0xc1ba8a,0xc2b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc3ba87,0xc0b786,0xbdb384,0xbfb688,0xc3b98c,0xc2b98c,0xc2ba8a,0xc1ba88,0xc2bb89,0xc3bb89,0xc2ba89,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc2b88a,0xc2b88a,0xc2b88a,0xc3b88a,0xc3b889,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc3b889,0xc3b889,0xc3b889,0xc3b889,0xc4b98c,0xc5b88d,0xc5b88c,0xc4b78b,0xc4b98d,0xc1b68c,0xc0b68e,0xc1b790,0xc1b790,0xc3b991,0xc3b991,0xc3b990,0xc3b98e,0xc3b98d,0xc3b98c,0xc3b98c,0xc3b98c,0xc2b98c,0xc1ba8b,0xc1ba8a,0xc0b98a,0xc6bf95,0x6e6747,0x0e0700,0x070000,0x19110c,0x312923,0x0d0600,0x080300,0x000000,0x030100,0x1a180a,0x2a2810,0x696646,0x908b64,0x958f63,0x948c5f,0x9c9365,0xbcb487,0xc4bd92,0xc0bb92,0xccc7a7,0x484232,0x000201,0x000d1a,0x002e47,0x33bbdf,0x1bc8f5,0x1accff,0x1ccfff,0x20d1ff,0x26d4ff,0x24d0ff,0x26d1ff,0x26d1ff,0x27d3ff,0x26d4ff,0x21cffd,0x1dccf9,0x1fcdfa,0x26d2ff,0x2bd7ff,0x2dd9ff,
+0x32d6fe,0x32d7ff,0x2fd6ff,0x2ad4ff,0x25d5ff,0x1cd4ff,0x12cffc,0x0bc9f8,0x25c6ed,0x21869e,0x000f1e,0x00050e,0x0d0400,0x5d573c,0xcbc59d,0xbdb68a,0xbdb687,0xbcb785,0xbcb783,0xbcb780,0xbbb785,0xb4b189,0x696549,0x000000,0x040000,0x423d2c,0x8a856f,0x8f8b6d,0x8f8b69,0x8e8a65,0x8f8b65,0x8f8b65,0x8f8b66,0x908c68,0x908c68,0x918c68,0x918c69,0x918c6b,0x908a6b,0x948e70,0x938c71,0x59523c,0x150e00,0x0c0400,0x0b0200,0x0b0200,0x0b0400,0x282119,0x3d3730,0x100b05,0x010000,0x030000,0x69604b,0xb7ae8e,0xc4ba94,0xc3b990,0xc2b78e,0xc4b88e,0xc4b88e,0xc3b78e,0xc7bb91,0xcbbf96,0xc5ba91,0xc2b78f,0xc1b88e,0xc0b88c,0xc0ba8c,0xc1ba8c,0xc1ba8c,0xc2b98b,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc1b887,0xc1b888,0xc1b889,0xc3b98a,0xc3b98a,0xc2ba88,0xc2ba88,0xc2ba87,0xc2ba88,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc1b889,0xc1b889,0xc1b889,0xc1b889,0xc1b88a,0xc2b88a,0xc2b88a,0xc3b88a,0xc3b889,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc3b889,0xc3b889,0xc3b88a,0xc4b98b,0xc4b98b,0xc3b78a,0xc5b98c,0xc5b98c,0xc3b78b,0xc3b78c,0xc2b78d,0xc2b88d,0xc1b88e,0xc1b88f,0xc2b78f,0xc2b78e,0xc2b78d,0xc3b98e,0xc3b98d,0xc3b98d,0xc3b98d,0xc3b98e,0xc2b98e,0xc1b98d,0xc1ba8d,0xc1b98e,0xb6af88,0x3a3315,0x040000,0x080200,0x251e18,0x241d15,0x020000,0x0c0802,0x080400,0x1b1910,0x070500,0x0a0800,0x3e3b1d,0x8b8660,0x958f63,0x968d60,0xa9a072,0xc2bb8e,0xc4bd92,0xc3bd94,0xd0caab,0x524b3c,0x000201,0x000d1a,0x002f49,0x2fb8dc,0x14c1ef,0x1accff,0x1acfff,0x1bceff,0x19cbfd,0x1eceff,0x22d1ff,0x22d1ff,0x20d1ff,0x1ccffe,0x16c9f7,0x15c8f5,0x19cbf9,0x1acbfa,0x1dd0ff,0x1fd5ff,
+0x22d0fc,0x24d2fd,0x23d2fe,0x21d1ff,0x20d2ff,0x1ad3ff,0x13cffd,0x0bc9fa,0x1ec0ea,0x16809b,0x000b1c,0x00040e,0x100602,0x5e563c,0xcdc69f,0xbcb589,0xbeb888,0xbcb785,0xbcb783,0xbcb780,0xbbb785,0xaba780,0x2c270c,0x010000,0x090300,0x676250,0x918c75,0x8c886a,0x8e8a67,0x8e8a65,0x8f8b65,0x8f8b66,0x8f8b67,0x908c69,0x908c69,0x918c69,0x918c6a,0x918c6b,0x918c6c,0x918c6c,0x958f72,0x8b856c,0x4b4530,0x110a00,0x0f0800,0x0e0600,0x090200,0x070000,0x272119,0x241f18,0x040000,0x000000,0x271f0c,0x92896e,0xc4bb99,0xc1b892,0xc0b68e,0xc4ba90,0xc3b78e,0xc4b890,0x9c8f68,0x7c704a,0xa39773,0xc3b894,0xc5bb96,0xbbb28b,0xbab289,0xbdb48b,0xc3ba90,0xc2b98d,0xc3b98b,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b887,0xc1b886,0xc1b887,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc1b887,0xc1b887,0xc3ba88,0xc3ba88,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc0b787,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc1b889,0xc2b88a,0xc2b88a,0xc3b889,0xc4b98a,0xc4b989,0xc4b989,0xc3b888,0xc3b888,0xc4b98a,0xc4b98b,0xc3b88a,0xc4b98b,0xc4b98b,0xc5ba8d,0xc4b98b,0xc4b98b,0xc2b68a,0xc3b78c,0xc3b78c,0xc3b98e,0xc2b88d,0xc1b68c,0xc2b78e,0xc3b78d,0xc3b78c,0xc2b88c,0xc2b88c,0xc2b88c,0xc3b98e,0xc2b98f,0xc2b98f,0xc1b98f,0xc0b991,0xc2ba94,0x888160,0x070000,0x030000,0x130d04,0x2f2921,0x282317,0x040000,0x010000,0x17140a,0x545247,0x050300,0x030100,0x201d03,0x807c57,0x948d63,0x988f63,0xb8af81,0xc5bd90,0xc6be93,0xc4bd94,0xd1caab,0x534b3c,0x000000,0x000c19,0x00162f,0x29b3d8,0x28d8ff,0x19ceff,0x18cfff,0x12c8fc,0x0cc1f4,0x17cbff,0x18cbff,0x16cafe,0x1acfff,0x1bd2ff,0x14ccfd,0x18cffe,0x1ad1ff,0x14cbfc,0x14ceff,0x18d6ff,
+0x0fcbff,0x14cfff,0x17d0ff,0x1ad1ff,0x1bd2ff,0x18d2ff,0x14d0ff,0x0fccff,0x25caf9,0x289bbb,0x001328,0x00020e,0x150b07,0x5b5339,0xcfc7a0,0xbbb488,0xbeb888,0xbcb785,0xbcb783,0xbcb780,0xbbb785,0xaaa67f,0x272306,0x020000,0x000000,0x4f4a36,0x8e8970,0x8c8869,0x8e8a66,0x8e8a64,0x8f8b65,0x8f8b67,0x8f8b69,0x908c6a,0x908c6b,0x908c6b,0x908c6c,0x908c6c,0x908c6c,0x908c6d,0x918d6f,0x918d71,0x8d886e,0x69644c,0x5f5943,0x413a26,0x120b00,0x050000,0x050000,0x130d07,0x070200,0x090300,0x090200,0x4d4630,0xc3bca0,0xc7c09d,0xbcb48e,0xc4bb94,0xc0b68f,0xbdb18a,0x675b36,0x180b00,0x271a00,0xaca083,0xc7bd9e,0x685d3d,0x655b39,0x8d835f,0xcdc39d,0xc1b88e,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc1b887,0xc1b887,0xc1b887,0xc1b886,0xc1b886,0xc3ba88,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc0b787,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b889,0xc2b889,0xc2b889,0xc2b889,0xc3b888,0xc3b888,0xc3b887,0xc3b887,0xc3b888,0xc4b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc5ba8d,0xc4b98b,0xc4b98b,0xc3b78b,0xc3b78c,0xc3b78c,0xc4b98e,0xc3b78c,0xc3b78d,0xc3b78d,0xc2b88c,0xc2b88c,0xc3b88b,0xc2b88b,0xc2b88b,0xc1b88b,0xc0b88c,0xc1b98f,0xc0b992,0xbeb895,0xbdb699,0x57503a,0x030000,0x040000,0x1c170e,0x2a261c,0x151201,0x000000,0x000000,0x333222,0x656456,0x000000,0x030000,0x0d0900,0x706b49,0x938c62,0x9d9468,0xbfb688,0xc6bd90,0xc9c096,0xc1b88f,0xcdc4a5,0x504637,0x000000,0x000a17,0x000720,0x0a97bb,0x2bdeff,0x17d0ff,0x14cfff,0x14ceff,0x12cbfe,0x14ccff,0x16cfff,0x10c9fd,0x14ceff,0x14cfff,0x12ceff,0x19d4ff,0x1bd6ff,0x0fccff,0x07c7fd,0x0acdff,
+0x00c1fb,0x07ccff,0x0cceff,0x0fceff,0x10cdff,0x10ceff,0x0ecdff,0x0bcaff,0x27d0ff,0x2da8cb,0x002238,0x000008,0x0b0200,0x3a3218,0xc2bc94,0xbdb68a,0xbcb586,0xbbb684,0xbcb783,0xbcb780,0xbbb785,0xafab84,0x413d20,0x000000,0x000000,0x4b4632,0x8c886e,0x8e8a69,0x8e8a65,0x8e8a63,0x8f8b65,0x8f8b68,0x908c6b,0x908c6b,0x918d6d,0x908c6c,0x908c6d,0x908c6d,0x908c6d,0x908c6d,0x908c6d,0x908c6e,0x908c6f,0x959074,0x9a957a,0x969078,0x5a5441,0x000000,0x050000,0x090300,0x0a0400,0x090300,0x060000,0x000000,0x6e6852,0xbcb699,0xb9b390,0xc4bc98,0xc3ba94,0xada27c,0x362a07,0x0b0000,0x120500,0xab9f85,0xbcb194,0x150a00,0x040000,0x2f2402,0xb6ac87,0xc1b88e,0xc1b88c,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc2b888,0xc2b888,0xc2b888,0xc3b888,0xc3b888,0xc3b887,0xc3b887,0xc3b888,0xc4b98a,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc4b98b,0xc4b98b,0xc4b98b,0xc4b98b,0xc4b98c,0xc4b98c,0xc4b98c,0xc4b98c,0xc4b98c,0xc3b78b,0xc2b88b,0xc2b88b,0xc3b88a,0xc3b88a,0xc2b88a,0xc1b88a,0xc1b88c,0xbfb88f,0xbfb994,0xc0ba9b,0x968f78,0x201909,0x000000,0x070200,0x0e0a02,0x0e0b00,0x000000,0x050400,0x42412b,0x898875,0x6c6b5b,0x050300,0x030000,0x0a0600,0x615c3c,0x989269,0xb5ac80,0xc1b88b,0xc5bb8f,0xc6bc92,0xc0b68e,0xb6ab8c,0x3f3426,0x000000,0x000916,0x003650,0x12a3c9,0x0cc4f4,0x11ceff,0x0fcfff,0x10cfff,0x0fcdff,0x0eccff,0x10cfff,0x0ac9ff,0x0bcaff,0x07c8ff,0x04c6ff,0x08c8ff,0x08c9ff,0x02c5ff,0x00c2fd,0x00c2fd,
+0x00bdfd,0x00c4ff,0x00c6ff,0x00c6fd,0x01c5fc,0x01c5fc,0x00c4fc,0x00c4ff,0x10c0f5,0x30b5d8,0x003b50,0x000003,0x010000,0x29250a,0xbbb68e,0xbeb78b,0xb8b282,0xbbb684,0xbcb783,0xbcb780,0xbbb785,0xb2ae87,0x565135,0x000000,0x000000,0x433e29,0x8a866b,0x8e8a68,0x8e8a64,0x8e8a63,0x8f8b65,0x8f8b68,0x918d6c,0x918d6d,0x918d6e,0x928e6f,0x908c6d,0x908c6d,0x8f8b6c,0x8f8b6c,0x908c6d,0x908c6d,0x908c6d,0x908c6e,0x918d70,0x8d886f,0x857f6b,0x403a2c,0x000000,0x090300,0x090200,0x0a0400,0x000000,0x050000,0x1c1608,0x413c25,0xaea88b,0xc1ba99,0xc2b895,0xbdb18c,0x605431,0x000000,0x130600,0xa89c82,0xc0b598,0x4b401f,0x150b00,0x201500,0xaea37e,0xc1b88e,0xc1b88c,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc1b888,0xc1b888,0xc2b888,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc4b989,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc4b98a,0xc3b889,0xc3b889,0xc3b889,0xc3b889,0xc3b889,0xc3b889,0xc2b88a,0xc1b88b,0xbfb78e,0xc1bc97,0xc2bea0,0x716b57,0x0f0900,0x010000,0x070300,0x070500,0x050300,0x000000,0x39381f,0x7b7b62,0x888771,0x666554,0x020100,0x030000,0x0a0600,0x5b5636,0xa39c73,0xc2b98d,0xc3b98c,0xc4ba8e,0xc3b98f,0xc3b991,0xa99e7f,0x302415,0x000000,0x000817,0x003652,0x10a6d1,0x08c7fb,0x08ccff,0x05cbff,0x03c9ff,0x00c5ff,0x00c4ff,0x00c7ff,0x00c2ff,0x00c3ff,0x00c2ff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00befd,
+0x00bdff,0x00bdfe,0x00bdfc,0x00c1fd,0x00c0fc,0x00c0fc,0x00c0fe,0x00bfff,0x04bbf3,0x30bde2,0x004258,0x00000c,0x000000,0x0f0d00,0x9e9a74,0xc0ba8f,0xb9b385,0xbbb684,0xbcb783,0xbcb781,0xbbb784,0xbab68f,0x979375,0x080300,0x010000,0x130f00,0x666246,0x908c6a,0x8f8b65,0x8f8b64,0x8f8b66,0x8f8b6a,0x908c6d,0x928e71,0x969175,0x938f72,0x928e71,0x918d70,0x918d6f,0x908c6e,0x908c6d,0x908c6d,0x908c6d,0x908c6c,0x918d6f,0x8e896e,0x8b8670,0x827d6d,0x322c20,0x050000,0x040000,0x070000,0x080100,0x070000,0x050000,0x020000,0x443e27,0xc1b99d,0xc1b796,0xc8bd98,0xb6aa87,0x8d7f64,0x85785f,0xab9f82,0xc0b695,0xc0b691,0xada27c,0xa69b75,0xbdb38b,0xc1b88d,0xc1b88b,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc1b888,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b988,0xc4b988,0xc4b988,0xc4b989,0xc4b989,0xc4b98a,0xc4b98a,0xc3b889,0xc3b888,0xc3b888,0xc3b888,0xc3b887,0xc3b887,0xc3b888,0xc2b88b,0xbfb78e,0xbcb795,0xa49f85,0x161000,0x010000,0x000000,0x070300,0x010000,0x030200,0x45452c,0x7d7d61,0x8c8d71,0x86866e,0x605f4e,0x000000,0x030000,0x0b0700,0x716c4d,0xb0a980,0xbdb588,0xc0b78a,0xc1b88c,0xc1b88e,0xc6bc95,0xa19678,0x150900,0x000001,0x000719,0x003455,0x14afdf,0x02c5ff,0x00c7ff,0x00c6ff,0x00c1ff,0x00b9fa,0x00b9fc,0x00bcff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bcff,0x00beff,0x00bfff,
+0x00bdff,0x00bdff,0x00bdff,0x00bfff,0x00bfff,0x00bfff,0x00bfff,0x00c0ff,0x01bdfa,0x27bee6,0x005a73,0x000917,0x000302,0x060800,0x93906e,0xc4be97,0xbfb88d,0xbdb888,0xbcb784,0xbcb781,0xbbb784,0xbbb88e,0xa7a383,0x171200,0x070200,0x0e0900,0x514d32,0x95916f,0x8e8a64,0x8f8b66,0x8f8b69,0x8f8b6e,0x908b72,0x9a967d,0x8e8971,0x514c34,0x746f57,0x9e9980,0x918d72,0x908c6f,0x908c6e,0x908c6d,0x908c6c,0x908c6c,0x908c6c,0x8e896c,0x8f8a71,0x8e8975,0x837e6d,0x454031,0x000000,0x010000,0x070000,0x070000,0x070000,0x070100,0x181101,0x9c947c,0xc9bfa1,0xc6ba96,0xc0b38e,0xc1b495,0xc0b496,0xc2b794,0xc3b991,0xc4ba90,0xbdb388,0xccc297,0xc4ba8e,0xc1b88b,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b886,0xc1b887,0xc1b888,0xc3b989,0xc3b989,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b988,0xc4b987,0xc4b986,0xc4b986,0xc4b986,0xc4b987,0xc4b98a,0xc4b98b,0xc4b98b,0xc3b889,0xc4b98a,0xc4b989,0xc3b887,0xc3b886,0xc3b885,0xc3b887,0xc2b88a,0xbeb58e,0xc7c1a2,0x66614b,0x000000,0x000000,0x000000,0x000000,0x080700,0x383823,0x838367,0x8c8d6e,0x8b8c6c,0x85866a,0x61604f,0x010000,0x030000,0x090500,0x868163,0xb8b189,0xbeb68a,0xbfb688,0xc0b78b,0xc0b78d,0xc9c099,0xa89e81,0x170b00,0x010208,0x00061c,0x00446b,0x1bb8f0,0x00bfff,0x00c1ff,0x00c0ff,0x00bfff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00b8ff,0x00baff,0x00bbff,0x00bbff,0x00bdff,0x00bdff,0x00beff,
+0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00beff,0x00c0ff,0x00bdfe,0x1bbaea,0x1180a1,0x001326,0x000306,0x000000,0x5c573b,0xc2bb99,0xc6bf97,0xbdb889,0xbcb784,0xbcb781,0xbbb783,0xbbb88d,0xaeab87,0x221e03,0x050000,0x080300,0x201b07,0x7a755a,0x969273,0x8a8667,0x918d71,0x8e8972,0x928d79,0x8a8572,0x332e1b,0x050000,0x191400,0x76715c,0x8f8a72,0x908c70,0x908c6e,0x908c6d,0x908c6c,0x908c6b,0x8f8b6a,0x8f8b6b,0x8f8a6e,0x8a856d,0x95907a,0x8a8570,0x443f2d,0x0f0900,0x030000,0x070000,0x090200,0x080200,0x000000,0x453c27,0xc9bfa1,0xc4b893,0xc3b790,0xc1b492,0xbfb391,0xc4ba92,0xc4ba8f,0xc1b88b,0xc1b88a,0xc0b789,0xc0b789,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b889,0xc1b888,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc3b989,0xc3b989,0xc2b888,0xc2b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc3b888,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b989,0xc4b988,0xc4b987,0xc4b986,0xc4b985,0xc4b985,0xc4b987,0xc4b98a,0xc4b98c,0xc4b98d,0xc4b98c,0xc2b689,0xc6bb8c,0xc4b988,0xc4b987,0xc3b884,0xc2b886,0xc3b98c,0xbbb38d,0x989276,0x181300,0x000000,0x000000,0x000000,0x0b0900,0x565540,0x8c8b71,0x8a8a6c,0x898a68,0x8b8c69,0x8b8b6f,0x585747,0x020000,0x050200,0x191506,0x9b9677,0xbbb58c,0xbeb68a,0xbfb689,0xc0b78b,0xbbb289,0xc6bd99,0x8e856b,0x0d0200,0x00040d,0x00051d,0x03618b,0x18bbf9,0x00bbff,0x00bcff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00baff,0x00b6fd,0x00b9ff,0x00baff,0x00baff,0x00baff,0x00bbff,0x00bcff,
+0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bfff,0x00bcff,0x0fb8f2,0x219ac5,0x001b34,0x000109,0x020200,0x332b15,0xb3aa8c,0xc2ba94,0xbdb88a,0xbcb784,0xbcb781,0xbbb783,0xbdb98c,0xc2bf99,0x726d51,0x191400,0x030000,0x030000,0x3b3527,0x837e6c,0x96917d,0x928d7b,0x8a8575,0x686355,0x262013,0x000000,0x040000,0x000000,0x292414,0x8a8571,0x918d73,0x908c6e,0x908c6c,0x908c6b,0x908c6a,0x8f8b68,0x8f8b69,0x8f8b6a,0x8f8b6d,0x908c70,0x969176,0x918d73,0x6e6955,0x1f1a0a,0x050000,0x020000,0x020000,0x000000,0x271f08,0xc2b899,0xc1b68f,0xc1b58c,0xc1b58e,0xc2b68f,0xc2b78e,0xc3b98d,0xc1b88b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b889,0xc1b889,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc2b888,0xc2b888,0xc2b888,0xc2b888,0xc2b888,0xc2b888,0xc2b888,0xc2b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b988,0xc3ba87,0xc3ba86,0xc3ba85,0xc3ba86,0xc3b988,0xc3b98b,0xc3b98e,0xc3b98f,0xc3b98f,0xc4ba8f,0xc3b98b,0xc3b988,0xc2b885,0xc2b884,0xc1b886,0xc2b98d,0xb9b28d,0x3b351b,0x000000,0x090300,0x151001,0x363321,0x76735d,0x8f8d72,0x919070,0x8c8c6a,0x8c8c68,0x898a66,0x757559,0x252416,0x000000,0x000000,0x514d3d,0xada886,0xbcb68b,0xbeb689,0xc0b78a,0xc0b68d,0xc2b993,0xa39c7b,0x3b331d,0x040000,0x00020e,0x00132d,0x1788b3,0x0cb7f7,0x00b9ff,0x00b9ff,0x00baff,0x00baff,0x00bbff,0x00baff,0x00bbff,0x00bbff,0x00b9ff,0x00bcff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,
+0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x04b8f7,0x1097c7,0x001a35,0x00020c,0x060601,0x0f0500,0x7b7258,0xc4bc99,0xbdb88b,0xbdb885,0xbab680,0xbbb782,0xbebb8c,0xbebb94,0xb4b092,0x58533f,0x080200,0x090200,0x1b1510,0x3d3731,0x645e55,0x6e685f,0x453f37,0x120c04,0x000000,0x0e0800,0x050000,0x020000,0x120c00,0x767160,0x969179,0x918d6f,0x908c6c,0x908c6a,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b68,0x8f8b6a,0x8f8b6b,0x8f8b6b,0x938f71,0x9c977d,0x6d6852,0x433e2c,0x0f0900,0x000000,0x020000,0x5c5439,0xbeb594,0xc1b68e,0xc3b78d,0xc2b68c,0xc3b78d,0xc2b88c,0xc3b98d,0xc1b88b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b988,0xc3ba88,0xc3b988,0xc3b989,0xc3b98c,0xc3b98f,0xc1b791,0xc5bb97,0xb5aa86,0xaea47d,0xc7bd94,0xc3b98c,0xc1b889,0xc1b887,0xc1b889,0xc1b98e,0xc1ba96,0x383318,0x000000,0x1a1502,0x55513c,0x89866e,0x8b896c,0x8d8b6b,0x8e8d69,0x8d8c67,0x8c8c68,0x8e8e6c,0x6c6c53,0x0f0d03,0x000000,0x000000,0x716d58,0xb5b08b,0xbcb689,0xbfb789,0xc0b78b,0xc0b68f,0xc8bf9d,0xa49c81,0x241e0f,0x0a0305,0x000011,0x002f4b,0x1a9cc9,0x04b5f7,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00b9ff,
+0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbf8,0x13abd9,0x0e5e78,0x00030d,0x020602,0x0f0500,0x473d25,0xc7c09e,0xbab488,0xbeb987,0xbab680,0xbbb782,0xbebb8b,0xbebb93,0xc2be9f,0xaea994,0x2d271c,0x090200,0x0f080a,0x000000,0x030000,0x080100,0x090200,0x030000,0x030000,0x050000,0x0c0600,0x0a0400,0x0b0500,0x3d3829,0x908b74,0x878266,0x8f8b6b,0x928f6c,0x908c69,0x8f8b67,0x8f8b67,0x8f8b68,0x8f8b68,0x8e8a67,0x8e8a67,0x8f8b69,0x918d6e,0x969274,0x918d72,0x6f6b51,0x575238,0x474226,0xa39c7b,0xc8be9a,0xc5ba91,0xc7bb90,0xc6ba8f,0xc4b98e,0xc3b98c,0xc3b98c,0xc3b98c,0xc3b98b,0xc3b98b,0xc3b98b,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b88a,0xc1b889,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98c,0xc3b98d,0xbfb58a,0xbdb389,0xbfb58e,0xc4b997,0xcdc2a4,0xa69a7f,0x291e02,0x312608,0xbcb190,0xc4ba94,0xc1b88f,0xbfb58a,0xc2b98e,0xc1b990,0xc1ba95,0x878263,0x706c50,0x8a866a,0x959275,0x929070,0x8d8b6a,0x8b8965,0x8c8b65,0x8c8b65,0x8c8c69,0x8d8c70,0x575644,0x090702,0x020000,0x000000,0x726f52,0xb7b38b,0xbcb688,0xbfb789,0xc0b78b,0xbfb690,0xc5bd9f,0x8a8370,0x18130d,0x05030f,0x000012,0x005373,0x17a7d6,0x00b4f8,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,
+0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bbf4,0x1db5de,0x35879d,0x000910,0x0b0f0b,0x110700,0x352c16,0xd0c7a9,0xc1bb92,0xbcb787,0xbcb784,0xbbb784,0xbdb98a,0xbdb990,0xbeb998,0xbeb99f,0xa19b88,0x585246,0x010000,0x000000,0x010000,0x070000,0x080100,0x000000,0x060000,0x2c261c,0x231c13,0x030000,0x090300,0x0f0900,0x77715d,0x8f8a72,0x9a967b,0x8c886b,0x7b7757,0x8c8967,0x8f8b69,0x8f8b68,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b68,0x908c6a,0x8f8b69,0x8f8b6a,0x8b8767,0x8e8a6a,0x8a8564,0x98916f,0xc1b994,0xdbd1aa,0xcfc49b,0xc5ba8f,0xc3b98d,0xc3b98c,0xc2b98b,0xc2b98c,0xc2b98c,0xc2b98c,0xc2b98c,0xc1b88b,0xc1b88b,0xc1b88b,0xc1b88b,0xc1b88a,0xc1b88a,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98b,0xc3b98d,0xc1b88d,0xc6bc93,0x837951,0x817751,0xa69b77,0xc6bb9d,0xc8bda2,0x62573e,0x040000,0x010000,0x7a6f54,0xc8be9f,0xcac09e,0xccc29d,0xc5bc95,0xc6be97,0xbbb490,0x948f6e,0x8f8b6b,0x938f70,0x908c6b,0x8e8b68,0x8c8b65,0x8b8963,0x8c8b65,0x8b8965,0x8d8b6b,0x8f8e76,0x484738,0x010000,0x000000,0x070500,0x8d8a68,0xbab58b,0xbeb88a,0xbfb78b,0xc0b68e,0xbfb693,0xc6bea4,0x877f71,0x0c0908,0x010415,0x00001c,0x006287,0x10abde,0x00b5fa,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,
+0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bcf8,0x08b8ea,0x21a7ca,0x1f6575,0x000709,0x0a0b05,0x0b0100,0x120900,0x6a6249,0xada685,0xb9b48c,0xbdb88a,0xbbb787,0xbcb88a,0xbcb88d,0xbcb792,0xbfb997,0xc8c2a2,0xbfb99c,0x67614b,0x362f1e,0x2b2415,0x181103,0x1c1505,0x433c2b,0x615b49,0x968f7e,0x6c6556,0x040000,0x0d0500,0x000000,0x484132,0x898272,0x433e2b,0x25200b,0x2f2b12,0x837f62,0x8f8b6c,0x8f8b6a,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b68,0x8f8b68,0x8f8b68,0x8f8b68,0x908c6a,0x8e8a68,0x8f8b6a,0x8c8665,0x5a5231,0x5e5632,0x827952,0xbdb48a,0xc3bb8e,0xc1ba8b,0xc0b889,0xc1b98c,0xc1b98d,0xc1b98d,0xc2b98d,0xc1b88d,0xc1b88d,0xc1b88c,0xc1b88b,0xc1b88b,0xc1b889,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b887,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b98a,0xc3b98c,0xc3b98d,0xc1b88d,0xc5bb92,0x8e845c,0x120800,0x030000,0x2a2000,0xbdb292,0xc7bc9f,0x4b4126,0x090000,0x020000,0x6c624c,0xc5bba3,0x90876c,0x786f4f,0xa49c79,0xbeb793,0x97926e,0x908c6a,0x8e8a69,0x8f8b6a,0x8d8a68,0x8d8a66,0x8d8a65,0x8b8963,0x8c8b66,0x8b8968,0x949276,0x6e6c56,0x0e0c00,0x000000,0x040200,0x575439,0xc9c5a1,0xbdb98f,0xbeb78c,0xbfb78e,0xc0b692,0xc0b599,0xbeb49f,0x463c32,0x080507,0x010a1c,0x000d2d,0x00739d,0x0bafe6,0x00b6fc,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,0x00b7ff,
+0x00bcff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00bbff,0x00bbfe,0x00bcf9,0x02b3e9,0x1eaedb,0x005e7d,0x001c28,0x000201,0x090600,0x0e0300,0x040000,0x28200c,0x999278,0xbcb594,0xbcb68d,0xbcb68a,0xbeb78b,0xbeb78c,0xbeb78f,0xbeb78f,0xbeb78e,0xbeb790,0xbcb592,0xa9a182,0x877f64,0x635b42,0x787057,0x877f66,0x8e866d,0x928b73,0x8c8470,0x2f2716,0x0a0100,0x060000,0x150d03,0x342c23,0x0c0500,0x110b00,0x171200,0x7d7961,0x8f8a6e,0x8f8b6b,0x8f8b69,0x8f8b68,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b67,0x908c68,0x8a8663,0x948f6f,0x666043,0x140d00,0x0e0600,0x160f00,0x605936,0xafa880,0xcfc99e,0xbfb98d,0xbfb88e,0xc1bb91,0xc0b990,0xc1b990,0xc2b990,0xc2b990,0xc2b98f,0xc2b98e,0xc2b98c,0xc2b98a,0xc3ba88,0xc3ba86,0xc3ba86,0xc3ba86,0xc3ba86,0xc3ba87,0xc3b988,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98d,0xc1b88d,0xc0b68d,0xc1b88f,0x938961,0x1c1200,0x000000,0x2f2602,0xc0b693,0xcec5a4,0x675f40,0x000000,0x000000,0x867d6a,0xaba290,0x261e09,0x170f00,0x777052,0xaea886,0x928d6b,0x908c6a,0x8f8b69,0x8f8b69,0x8e8a67,0x8e8a65,0x8d8a64,0x8b8963,0x8c8a67,0x8b896b,0x97947b,0x4e4b37,0x000000,0x000000,0x0b0900,0x898667,0xc6c29b,0xbcb88d,0xbeb78e,0xc2b994,0xc4b99b,0xc1b69f,0xa49a8a,0x130a04,0x000208,0x000d22,0x002447,0x1093c2,0x07b4f0,0x00b7fd,0x00b8ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,
+0x00bcff,0x00bcff,0x00bbff,0x00baff,0x00baff,0x00bcff,0x00baf8,0x06b8ef,0x30c1f1,0x0e6f97,0x000c27,0x00020c,0x0c0402,0x110700,0x100600,0x0b0300,0x080100,0x29220d,0xaca48a,0xc1ba97,0xbdb68d,0xbfb78c,0xbfb78c,0xbfb78c,0xbfb78c,0xbfb78b,0xc1b88c,0xc2b98e,0xbfb78d,0xb6ad88,0x9f9672,0x978d6b,0x918765,0x908665,0x92886a,0x9e957b,0x8d8470,0x100600,0x0b0100,0x060000,0x010000,0x060000,0x040000,0x1e180b,0x807b66,0x8f8a70,0x8f8b6c,0x8f8b6a,0x8f8b69,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b66,0x8f8b66,0x9c9873,0x979372,0x6e6a50,0x211b07,0x030000,0x0b0400,0x090300,0x302b0f,0x746f4e,0xb3ae8a,0xbdb893,0xbcb791,0xbfb994,0xc0b994,0xc0b892,0xc0b891,0xc1b991,0xc1b98f,0xc1b98d,0xc2ba8a,0xc2ba87,0xc3ba85,0xc3ba84,0xc3ba84,0xc3ba85,0xc3ba86,0xc3ba87,0xc3ba88,0xc3ba88,0xc3ba88,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc1b888,0xc0b787,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98c,0xc3b98d,0xc1b88d,0xc1b88e,0xc0b68e,0xb6ac84,0x887e58,0x635a35,0x99916c,0xbeb790,0xbab38e,0xaaa482,0x403b1f,0x49422e,0xa8a192,0x726c5e,0x020000,0x0a0400,0x2d270d,0x7d785a,0x989473,0x908c6a,0x908c69,0x8f8b68,0x8f8b67,0x8f8b65,0x8d8a63,0x8d8a64,0x8b8865,0x8b876c,0x827f68,0x272410,0x010000,0x010000,0x3e3c22,0xb3b08e,0xbbb890,0xbcb88e,0xbfb891,0xbeb595,0xc2b79f,0xb1a896,0x574f45,0x000000,0x00050f,0x00132c,0x00577e,0x1fb0e5,0x00b7f7,0x00b8fe,0x00b9ff,0x00b8ff,0x00b8fe,0x00b9ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,
+0x00bcff,0x00bcff,0x00bbff,0x00baff,0x00bbff,0x00bdff,0x01b9f4,0x18b1e4,0x38a7d3,0x002a4c,0x000010,0x040004,0x22120d,0x2d2016,0x100600,0x0a0300,0x0e0800,0x090200,0x867f68,0xcbc3a3,0xbcb38d,0xbfb58c,0xc0b78c,0xc0b78b,0xc0b78b,0xc0b789,0xc1b889,0xc3b98a,0xc3b98b,0xc1b88c,0xb1a77e,0x998f67,0x948a63,0x928861,0x958b68,0x978e6f,0x978e74,0x675e48,0x251b0c,0x070000,0x0a0100,0x000000,0x090100,0x554f40,0x89846e,0x8f8b6e,0x8f8b6a,0x8f8b69,0x8f8b68,0x8f8b68,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b66,0x8f8b66,0x918e68,0x93906e,0x969178,0x5a5542,0x0f0900,0x030000,0x080200,0x050000,0x171200,0x4b472e,0x605c41,0xaca78c,0xc6c0a3,0xc9c2a4,0xbfb796,0xbfb693,0xc1b993,0xc1b991,0xc1b98e,0xc1ba8a,0xc2ba87,0xc3ba85,0xc3ba84,0xc3ba84,0xc3ba85,0xc3ba86,0xc3ba87,0xc3ba88,0xc3ba88,0xc3b988,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc0b787,0xc0b787,0xc0b787,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98c,0xc3b98e,0xc3b98e,0xc3b98f,0xbfb58d,0xc1b790,0xc2b992,0xc2ba94,0xc2ba94,0xbeb890,0xbcb790,0xbdb895,0xb3af92,0xc8c3af,0x8e887a,0x241e13,0x040000,0x000000,0x201c03,0x817d60,0x908c6c,0x908c6a,0x908c69,0x8f8b67,0x8f8b67,0x8f8b66,0x8f8b67,0x908c6a,0x918d70,0x99947f,0x5b5645,0x0b0700,0x070400,0x090700,0x949275,0xbfbc97,0xbdb98f,0xbeb98e,0xbfb892,0xc2b89b,0xd0c5b0,0x8a8072,0x18130d,0x000000,0x000615,0x002d4c,0x0a7ba8,0x15b9f0,0x00bbfa,0x00b9fe,0x00b9ff,0x00b8fd,0x00b8fd,0x00b8ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00b9ff,0x00bbff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,
+0x00bcff,0x00bcff,0x00bbff,0x00b9ff,0x00baff,0x00bdff,0x11bbf6,0x38b2e6,0x17648c,0x00041d,0x000006,0x0c0405,0x544741,0x5b5047,0x2d2318,0x0c0400,0x040000,0x020000,0x2d2510,0xb1a98c,0xc0b794,0xc1b890,0xc0b78c,0xc0b78c,0xc0b78a,0xc0b788,0xc0b787,0xc1b888,0xc3b98a,0xc3b98c,0xc0b78b,0xb5ab81,0x9c926a,0x8f855d,0x928962,0x948b66,0x958c6a,0x968d6e,0x857c63,0x504635,0x2f2518,0x4a4234,0x716a58,0x8e8970,0x908c6d,0x8f8b68,0x8f8b66,0x8f8b66,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b67,0x8f8b67,0x898561,0x918d6b,0x928e71,0x8f8a72,0x817c68,0x353020,0x100a00,0x030000,0x080200,0x080200,0x030000,0x1c1609,0x575041,0xa59d89,0xbdb59a,0xc1b898,0xc0b894,0xc0b891,0xc0b88d,0xc1ba8b,0xc2ba88,0xc3ba86,0xc3ba85,0xc3ba85,0xc3ba86,0xc3ba87,0xc3b988,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98b,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98c,0xc3b98e,0xc3b98f,0xc3b98f,0xc3b98f,0xc0b68e,0xc1b790,0xc2b992,0xc1b993,0xc0b993,0xc1bb93,0xbfba93,0xbeb998,0xcac6aa,0x8b8673,0x191406,0x0e0800,0x080200,0x000000,0x444027,0x8e896d,0x8f8b6b,0x908c6a,0x908c69,0x908c69,0x908c69,0x8f8b6a,0x888466,0x9a967d,0x8e8875,0x5a5548,0x201a10,0x050100,0x080500,0x25230c,0xbab799,0xc1bd97,0xc0bb91,0xbfba8f,0xbfb891,0xc4ba9d,0xbcb19c,0x382d20,0x000000,0x00030b,0x000c23,0x0b6d95,0x15a6d8,0x01bbf1,0x00bdf8,0x00bafc,0x00bafe,0x00b8fc,0x00b8fc,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00bbff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,
+0x00bcff,0x00bcff,0x00bbff,0x00baff,0x00b9ff,0x02bbfa,0x21baee,0x298ab2,0x002641,0x000007,0x080204,0x312722,0x60544c,0x5f534a,0x53493e,0x2a2115,0x0b0300,0x100700,0x020000,0x3f361b,0x9b9272,0xcec49f,0xc1b88f,0xc0b78c,0xc0b789,0xbfb686,0xc0b786,0xc1b887,0xc1b888,0xc1b889,0xc3b98b,0xc3b98d,0xb5ab80,0xa69c71,0x968d62,0x91885e,0x8f875f,0x938a64,0x98906e,0x9e957a,0x999078,0x928b73,0x9a9378,0x938e6d,0x908c67,0x908d64,0x8f8c62,0x8f8c64,0x8f8b65,0x8f8b67,0x8e8a67,0x8f8b69,0x8f8b6a,0x8f8b6a,0x908c6a,0x928f6b,0x928e6d,0x938f71,0x9e997f,0xc1bca5,0xc4bfae,0x857f75,0x4b453f,0x1d1612,0x070000,0x000000,0x000000,0x000000,0x170f03,0x463d29,0x8b8268,0xa9a183,0xbcb492,0xbfb892,0xc1b990,0xc2b98b,0xc1b887,0xc2ba87,0xc2ba87,0xc2ba88,0xc3bb8a,0xc2b98a,0xc2b98b,0xc2b98b,0xc2b98b,0xc3b98c,0xc3b98c,0xc3b98c,0xc3b98c,0xc3b98c,0xc3b98b,0xc3b98a,0xc3b98a,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98b,0xc3b98d,0xc3b98f,0xc3b990,0xc3b990,0xc3b990,0xc1b78f,0xc1b790,0xc0b690,0xbfb691,0xc0b994,0xbfb994,0xbfb996,0xbeb99a,0x98947a,0x020000,0x000000,0x0a0400,0x080200,0x26210d,0x7a755d,0x8a8669,0x918d6d,0x918d6a,0x908c68,0x908c69,0x908c6c,0x8f8a70,0x88836e,0x6b6556,0x352f24,0x000000,0x040000,0x000000,0x100c00,0x7e7b62,0xcac6a6,0xc1bc95,0xc1bc91,0xbfba8e,0xbcb68e,0xc5bd9f,0x7a705c,0x030000,0x000101,0x000c1b,0x002848,0x1899cc,0x0ab5f0,0x00bbf4,0x00bcf8,0x00bafd,0x00b9ff,0x00b8fd,0x00b8fd,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,
+0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00b9fb,0x0db9ef,0x2db4d9,0x00485b,0x00080d,0x000000,0x181009,0x493d33,0x605348,0x605347,0x5f5347,0x4c4235,0x160d00,0x0d0400,0x0f0500,0x050000,0x41361b,0xb8ae8c,0xc5bb95,0xbeb489,0xbdb385,0xbfb684,0xc0b784,0xc1b985,0xc1b885,0xc1b887,0xc3b989,0xc3b98a,0xc0b789,0xbfb687,0xb2a97b,0xa69d6f,0x9b9264,0x92895e,0x91885f,0x938a66,0x978f6d,0x958e6b,0x948d69,0x938d67,0x918c63,0x918d61,0x908c5f,0x8f8c61,0x8f8c64,0x8e8a66,0x8e8a69,0x918d6f,0x888467,0x797458,0x6f6b4d,0x928f6c,0x969270,0xa7a386,0xc0bba2,0xc5c0ac,0xb2ac9c,0x524c41,0x534d46,0x7b7470,0x4c4643,0x000000,0x0a0301,0x090200,0x020000,0x040000,0x1f1704,0x3c3420,0x817961,0xa59e81,0xc0b997,0xc4bd94,0xbcb487,0xbeb687,0xbcb484,0xc1ba8b,0xc4bc8f,0xc2bb8f,0xc1b98e,0xc1b98e,0xc2b98e,0xc2b98e,0xc3b98e,0xc3b98d,0xc3b98d,0xc3b98d,0xc3b98c,0xc1b88a,0xc3b98a,0xc0b787,0xc3b989,0xc0b787,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98c,0xc3b98e,0xc3b990,0xc3b991,0xc3b991,0xc3b991,0xc3b991,0xc1b790,0xbfb58f,0xbcb38f,0xc0b996,0xc4be9c,0xb6b192,0x898469,0x302c15,0x080200,0x080200,0x000000,0x140f00,0x615c47,0x9c977e,0x908c6f,0x928e6d,0x918e68,0x918e68,0x908c6a,0x918d71,0x8a8572,0x484236,0x1d1610,0x030000,0x040000,0x0d0800,0x000000,0x38341d,0xb2af91,0xc1bd99,0xc1bc93,0xc0bb8f,0xbfba8c,0xb8b38a,0xaca688,0x251e0c,0x000000,0x00040b,0x001931,0x005681,0x0aa9e8,0x00b6fc,0x00b9fb,0x00b9fc,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00bbff,0x00baff,0x00baff,
+0x00bbff,0x00bcff,0x00bbff,0x00bbfd,0x01b8f1,0x1cb3df,0x17849e,0x000d13,0x000000,0x060700,0x43392b,0x625446,0x625345,0x615345,0x625648,0x605547,0x2c2013,0x0b0000,0x0b0000,0x0c0000,0x0c0000,0x53482d,0xada282,0xb1a781,0xb8ae84,0xbfb687,0xc0b785,0xc1b985,0xc1b985,0xc1b985,0xc3ba87,0xc3ba88,0xc1b887,0xc1b887,0xc5bc8b,0xc6bd8c,0xbfb685,0xafa676,0xa69d6f,0xa69d72,0xa39b71,0xa0996f,0x9e966d,0x9b946a,0x948f63,0x908a5d,0x8d885b,0x8d895f,0x8d8962,0x8d8967,0x959073,0x7a755c,0x2d2811,0x130f00,0x0a0600,0x474322,0x989473,0xc8c3a8,0xbbb69f,0x9a9583,0x342e20,0x000000,0x0f0900,0x554e48,0xa19b96,0x79726f,0x2c2522,0x0f0804,0x070000,0x0b0400,0x070000,0x010000,0x070000,0x160f00,0x625b41,0xa9a180,0xa79f79,0xc4bd95,0xc2ba92,0xc2ba92,0xc2ba93,0xc2ba94,0xc2ba94,0xc2ba94,0xc2ba93,0xc3ba92,0xc4ba90,0xc4ba8e,0xc4ba8d,0xc4ba8d,0xc4ba8d,0xc4ba8c,0xc4ba8c,0xbfb686,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98c,0xc3b98d,0xc3b98f,0xc3b990,0xc3b991,0xc3b991,0xc3b892,0xc1b792,0xbeb490,0xbfb694,0xb6ae8e,0x8b8467,0x4b452b,0x000000,0x000000,0x080200,0x0e0800,0x26210f,0x6b6652,0x938f78,0x8b876d,0x908c6f,0x908c6b,0x918e69,0x918e69,0x8f8b6c,0x96917a,0x514b3e,0x020000,0x040000,0x080100,0x0b0500,0x0c0700,0x615c47,0xc1bda0,0xbab693,0xbeba92,0xbfbb91,0xbdb98d,0xbab58a,0xb5af8a,0x4b442c,0x0c0600,0x020001,0x000617,0x003153,0x20a1d5,0x04b7fd,0x00b8ff,0x00b7ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00baff,
+0x00bbff,0x00bcff,0x00bbfe,0x00bbf4,0x10b9e7,0x1892b2,0x003c4e,0x000708,0x000000,0x201909,0x605440,0x625240,0x635141,0x625141,0x635445,0x615345,0x544639,0x281a0d,0x090000,0x0a0000,0x120500,0x201401,0x483d26,0xbfb498,0xcabf9e,0xc0b68f,0xc0b78a,0xc1b887,0xc1b985,0xc1b985,0xc3ba86,0xc3ba86,0xc1b985,0xc1b985,0xc5bc88,0xc6bd8a,0xc7be8b,0xc3ba86,0xbeb583,0xbeb584,0xbcb484,0xb9b183,0xb7b083,0xb5ae82,0xb1aa7f,0xa39c71,0x9d976d,0x99936b,0x9a9572,0xa5a183,0x625e46,0x292412,0x020000,0x030000,0x040000,0x0e0900,0x858162,0xc4c0a6,0xb6b19d,0x4c4738,0x0e0800,0x090300,0x0a0400,0x140e06,0x575149,0x575149,0x241d16,0x0f0802,0x050000,0x0a0400,0x0a0400,0x0c0500,0x0e0700,0x000000,0x080000,0x1f1600,0x2f270a,0x6d6447,0xaaa182,0xcac2a3,0xcbc3a5,0xcdc4a6,0xcbc3a5,0xc3bb9c,0xc1b897,0xc2b992,0xc4ba8f,0xc4ba8c,0xc4bb8a,0xc4ba8b,0xc5bc8d,0xc3b98a,0xc4bb8b,0xc4bb8b,0xc3b989,0xc5bc8c,0xc0b787,0xc0b787,0xc0b787,0xc0b787,0xc0b787,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc3b989,0xc1b888,0xc4bb8a,0xc3b989,0xc3b98a,0xc3b98a,0xc3b98b,0xc3b98b,0xc3b98c,0xc3b98e,0xc4ba92,0xcabf9a,0xcfc5a3,0xcac0a1,0x92886a,0x554d31,0x170f00,0x0a0400,0x0a0500,0x070100,0x000000,0x3c3725,0x817c68,0x8f8a74,0x908b74,0x908b72,0x918d71,0x908c6d,0x8f8b68,0x928e6d,0x979278,0x797362,0x0c0600,0x090200,0x070000,0x000000,0x272117,0x706b59,0xaba68b,0xb7b491,0xbab78f,0xbbb88d,0xbab88d,0xbbb88e,0xd0cba5,0x7c7559,0x170b00,0x030000,0x00000d,0x000521,0x00638f,0x19b0eb,0x00b3fc,0x00b6ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,
+0x00bbff,0x00bbff,0x00bafb,0x04baef,0x2abce2,0x00465f,0x00101b,0x010d0b,0x110b00,0x463c29,0x6a5c46,0x62503c,0x624f3c,0x635140,0x635342,0x625344,0x67574a,0x5e4f42,0x443629,0x160800,0x100300,0x130600,0x0b0000,0x3c2f20,0x7e725d,0xbeb396,0xc0b691,0xc1b88c,0xc3b988,0xc3ba86,0xc3ba85,0xc3ba85,0xc1b984,0xc1b984,0xc4bb87,0xc5bc88,0xc7be8b,0xc6bd89,0xc6bd8a,0xc6bd8b,0xc5bc8b,0xc4bc8c,0xc2bb8c,0xc4bd90,0xc4bd92,0xc3bc92,0xbfb891,0xc2bb98,0xaca688,0x6d6851,0x191402,0x000000,0x0b0500,0x040000,0x0e0800,0x625d41,0xb2ad90,0xbcb7a0,0x56503f,0x000000,0x0c0600,0x080200,0x050000,0x393329,0x5e584e,0x2b251b,0x040000,0x080200,0x090300,0x0a0400,0x0a0400,0x080200,0x070000,0x090100,0x080000,0x030000,0x030000,0x050000,0x1f1601,0x382f1a,0x433a25,0x665d47,0x7e755f,0xb6ad96,0xc4bba1,0xc5bc9c,0xc2b894,0xc1b88f,0xc5bb91,0xc5bb92,0xc5bb91,0xc3bb8c,0xc3bb8a,0xc0b787,0xc2ba89,0xc3bb8a,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc1b888,0xc2ba89,0xc2ba89,0xc2ba89,0xc2ba89,0xc2ba89,0xc1b888,0xc0b787,0xc0b788,0xc0b789,0xc1b88a,0xc1b889,0xc2b98a,0xc2ba89,0xc2ba89,0xc2ba89,0xc2ba89,0xc3bb8a,0xc7be8e,0xc1b888,0xc5bc8c,0xc2b98a,0xc2b98c,0xc2b98d,0xc2b98f,0xc0b68f,0xbeb48e,0xc2b894,0xb3a988,0x8a8062,0x5f5539,0x4a4026,0x100700,0x000000,0x0a0200,0x000000,0x000000,0x090300,0x5a5544,0x9e9986,0x9d9882,0x8f8a73,0x908b73,0x918d73,0x918d71,0x908c6e,0x8b8767,0x827e60,0x59543f,0x1e180a,0x000000,0x020000,0x17100d,0x605a52,0xafaa9a,0xc0bba3,0xbbb797,0xb5b28c,0xb9b68c,0xbcb98f,0xc3c199,0xbcba96,0x999578,0x231d0c,0x000000,0x00000e,0x00061f,0x004268,0x27abe1,0x03aff2,0x00b2fc,0x00b3ff,0x00b5ff,0x00b6ff,0x00b6ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bcff,
+0x00bbff,0x00bbff,0x00b8f9,0x17b2e5,0x2491b5,0x002337,0x00090f,0x060903,0x211c0d,0x574c38,0x63533e,0x624f3b,0x624f3b,0x63503d,0x645241,0x635243,0x635244,0x645446,0x605042,0x38291b,0x0c0000,0x090000,0x0e0000,0x140503,0x170904,0x736656,0xb9ae93,0xc6bc96,0xc1b88a,0xc1b886,0xc3ba85,0xc3ba86,0xc1b885,0xc1b885,0xc4bb88,0xc4bb89,0xc6bd8b,0xc5bc89,0xc3ba87,0xc3b988,0xc2ba89,0xc1ba8a,0xc1ba8c,0xc1ba8d,0xc2bb90,0xc1b990,0xc2ba95,0xc1ba9c,0x6b644d,0x161000,0x0b0500,0x040000,0x0a0400,0x100a00,0x5e5947,0xbbb59b,0xc2bca1,0x948e79,0x1e1809,0x030000,0x0c0600,0x0c0600,0x211b13,0x484239,0x3c362e,0x161007,0x070000,0x090300,0x090300,0x090400,0x080300,0x080300,0x070100,0x070000,0x070000,0x070000,0x080000,0x080000,0x090000,0x090000,0x0d0500,0x120a00,0x160d00,0x3b3323,0x665e4c,0x958b76,0x9c927b,0xa49b81,0xc9c0a6,0xcdc3a9,0xcdc4a4,0xccc499,0xc8c190,0xc1ba89,0xc0b988,0xc0b988,0xc2bb8a,0xc2bb8a,0xc2bb8a,0xc2bb8a,0xc2bb8a,0xc2bb8a,0xc1ba89,0xc1ba89,0xc1ba89,0xc1ba89,0xc1ba89,0xc0b988,0xc0b989,0xc0b88c,0xc0b88d,0xc0b88d,0xc0b88c,0xc1ba8a,0xc1ba89,0xc1ba89,0xc1ba89,0xc1ba89,0xbeb686,0xc6be8e,0xc6be8e,0xcbc393,0xd0c99b,0xccc49b,0xc4bb98,0xbab194,0xa39981,0xa29882,0x736956,0x362b19,0x1b1100,0x0c0100,0x090000,0x080000,0x070000,0x090100,0x130d00,0x0f0900,0x605b4a,0x96917e,0x96917c,0x938f77,0x938f75,0x918d73,0x918d72,0x928e73,0x8c886c,0x8a8668,0x413c22,0x0f0a00,0x000000,0x080200,0x000000,0x3c362a,0xaea997,0xbbb69e,0xbab698,0xbab694,0xb9b590,0xbab690,0xb8b58f,0xc5c3a1,0x9d9b80,0x3a3625,0x040401,0x000615,0x000c26,0x003f5e,0x0e8fbb,0x0eb7f6,0x00b8ff,0x00b6ff,0x00b5ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,
+0x00bcff,0x00bcff,0x03b8f6,0x169bca,0x004766,0x000716,0x070506,0x0c0800,0x3c3423,0x635440,0x624f3a,0x624d38,0x644e3a,0x64503c,0x65523f,0x645240,0x645341,0x645341,0x645442,0x534432,0x211203,0x0e0000,0x0f0000,0x0f0001,0x0d0000,0x100200,0x382c19,0xa69c7d,0xc7bd96,0xc1b88b,0xc2ba89,0xc2ba89,0xc1b888,0xc0b787,0xc2b98a,0xc2b98b,0xc5bc8e,0xc3bb8c,0xc2b98a,0xc2b98b,0xc2b98c,0xc1ba8c,0xc1ba8c,0xc1ba8d,0xc2bb8f,0xc0b991,0xc3bc9a,0x999279,0x0b0500,0x040000,0x050000,0x010000,0x27211c,0x938c83,0xcbc4b6,0xa49d88,0x534c36,0x130d00,0x0a0400,0x0c0500,0x030000,0x1a130c,0x3a332c,0x0b0500,0x0a0400,0x0c0600,0x080200,0x090300,0x080300,0x080400,0x060300,0x060301,0x050200,0x060100,0x060000,0x070000,0x070000,0x070000,0x070000,0x070000,0x070000,0x040000,0x000000,0x040000,0x000000,0x060000,0x020000,0x100700,0x61594b,0x766e60,0x776f5c,0x8f8869,0xa8a27d,0xc2bc96,0xbfb994,0xbfb994,0xc2bc96,0xc1ba95,0xc2bc96,0xc2bc96,0xc2bc96,0xc1ba95,0xc1ba95,0xc1bb94,0xbfb993,0xc1bb94,0xc1bb94,0xc1bb93,0xc1bb93,0xc1ba94,0xbfb994,0xbeb893,0xbeb893,0xbfb993,0xbfb992,0xbfb993,0xbfb993,0xbfb993,0xbfb993,0xb2ab86,0xa8a27d,0x9e9772,0x79724f,0x575032,0x2e270e,0x29210f,0x1f1608,0x0d0500,0x0f0600,0x080000,0x080000,0x070000,0x080000,0x070000,0x020000,0x241d0b,0x736c59,0x86806d,0x9d9883,0x8a856f,0x8f8a72,0x918d71,0x928e71,0x928e71,0x918d6f,0x938f71,0x898566,0x8a8666,0x322d10,0x010000,0x080300,0x080300,0x141000,0x8e8971,0xbeba9f,0xbbb798,0xbbb796,0xbab694,0xbbb795,0xb7b492,0xc3c0a2,0x949279,0x0f0e00,0x000100,0x000b14,0x000821,0x004b70,0x2bb4df,0x10bef5,0x00b9ff,0x00baff,0x00b9ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x00bdff,0x00bcfd,0x04b7ef,0x2395bf,0x00304b,0x00010a,0x030000,0x271f11,0x564835,0x65513c,0x644d37,0x664e39,0x68503b,0x66513a,0x66523b,0x65533b,0x65533a,0x65533a,0x64533b,0x5f4e38,0x564633,0x372619,0x170600,0x090000,0x0c0000,0x0c0000,0x0a0000,0x352b14,0x9a9172,0xaaa17d,0xc9c199,0xc9c197,0xd2ca9e,0xc4bc90,0xc4bc91,0xc1b990,0xc4bb93,0xc2ba91,0xc1b98f,0xc1b98f,0xc1b98f,0xc1b98e,0xc1ba8d,0xc1ba8c,0xc0ba8e,0xbfb890,0xcac3a3,0x746e59,0x000000,0x030000,0x020000,0x1b1511,0x9c9591,0xc7bfb9,0x8d837b,0x403729,0x110800,0x070000,0x0b0400,0x0b0300,0x070000,0x3a322c,0x453e38,0x020000,0x020000,0x090300,0x090300,0x080300,0x070300,0x060300,0x050301,0x050302,0x050302,0x050200,0x050200,0x040100,0x050000,0x050000,0x070100,0x070100,0x070100,0x060000,0x060000,0x080300,0x060000,0x050000,0x060000,0x060000,0x0f0906,0x130d09,0x130d07,0x181207,0x252013,0x474234,0x5c5748,0x635e4f,0x5a5546,0x6a6556,0x797465,0x7f7a6b,0x9c9788,0xb8b3a4,0xa6a191,0x9b9685,0xbcb7a5,0xa4a08d,0xa6a18d,0xa7a28c,0x9f9b82,0x999579,0xafab8f,0xa8a48a,0xbfbba3,0xaba792,0x9d9985,0x94907d,0x7e7967,0x635f4d,0x555040,0x393425,0x292415,0x272213,0x140f01,0x0b0600,0x050000,0x050000,0x070200,0x040000,0x070200,0x000000,0x000000,0x000000,0x130c00,0x342d1e,0x787261,0x7f7965,0x98937c,0x979279,0x918d72,0x8b876b,0x8f8b6d,0x908c6b,0x918d6a,0x918d6a,0x908c69,0x908c68,0x8e8a65,0x8a8760,0x524f29,0x262200,0x393513,0x514d2a,0x817d58,0xbdba94,0xc1bd98,0xbdba96,0xbdba98,0xbbb797,0xbfbb9f,0xbfbba3,0x979582,0x514e43,0x000000,0x000309,0x000a1b,0x002443,0x0b93c0,0x07bffc,0x00bfff,0x00bdff,0x00bcff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x00bdfd,0x00bcf9,0x1bbef2,0x086589,0x000b1f,0x000407,0x100b03,0x5e5242,0x65533e,0x654e38,0x664c36,0x674e37,0x695039,0x675138,0x665338,0x665337,0x655336,0x655336,0x655337,0x635238,0x64533d,0x615040,0x4a392d,0x201008,0x0c0000,0x0c0000,0x0a0000,0x0b0000,0x180f00,0x1e1500,0x554c30,0x8b8364,0x958c6c,0xa09878,0xb5ad8d,0xbfb697,0xc3bb9b,0xc2ba98,0xc1b996,0xc1b996,0xc1b994,0xc1b992,0xc1b990,0xc0b88e,0xc0b990,0xbeb893,0xada78a,0x1c1605,0x010000,0x0b0601,0x27221f,0x9f9995,0x918986,0x534945,0x080000,0x070000,0x040000,0x090000,0x0b0200,0x0b0200,0x080000,0x1e1611,0x4f4742,0x2d2621,0x0a0400,0x080100,0x070100,0x060200,0x050200,0x050301,0x040302,0x030403,0x030403,0x040302,0x050302,0x040201,0x040201,0x050201,0x050201,0x050201,0x050200,0x050200,0x050200,0x070300,0x070301,0x050101,0x050102,0x050102,0x050102,0x050102,0x050102,0x040000,0x050200,0x020000,0x030000,0x070300,0x000000,0x000000,0x000000,0x020000,0x120f0b,0x211e1a,0x13100b,0x100d05,0x1f1c13,0x0c0901,0x0c0900,0x0f0c00,0x0b0900,0x070400,0x1c1906,0x151201,0x242113,0x17140b,0x0c0903,0x0b0803,0x000000,0x000000,0x000000,0x050200,0x040100,0x030000,0x030000,0x030000,0x030000,0x030000,0x080600,0x040100,0x0a0700,0x120f05,0x454136,0x7b7769,0x868173,0x787364,0x716c5b,0x918c76,0x979278,0x8b876a,0x8f8b6c,0x8c8869,0x8e8a68,0x8f8b66,0x908d66,0x918e67,0x918e66,0x908d64,0x8e8b60,0x908d61,0xa4a175,0xbab78c,0xc1be92,0xc9c698,0xc9c698,0xc2bf92,0xbebb91,0xbdba96,0xbcb899,0xbbb89d,0xafac96,0x666253,0x030100,0x000304,0x000811,0x000212,0x001d36,0x0989af,0x0ebaef,0x00bfff,0x00c0ff,0x00beff,0x00bcff,0x00bbff,0x00baff,0x00b9ff,0x00b9ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b5ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x00bcfb,0x03b6f2,0x189fd0,0x002f4c,0x000814,0x000301,0x211d11,0x625542,0x604d36,0x654d36,0x694f38,0x6b5039,0x6b5139,0x685237,0x665336,0x665335,0x655334,0x655334,0x655335,0x655337,0x65533b,0x65523f,0x695748,0x554438,0x312118,0x190b04,0x0f0200,0x0b0000,0x090000,0x090000,0x010000,0x0f0400,0x090000,0x251b0f,0x4c4235,0x8c8372,0xafa692,0xb6ad96,0xb9b096,0xbab196,0xc1b89b,0xb9b090,0xbbb390,0xc0b893,0xbdb592,0xc1ba9a,0x423c23,0x000000,0x060000,0x050000,0x2e2927,0x46403d,0x090100,0x010000,0x070000,0x0b0000,0x090000,0x0b0200,0x0d0401,0x090100,0x0c0300,0x050000,0x130b08,0x4c4540,0x332c27,0x0b0500,0x050000,0x060200,0x050200,0x050301,0x030402,0x030403,0x030403,0x030403,0x040303,0x040202,0x040202,0x040202,0x050202,0x050202,0x050202,0x050201,0x050201,0x050201,0x050201,0x050202,0x050202,0x050202,0x050202,0x050202,0x050202,0x030100,0x0a0805,0x050200,0x070400,0x050200,0x080601,0x060300,0x090703,0x0a0804,0x020000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x010000,0x050300,0x050300,0x000000,0x000000,0x000000,0x000000,0x000000,0x050104,0x090609,0x070406,0x020001,0x060303,0x050201,0x030100,0x030100,0x020000,0x030100,0x040200,0x13130c,0x494942,0x84837b,0xacaaa0,0x9f9c91,0x6b685b,0x383527,0x030000,0x000000,0x726e56,0x8e896d,0x8c8869,0x918d6c,0x8f8b69,0x8e8a66,0x8e8a64,0x8f8c63,0x928f66,0x939066,0x959266,0x9a986b,0xadaa7b,0xbbb889,0xc2bf90,0xc0bd8d,0xbebc8b,0xbebc8b,0xbebc8d,0xbebb93,0xbab696,0xb7b39a,0xb5b39f,0x666356,0x080300,0x000000,0x000713,0x001527,0x00233b,0x057898,0x10b3df,0x00bcf6,0x00bdff,0x00bdff,0x00beff,0x00bdff,0x00bcff,0x00bbff,0x00baff,0x00b9ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b5ff,0x00b5ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x00b9f7,0x10ace7,0x005c8a,0x000013,0x000006,0x060801,0x373222,0x60513c,0x624c35,0x664d35,0x6b5038,0x6b5038,0x6b5138,0x685236,0x675335,0x665334,0x655334,0x655334,0x655334,0x655336,0x655339,0x65533c,0x65533f,0x645341,0x605040,0x453729,0x2e2115,0x150800,0x080000,0x050000,0x060000,0x090000,0x090000,0x090000,0x140803,0x23180f,0x32271c,0x584e3f,0x5e5443,0x645a48,0x877d69,0x595038,0x685f45,0x81785c,0x7d7559,0x5e563d,0x1b1400,0x090300,0x060000,0x060200,0x060100,0x070100,0x090100,0x0c0200,0x0c0200,0x070000,0x0d0300,0x342b26,0x2b231e,0x070000,0x0b0300,0x080000,0x030000,0x453e37,0x5f5750,0x1c140d,0x080100,0x070100,0x060200,0x040200,0x030200,0x020301,0x030403,0x040303,0x050303,0x060303,0x060303,0x060303,0x060303,0x060303,0x050303,0x050303,0x050303,0x050303,0x050303,0x050303,0x060304,0x060304,0x060304,0x060304,0x060303,0x030100,0x080504,0x050301,0x060401,0x050300,0x050300,0x050300,0x050300,0x050300,0x050300,0x050300,0x040200,0x040200,0x040300,0x040300,0x040200,0x060500,0x050400,0x060500,0x050300,0x050300,0x050301,0x030003,0x030005,0x060408,0x060408,0x050307,0x040106,0x050305,0x040203,0x050304,0x040203,0x030100,0x020100,0x040400,0x10110a,0x2d2e27,0x6d6d65,0x828077,0x29271c,0x000000,0x050100,0x020000,0x000000,0x68644b,0x8a8669,0x8e8a6a,0x8e8a68,0x8c8966,0x8a8761,0x87835b,0x8f8c62,0x979469,0xa2a073,0xaca97c,0xb3b082,0xb9b686,0xbbb987,0xbdbb89,0xbebc8b,0xbdbb8a,0xbebc8e,0xbbb88e,0xbab694,0xc0bba3,0x898575,0x474539,0x181611,0x070206,0x000007,0x00071a,0x00314b,0x006887,0x0ba8cf,0x00baec,0x00befd,0x00bdff,0x00bcff,0x00bdff,0x00beff,0x00bdff,0x00bcff,0x00bbff,0x00bbff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x03b8f4,0x0c93cc,0x00335e,0x00000e,0x030000,0x262015,0x564d3c,0x64533e,0x675139,0x695038,0x6a5037,0x6a5037,0x6a5238,0x695237,0x675336,0x665335,0x655335,0x655335,0x655335,0x655337,0x655338,0x655339,0x655339,0x645339,0x64553a,0x645539,0x615339,0x443623,0x231506,0x140600,0x0c0000,0x0d0000,0x0f0100,0x0f0100,0x0c0000,0x090000,0x040000,0x000000,0x000000,0x000000,0x070000,0x000000,0x000000,0x000000,0x000000,0x010000,0x060000,0x090300,0x070200,0x080300,0x080300,0x070200,0x060000,0x0a0100,0x0f0400,0x1f150b,0x3c3229,0x696058,0x625a52,0x2f2821,0x0c0500,0x090200,0x030000,0x20170e,0x5d544a,0x564b42,0x2f251c,0x130a02,0x080100,0x060200,0x050200,0x040200,0x050302,0x060302,0x050101,0x080203,0x080203,0x070102,0x060102,0x070203,0x070405,0x050303,0x040303,0x040303,0x050303,0x060303,0x070204,0x080206,0x080206,0x080205,0x080204,0x060102,0x060303,0x060302,0x040201,0x030100,0x050302,0x050302,0x050302,0x050302,0x050302,0x050301,0x040200,0x040200,0x040200,0x040200,0x040200,0x050302,0x050303,0x050304,0x050304,0x040202,0x040203,0x040105,0x040105,0x050303,0x050303,0x040105,0x050307,0x050307,0x040105,0x030004,0x0f0c0f,0x1a1819,0x12100f,0x070703,0x000000,0x000000,0x010000,0x000000,0x020000,0x0a0600,0x0f0a00,0x312c1f,0x5b5646,0x89846e,0x938f74,0x959072,0x999575,0x9a9774,0x9d9974,0x9e9b71,0xa9a77a,0xaeab7e,0xb7b586,0xbdbb8c,0xc0bd8e,0xc0bd8c,0xbdbb89,0xc1bf8d,0xc0bd8d,0xbebc90,0xc1bd97,0xbdb99a,0xc1bca6,0x858074,0x130f09,0x000000,0x000001,0x04010b,0x000617,0x00263e,0x44a5c3,0x0db1d3,0x00c0ec,0x00bff9,0x00bfff,0x00beff,0x00bdff,0x00bfff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00bcff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x0db8f0,0x1987bb,0x00193e,0x000310,0x0b0000,0x3f3326,0x605441,0x68553f,0x6b533b,0x6a5237,0x6a5236,0x6a5236,0x6a5236,0x695237,0x685236,0x665336,0x665335,0x665336,0x665336,0x665337,0x665337,0x665337,0x655337,0x655336,0x645435,0x645433,0x635435,0x5f5036,0x53442f,0x493928,0x39291a,0x27170a,0x170700,0x110100,0x0e0000,0x130500,0x120500,0x0d0200,0x100500,0x0e0300,0x0e0300,0x0c0200,0x0a0000,0x080000,0x040000,0x0a0100,0x100800,0x0b0400,0x0a0400,0x070200,0x060100,0x120c02,0x191206,0x241b0d,0x413728,0x534839,0x514739,0x5d5447,0x595247,0x453f36,0x181209,0x070000,0x070000,0x1b1105,0x615649,0x625648,0x4e4234,0x2b2013,0x0c0400,0x070200,0x060200,0x040100,0x040100,0x000000,0x010000,0x0a0303,0x0b0404,0x070000,0x090200,0x090401,0x0a0604,0x070603,0x040401,0x030200,0x050301,0x070303,0x080204,0x090207,0x090107,0x090106,0x090205,0x080204,0x070204,0x060303,0x020000,0x020000,0x080506,0x050303,0x060405,0x060405,0x050303,0x050302,0x040200,0x040200,0x040200,0x040200,0x050301,0x060404,0x060406,0x050306,0x040205,0x040204,0x040204,0x040105,0x040204,0x040202,0x040202,0x050306,0x060408,0x050307,0x040106,0x030005,0x09060a,0x2c292b,0x3c3a3a,0x242320,0x0a0a05,0x050500,0x000000,0x040100,0x040000,0x040000,0x443e34,0x9a9589,0xa9a495,0xa7a28e,0xaeaa92,0xb9b499,0xb7b395,0xb9b594,0xbab692,0xbbb88f,0xbdba8f,0xbdbb8e,0xbebc8e,0xc0bd90,0xbebc8f,0xbcb98c,0xbcb98c,0xc3c094,0xc4c198,0xc1bd9a,0xb5b195,0x746f5b,0x534e41,0x140e09,0x0c0707,0x000000,0x000000,0x02000b,0x000415,0x002d45,0x3da0bf,0x0fbde5,0x00c4f8,0x00c0ff,0x00bfff,0x00beff,0x00bfff,0x00c0ff,0x00c0ff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00baff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,
+0x19b6eb,0x12628d,0x000622,0x02030a,0x0d0000,0x504134,0x675542,0x69533c,0x6a5237,0x6a5235,0x6a5234,0x6a5234,0x6a5234,0x685235,0x675336,0x675335,0x665336,0x665336,0x665337,0x665337,0x665337,0x665337,0x665337,0x665337,0x665336,0x655336,0x655336,0x645338,0x65543b,0x685640,0x685642,0x63513e,0x574632,0x453320,0x1e0d00,0x1c0d00,0x110400,0x090000,0x150b00,0x0f0500,0x0f0500,0x0c0200,0x0b0100,0x0c0200,0x0f0400,0x0d0300,0x0d0300,0x0d0500,0x0b0400,0x0a0400,0x2f291f,0x514a3e,0x5b5344,0x605543,0x5e533f,0x5d523d,0x5d533f,0x5b5240,0x575041,0x3f3a2d,0x130e02,0x060000,0x050000,0x2c2212,0x5d503f,0x645642,0x5e503c,0x554835,0x2d2211,0x0c0500,0x070200,0x020000,0x1b1712,0x47413e,0x211b19,0x030000,0x090200,0x0f0800,0x0d0700,0x090400,0x060300,0x050400,0x050400,0x070600,0x020000,0x030000,0x080103,0x090005,0x0a0107,0x0a0107,0x090107,0x080205,0x070205,0x070405,0x040202,0x010000,0x040202,0x020000,0x030101,0x030101,0x040202,0x040202,0x050302,0x040200,0x030100,0x030100,0x020000,0x020000,0x030100,0x050303,0x050303,0x030101,0x030102,0x040203,0x030003,0x050306,0x040106,0x030004,0x040105,0x050307,0x050208,0x040106,0x080509,0x201e20,0x423f40,0x434140,0x23221f,0x050300,0x030100,0x040100,0x090400,0x0a0400,0x221d12,0x5c564b,0x6e685c,0x393322,0x4c4733,0x97927b,0xc0bba1,0xc5c1a4,0xc4c0a0,0xc0bc98,0xbdba93,0xbbb88f,0xbab78d,0xc2bf97,0xc5c29c,0xc0bc98,0xbdba96,0xc7c3a0,0xa7a384,0x5d5840,0x262110,0x000000,0x000000,0x070000,0x0a0504,0x010000,0x111011,0x14141b,0x00000b,0x000216,0x004766,0x1db3e2,0x02c1fe,0x00bdff,0x00bcff,0x00bdff,0x00bdff,0x00bfff,0x00bfff,0x00bfff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00baff,0x00baff,0x00b9ff,0x00b7ff,0x00b7ff,0x00b6ff,0x00b7ff,0x00b9ff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bdff,
+0x23aedd,0x002d4e,0x00071a,0x040205,0x150a02,0x5a493b,0x685340,0x6a513a,0x6b5236,0x6a5234,0x6a5232,0x6a5232,0x695233,0x685334,0x675335,0x675336,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x665337,0x665337,0x665338,0x66533a,0x66533a,0x6a573f,0x705d45,0x68553d,0x5c4b33,0x5d4d38,0x3f321d,0x382e1a,0x443b28,0x3f3523,0x3d3323,0x352b1d,0x32271c,0x32271d,0x2e241a,0x1a1006,0x120800,0x100700,0x0b0400,0x070100,0x373025,0x5c5447,0x574e3f,0x5a4f3d,0x5d523d,0x5f533e,0x5e533e,0x5d5442,0x57503f,0x201c0d,0x010000,0x060000,0x020000,0x3a2f1d,0x625540,0x605039,0x5d4c34,0x5f5039,0x4a3e2a,0x150c00,0x060000,0x090400,0x0b0600,0x4e4742,0x443d38,0x000000,0x1a1305,0x6e6749,0x635d3a,0x484325,0x3d391d,0x211d02,0x100d00,0x201d03,0x050100,0x000000,0x020000,0x070001,0x0a0005,0x0b0104,0x0a0203,0x070102,0x050102,0x070404,0x0d0b0a,0x1f1d1c,0x22201f,0x272524,0x282625,0x201e1d,0x161313,0x171414,0x131110,0x110f0c,0x0c0a07,0x0b0905,0x090703,0x060500,0x080601,0x16140e,0x1d1b15,0x191712,0x1a1815,0x0a0805,0x030100,0x050306,0x040105,0x0d0b0d,0x100d0f,0x050305,0x050305,0x040204,0x050305,0x090608,0x2f2d2d,0x42403e,0x252320,0x050300,0x030100,0x030000,0x000000,0x040000,0x060000,0x0e0700,0x0f0900,0x080200,0x0b0600,0x1a1505,0x443f2d,0xb7b39e,0xbab59d,0xc4c0a6,0xd1cdb0,0xccc8aa,0xc8c4a6,0xb6b296,0x9a967c,0x938f77,0x817c65,0x56513b,0x241f0b,0x0b0600,0x050000,0x070000,0x090200,0x090200,0x060000,0x140e09,0x504b47,0x393636,0x000106,0x000512,0x00203b,0x148fbd,0x17bffc,0x00bbff,0x00bbff,0x00bdff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00beff,0x00beff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00baff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bdff,
+0x2ba1c9,0x012d43,0x01030c,0x070202,0x2e221a,0x665345,0x69513e,0x6b513a,0x6b5136,0x6a5233,0x695231,0x695231,0x695332,0x675334,0x675336,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x665337,0x665338,0x685439,0x685439,0x685439,0x685439,0x685439,0x69563d,0x6a5a42,0x685b44,0x5d523c,0x5d533e,0x5d533f,0x605744,0x615747,0x685e50,0x564b40,0x2c2117,0x190f04,0x120800,0x120900,0x0b0400,0x070100,0x1f190d,0x473f33,0x5d5447,0x665b4d,0x625647,0x5d5142,0x5b5040,0x534a3a,0x373121,0x100c00,0x090500,0x090300,0x0e0700,0x4d412e,0x675842,0x5f4d34,0x5d4b31,0x605038,0x5d4f3b,0x4b4032,0x140c02,0x050000,0x010000,0x090100,0x251d14,0x0c0400,0x4c4425,0xafa973,0xa7a262,0xa6a064,0xa9a268,0x958e56,0x8b844c,0x928b53,0x766e3e,0x615837,0x261c0b,0x0f0403,0x080001,0x0b0200,0x0a0200,0x040000,0x040000,0x070401,0x0c0a07,0x191714,0x1d1b17,0x201e1b,0x211f1c,0x1f1d1a,0x171512,0x1b1916,0x292723,0x43413b,0x605e57,0x706f68,0x7d7c74,0x7e7d73,0x7f7e72,0x888778,0x838273,0x868577,0x868579,0x413f37,0x080601,0x030100,0x020000,0x13110f,0x181613,0x050301,0x050301,0x050301,0x040200,0x020000,0x353331,0x43413f,0x161311,0x040200,0x040100,0x080300,0x262019,0x181009,0x020000,0x030000,0x060000,0x080100,0x0a0400,0x120c04,0x080200,0x352f26,0x322c22,0x413b30,0x534e42,0x4e483c,0x454034,0x363026,0x120c03,0x0b0500,0x000000,0x000000,0x030000,0x030000,0x020000,0x0b0500,0x1a1409,0x2f291e,0x352e22,0x504438,0x685d51,0x5f564e,0x1e1c19,0x00060c,0x001225,0x005379,0x2bb7ed,0x04bbfd,0x00beff,0x00bdff,0x00bdff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00baff,0x00baff,0x00bbff,0x00bbff,0x00bbff,
+0x0f7195,0x000717,0x040204,0x0e0704,0x43362d,0x6a5748,0x69513d,0x6b5139,0x6b5235,0x695232,0x695331,0x695331,0x685332,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x665338,0x665338,0x67543a,0x68563d,0x685941,0x6b5e48,0x635943,0x5f5640,0x5b513c,0x5e533f,0x5e5341,0x5f5444,0x22170a,0x0e0300,0x0d0200,0x271d11,0x150c00,0x0b0300,0x070100,0x0d0600,0x1f180c,0x4d4438,0x605549,0x5b4f43,0x52463a,0x372c1f,0x1e1507,0x100900,0x070100,0x040000,0x0d0700,0x3d3421,0x665a45,0x66563e,0x624f35,0x614e34,0x615037,0x5f503b,0x645748,0x43392d,0x231b11,0x000000,0x020000,0x0c0200,0x0c0300,0x5f5734,0xada769,0xa09b4e,0xa0994d,0xa1994e,0xa2984f,0xa3984f,0xa3984f,0xa19656,0x9a8f61,0x81765c,0x362a26,0x030000,0x271e11,0x191201,0x000000,0x000000,0x090600,0x080600,0x070500,0x070500,0x070400,0x060300,0x070400,0x070400,0x060300,0x080600,0x0d0a02,0x232118,0x27241b,0x423f36,0x605d53,0x636155,0x615f50,0x727061,0x716f61,0x78766a,0x69665e,0x2e2b25,0x110e09,0x050200,0x080502,0x0a0703,0x070400,0x060300,0x060300,0x060300,0x060300,0x3c3a37,0x373533,0x0b0907,0x030100,0x040100,0x0a0500,0x463f39,0x4a423b,0x312921,0x100801,0x030000,0x050000,0x070000,0x050000,0x050000,0x080100,0x060000,0x060000,0x060000,0x070000,0x060000,0x040000,0x040000,0x030000,0x080000,0x070000,0x080000,0x080000,0x090200,0x231c0c,0x352e1e,0x504938,0x5c5241,0x665645,0x685747,0x66594b,0x373028,0x070b0c,0x000917,0x002343,0x1c94c3,0x05b6f4,0x00beff,0x00bdff,0x00bdff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bdff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00b9ff,0x00b8ff,0x00b6ff,0x00b6ff,0x00b8ff,0x00b8ff,0x00baff,0x00bbff,0x00baff,
+0x005173,0x00000b,0x050001,0x1d1310,0x514239,0x685444,0x68523c,0x6a5238,0x6a5234,0x695232,0x695331,0x695331,0x685332,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x655338,0x655338,0x64533a,0x64533b,0x65543e,0x62533e,0x322511,0x312713,0x584d39,0x60543f,0x5f533e,0x5f523f,0x5e5140,0x201304,0x1c1001,0x44392a,0x625749,0x382d20,0x0c0200,0x080000,0x070000,0x0b0300,0x150c00,0x22180d,0x1c1106,0x190e02,0x0d0200,0x040000,0x060000,0x050000,0x070000,0x392f1c,0x5c503c,0x61523d,0x62513a,0x624f35,0x645036,0x624f37,0x604f3a,0x605241,0x605346,0x4f4337,0x150a00,0x100400,0x0d0200,0x160b00,0x5d5438,0xa49e64,0x9e984e,0xa1994b,0xa39849,0xa5984a,0xa5984b,0xa5984b,0xa39753,0xa59a68,0x867a5c,0x1e120a,0x0f0400,0x736a54,0x867e62,0x413b21,0x0e0900,0x050100,0x060200,0x060200,0x060200,0x080300,0x080300,0x080300,0x070200,0x070200,0x080300,0x070200,0x060100,0x000000,0x080300,0x070200,0x060000,0x060000,0x070200,0x090400,0x090400,0x0e0805,0x110c09,0x090402,0x060000,0x040000,0x080300,0x060100,0x070200,0x070100,0x090304,0x080403,0x363331,0x23201e,0x040200,0x030100,0x040100,0x0a0500,0x4c453f,0x655d56,0x5c544c,0x4a413a,0x342c26,0x17100d,0x0c0604,0x040000,0x060000,0x050000,0x060000,0x070000,0x070000,0x080000,0x070000,0x080000,0x020000,0x050000,0x1c1105,0x3a2f23,0x3f3426,0x413727,0x4c412f,0x564c38,0x5a503b,0x5c523d,0x625540,0x66543f,0x675340,0x645444,0x534940,0x181a1a,0x00030f,0x000622,0x0f79a5,0x12bffb,0x00bdff,0x00bfff,0x00beff,0x00bdff,0x00bcff,0x00bdff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00b9ff,0x00b6ff,0x00b6ff,0x00b8ff,0x00b8ff,0x00baff,0x00bbff,0x00b9ff,
+0x0d5171,0x000008,0x000000,0x2d211c,0x5a4a3f,0x675542,0x67523a,0x695236,0x695234,0x695332,0x695331,0x695331,0x685332,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x655337,0x645337,0x635439,0x62543b,0x61523d,0x3c2d1a,0x150600,0x070000,0x0e0200,0x3e321f,0x685945,0x62523d,0x62523d,0x625340,0x5a4c3a,0x5a4c3c,0x625444,0x5e5141,0x5b5041,0x33291a,0x140b00,0x070000,0x0a0100,0x070000,0x0b0100,0x070000,0x0c0200,0x050000,0x0c0100,0x0c0100,0x2a1e0b,0x493d28,0x625540,0x63553f,0x65543e,0x64523a,0x634f35,0x645036,0x645038,0x63503b,0x61503e,0x605040,0x625344,0x4a3c2e,0x1e0f04,0x0d0000,0x090000,0x2b210c,0xaaa372,0xb5ad69,0xa79d4f,0xa49846,0xa89948,0xa89948,0xa69847,0xa5974f,0xada16b,0x716544,0x050000,0x21170e,0x80775a,0xa69e76,0xa49c73,0x7b754b,0x443e14,0x423d14,0x423d15,0x3f391a,0x090200,0x090100,0x100900,0x1b1502,0x1c1605,0x140e00,0x140e00,0x0a0300,0x090200,0x100900,0x0a0300,0x040000,0x0c0401,0x060000,0x090100,0x050000,0x000000,0x000000,0x090200,0x070000,0x090200,0x0d0600,0x352e1f,0x2f281d,0x070000,0x090205,0x080202,0x3f3b39,0x1c1917,0x040200,0x040200,0x040100,0x060000,0x140d07,0x403831,0x554d45,0x5a514a,0x5e5650,0x48413f,0x130b0a,0x050000,0x070000,0x0f0700,0x30261b,0x291e12,0x2b1f12,0x2d2013,0x2f2114,0x2f2114,0x382a1c,0x4b3d2c,0x594b38,0x665844,0x675945,0x675944,0x665842,0x64563f,0x63553d,0x61543c,0x63533b,0x67523a,0x68523c,0x64513f,0x5b5045,0x1d1d1b,0x000005,0x000218,0x0a6c93,0x0eb7f2,0x00beff,0x00beff,0x00beff,0x00beff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00bcff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00baff,0x00b8ff,0x00b6ff,0x00b6ff,0x00b8ff,0x00baff,0x00baff,0x00baff,0x00b9ff,
+0x001f3d,0x00000a,0x060000,0x2e201b,0x5f4e40,0x66543e,0x665338,0x675335,0x685333,0x685332,0x695331,0x695331,0x685332,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x655336,0x635437,0x615438,0x5f533b,0x493c2a,0x0f0200,0x070000,0x0d0100,0x0d0100,0x372918,0x6b5a46,0x64513c,0x64513c,0x64513c,0x62523d,0x61523e,0x61523f,0x605240,0x5e5140,0x524737,0x362b1c,0x170d00,0x0e0400,0x0c0300,0x0b0300,0x060000,0x040000,0x050000,0x1b1000,0x342813,0x5b4c36,0x605038,0x62523a,0x65543c,0x68553d,0x655139,0x634f36,0x634f36,0x634f37,0x64503a,0x63503c,0x63503d,0x63503d,0x614f3e,0x483629,0x130300,0x110300,0x0b0000,0x6e653f,0xc6bd82,0xc8be71,0xbeb25d,0xb5a651,0xaf9f49,0xaa9b46,0xa5984c,0xada169,0x635734,0x090000,0x211608,0x857c57,0x9d9560,0xa1995b,0xa19958,0x989150,0x979151,0x979153,0xa09869,0x443927,0x070000,0x221903,0x776f53,0x857d61,0x5b5337,0x645c42,0x2d250d,0x292009,0x100800,0x060000,0x0c0200,0x0f0500,0x0f0500,0x0c0200,0x090000,0x030000,0x020000,0x0e0600,0x110a00,0x0f0800,0x413a19,0xaba485,0x6b634e,0x080000,0x0b0106,0x090202,0x423d3a,0x1c1917,0x040200,0x040200,0x040100,0x060000,0x000000,0x0f0700,0x312921,0x595049,0x5a514c,0x251d1a,0x070000,0x090100,0x0e0600,0x1a1103,0x574d3b,0x5b4f3b,0x5e503c,0x62523e,0x655440,0x65543f,0x65543e,0x65533b,0x67553d,0x66543b,0x66543b,0x66543b,0x655339,0x655339,0x645238,0x645238,0x665338,0x685136,0x675138,0x63503c,0x5c5144,0x252621,0x000003,0x000010,0x076789,0x0db5ee,0x00beff,0x00beff,0x00beff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00b9ff,0x00bbff,0x00bbff,0x00b9ff,0x00baff,0x00b9ff,0x00baff,0x00bbff,0x00baff,0x00b9ff,0x00b9ff,0x00b8ff,0x00b6ff,0x00b7ff,0x00b8ff,0x00baff,0x00baff,0x00baff,0x00baff,
+0x00102c,0x000008,0x050000,0x34251f,0x604f40,0x65533b,0x665336,0x665334,0x675332,0x685331,0x695331,0x695331,0x685332,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x665337,0x655537,0x645538,0x5f5338,0x584c35,0x1a0e00,0x0a0000,0x0e0200,0x100300,0x2f2214,0x5d4e3e,0x65523f,0x66513c,0x66513b,0x65513b,0x63523c,0x62523d,0x62523d,0x61523e,0x60523e,0x5e513e,0x605440,0x564b37,0x413622,0x1f1401,0x1b1100,0x2a200c,0x312713,0x3d321e,0x60543f,0x675842,0x66553d,0x66543b,0x655339,0x67543b,0x68543b,0x675239,0x634f36,0x655037,0x655038,0x655039,0x65503b,0x65503b,0x67523e,0x6a5543,0x6d5949,0x402e23,0x070000,0x0a0000,0x0b0000,0x695e31,0xd9ce8a,0xe1d584,0xd7c773,0xd0bf68,0xc2b35b,0xb5a759,0xb0a36a,0x483d18,0x0b0000,0x1d1302,0x877e54,0x9e9558,0xa29a4f,0xa39b4b,0xa49d4e,0xa39d4f,0xa39c51,0xaba36b,0x4d412e,0x020000,0x31280b,0x9d956d,0xa7a073,0xa0996a,0xa0996b,0x979063,0x989165,0x877f56,0x79714b,0x82795d,0x5f5546,0x080000,0x1d1301,0x483f22,0x7b7447,0x7a733e,0x7a743a,0xbab479,0xc1bb80,0xd0ca92,0xdad4a2,0x595130,0x000000,0x0e0309,0x0a0203,0x413b3a,0x1d1918,0x050200,0x050200,0x090503,0x060000,0x090200,0x080000,0x010000,0x170f08,0x0f0701,0x020000,0x070000,0x000000,0x110800,0x413726,0x5e533e,0x5e5039,0x605139,0x625139,0x645239,0x65533a,0x67543a,0x685439,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x665136,0x655035,0x655034,0x675033,0x655037,0x5c5040,0x5c584f,0x363a37,0x000408,0x000210,0x0a6988,0x0eb6ee,0x00bfff,0x00beff,0x00bcff,0x00bbff,0x00bbff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00baff,0x00baff,0x00baff,0x00b9ff,0x00b9ff,0x00b8ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00baff,0x00baff,0x00bbff,
+0x001733,0x00000b,0x060000,0x3d2e28,0x615042,0x63523a,0x665336,0x665334,0x675332,0x685331,0x695331,0x695332,0x685333,0x675334,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675336,0x675336,0x634f33,0x624f34,0x675639,0x67593c,0x62553b,0x362a14,0x0d0100,0x0c0000,0x0c0000,0x302317,0x574a3c,0x615241,0x64513d,0x66513b,0x66513a,0x65513b,0x63523c,0x62523c,0x62523c,0x62523b,0x60533b,0x60533a,0x5f533a,0x5f5339,0x5f5238,0x5f5037,0x5e4f36,0x5f5037,0x605138,0x615138,0x62523a,0x635239,0x645239,0x645238,0x655339,0x665339,0x665339,0x665138,0x655037,0x655037,0x655037,0x66513a,0x66513c,0x66513c,0x66513c,0x65513d,0x675340,0x5a493a,0x22140a,0x0d0000,0x0f0300,0x160a00,0xbbaf7b,0xddcf8a,0xd0c070,0xddcc76,0xe3d37c,0xdbcd7f,0xdacd94,0x514622,0x0a0000,0x1d1302,0x948b5e,0xa8a05f,0xa59c4d,0xa09843,0x9f9845,0x9f9847,0xa19b4b,0xa9a167,0x4c4030,0x0f0300,0x241b00,0x8a844d,0xa39d5a,0xa6a158,0xa8a459,0xaba65b,0xb5b166,0xc6c179,0xc8c380,0xc9c28e,0x999075,0x070000,0x362e0c,0xbdb782,0xd0cc80,0xcbc870,0xcac76e,0xceca71,0xceca71,0xd3d07c,0xd3cf88,0x7f7748,0x0a0000,0x0c0105,0x0d0308,0x342d30,0x1a1516,0x040000,0x020000,0x211c1a,0x16110c,0x030000,0x070000,0x0b0200,0x0b0200,0x0b0200,0x060000,0x040000,0x070000,0x382e26,0x564c3b,0x5e523c,0x5e5039,0x615139,0x66543b,0x66543b,0x66543b,0x665339,0x665338,0x675337,0x675337,0x675337,0x675337,0x665136,0x665136,0x655035,0x655035,0x655034,0x675033,0x61513b,0x51524b,0x576061,0x354042,0x00030a,0x00010f,0x127290,0x11b8f1,0x00bfff,0x00beff,0x00bcff,0x00bbff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00baff,0x00baff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b8ff,0x00b8ff,0x00b8ff,0x00baff,0x00baff,0x00bcff,
+0x001734,0x00000a,0x070000,0x3f3129,0x635142,0x625039,0x665336,0x665334,0x675333,0x685332,0x695332,0x695233,0x685234,0x675335,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675336,0x675335,0x675335,0x655035,0x604d32,0x59482d,0x615239,0x645740,0x372b17,0x0e0200,0x281b0f,0x3e3125,0x675a4d,0x655747,0x60513e,0x64513c,0x65513a,0x65513a,0x64513a,0x63523b,0x62523b,0x62523a,0x625239,0x615338,0x605337,0x605336,0x605336,0x625336,0x635236,0x645236,0x645236,0x655236,0x655236,0x645237,0x645238,0x645238,0x645238,0x645238,0x655238,0x655138,0x665138,0x655037,0x655037,0x655037,0x665139,0x66513a,0x66513c,0x66513c,0x65513c,0x64513b,0x63523e,0x544637,0x1f1207,0x0c0000,0x0e0100,0x463913,0xa09159,0xd9c980,0xdac977,0xd9ca73,0xd6c87b,0xcdc08a,0x3b2f10,0x050000,0x251b0c,0xb8af80,0xd1c983,0xd3cb78,0xd1ca70,0xcac46c,0xc3bd67,0xbeb865,0xc4bc80,0x463a2a,0x080000,0x423a11,0xb1ab6a,0xc9c573,0xcbc86c,0xcdca6b,0xcecb6b,0xcbc969,0xcecb6e,0xd1ce77,0xd3ce8c,0x958c6b,0x000000,0x211a00,0xb4ae70,0xd6d377,0xcecc61,0xcecc61,0xcecc62,0xcecc62,0xcdca67,0xceca74,0xbcb67a,0x352c14,0x040000,0x0f040a,0x1a1118,0x130c10,0x060001,0x000000,0x36302c,0x564f49,0x251d15,0x100700,0x0b0100,0x0c0200,0x0b0100,0x0b0100,0x090000,0x261d18,0x594f46,0x5b5041,0x5d503c,0x60513a,0x63523a,0x65533a,0x655339,0x655339,0x665339,0x655137,0x665136,0x665136,0x665136,0x665136,0x665136,0x655035,0x655035,0x655035,0x665136,0x685135,0x5e5340,0x485555,0x51676f,0x18282d,0x000006,0x000818,0x096888,0x04abe3,0x00bdff,0x00bbff,0x00baff,0x00b8ff,0x00b8ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b7ff,0x00b8ff,0x00b8ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00bbff,0x00bbff,0x00bbff,0x00bbff,0x00baff,0x00baff,0x00bdff,
+0x001230,0x00020a,0x070000,0x3e3026,0x635142,0x625139,0x665336,0x665334,0x675333,0x685334,0x695234,0x695234,0x685235,0x675336,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675337,0x675336,0x675335,0x675334,0x675335,0x675338,0x48341b,0x281600,0x2f200a,0x4d402b,0x5f5241,0x4c4032,0x574a3e,0x5d5042,0x625445,0x60523f,0x61523d,0x63523b,0x64513a,0x645239,0x645239,0x635239,0x625239,0x635239,0x635238,0x625236,0x625335,0x615335,0x625334,0x635234,0x645234,0x655234,0x665234,0x665134,0x665135,0x665136,0x655137,0x655137,0x655137,0x655137,0x655137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665137,0x665139,0x66513a,0x66513a,0x65513a,0x645238,0x635239,0x5c4f39,0x3f3321,0x110400,0x140600,0x0d0000,0x43330a,0xd5c385,0xd3c275,0xd6c671,0xd6c87d,0xc7ba8b,0x2f220c,0x050000,0x1d1206,0xb0a774,0xd1ca7e,0xd7cf78,0xd7d074,0xd5cf75,0xd2cc74,0xcfca74,0xd3cb8d,0x433724,0x020000,0x5d5626,0xd0cb82,0xd3d074,0xcdcb64,0xcac85f,0xcac95e,0xc9c75d,0xc7c55e,0xc7c465,0xcac57d,0x9a9270,0x080000,0x170f00,0xaca66c,0xd6d375,0xc9c858,0xcecc5d,0xcfce5f,0xcfcd62,0xc7c55e,0xcbc96b,0xc8c37b,0x514924,0x000000,0x12080c,0x150b15,0x12090f,0x090002,0x020000,0x312923,0x5d544a,0x574d40,0x3f3324,0x291d0e,0x1e1103,0x201308,0x2c2018,0x382c27,0x574c46,0x5c5148,0x5b4f41,0x5d503e,0x60513b,0x615139,0x635239,0x645238,0x645238,0x645238,0x655137,0x665136,0x665136,0x665136,0x665136,0x655035,0x655035,0x665136,0x665136,0x665136,0x675136,0x5c5543,0x425b5e,0x4c6e78,0x061c20,0x000004,0x001123,0x2685a7,0x04ade4,0x00b9fd,0x00baff,0x00b8ff,0x00b5ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b6ff,0x00b7ff,0x00b7ff,0x00b9ff,0x00b9ff,0x00b9ff,0x00b8ff,0x00b9ff,0x00bcff,0x00bcff,0x00bcff,0x00bbff,0x00bbff,0x00bcff,0x00bdff,
+};
+const cm::sprite_span spans[] = {
+{18, 2},{21, 4},{34, 1},{36, 2},{69, 1},{72, 4},{82, 35},{138, 5},{176, 1},{18, 8},{34, 4},{73, 5},{80, 38},{140, 3},{171, 1},{19, 5},{26, 1},{35, 3},{73, 47},{139, 4},{170, 8},{19, 8},{36, 2},{53, 1},{73, 52},{138, 7},{170, 11},{19, 7},{53, 1},{73, 52},{140, 7},{172, 8},{18, 8},{27, 2},{37, 1},{53, 2},{68, 58},{141, 6},{170, 10},{12, 2},{18, 14},{35, 1},{37, 2},{52, 3},{66, 47},{114, 11},{142, 1},{171, 9},{12, 2},{18, 7},{27, 7},{35, 1},{49, 5},{66, 50},{117, 2},{120, 6},{130, 4},{141, 2},{169, 2},{172, 1},{174, 9},{0, 1},{13, 2},{18, 7},{28, 6},{35, 1},{39, 1},{49, 5},{67, 16},{88, 36},{128, 20},{176, 8},{0, 2},{13, 3},{19, 7},{28, 6},{35, 1},{39, 1},{47, 9},{68, 82},{152, 1},{170, 1},{177, 8},{0, 3},{14, 3},{19, 15},{35, 1},{47, 10},{68, 61},{130, 25},{169, 4},{174, 1},{177, 8},{1, 4},{14, 4},{19, 15},{35, 4},{42, 1},{45, 13},{68, 90},{163, 12},{180, 6},{190, 2},{3, 3},{13, 21},{37, 3},{41, 2},{45, 12},{66, 96},{163, 2},{166, 9},{180, 6},{191, 1},{4, 31},{37, 6},{46, 11},{64, 6},{71, 88},{161, 4},{168, 7},{179, 7},{187, 2},{6, 30},{37, 20},{63, 6},{70, 90},{162, 3},{168, 8},{179, 6},{187, 4},{0, 1},{5, 52},{63, 102},{167, 3},{175, 3},{179, 8},{188, 4},{0, 2},{5, 52},{62, 80},{143, 27},{178, 14},{0, 1},{5, 52},{60, 83},{144, 27},{174, 2},{177, 7},{187, 3},{0, 1},{6, 52},{60, 85},{146, 39},{189, 1},{0, 2},{6, 52},{60, 122},{191, 1},{6, 52},{59, 122},{6, 177},{5, 180},{1, 2},{5, 180},{3, 185},{3, 186},{191, 1},{3, 187},{0, 1},{3, 189},{0, 1},{3, 189},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{1, 191},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{1, 191},{1, 191},{1, 191},{2, 190},{3, 189},{3, 189},{2, 190},{1, 191},{1, 191},{1, 4},{10, 182},{1, 4},{11, 181},{1, 8},{10, 182},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192},{0, 192}};
+const uint32_t row_spans[] = {
+0,9,15,21,27,32,39,48,61,72,83,93,103,113,122,130,137,142,149,154,158,160,161,162,164,165,167,168,170,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,212,214,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298};
+const cm::sprite_item item = {width, height, data, spans, row_spans, 255, rgb};
 }
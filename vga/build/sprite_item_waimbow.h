@@ -1,39 +1,73 @@
 namespace sprite_waimbow {
 const int width = 251;
 const int height = 32;
-const cm::pixel data[] = {
-{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},
-{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},
-{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 0},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 1, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{0, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},{1, 0, 1},
-{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},
-{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 0, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{2, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{1, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 0},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 1},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 2, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 1, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{0, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{1, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},{2, 0, 2},
-{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},
-{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 1, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},
-{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},
-{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 0, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 1, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 2, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{3, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{2, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{1, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 0},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 1},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 2},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 3, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 2, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{0, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{1, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},{2, 0, 3},
-{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{2, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 2},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},{2, 0, 4},
-{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},
-{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},
-{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},
-{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 0, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 1, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 2, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 3, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{4, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{3, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{1, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 0},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 1},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 3},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 4, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 2, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{0, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{1, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},{3, 0, 4},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 3, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 2, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{0, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{2, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 0, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 2},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 3},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 5, 5},{0, 2, 5},{1, 3, 5},{1, 3, 5},{1, 3, 5},{1, 2, 5},{1, 3, 5},{1, 3, 5},{1, 3, 5},{1, 3, 5},{1, 3, 5},{1, 2, 5},{1, 3, 5},{1, 2, 5},{1, 2, 5},{1, 3, 5},{1, 3, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{1, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{2, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 1, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{5, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{3, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{2, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{0, 5, 0},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 2},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 3},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{1, 5, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 2, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 0},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{5, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{3, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{2, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{1, 5, 1},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 3, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{2, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{3, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 2, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},
-{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 0, 0},{5, 1, 0},{5, 1, 0},{5, 1, 0},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 3, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 1},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 3},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 4},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{2, 5, 5},{3, 5, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},
-{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 1, 1},{5, 2, 1},{5, 2, 1},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{5, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{4, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{2, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 2},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 4, 5},{3, 3, 5},{3, 4, 5},{3, 4, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},
-{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 2},{5, 4, 3},{5, 4, 2},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 5, 3},{5, 5, 2},{5, 5, 2},{5, 5, 3},{5, 5, 2},{5, 5, 2},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},{4, 3, 5},
-{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 2, 2},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 2},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 2},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 4, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{3, 3, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 3, 5},{3, 3, 5},{3, 3, 5},{4, 4, 5},{4, 4, 5},{4, 3, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},
-{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 3},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{3, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{3, 5, 4},{4, 5, 4},{3, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},
-{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{5, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 4},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 3},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},
-{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 3, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 4},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 3},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},
-{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 4},{4, 5, 5},{4, 5, 4},{4, 5, 5},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},
-{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{5, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{5, 4, 5},{5, 4, 5},{5, 4, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 4, 4},{5, 5, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 4, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 4},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
-{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
+const uint8_t data[] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+108,108,108,108,108,108,108,108,108,108,108,108,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+108,108,108,108,108,108,108,108,108,108,108,108,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+108,108,108,108,108,108,108,108,108,108,108,108,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+108,108,108,108,108,108,108,108,108,108,108,108,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+144,144,144,144,144,144,144,144,144,144,144,144,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+144,144,144,144,144,144,144,144,144,144,144,144,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+144,144,144,144,144,144,144,144,144,144,144,144,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+144,144,144,144,144,144,144,144,144,144,144,144,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+144,144,144,144,144,144,144,144,144,144,144,144,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,113,113,113,113,113,113,113,113,113,113,113,119,119,119,119,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,17,59,59,59,53,59,59,59,59,59,53,59,53,53,59,59,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,119,119,119,119,119,119,119,119,119,119,125,125,125,125,125,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,204,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,30,30,30,30,30,30,30,67,67,67,67,67,67,67,67,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,125,125,125,125,125,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,192,204,204,204,204,204,204,204,204,204,204,204,204,204,205,205,205,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,67,67,67,67,67,67,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,161,161,161,161,161,161,161,161,167,167,167,167,167,167,167,
+180,180,180,180,180,180,180,180,180,180,180,180,186,186,186,187,187,187,187,187,187,187,187,187,187,187,187,187,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,205,205,205,205,205,205,205,205,205,205,205,205,206,206,206,206,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,104,104,104,104,104,104,104,140,140,140,140,140,140,140,140,140,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,143,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
+187,187,187,187,187,187,187,187,187,187,187,187,193,193,194,194,194,194,194,194,194,194,194,194,194,194,194,194,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,104,104,104,104,140,140,141,141,141,140,140,140,140,140,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,131,131,131,131,131,131,131,131,131,131,131,131,137,131,137,137,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
+194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,200,206,206,206,206,206,206,206,206,206,206,207,206,207,207,207,207,213,212,212,213,212,212,213,213,213,213,213,213,213,213,213,213,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
+194,194,194,194,194,194,194,194,194,194,194,194,201,201,201,201,200,200,200,200,201,201,201,201,200,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,131,131,131,131,131,131,131,131,173,173,173,173,167,131,131,173,173,167,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,
+201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,207,207,201,201,201,201,201,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,141,141,141,177,177,177,177,177,177,177,177,177,177,177,177,177,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,142,142,142,142,142,142,142,142,142,142,142,142,142,142,178,178,178,178,178,178,178,178,142,178,142,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,
+201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,177,177,177,177,177,177,177,177,177,177,177,178,177,177,177,177,177,177,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,
+201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,207,207,207,207,207,207,207,207,207,207,207,207,207,207,208,207,207,207,207,207,207,207,207,207,207,207,207,207,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,179,178,179,178,179,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,214,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,209,209,209,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,208,208,208,214,214,208,214,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
 };
-const cm::sprite_item item = {width, height, data};
+const uint32_t rgb[] = {
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000100,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000001,0x000000,0x000000,0x000000,0x000100,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x010000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,0x000000,
+0x460000,0x470000,0x470000,0x470000,0x470000,0x470000,0x480000,0x470000,0x480000,0x480000,0x470000,0x470000,0x480b00,0x470a00,0x480b00,0x480b00,0x470b00,0x460b00,0x480a00,0x470b00,0x460a00,0x460a00,0x470a00,0x470b00,0x470a00,0x480b00,0x460a00,0x480b00,0x481f00,0x481f00,0x461e00,0x461e00,0x471f00,0x461e00,0x461e00,0x471f00,0x471f00,0x471f00,0x461e00,0x461e00,0x461e00,0x471f00,0x471f00,0x471f00,0x461e00,0x471e00,0x471f00,0x481f00,0x481f00,0x481f00,0x481f00,0x481f00,0x461e00,0x481f00,0x471f00,0x481f00,0x471f00,0x461e00,0x481f00,0x481f00,0x483300,0x483400,0x473300,0x473300,0x483400,0x473300,0x483300,0x483300,0x473300,0x483400,0x483300,0x473300,0x473300,0x483400,0x483300,0x463200,0x464600,0x484700,0x474700,0x464600,0x474700,0x484800,0x474700,0x474700,0x484800,0x484800,0x474700,0x474700,0x464600,0x474700,0x484800,0x484800,0x2c4800,0x2c4700,0x2c4700,0x2b4700,0x2c4700,0x2c4800,0x2c4800,0x2c4800,0x2b4600,0x2b4700,0x2b4700,0x2b4600,0x2c4800,0x2c4800,0x2c4700,0x2b4700,0x124700,0x124800,0x124700,0x124700,0x124800,0x124800,0x124700,0x124800,0x124700,0x124600,0x124800,0x124700,0x124800,0x124800,0x124800,0x124600,0x004700,0x004700,0x004600,0x004800,0x004800,0x004800,0x004800,0x004800,0x004700,0x004700,0x004800,0x004700,0x004600,0x004600,0x004700,0x004700,0x004812,0x004812,0x004712,0x004812,0x004812,0x004812,0x004812,0x004812,0x004612,0x004812,0x004712,0x004812,0x004712,0x004712,0x004712,0x004612,0x00482c,0x00472b,0x00482c,0x00472b,0x00472b,0x00482c,0x00482c,0x00472b,0x00482c,0x00482c,0x00472b,0x00472c,0x00472c,0x00472b,0x00472c,0x00472b,0x004848,0x004747,0x004747,0x004646,0x004646,0x004848,0x004747,0x004747,0x004646,0x004747,0x004848,0x004848,0x004848,0x004646,0x004748,0x004747,0x001f48,0x001f46,0x001f47,0x001f47,0x001f47,0x002048,0x001f48,0x001f48,0x001f48,0x001f46,0x001f47,0x001f48,0x001f47,0x001f47,0x001e46,0x001f48,0x000048,0x000048,0x000046,0x000047,0x000047,0x000046,0x000048,0x000047,0x000047,0x000047,0x000047,0x000048,0x000048,0x000047,0x000047,0x000047,0x120046,0x120047,0x120047,0x130048,0x120046,0x120047,0x120048,0x120047,0x120046,0x120047,0x130048,0x120046,0x130048,0x120047,0x120048,0x120048,0x2c0047,0x2b0046,0x2c0048,0x2b0046,0x2b0046,0x2c0048,0x2c0047,0x2c0048,0x2c0047,0x2b0047,0x2c0047,0x2c0048,0x2b0047,0x2c0048,0x2b0046,
+0x640000,0x630000,0x630000,0x640000,0x630000,0x640000,0x640000,0x630000,0x630000,0x630000,0x650000,0x630000,0x641300,0x631200,0x641300,0x631300,0x631300,0x641300,0x641300,0x641200,0x641300,0x641300,0x641300,0x641300,0x641300,0x641300,0x641200,0x631200,0x642e00,0x642e00,0x642e00,0x632d00,0x642e00,0x642e00,0x632d00,0x642e00,0x642e00,0x642e00,0x642e00,0x642e00,0x632d00,0x642e00,0x642e00,0x642e00,0x632e00,0x642e00,0x632d00,0x632d00,0x632d00,0x642e00,0x642e00,0x642e00,0x632d00,0x642e00,0x642e00,0x642e00,0x642d00,0x632d00,0x642e00,0x642e00,0x634800,0x644900,0x634800,0x634800,0x634800,0x634800,0x644900,0x644900,0x634800,0x644900,0x644900,0x634800,0x644900,0x644900,0x634800,0x634800,0x646400,0x636300,0x646400,0x646400,0x646400,0x646400,0x646400,0x646400,0x656400,0x646400,0x656500,0x656500,0x646400,0x636300,0x646400,0x646400,0x3f6400,0x3f6400,0x3f6500,0x3f6300,0x3f6300,0x3f6400,0x3f6400,0x3f6400,0x3f6400,0x3f6400,0x3f6400,0x3f6400,0x3f6300,0x3f6400,0x3f6400,0x3f6500,0x1d6300,0x1d6400,0x1d6400,0x1d6400,0x1d6400,0x1d6500,0x1d6300,0x1d6400,0x1d6400,0x1d6300,0x1d6400,0x1d6300,0x1d6400,0x1d6400,0x1d6400,0x1d6400,0x006400,0x006400,0x006300,0x006400,0x006300,0x006400,0x006400,0x006400,0x006400,0x006300,0x006300,0x006400,0x006400,0x006400,0x006400,0x006300,0x00631d,0x00641d,0x00641d,0x00641d,0x00631d,0x00651d,0x00651d,0x00641d,0x00641d,0x00641d,0x00641d,0x00631c,0x00641d,0x00641d,0x00641d,0x00631d,0x00653f,0x00643f,0x00643f,0x00633f,0x00653f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x00643f,0x006464,0x006464,0x006363,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006464,0x006565,0x002e63,0x002e63,0x002e64,0x002e64,0x002e63,0x002e64,0x002e63,0x002e64,0x002e65,0x002e64,0x002e64,0x002e64,0x002e64,0x002e64,0x002e64,0x002f64,0x000064,0x000064,0x000065,0x000064,0x000065,0x000064,0x000063,0x000063,0x000063,0x000063,0x000064,0x000064,0x000064,0x000063,0x000063,0x000065,0x1c0063,0x1d0065,0x1d0064,0x1d0064,0x1d0064,0x1d0063,0x1c0063,0x1d0064,0x1d0064,0x1d0063,0x1d0064,0x1d0064,0x1c0063,0x1d0064,0x1d0063,0x1d0064,0x3f0063,0x3f0064,0x3f0063,0x3f0063,0x3f0064,0x3f0064,0x3f0064,0x3f0064,0x400065,0x3f0063,0x3f0064,0x3f0063,0x3f0064,0x3f0064,0x3f0064,
+0x790000,0x780000,0x790000,0x790000,0x790000,0x790000,0x780000,0x780000,0x790000,0x790000,0x780000,0x780000,0x791900,0x791900,0x781800,0x791900,0x791900,0x791900,0x791900,0x781900,0x791900,0x791900,0x781800,0x791900,0x781900,0x791800,0x781800,0x791900,0x793900,0x783900,0x783800,0x793900,0x793900,0x793900,0x793900,0x793900,0x783800,0x793900,0x793900,0x793900,0x783800,0x783800,0x793900,0x793900,0x783800,0x793900,0x783800,0x783800,0x793900,0x793900,0x793900,0x793900,0x783800,0x783800,0x793900,0x793900,0x793900,0x793900,0x783900,0x793900,0x795900,0x795900,0x785800,0x795900,0x795900,0x785800,0x795900,0x785800,0x785800,0x795900,0x795900,0x785800,0x795900,0x795900,0x795900,0x795900,0x787800,0x787800,0x797900,0x797900,0x797900,0x797900,0x797900,0x797900,0x797900,0x787800,0x797900,0x797900,0x787800,0x787800,0x787800,0x797900,0x4d7900,0x4d7900,0x4d7900,0x4e7900,0x4d7900,0x4d7800,0x4e7900,0x4d7800,0x4d7900,0x4d7800,0x4d7800,0x4d7900,0x4d7900,0x4e7900,0x4d7900,0x4d7800,0x257900,0x257900,0x257900,0x257800,0x257900,0x257900,0x257900,0x257900,0x257900,0x257900,0x247900,0x257900,0x257900,0x257900,0x257900,0x257900,0x007900,0x007900,0x007800,0x007900,0x007800,0x007800,0x007800,0x007900,0x007900,0x007800,0x007900,0x007800,0x007800,0x007800,0x007900,0x007800,0x007925,0x007925,0x007824,0x007925,0x007925,0x007925,0x007824,0x007925,0x007925,0x007925,0x007825,0x007925,0x007925,0x007925,0x007925,0x007925,0x00794d,0x00794d,0x00784d,0x00794d,0x00794e,0x00794d,0x00784d,0x00794e,0x00794d,0x00794d,0x00794d,0x00794d,0x00794d,0x00794d,0x00794e,0x00794d,0x007979,0x007878,0x007979,0x007979,0x007979,0x007878,0x007878,0x007979,0x007979,0x007979,0x007878,0x007979,0x007979,0x007979,0x007979,0x007979,0x003978,0x003979,0x003979,0x003979,0x003978,0x003979,0x003978,0x003979,0x003978,0x003979,0x003978,0x003979,0x003979,0x003978,0x003979,0x003978,0x000079,0x000078,0x000078,0x000079,0x000079,0x000079,0x000078,0x000079,0x000078,0x000078,0x000079,0x000078,0x000078,0x000079,0x000079,0x000079,0x250079,0x240078,0x250079,0x240078,0x240078,0x250079,0x250079,0x250078,0x250079,0x250079,0x250079,0x240078,0x250079,0x250079,0x250079,0x250079,0x4d0079,0x4d0079,0x4d0079,0x4d0078,0x4e0079,0x4d0078,0x4d0079,0x4d0078,0x4d0078,0x4d0078,0x4d0079,0x4d0079,0x4d0078,0x4e0079,0x4d0079,
+0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a0000,0x8a1e00,0x8a1e00,0x8a1d00,0x8a1d00,0x8a1d00,0x8a1d00,0x8a1d00,0x8a1d00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a1e00,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4100,0x8a4200,0x8a4200,0x8a4100,0x8a4100,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a4200,0x8a6600,0x896500,0x8a6500,0x8a6600,0x8a6500,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a6600,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x8a8a00,0x598a00,0x598a00,0x598a00,0x598a00,0x588900,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x598a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x2b8a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a00,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x00892b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a2b,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a59,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x008a8a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00428a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x00008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x2b008a,0x59008a,0x59008a,0x59008a,0x59008a,0x590089,0x59008a,0x59008a,0x59008a,0x59008a,0x59008a,0x59008a,0x59008a,0x59008a,0x59008a,0x590089,
+0x980000,0x990000,0x990000,0x990000,0x990000,0x990000,0x990000,0x990000,0x980000,0x990000,0x990000,0x990000,0x992200,0x992200,0x992200,0x982200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x992200,0x994900,0x994a00,0x994a00,0x994900,0x994a00,0x994900,0x994a00,0x984900,0x994a00,0x994a00,0x984900,0x994900,0x994a00,0x994900,0x994a00,0x984900,0x994900,0x994900,0x994900,0x994900,0x994900,0x984900,0x994900,0x994a00,0x984900,0x994900,0x994a00,0x994900,0x994900,0x994a00,0x994900,0x994900,0x997100,0x997100,0x987100,0x997100,0x997100,0x997100,0x997100,0x997100,0x997100,0x997100,0x997100,0x997100,0x987100,0x997100,0x997100,0x997100,0x999900,0x999900,0x999900,0x999900,0x989900,0x999900,0x999900,0x999900,0x989800,0x999900,0x999900,0x989800,0x989800,0x999900,0x999900,0x989900,0x639900,0x639900,0x639900,0x639900,0x639900,0x639800,0x639900,0x639900,0x639900,0x639900,0x639800,0x639800,0x639900,0x639900,0x639800,0x639900,0x319900,0x319900,0x319900,0x319900,0x319900,0x319900,0x309800,0x319900,0x319900,0x319900,0x309800,0x319900,0x319900,0x319800,0x319900,0x319900,0x009900,0x009900,0x009900,0x009800,0x009900,0x009900,0x009900,0x009900,0x009800,0x009900,0x009900,0x009900,0x009900,0x009900,0x009900,0x009900,0x009831,0x009831,0x009931,0x009931,0x009931,0x009931,0x009931,0x009931,0x009931,0x009931,0x009931,0x009830,0x009931,0x009931,0x009931,0x009830,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009963,0x009863,0x009963,0x009963,0x009963,0x009999,0x009999,0x009999,0x009999,0x009999,0x009999,0x009999,0x009999,0x009999,0x009898,0x009999,0x009898,0x009999,0x009999,0x009999,0x009999,0x004a99,0x004a99,0x004a99,0x004a99,0x004a99,0x004a99,0x004a99,0x004a99,0x004a98,0x004a99,0x004a98,0x004a99,0x004a99,0x004a98,0x004a99,0x004a99,0x000098,0x000098,0x000099,0x000099,0x000098,0x000099,0x000099,0x000099,0x000098,0x000099,0x000099,0x000099,0x000098,0x000099,0x000099,0x000099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310099,0x310098,0x300098,0x630099,0x630099,0x630099,0x630098,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,0x630099,
+0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa60000,0xa62500,0xa62500,0xa62500,0xa62600,0xa62600,0xa62600,0xa62600,0xa62600,0xa62600,0xa62600,0xa62600,0xa62600,0xa62500,0xa62600,0xa62600,0xa62500,0xa65000,0xa65000,0xa65000,0xa65100,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa65000,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa67b00,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0xa6a600,0x6ba600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x6ca600,0x36a600,0x35a600,0x36a600,0x36a600,0x36a600,0x35a600,0x35a600,0x36a600,0x36a600,0x35a600,0x36a600,0x36a600,0x35a600,0x36a600,0x35a600,0x36a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a600,0x00a636,0x00a636,0x00a636,0x00a635,0x00a635,0x00a636,0x00a636,0x00a636,0x00a635,0x00a635,0x00a636,0x00a635,0x00a635,0x00a635,0x00a636,0x00a636,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a66c,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x00a6a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0051a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x0000a6,0x3500a6,0x3600a6,0x3600a6,0x3600a6,0x3600a6,0x3600a6,0x3600a6,0x3500a6,0x3500a6,0x3500a6,0x3500a6,0x3600a6,0x3600a6,0x3500a6,0x3500a6,0x3600a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,0x6c00a6,
+0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb20000,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb22900,0xb25700,0xb25700,0xb25700,0xb25600,0xb25600,0xb25700,0xb25600,0xb25700,0xb25600,0xb25700,0xb25600,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25600,0xb25600,0xb25600,0xb25600,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25700,0xb25600,0xb25700,0xb25600,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb28400,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0xb2b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x74b200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x3ab200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b200,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b23a,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b274,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x00b2b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0057b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x0000b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x3a00b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,0x7400b2,
+0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd0000,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd2c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd5c00,0xbd8c00,0xbd8d00,0xbd8d00,0xbd8d00,0xbd8c00,0xbd8c00,0xbd8c00,0xbd8d00,0xbd8c00,0xbd8d00,0xbd8d00,0xbd8d00,0xbd8d00,0xbd8d00,0xbd8d00,0xbd8d00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0xbdbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x7bbd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x3ebd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd00,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd3e,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bd7b,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x00bdbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x005dbd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x0000bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x3e00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,0x7b00bd,
+0xc40000,0xc40000,0xc40000,0xc50000,0xc50000,0xc50000,0xc50000,0xc40000,0xc40000,0xc50000,0xc40000,0xc40000,0xc42e00,0xc52e00,0xc52e00,0xc42e00,0xc42e00,0xc42e00,0xc42e00,0xc52e00,0xc52e00,0xc52e00,0xc52e00,0xc42e00,0xc42e00,0xc52e00,0xc42e00,0xc52e00,0xc56000,0xc56000,0xc46000,0xc46000,0xc56000,0xc46000,0xc46000,0xc46000,0xc56000,0xc46000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc46000,0xc56000,0xc56000,0xc46000,0xc56100,0xc46000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc56000,0xc46000,0xc56000,0xc59200,0xc59200,0xc49200,0xc59200,0xc49200,0xc49200,0xc49200,0xc49200,0xc49200,0xc59200,0xc59300,0xc59300,0xc49200,0xc59300,0xc49200,0xc59300,0xc5c500,0xc4c400,0xc5c500,0xc4c400,0xc4c400,0xc4c400,0xc5c500,0xc5c500,0xc5c500,0xc4c400,0xc5c500,0xc5c500,0xc5c500,0xc5c400,0xc5c500,0xc5c500,0x81c500,0x81c500,0x81c500,0x81c500,0x80c400,0x80c500,0x80c400,0x81c500,0x80c500,0x80c400,0x80c400,0x81c500,0x81c500,0x81c500,0x81c500,0x80c400,0x41c500,0x41c500,0x41c500,0x41c500,0x41c500,0x41c500,0x41c500,0x41c500,0x41c500,0x41c400,0x41c400,0x41c400,0x41c400,0x41c500,0x41c500,0x41c400,0x00c400,0x00c400,0x00c500,0x00c400,0x00c400,0x00c500,0x00c500,0x00c500,0x00c400,0x00c500,0x00c400,0x00c500,0x00c400,0x00c400,0x00c500,0x00c400,0x00c541,0x00c541,0x00c541,0x00c441,0x00c541,0x00c441,0x00c441,0x00c541,0x00c441,0x00c541,0x00c441,0x00c541,0x00c441,0x00c541,0x00c541,0x00c541,0x00c480,0x00c580,0x00c480,0x00c480,0x00c581,0x00c580,0x00c480,0x00c581,0x00c581,0x00c480,0x00c581,0x00c581,0x00c581,0x00c480,0x00c480,0x00c580,0x00c5c5,0x00c5c5,0x00c5c5,0x00c5c5,0x00c4c4,0x00c4c4,0x00c4c4,0x00c4c4,0x00c4c4,0x00c5c5,0x00c5c5,0x00c4c4,0x00c5c5,0x00c4c4,0x00c4c4,0x00c5c5,0x0061c4,0x0061c4,0x0061c4,0x0061c4,0x0061c5,0x0061c5,0x0061c5,0x0061c5,0x0061c5,0x0061c4,0x0061c5,0x0061c5,0x0061c5,0x0061c4,0x0061c5,0x0061c4,0x0000c5,0x0000c4,0x0000c5,0x0000c4,0x0000c5,0x0000c4,0x0000c4,0x0000c4,0x0000c5,0x0000c4,0x0000c5,0x0000c5,0x0000c4,0x0000c5,0x0000c5,0x0000c5,0x4100c5,0x4100c5,0x4100c4,0x4100c4,0x4100c5,0x4100c4,0x4100c5,0x4100c5,0x4100c5,0x4100c5,0x4100c5,0x4100c5,0x4100c4,0x4100c4,0x4100c5,0x4100c5,0x8000c4,0x8100c5,0x8100c5,0x8000c4,0x8000c4,0x8000c5,0x8100c5,0x8000c4,0x8000c4,0x8100c5,0x8100c5,0x8000c4,0x8100c5,0x8100c5,0x8100c5,
+0xcf0000,0xce0000,0xce0000,0xce0000,0xce0000,0xce0000,0xce0000,0xce0000,0xce0000,0xcf0000,0xce0000,0xce0000,0xce3100,0xcf3100,0xce3100,0xce3100,0xce3100,0xce3100,0xcf3100,0xce3100,0xce3100,0xce3100,0xce3100,0xce3100,0xce3100,0xce3100,0xcf3100,0xce3100,0xcf6600,0xce6500,0xce6500,0xce6500,0xce6600,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6500,0xce6600,0xce6500,0xce6500,0xce6500,0xce6500,0xce6600,0xcf6600,0xce6500,0xce6500,0xce6500,0xce6500,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xcf9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xce9a00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcfcf00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0xcece00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x87ce00,0x45ce00,0x45ce00,0x45ce00,0x45ce00,0x45cf00,0x45ce00,0x45ce00,0x45ce00,0x45ce00,0x45ce00,0x45cf00,0x45ce00,0x45ce00,0x45ce00,0x45ce00,0x45ce00,0x00ce00,0x00ce00,0x00ce00,0x00cf00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00ce00,0x00cf45,0x00ce45,0x00ce45,0x00ce45,0x00cf45,0x00ce45,0x00ce45,0x00cf45,0x00ce45,0x00ce45,0x00ce45,0x00ce45,0x00ce45,0x00ce45,0x00ce45,0x00cf45,0x00cf87,0x00ce87,0x00ce87,0x00ce87,0x00ce87,0x00ce87,0x00ce87,0x00cf87,0x00ce87,0x00ce87,0x00ce87,0x00cf87,0x00ce87,0x00ce87,0x00ce87,0x00ce87,0x00cece,0x00cece,0x00cece,0x00cece,0x00cece,0x00cece,0x00cece,0x00cece,0x00cfcf,0x00cece,0x00cece,0x00cece,0x00cece,0x00cfcf,0x00cfcf,0x00cfce,0x0066ce,0x0066ce,0x0066ce,0x0066cf,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0066ce,0x0000ce,0x0000ce,0x0000cf,0x0000ce,0x0000ce,0x0000ce,0x0000ce,0x0000ce,0x0000ce,0x0000ce,0x0000cf,0x0000cf,0x0000cf,0x0000ce,0x0000ce,0x0000cf,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500cf,0x4500cf,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500ce,0x4500cf,0x8700cf,0x8700ce,0x8700ce,0x8700ce,0x8700cf,0x8700ce,0x8700ce,0x8700cf,0x8700cf,0x8700ce,0x8700ce,0x8700ce,0x8700ce,0x8700ce,0x8700ce,
+0xd70000,0xd70000,0xd70000,0xd70000,0xd70000,0xd80000,0xd70000,0xd70000,0xd70000,0xd70000,0xd80000,0xd70000,0xd73400,0xd83400,0xd73400,0xd73400,0xd73400,0xd73400,0xd83400,0xd83400,0xd73400,0xd83400,0xd73400,0xd73400,0xd83400,0xd73400,0xd73400,0xd83400,0xd76a00,0xd76a00,0xd86a00,0xd76a00,0xd76a00,0xd76a00,0xd76a00,0xd86a00,0xd76a00,0xd76a00,0xd86a00,0xd86a00,0xd76a00,0xd76a00,0xd86a00,0xd86a00,0xd76a00,0xd76a00,0xd86a00,0xd86a00,0xd86a00,0xd76a00,0xd86a00,0xd76a00,0xd76a00,0xd86a00,0xd76a00,0xd86a00,0xd86a00,0xd76a00,0xd76a00,0xd86a00,0xd7a100,0xd7a100,0xd7a100,0xd8a100,0xd7a100,0xd8a100,0xd8a100,0xd7a100,0xd7a100,0xd8a100,0xd7a100,0xd7a100,0xd7a100,0xd7a100,0xd7a100,0xd7a100,0xd8d800,0xd8d800,0xd8d800,0xd7d700,0xd7d700,0xd8d800,0xd7d700,0xd8d800,0xd7d700,0xd7d700,0xd7d700,0xd8d800,0xd8d800,0xd7d700,0xd7d700,0xd8d800,0x8dd700,0x8dd700,0x8dd700,0x8dd700,0x8dd700,0x8dd800,0x8dd700,0x8dd700,0x8dd700,0x8dd700,0x8dd700,0x8dd800,0x8dd700,0x8dd700,0x8dd700,0x8dd700,0x48d700,0x48d700,0x48d700,0x48d700,0x48d700,0x48d800,0x48d800,0x48d700,0x48d800,0x48d700,0x48d700,0x48d700,0x48d800,0x48d800,0x48d700,0x48d700,0x00d700,0x00d700,0x00d700,0x00d700,0x00d800,0x00d700,0x00d700,0x00d800,0x00d700,0x00d700,0x00d700,0x00d800,0x00d800,0x00d800,0x00d700,0x00d700,0x00d748,0x00d748,0x00d748,0x00d848,0x00d848,0x00d748,0x00d748,0x00d748,0x00d748,0x00d848,0x00d748,0x00d748,0x00d748,0x00d748,0x00d748,0x00d848,0x00d78d,0x00d78d,0x00d78d,0x00d78d,0x00d88d,0x00d78d,0x00d78d,0x00d78d,0x00d78d,0x00d78d,0x00d78d,0x00d88d,0x00d78d,0x00d88d,0x00d78d,0x00d78d,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d8d8,0x00d7d7,0x00d8d8,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x00d7d7,0x006bd7,0x006bd7,0x006bd7,0x006bd7,0x006bd7,0x006bd8,0x006bd8,0x006bd8,0x006bd7,0x006bd8,0x006bd7,0x006bd8,0x006bd7,0x006bd7,0x006bd7,0x006bd8,0x0000d7,0x0000d7,0x0000d7,0x0000d8,0x0000d7,0x0000d7,0x0000d7,0x0000d8,0x0000d8,0x0000d7,0x0000d7,0x0000d8,0x0000d7,0x0000d7,0x0000d7,0x0000d7,0x4800d7,0x4800d8,0x4800d8,0x4800d8,0x4800d8,0x4800d8,0x4800d8,0x4800d7,0x4800d8,0x4800d7,0x4800d7,0x4800d7,0x4800d7,0x4800d7,0x4800d8,0x4800d7,0x8d00d7,0x8d00d8,0x8d00d8,0x8d00d8,0x8d00d8,0x8d00d8,0x8d00d8,0x8d00d7,0x8d00d7,0x8d00d8,0x8d00d7,0x8d00d8,0x8d00d7,0x8d00d8,0x8d00d7,
+0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe00000,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe03600,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe06f00,0xe0a800,0xe0a700,0xe0a700,0xe0a700,0xe0a700,0xe0a700,0xe0a800,0xe0a800,0xe0a700,0xe0a800,0xe0a800,0xe0a700,0xe0a700,0xe0a700,0xe0a700,0xe0a700,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0xe0e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x93e000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x4be000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e000,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e04b,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e093,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x00e0e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0070e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x0000e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x4b00e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,0x9300e0,
+0xe80000,0xe80000,0xe80000,0xe80000,0xe80000,0xe80000,0xe90000,0xe80000,0xe80000,0xe90000,0xe80000,0xe80000,0xe93900,0xe93900,0xe93900,0xe83800,0xe83800,0xe83800,0xe83800,0xe83800,0xe93900,0xe83900,0xe83900,0xe93900,0xe83900,0xe83800,0xe83800,0xe83900,0xe87300,0xe87300,0xe97300,0xe87300,0xe87300,0xe87300,0xe87300,0xe97300,0xe87300,0xe87300,0xe87300,0xe97300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe97300,0xe87300,0xe87300,0xe97300,0xe97300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe87300,0xe8ae00,0xe9ae00,0xe9ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe9ae00,0xe8ae00,0xe8ae00,0xe8ae00,0xe8e800,0xe8e800,0xe9e900,0xe9e900,0xe8e800,0xe9e900,0xe9e900,0xe8e800,0xe8e800,0xe8e800,0xe8e800,0xe8e800,0xe8e800,0xe8e800,0xe8e800,0xe9e900,0x99e800,0x99e800,0x99e800,0x99e800,0x99e800,0x99e900,0x99e800,0x99e800,0x99e800,0x99e800,0x99e900,0x99e800,0x99e800,0x99e800,0x99e800,0x99e800,0x4ee800,0x4fe800,0x4ee800,0x4fe900,0x4ee800,0x4ee800,0x4ee800,0x4ee800,0x4ee800,0x4ee800,0x4ee800,0x4fe900,0x4fe800,0x4fe900,0x4ee800,0x4ee800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e800,0x00e84e,0x00e84e,0x00e84e,0x00e84f,0x00e84f,0x00e84f,0x00e84f,0x00e84e,0x00e84f,0x00e94f,0x00e84f,0x00e84e,0x00e84e,0x00e84e,0x00e94f,0x00e84e,0x00e899,0x00e898,0x00e999,0x00e999,0x00e899,0x00e899,0x00e899,0x00e899,0x00e899,0x00e999,0x00e899,0x00e899,0x00e999,0x00e899,0x00e999,0x00e899,0x00e8e8,0x00e8e8,0x00e8e8,0x00e8e8,0x00e8e8,0x00e9e9,0x00e8e8,0x00e8e8,0x00e8e8,0x00e8e8,0x00e8e8,0x00e8e8,0x00e9e9,0x00e9e9,0x00e8e8,0x00e8e8,0x0074e8,0x0074e8,0x0074e8,0x0074e8,0x0074e8,0x0074e8,0x0074e9,0x0074e8,0x0074e8,0x0074e8,0x0074e8,0x0074e9,0x0074e8,0x0074e8,0x0074e8,0x0074e9,0x0000e8,0x0000e9,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e8,0x0000e9,0x0000e9,0x4e00e8,0x4e00e8,0x4e00e8,0x4e00e8,0x4f00e8,0x4e00e8,0x4f00e8,0x4e00e8,0x4f00e8,0x4e00e8,0x4e00e8,0x4f00e9,0x4e00e8,0x4e00e8,0x4f00e9,0x4f00e8,0x9900e8,0x9900e8,0x9900e9,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9900e8,0x9800e8,0x9900e8,0x9900e8,
+0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf00000,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf03b00,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf07700,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0b400,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0xf0f000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x9ef000,0x51f000,0x51f000,0x51f000,0x52f000,0x51f000,0x52f000,0x51f000,0x51f000,0x51f000,0x51f000,0x51f000,0x51f000,0x51f000,0x52f000,0x51f000,0x51f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f000,0x00f051,0x00f052,0x00f052,0x00f051,0x00f051,0x00f051,0x00f051,0x00f051,0x00f051,0x00f051,0x00f051,0x00f051,0x00f052,0x00f051,0x00f051,0x00f051,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f09e,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x00f0f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0078f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x0000f0,0x5200f0,0x5100f0,0x5100f0,0x5200f0,0x5100f0,0x5100f0,0x5100f0,0x5100f0,0x5100f0,0x5100f0,0x5100f0,0x5200f0,0x5200f0,0x5100f0,0x5200f0,0x5100f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0x9e00f0,0xa021f0,0xa021f0,0xa023f0,0xa021f0,
+0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf80000,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf83d00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf87b00,0xf8ba00,0xf8b900,0xf8ba00,0xf8ba00,0xf8b900,0xf8b900,0xf8b900,0xf8ba00,0xf8b900,0xf8ba00,0xf8ba00,0xf8ba00,0xf8b900,0xf8b900,0xf8b900,0xf8ba00,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xf8f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0xa3f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x54f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f800,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f854,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8a3,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x00f8f8,0x007cf8,0x2380f8,0x2580f8,0x2380f8,0x227ff8,0x2380f8,0x2580f8,0x2580f8,0x2580f8,0x2580f8,0x217ff8,0x2480f8,0x217ff8,0x217ff8,0x2380f8,0x2280f8,0x3232f8,0x3232f8,0x3535f8,0x3233f8,0x3232f8,0x3232f8,0x3434f8,0x3333f8,0x3434f8,0x3434f8,0x3333f8,0x3333f8,0x3232f8,0x3535f8,0x3f3ff8,0x3e3ff8,0x6740f8,0x6740f8,0x6740f8,0x663ff8,0x6740f8,0x663ff8,0x663ff8,0x6740f8,0x6740f8,0x663ff8,0x6740f8,0x6740f8,0x6b48f8,0x6b48f8,0x6c4af8,0x6b48f8,0xab49f8,0xab49f8,0xab4af8,0xab49f8,0xab48f8,0xab48f8,0xab49f8,0xab49f8,0xab4af8,0xab48f8,0xad51f8,0xad51f8,0xad51f8,0xad50f8,0xad52f8,
+0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xffff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0xa8ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x57ff00,0x00ff00,0x00ff00,0x00ff00,0x00ff00,0x00ff00,0x00ff00,0x00ff00,0x25ff24,0x21ff21,0x22ff21,0x24ff24,0x24ff24,0x24ff24,0x24ff24,0x22ff22,0x23ff23,0x22ff5d,0x24ff5e,0x23ff5d,0x24ff5e,0x25ff5e,0x25ff5e,0x34ff63,0x33ff63,0x32ff63,0x32ff63,0x34ff63,0x34ff64,0x34ff64,0x33ff63,0x33ff63,0x32ff63,0x32ffac,0x33ffac,0x34ffac,0x33ffac,0x3effad,0x3effad,0x3effad,0x3fffae,0x3fffae,0x40ffae,0x3effad,0x3fffae,0x3effad,0x3effad,0x3fffae,0x3fffae,0x3effff,0x3fffff,0x48ffff,0x48ffff,0x48ffff,0x48ffff,0x49ffff,0x4affff,0x48ffff,0x48ffff,0x49ffff,0x4affff,0x49ffff,0x4affff,0x49ffff,0x49ffff,0x5291ff,0x5291ff,0x5190ff,0x5190ff,0x5291ff,0x5190ff,0x5190ff,0x5190ff,0x5291ff,0x5291ff,0x5291ff,0x5290ff,0x5290ff,0x5291ff,0x5190ff,0x5993ff,0x595aff,0x5a5aff,0x5959ff,0x5958ff,0x5959ff,0x5959ff,0x5959ff,0x5959ff,0x5959ff,0x5959ff,0x5959ff,0x5a5aff,0x5859ff,0x6060ff,0x6161ff,0x5f5fff,0x7c60ff,0x7b5fff,0x7c60ff,0x7c60ff,0x7c60ff,0x7c60ff,0x7b60ff,0x7c60ff,0x7b5fff,0x7b5fff,0x7c60ff,0x8066ff,0x8067ff,0x8066ff,0x8066ff,0x8066ff,0xb767ff,0xb766ff,0xb766ff,0xb767ff,0xb665ff,0xb766ff,0xb767ff,0xb767ff,0xb766ff,0xb96dff,0xb86cff,0xb86dff,0xb86cfe,0xb86cff,0xb96cff,
+0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff3f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xff7f00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffbf00,0xffc022,0xffc021,0xffc025,0xffff23,0xffff22,0xffff22,0xffff21,0xffff23,0xffff24,0xffff21,0xffff22,0xffff23,0xffff21,0xffff23,0xffff21,0xffff34,0xffff33,0xffff33,0xffff33,0xacff34,0xacff34,0xacff34,0xacff34,0xacff31,0xacff34,0xacff33,0xacff34,0xacff31,0xacff32,0xaeff3e,0xaeff40,0xaeff3f,0xaeff3e,0xaeff3f,0xaeff3f,0x69ff3f,0x69ff40,0x68ff3f,0x69ff40,0x69ff3e,0x69ff3f,0x68ff3e,0x69ff3f,0x6eff48,0x6eff4a,0x6eff49,0x6eff49,0x6eff49,0x6eff49,0x6eff4a,0x6eff49,0x49ff49,0x49ff49,0x49ff48,0x49ff49,0x48ff48,0x49ff49,0x50ff50,0x51ff50,0x51ff50,0x52ff51,0x51ff51,0x51ff51,0x52ff52,0x52ff51,0x51ff50,0x52ff51,0x52ff73,0x51ff73,0x52ff73,0x52ff73,0x52ff73,0x59ff77,0x5aff77,0x59ff77,0x58ff77,0x59ff77,0x59ff77,0x59ff77,0x5aff77,0x59ff77,0x59ff77,0x58ff77,0x5affb3,0x58ffb3,0x5affb3,0x5fffb5,0x60ffb5,0x5fffb5,0x60ffb5,0x60ffb5,0x61ffb5,0x60ffb5,0x60ffb5,0x60ffb5,0x61ffb5,0x60ffb5,0x60ffb5,0x60ffb5,0x60ffff,0x67ffff,0x66ffff,0x66ffff,0x66ffff,0x67ffff,0x67ffff,0x66ffff,0x67ffff,0x66ffff,0x66ffff,0x67ffff,0x67ffff,0x66ffff,0x66ffff,0x6bffff,0x6c9cfe,0x6c9cff,0x6c9cff,0x6d9cff,0x6b9cfe,0x6c9cff,0x6c9cff,0x6c9cff,0x6c9cff,0x6c9cfe,0x6b9cff,0x6b9cfe,0x6c9cff,0x6c9cff,0x719ffe,0x729ffe,0x7272fe,0x7271ff,0x7171fe,0x7272ff,0x7171fe,0x7172fe,0x7272fe,0x7171fe,0x7171fe,0x7171fe,0x7171fe,0x7272fe,0x7777fe,0x7777fe,0x7676fe,0x7777fe,0x8b76fe,0x8c77fe,0x8c76fe,0x8c77fe,0x8b76ff,0x8b76fe,0x8b76ff,0x8c76fe,0x8b76fe,0x8b77fe,0x8f7bfe,0x8f7bfe,0x8f7bfe,0x8f7bfe,0x8f7bfe,0x8f7cfe,0xbd7bfe,0xbd7bfe,0xbd7bfe,0xbd7bfe,0xbd7bfe,0xbd7cfe,0xbe7cfe,0xbd7bfe,0xbf80fe,0xbf80fe,0xbf80fe,0xbf81fe,0xbf80fe,0xbf80fe,0xbf80fe,
+0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff0000,0xff3f00,0xff3f00,0xff3f00,0xff4822,0xff4822,0xff4821,0xff4923,0xff4823,0xff4823,0xff4924,0xff4923,0xff4822,0xff4923,0xff4821,0xff4924,0xff4822,0xff8324,0xff8324,0xff8633,0xff8633,0xff8634,0xff8632,0xff8633,0xff8633,0xff8633,0xff8633,0xff8632,0xff8633,0xff8633,0xff8634,0xff8633,0xff8632,0xff893e,0xff893f,0xff893e,0xff893f,0xff893f,0xff893e,0xff893f,0xff8940,0xff893e,0xff8a40,0xff893e,0xff893e,0xff8a40,0xff893e,0xff8c48,0xff8c48,0xffc448,0xffc449,0xffc449,0xffc449,0xffc448,0xffc449,0xffc448,0xffc449,0xffc448,0xffc448,0xffc448,0xffc44a,0xffc552,0xffc550,0xffc551,0xffc552,0xffff52,0xffff50,0xffff50,0xffff51,0xffff51,0xffff52,0xffff50,0xffff52,0xffff51,0xffff51,0xffff51,0xffff59,0xffff58,0xffff59,0xffff58,0xffff58,0xb3ff59,0xb3ff59,0xb3ff59,0xb3ff59,0xb3ff59,0xb3ff59,0xb3ff58,0xb3ff58,0xb3ff58,0xb5ff60,0xb5ff5f,0xb5ff5f,0xb5ff5f,0xb5ff60,0xb5ff60,0xb5ff5f,0x7cff60,0x7cff60,0x7cff60,0x7cff60,0x7bff5f,0x7cff60,0x7cff5f,0x80ff66,0x80ff66,0x80ff66,0x80ff65,0x80ff66,0x80ff66,0x80ff66,0x80ff66,0x80ff66,0x66ff65,0x66ff65,0x66ff66,0x66ff65,0x66ff66,0x6cff6c,0x6cff6c,0x6cff6c,0x6cff6c,0x6cff6b,0x6bff6b,0x6cff6c,0x6cff6b,0x6cff6c,0x6cff6b,0x6cff6b,0x6cff84,0x6bff83,0x6bff83,0x6cff84,0x71ff87,0x71ff87,0x71ff87,0x71ff87,0x71ff87,0x71ff87,0x71ff87,0x71ff87,0x72ff88,0x71ff87,0x71ff87,0x71ff87,0x72ffba,0x72ffba,0x77ffbc,0x76ffbb,0x77ffbc,0x76ffbb,0x77ffbc,0x77ffbc,0x77ffbc,0x76ffbb,0x77ffbc,0x76ffbb,0x76ffbb,0x76ffbb,0x77ffbc,0x77ffbb,0x7cfffe,0x7bfffe,0x7cfffe,0x7cfffe,0x7cfffe,0x7bfffe,0x7cfffe,0x7bfffe,0x7bfffe,0x7cfffe,0x7cfffe,0x7cfffe,0x7bfffe,0x7cfffe,0x7ffffe,0x80fffe,0x80a7fe,0x81a7fe,0x81a7fe,0x80a7fe,0x80a7fe,0x80a7fe,0x80a7fe,0x80a6fe,0x81a7fe,0x80a7fe,0x80a7fe,0x80a6fe,0x81a7fe,0x85a9fe,0x84a9fe,0x84a9fe,0x8484fe,0x8584fe,0x8585fe,0x8484fe,0x8585fe,0x8585fe,0x8484fe,0x8484fe,0x8585fe,0x8484fe,0x8484fe,0x8989fe,0x8989fe,0x8989fe,0x8989fe,0x8989fe,0x9a89fe,0x9988fe,0x9989fe,0x9989fe,0x9a89fe,0x9988fe,0x9a8afe,0x9a89fe,0x9988fe,0x9d8dfe,0x9d8dfe,0x9d8dfe,0x9d8efe,0x9c8dfe,0x9d8dfe,0x9c8dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc48dfe,0xc691fe,0xc692fe,0xc691fe,0xc691fe,0xc691fe,0xc691fe,0xc691fe,
+0xff4949,0xff4948,0xff4948,0xff4a49,0xff4949,0xff4a4a,0xff4a49,0xff4949,0xff4949,0xff4848,0xff4848,0xff4949,0xff5e48,0xff5f4a,0xff6552,0xff6552,0xff6552,0xff6552,0xff6450,0xff6552,0xff6451,0xff6450,0xff6451,0xff6451,0xff6450,0xff6451,0xff6552,0xff6552,0xff9052,0xff9359,0xff9359,0xff9258,0xff9359,0xff9359,0xff9358,0xff9359,0xff9359,0xff9358,0xff9258,0xff9359,0xff9358,0xff9359,0xff9359,0xff955f,0xff9660,0xff9660,0xff955f,0xff965f,0xff9660,0xff9660,0xff965f,0xff955f,0xff965f,0xff9660,0xff9660,0xff965f,0xff955f,0xff9966,0xff9966,0xff9865,0xffc965,0xffc966,0xffc965,0xffc966,0xffc966,0xffc966,0xffc966,0xffc965,0xffc965,0xffc966,0xffc966,0xffca6c,0xffca6c,0xffca6b,0xffca6b,0xffca6b,0xffff6c,0xffff6b,0xffff6b,0xffff6c,0xffff6b,0xffff6b,0xffff6c,0xffff6c,0xffff6c,0xffff6b,0xffff72,0xffff70,0xffff71,0xffff71,0xffff71,0xffff70,0xbaff71,0xbaff71,0xbaff72,0xbaff70,0xbaff71,0xbaff71,0xbaff70,0xbaff71,0xbcff76,0xbcff76,0xbcff76,0xbcff77,0xbcff76,0xbcff76,0xbcff76,0xbcff76,0x8cff76,0x8cff76,0x8bff76,0x8cff77,0x8cff77,0x8bff76,0x8fff7b,0x8fff7b,0x8fff7b,0x8fff7b,0x90ff7b,0x90ff7b,0x8fff7b,0x8fff7b,0x8fff7a,0x8fff7b,0x7bff7b,0x7bff7b,0x7bff7a,0x7cff7b,0x80ff7f,0x80ff7f,0x80fe80,0x80ff80,0x81fe80,0x80ff7f,0x80fe7f,0x80ff7f,0x80fe7f,0x80ff7f,0x81ff80,0x80ff80,0x80ff92,0x80fe92,0x81ff93,0x85fe96,0x84ff96,0x84ff96,0x85ff96,0x85fe96,0x85ff96,0x85ff96,0x85ff96,0x85fe96,0x84fe96,0x85fe96,0x85ff96,0x85fe96,0x85ffc1,0x89fec2,0x89fec2,0x89fec2,0x89ffc2,0x88ffc2,0x88ffc2,0x89ffc2,0x89ffc2,0x89ffc2,0x89fec2,0x89fec2,0x88ffc2,0x89ffc2,0x88fec2,0x8effc4,0x8dfefe,0x8efefe,0x8dfefe,0x8dfefe,0x8dfefe,0x8dfffe,0x8dfefe,0x8dfffe,0x8dfefe,0x8dfffe,0x8dfffe,0x8dfefe,0x8dfefe,0x8dfffe,0x91fefe,0x90fefe,0x91b0fe,0x91b1fe,0x91b1fe,0x91b1fe,0x91b0fe,0x91b0fe,0x91b0fe,0x91b0fe,0x91b0fe,0x91b0fe,0x91b1fe,0x90b0fe,0x95b3fe,0x95b2fe,0x95b3fe,0x95b3fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9595fe,0x9999fe,0x9898fe,0x9999fe,0x9898fe,0x9898fe,0x9999fe,0xa598fe,0xa698fe,0xa699fe,0xa699fe,0xa699fe,0xa699fe,0xa699fe,0xa699fe,0xa99cfe,0xa99cfe,0xa99cfe,0xa99cfe,0xa99cfe,0xa99cfe,0xa99cfe,0xa99cfe,0xca9cfe,0xca9dfe,0xca9cfe,0xca9cfe,0xca9cfe,0xca9cfe,0xca9dfe,0xcc9ffe,0xcca0fe,0xcca0fe,0xcca0fe,0xcca0fe,0xcc9ffe,0xcc9ffe,0xcc9ffe,
+0xff6666,0xff6665,0xff6666,0xff6665,0xff6565,0xff6666,0xff6666,0xff6665,0xff6666,0xff6565,0xff6666,0xff6666,0xff7566,0xff796c,0xff796b,0xff796b,0xff796c,0xff7a6c,0xff796c,0xff796b,0xff7a6c,0xff7a6c,0xff7a6c,0xff796c,0xff796b,0xff796b,0xff796b,0xff796b,0xff9e71,0xff9e71,0xff9e70,0xff9e71,0xff9e71,0xff9e71,0xff9e71,0xff9e70,0xff9e71,0xff9e70,0xff9e72,0xff9e71,0xff9e71,0xff9e71,0xffa176,0xffa176,0xffa177,0xffa176,0xffa176,0xffa176,0xffa176,0xffa176,0xffa175,0xffa176,0xffa176,0xffa176,0xffa177,0xffa176,0xffa37b,0xfea47b,0xffa37b,0xffa47b,0xffce7b,0xffce7b,0xffcd7b,0xffcd7b,0xffcd7b,0xffce7b,0xffce7b,0xffce7b,0xffce7c,0xffce7b,0xffcf80,0xfecf7f,0xffcf80,0xffcf80,0xffcf80,0xffcf80,0xffff80,0xfffe7f,0xfeff7f,0xffff80,0xffff7f,0xfffe7f,0xffff80,0xffff80,0xffff80,0xfeff84,0xfeff85,0xfeff84,0xffff84,0xffff84,0xfeff84,0xffff84,0xc1ff84,0xc1fe84,0xc1ff85,0xc1ff84,0xc1ff84,0xc1fe84,0xc1fe84,0xc2ff88,0xc3fe88,0xc2fe88,0xc2ff89,0xc2fe88,0xc2ff88,0xc2ff88,0xc2ff89,0xc2fe88,0x99ff88,0x9afe89,0x99ff88,0x99ff88,0x99ff88,0x9dff8c,0x9cff8c,0x9cfe8d,0x9dff8c,0x9cff8c,0x9dfe8c,0x9cff8c,0x9dfe8d,0x9dfe8c,0x9dfe8d,0x9cff8c,0x8dfe8c,0x8dfe8c,0x8dfe8d,0x8dfe8c,0x91ff91,0x91fe90,0x91fe90,0x91fe90,0x91fe91,0x91fe90,0x92fe91,0x91fe90,0x91fe90,0x91fe90,0x91fe90,0x90ff90,0x91fe9f,0x91fe9f,0x95fea2,0x95fea3,0x95fea3,0x95fea3,0x95fea2,0x95fea3,0x95fea3,0x95fea2,0x95ffa2,0x95fea3,0x95fea3,0x95fea3,0x95fea3,0x94fea2,0x99fec8,0x99fec8,0x99fec8,0x98fec8,0x99fec8,0x99fec8,0x99fec8,0x99fec8,0x99fec8,0x99fec8,0x99fec8,0x98fec8,0x99fec8,0x98fec8,0x9cfeca,0x9cfeca,0x9cfefe,0x9cfefe,0x9cfefe,0x9cfefe,0x9cfefe,0x9dfefe,0x9cfefe,0x9cfefe,0x9cfefe,0x9cfefe,0x9dfefe,0x9cfefe,0x9cfefe,0xa0fefe,0xa0fefe,0xa0fefe,0xa0bafe,0xa0bafe,0x9fb9fe,0x9fbafe,0xa0b9fe,0x9fbafe,0xa0bafe,0x9fbafe,0x9fb9fe,0x9fb9fe,0x9fb9fe,0xa3bcfe,0xa3bcfe,0xa3bcfe,0xa3bcfe,0xa3bcfe,0xa4a3fe,0xa3a3fe,0xa3a3fe,0xa3a3fe,0xa3a3fe,0xa4a3fe,0xa3a3fe,0xa3a3fe,0xa4a3fe,0xa7a6fe,0xa7a7fe,0xa6a6fe,0xa7a6fe,0xa6a6fe,0xa7a6fe,0xa6a6fe,0xb1a6fe,0xb1a6fe,0xb1a6fe,0xb1a6fe,0xb1a7fe,0xb1a6fe,0xb1a6fe,0xb4a9fe,0xb4aafe,0xb4aafe,0xb4a9fe,0xb4aafe,0xb4a9fe,0xb4aafe,0xb4aafe,0xb4aafe,0xd0aafe,0xd0a9fe,0xd0aafe,0xd0aafe,0xd0aafe,0xd0a9fe,0xd1adfe,0xd1adfe,0xd1acfe,0xd2adfe,0xd2adfe,0xd1acfe,0xd2acfe,0xd2adfe,0xd1adfe,
+0xff7c7b,0xff7b7b,0xff7b7a,0xff7c7b,0xff7c7b,0xff7b7b,0xff7c7b,0xff7c7b,0xff7b7a,0xff7b7b,0xff7b7a,0xff7b7b,0xfe8b80,0xff8a80,0xff8a80,0xfe8a80,0xff8a7f,0xfe8a7f,0xff8a7f,0xff8a7f,0xff8a80,0xfe8b80,0xff8b80,0xff8a80,0xfe8a7f,0xfe8a80,0xff8a80,0xff8d83,0xfea984,0xffa884,0xffa884,0xfea984,0xffa984,0xfea984,0xffa884,0xffa984,0xffa985,0xffa984,0xffa985,0xfea984,0xffa984,0xffab89,0xfeab89,0xfeab88,0xffab88,0xfeab88,0xfeab89,0xfeab88,0xfeab88,0xffab89,0xfeab88,0xffab89,0xfeab89,0xfeab89,0xfeab88,0xfead8c,0xfead8c,0xfead8c,0xfeae8d,0xffae8c,0xfed28c,0xfed28c,0xfed28d,0xffd28c,0xffd28c,0xffd28d,0xfed28c,0xffd28c,0xfed28d,0xffd28d,0xfed390,0xfed390,0xffd390,0xfed390,0xffd390,0xfed391,0xfefe90,0xfefe90,0xfffe90,0xfffe90,0xfffe91,0xfefe91,0xfefe91,0xfeff91,0xfefe94,0xfeff94,0xfffe94,0xfefe94,0xfefe94,0xfffe94,0xfefe94,0xfefe94,0xc7ff94,0xc7fe94,0xc7fe94,0xc7fe94,0xc7fe94,0xc7fe94,0xc9fe98,0xc9fe98,0xc9fe98,0xc9fe98,0xc8fe98,0xc9fe98,0xc9fe98,0xc9fe98,0xc9fe98,0xc9fe98,0xa6fe98,0xa6fe98,0xa6fe98,0xa6fe98,0xa9fe9c,0xa9fe9b,0xa8fe9b,0xa9fe9c,0xa9fe9b,0xa9fe9b,0xa9fe9b,0xa9fe9c,0xa9fe9c,0xa8fe9b,0xa9fe9c,0xa9fe9c,0x9cfe9b,0x9cfe9b,0x9cfe9b,0xa0fe9f,0x9ffe9e,0xa0fe9f,0x9ffe9f,0xa0fe9f,0x9ffe9f,0xa0fe9f,0xa0fe9f,0xa0fe9f,0xa0fe9f,0xa0fe9f,0x9ffe9f,0x9ffe9f,0xa0feab,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa4feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa3feae,0xa6feb0,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xa7fece,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xa6fece,0xaafecf,0xaafecf,0xaafed0,0xaafefe,0xaafefe,0xa9fefe,0xa9fefe,0xaafefe,0xaafefe,0xa9fefe,0xaafefe,0xa9fefe,0xaafefe,0xa9fefe,0xaafefe,0xadfefe,0xadfefe,0xacfefe,0xadfefe,0xacc2fe,0xadc2fe,0xadc2fe,0xadc3fe,0xadc2fe,0xacc2fe,0xacc2fe,0xadc3fe,0xacc2fe,0xadc2fe,0xb0c4fe,0xb0c5fe,0xb0c4fe,0xafc4fe,0xb0c5fe,0xb0c4fe,0xafb0fe,0xb0b0fe,0xb0b0fe,0xafb0fe,0xb0b0fe,0xb0b0fe,0xb0b0fe,0xb0b0fe,0xb3b3fe,0xb3b3fe,0xb3b3fe,0xb3b3fd,0xb3b2fe,0xb2b2fe,0xb2b2fe,0xb3b3fe,0xbbb3fe,0xbcb2fe,0xbcb3fe,0xbcb3fd,0xbcb3fd,0xbcb3fe,0xbeb6fe,0xbeb5fe,0xbeb5fe,0xbeb6fe,0xbeb6fe,0xbeb5fe,0xbeb6fd,0xbfb6fd,0xbeb6fd,0xbfb6fd,0xd6b6fd,0xd6b5fe,0xd6b5fd,0xd6b6fd,0xd6b5fe,0xd8b8fe,0xd8b8fe,0xd8b8fe,0xd7b9fe,0xd8b9fe,0xd7b8fe,0xd7b8fe,0xd7b9fe,0xd7b9fe,0xd7b8fd,
+0xfe8e8d,0xff8d8c,0xff8d8c,0xfe8d8c,0xff8d8c,0xfe8d8c,0xff8d8c,0xff8d8c,0xff8d8c,0xfe8d8d,0xfe8d8c,0xff8d8c,0xfe9990,0xff9991,0xfe9990,0xfe9990,0xfe9991,0xfe9990,0xfe9991,0xff9991,0xfe9991,0xff9991,0xfe9991,0xff9990,0xfe9990,0xfe9991,0xfe9d95,0xfe9d94,0xfeb294,0xfeb294,0xfeb294,0xfeb294,0xfeb295,0xfeb395,0xfeb394,0xffb294,0xfeb295,0xfeb295,0xfeb294,0xfeb295,0xfeb497,0xfeb598,0xfeb598,0xfeb598,0xfeb497,0xfeb598,0xfeb598,0xfeb598,0xffb598,0xfeb598,0xfeb598,0xfeb498,0xfeb598,0xfeb498,0xfeb79b,0xfeb79c,0xfeb79b,0xfeb79c,0xfeb79b,0xfeb79c,0xfed79b,0xfed79b,0xfed79b,0xfed79b,0xfed79c,0xfed79b,0xfed79b,0xfed79c,0xfed79b,0xfed8a0,0xfed89f,0xfed89f,0xfed89f,0xfed89f,0xfed89f,0xfed89f,0xfefe9e,0xfefe9e,0xfefe9f,0xfefe9e,0xfefe9f,0xfefe9f,0xfefe9f,0xfefea2,0xfefea2,0xfefea2,0xfefea2,0xfefea3,0xfefea2,0xfefea2,0xfefea2,0xfefea2,0xcdfea2,0xcdfea2,0xcefea3,0xcefea3,0xcdfea3,0xcffea5,0xcefea6,0xcffea6,0xcffea6,0xcffea5,0xcefea5,0xcefea6,0xcffea6,0xcffea5,0xcefea6,0xcffea6,0xb1fea5,0xb1fea5,0xb2fea6,0xb4fea9,0xb4fea9,0xb4fea9,0xb4fea9,0xb4fea9,0xb5fea9,0xb4fea9,0xb4fea8,0xb4fea9,0xb4fea9,0xb4fea9,0xb4fea9,0xb4fea8,0xaafea9,0xaafea9,0xadfeac,0xadfeac,0xadfeac,0xadfeac,0xacfeac,0xadfeac,0xadfeac,0xacfeac,0xadfeac,0xadfeac,0xadfeac,0xadfeac,0xadfeac,0xadfead,0xb0feb9,0xb0feb9,0xb0feb8,0xb0feb9,0xb0feb8,0xb0feb9,0xb0feb9,0xb0feb9,0xaffeb8,0xb0feb9,0xb0feb9,0xb0feb9,0xaffeb8,0xb0feb8,0xb3febb,0xb3febb,0xb3fed4,0xb3fed4,0xb3fed4,0xb3fed4,0xb3fed4,0xb3fed4,0xb2fed4,0xb3fed4,0xb2fed4,0xb3fed4,0xb3fed4,0xb3fed4,0xb6fed5,0xb5fed5,0xb6fed5,0xb6fed5,0xb6fefe,0xb6fefd,0xb6fefd,0xb5fefd,0xb6fefe,0xb6fefe,0xb6fefe,0xb6fefe,0xb6fefe,0xb5fefe,0xb6fefe,0xb9fefe,0xb8fefd,0xb9fefd,0xb9fefd,0xb9fefe,0xb8cafd,0xb9cafe,0xb9cbfe,0xb9cbfe,0xb9cafd,0xb9cafd,0xb9cbfd,0xb9cafd,0xb9cafd,0xbcccfe,0xbbccfd,0xbbccfe,0xbcccfe,0xbbccfe,0xbcccfe,0xbcccfd,0xbcbbfd,0xbbbbfd,0xbbbbfd,0xbbbbfe,0xbbbbfd,0xbbbcfe,0xbcbbfe,0xbfbefe,0xbebffd,0xbebefd,0xbebefd,0xbebefe,0xbebefd,0xbebffe,0xbebefe,0xbebefe,0xc5befd,0xc5bffe,0xc6befe,0xc6befd,0xc5befe,0xc8c1fd,0xc7c0fd,0xc8c1fd,0xc8c1fd,0xc7c1fd,0xc8c1fd,0xc8c1fe,0xc7c1fd,0xc7c0fd,0xc8c1fd,0xc7c1fd,0xdbc1fd,0xdbc1fd,0xdcc1fd,0xdbc1fd,0xddc3fd,0xddc4fd,0xddc4fe,0xddc4fd,0xddc3fd,0xddc3fd,0xddc3fe,0xddc3fd,0xddc3fd,0xddc4fd,0xddc3fe,
+0xfe9c9b,0xfe9d9c,0xfe9d9c,0xfe9c9c,0xfe9c9b,0xfe9c9b,0xfe9c9b,0xfe9c9b,0xfe9d9c,0xfe9c9b,0xfe9c9c,0xfea09f,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfea69e,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfea69f,0xfeaaa3,0xfea9a2,0xfea9a2,0xfebba2,0xfebba3,0xfebba2,0xfebba2,0xfebba3,0xfebca2,0xfebba2,0xfebba2,0xfebca3,0xfebba3,0xfebca3,0xfebea6,0xfebda5,0xfebda6,0xfebea6,0xfebda6,0xfebda6,0xfebea6,0xfebda6,0xfebda6,0xfebea6,0xfebda5,0xfebea6,0xfebda6,0xfebea6,0xfec0a9,0xfec0a9,0xfec0a9,0xfec0a9,0xfec0a9,0xfec0a9,0xfec0a8,0xfedba9,0xfedba8,0xfedba9,0xfedba9,0xfedba9,0xfedba9,0xfedba9,0xfedba8,0xfedcac,0xfedcac,0xfedcac,0xfedcac,0xfedcac,0xfedcac,0xfedcac,0xfedcac,0xfefeac,0xfefeac,0xfefeac,0xfefeac,0xfefeac,0xfefeac,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xfefeaf,0xd3feaf,0xd3feaf,0xd3feaf,0xd3feaf,0xd4feb2,0xd4feb2,0xd5feb2,0xd5feb2,0xd5feb2,0xd5feb2,0xd4feb2,0xd5feb3,0xd5feb2,0xd5feb2,0xd5feb2,0xd4feb2,0xbcfeb2,0xbcfeb2,0xbefeb5,0xbefeb5,0xbefeb5,0xbffeb5,0xbefeb5,0xbefeb5,0xbefeb5,0xbefeb5,0xbefeb5,0xbefeb5,0xbefeb5,0xbffeb5,0xbefeb5,0xbefeb5,0xb6feb5,0xb9feb8,0xb9feb8,0xb9feb8,0xb9feb8,0xb9feb8,0xb8feb8,0xb8feb8,0xb9feb8,0xb8feb8,0xb9feb8,0xb9feb8,0xb8feb8,0xb9feb7,0xb8feb8,0xbbfebb,0xbcfec2,0xbcfec3,0xbbfec2,0xbcfec2,0xbcfec2,0xbbfec2,0xbbfec3,0xbbfec2,0xbbfec2,0xbcfec2,0xbcfec3,0xbbfec2,0xbcfec2,0xbffec5,0xbefec5,0xbefec5,0xbffeda,0xbefeda,0xbffeda,0xbefed9,0xbefed9,0xbefeda,0xbefed9,0xbefeda,0xbefed9,0xbefed9,0xbefeda,0xc1fedb,0xc1fedb,0xc0fedb,0xc1fedb,0xc1fedb,0xc1fefd,0xc1fefe,0xc1fefd,0xc1fefd,0xc1fefe,0xc1fefd,0xc1fefe,0xc1fefd,0xc0fefd,0xc1fefd,0xc4fefd,0xc4fefd,0xc4fefd,0xc4fefd,0xc4fefd,0xc3fefd,0xc4d2fd,0xc3d2fd,0xc3d2fd,0xc3d2fe,0xc3d2fd,0xc4d2fd,0xc4d2fd,0xc4d2fe,0xc6d4fd,0xc6d4fd,0xc7d4fd,0xc6d4fd,0xc7d4fd,0xc6d4fd,0xc6d4fd,0xc6d4fd,0xc6c6fd,0xc6c6fe,0xc6c6fd,0xc7c6fd,0xc6c6fd,0xc6c6fd,0xc9c8fd,0xc9c9fd,0xc9c8fe,0xc8c9fe,0xc9c8fd,0xc9c9fd,0xc9c9fd,0xc8c9fd,0xc9c9fe,0xc9c8fd,0xcfc9fd,0xcec8fd,0xcec9fd,0xcec9fd,0xd1cbfd,0xd1ccfd,0xd0cbfd,0xd1cbfd,0xd1cbfd,0xd1cbfd,0xd0cbfd,0xd1ccfd,0xd1cbfd,0xd1cbfd,0xd1cbfd,0xd1cbfd,0xe1cbfd,0xe1cbfd,0xe1cbfd,0xe2cefd,0xe2cefd,0xe2cdfd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,0xe2cefd,
+0xfea9a9,0xfea9a9,0xfea9a8,0xfea9a9,0xfeaaa9,0xfea9a8,0xfeaaa9,0xfea9a8,0xfeaaa9,0xfea9a9,0xfeacac,0xfeadac,0xfeb2ab,0xfeb2ac,0xfeb2ab,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb2ac,0xfeb5af,0xfeb5af,0xfeb4af,0xfeb5af,0xfec4af,0xfec4af,0xfec4b0,0xfec4af,0xfec4af,0xfec4af,0xfec4af,0xfec4af,0xfec4af,0xfec4af,0xfec6b3,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec6b2,0xfec8b5,0xfec8b5,0xfec8b5,0xfec8b5,0xfec8b5,0xfec8b5,0xfec8b5,0xfec9b5,0xfedfb5,0xfee0b6,0xfedfb5,0xfedfb5,0xfedfb5,0xfedfb6,0xfedfb5,0xfee0b7,0xfee0b8,0xfee0b8,0xfee0b7,0xfee1b8,0xfee0b8,0xfee0b8,0xfee0b8,0xfee0b8,0xfefeb8,0xfefeb8,0xfefeb8,0xfefeb8,0xfefeb8,0xfefebb,0xfefebb,0xfefebb,0xfefebb,0xfefeba,0xfefebb,0xfefebb,0xfefeba,0xfefeba,0xfefeba,0xfefebb,0xd9febb,0xd8febb,0xd8feba,0xdafebd,0xdafebe,0xdafebe,0xdafebe,0xdafebd,0xdafebe,0xdafebd,0xdafebd,0xdafebe,0xdafebd,0xdafebd,0xdafebe,0xdafebd,0xc5febd,0xc8fec1,0xc8fec0,0xc8fec0,0xc8fec1,0xc8fec1,0xc7fec0,0xc8fec0,0xc8fec0,0xc8fec0,0xc8fec0,0xc8fec0,0xc8fec0,0xc7fec0,0xc8fec0,0xc8fec1,0xc3fec3,0xc4fec3,0xc3fec3,0xc4fec3,0xc4fec3,0xc4fec3,0xc4fec3,0xc4fec3,0xc4fec3,0xc4fec3,0xc3fec2,0xc4fec3,0xc4fec3,0xc3fec2,0xc6fec5,0xc6fec6,0xc6fecc,0xc6fecc,0xc6fecb,0xc6fecb,0xc6fecc,0xc6fecc,0xc6fecc,0xc6fecc,0xc6fecc,0xc6fecb,0xc6fecc,0xc6fecb,0xc8fece,0xc9fece,0xc8fece,0xc8fece,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xc9fedf,0xccfee0,0xcbfee0,0xccfee1,0xcbfee0,0xcbfee0,0xcbfee0,0xcbfefd,0xcbfefd,0xccfefd,0xcbfefd,0xcbfefd,0xccfefd,0xcbfefd,0xcbfefd,0xcbfefd,0xcefefd,0xcdfdfd,0xcefefd,0xcdfefd,0xcefefd,0xcefefd,0xcefdfd,0xcedafd,0xcddafd,0xcedafd,0xced9fd,0xced9fd,0xcdd9fd,0xced9fd,0xd0dcfd,0xd0dbfd,0xd0dbfd,0xd0dbfd,0xd1dbfd,0xd1dbfd,0xd0dbfd,0xd0dcfd,0xd1dcfd,0xd1d1fd,0xd0d0fd,0xd0d1fd,0xd1d0fd,0xd0d0fd,0xd2d2fd,0xd2d2fd,0xd2d2fd,0xd3d3fd,0xd3d3fd,0xd3d3fd,0xd3d3fd,0xd3d3fd,0xd3d3fd,0xd2d2fd,0xd3d3fd,0xd7d2fd,0xd7d2fd,0xd7d3fd,0xd9d5fd,0xd9d5fd,0xdad5fd,0xdad5fd,0xd9d5fd,0xd9d5fd,0xd9d5fd,0xd9d5fd,0xd9d5fd,0xd9d5fd,0xdad5fd,0xdad5fd,0xdad5fd,0xe6d5fd,0xe6d5fd,0xe7d8fd,0xe7d7fd,0xe7d7fd,0xe8d8fd,0xe7d7fd,0xe7d7fd,0xe7d8fd,0xe7d7fd,0xe7d8fd,0xe8d8fd,0xe7d7fd,0xe7d7fd,0xe7d7fd,
+0xfeb5b5,0xfeb6b5,0xfeb6b5,0xfeb6b5,0xfeb6b5,0xfeb6b5,0xfeb6b5,0xfeb6b5,0xfeb5b5,0xfeb9b8,0xfeb9b8,0xfeb9b8,0xfebdb7,0xfebdb8,0xfebdb8,0xfebdb8,0xfebdb8,0xfebdb8,0xfebdb7,0xfebdb8,0xfebdb8,0xfebcb7,0xfebdb7,0xfec0ba,0xfebfba,0xfec0bb,0xfebfba,0xfebfba,0xfeccbb,0xfeccbb,0xfeccbb,0xfeccba,0xfeccba,0xfeccbb,0xfeccba,0xfeccbb,0xfeccbb,0xfecebd,0xfecebd,0xfecebd,0xfecebd,0xfecebd,0xfecebd,0xfecebe,0xfecebd,0xfecebe,0xfecebe,0xfecebd,0xfecebd,0xfecebe,0xfecebd,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c0,0xfed0c1,0xfee4c0,0xfee3c0,0xfee3c0,0xfee4c0,0xfee3c0,0xfee4c0,0xfee5c3,0xfee5c3,0xfee4c3,0xfee4c3,0xfee5c3,0xfee4c2,0xfee4c3,0xfee5c3,0xfee5c3,0xfee4c2,0xfefec3,0xfefec3,0xfefec3,0xfefec3,0xfefec6,0xfefec5,0xfefec5,0xfefec5,0xfefec6,0xfefec5,0xfefec6,0xfefec5,0xfefec5,0xfefec5,0xfefec5,0xfefec5,0xdefec5,0xdefec6,0xe0fec7,0xe0fec8,0xe0fec9,0xe0fec8,0xe0fec8,0xdffec8,0xdffec8,0xdffec8,0xe0fec8,0xe0fec8,0xdffec8,0xdffec8,0xe0fec8,0xe0fec8,0xd0fecb,0xd0feca,0xd1fecb,0xd1fecb,0xd1feca,0xd1fecb,0xd1fecb,0xd1fecb,0xd1feca,0xd1fecb,0xd1feca,0xd1fecb,0xd1fecb,0xd1feca,0xd1feca,0xd3fecd,0xcefecd,0xcefece,0xcefecd,0xcefece,0xcefecd,0xcefecd,0xcefecd,0xcefecd,0xcefecd,0xcefecd,0xcefecd,0xcefecd,0xcdfecc,0xd0fdcf,0xd1fed0,0xd0fecf,0xd1fed5,0xd0fed4,0xd0fdd5,0xd0fed5,0xd0fed4,0xd1fed4,0xd0fed4,0xd1fed5,0xd0fed4,0xd1fdd5,0xd0fed5,0xd3fed6,0xd3fdd7,0xd3fdd7,0xd2fed6,0xd3fed6,0xd2fde4,0xd2fee4,0xd3fee4,0xd3fee4,0xd3fde4,0xd3fee4,0xd2fde4,0xd2fee4,0xd3fee5,0xd5fee6,0xd5fee5,0xd5fde6,0xd5fee5,0xd6fee6,0xd5fee5,0xd5fde5,0xd5fefd,0xd5fefd,0xd5fdfd,0xd5fefd,0xd5fdfd,0xd5fefd,0xd5fefd,0xd5fdfd,0xd7fefd,0xd8fdfd,0xd8fefd,0xd7fefd,0xd7fefd,0xd7fefd,0xd8fdfd,0xd8fdfd,0xd8e0fd,0xd8e0fd,0xd7e1fd,0xd7e0fd,0xd8e1fd,0xd8e0fd,0xdae2fd,0xd9e2fd,0xd9e2fd,0xdae2fd,0xdae2fd,0xdae2fd,0xdae2fd,0xd9e2fd,0xdae3fd,0xdae2fd,0xd9dafd,0xdadafd,0xdadafd,0xd9dafd,0xdddcfd,0xdcdcfd,0xdcdcfd,0xdddcfd,0xdcddfd,0xdcdbfd,0xdcdcfd,0xdcdcfd,0xdcdcfd,0xdcdcfd,0xdcdcfd,0xdcdcfd,0xe0dcfd,0xdfdcfd,0xe1defd,0xe1defd,0xe2defd,0xe1defd,0xe1defd,0xe2defd,0xe2dffd,0xe1defd,0xe2dffd,0xe2dffd,0xe2defd,0xe2defd,0xe2defd,0xe2defc,0xebdefd,0xece0fc,0xece0fc,0xede0fd,0xede1fd,0xece0fc,0xece1fd,0xece1fd,0xece1fd,0xede1fd,0xede1fd,0xece0fc,0xede0fd,0xede0fc,0xece1fc,
+0xfec1c0,0xfec1c0,0xfec1c0,0xfec1c0,0xfec1c0,0xfec1c0,0xfec1c0,0xfec1c0,0xfec4c3,0xfec4c3,0xfec3c3,0xfec4c3,0xfec7c3,0xfec7c3,0xfec7c3,0xfec7c3,0xfec7c3,0xfec7c3,0xfec7c3,0xfec8c3,0xfec7c3,0xfec7c3,0xfecac5,0xfec9c5,0xfecac6,0xfec9c6,0xfecac5,0xfecac6,0xfed4c6,0xfed3c5,0xfed3c6,0xfed4c5,0xfed4c5,0xfed4c5,0xfed4c5,0xfed4c6,0xfed6c8,0xfed6c8,0xfed5c8,0xfed5c8,0xfed6c8,0xfed6c8,0xfed5c8,0xfed6c8,0xfed5c8,0xfed5c7,0xfed6c8,0xfed6c8,0xfed6c8,0xfed5c8,0xfed7ca,0xfed7cb,0xfed7cb,0xfed7ca,0xfed7ca,0xfed7cb,0xfed8cb,0xfed7ca,0xfed7ca,0xfed7ca,0xfee8cb,0xfee7cb,0xfee7cb,0xfee8cb,0xfee8cb,0xfee8cd,0xfee9cc,0xfee9cd,0xfee8cd,0xfee8cc,0xfee9cd,0xfee9cd,0xfee9cd,0xfee9cd,0xfee9cd,0xfee8cd,0xfefecd,0xfdfecd,0xfefecd,0xfefecf,0xfefecf,0xfefecf,0xfefecf,0xfdfdcf,0xfefed0,0xfefed0,0xfdfed0,0xfefecf,0xfefdd0,0xfefed0,0xfefecf,0xfefecf,0xe3fed0,0xe5fed2,0xe5fdd2,0xe5fed2,0xe5fdd2,0xe5fdd2,0xe5fed2,0xe5fed1,0xe4fed1,0xe5fed2,0xe5fed2,0xe5fed2,0xe5fed1,0xe5fed2,0xe5fed2,0xe6fed4,0xd9fed4,0xd9fed4,0xd9fed4,0xd9fed4,0xd9fed4,0xd9fed5,0xdafed4,0xd9fdd4,0xd9fdd5,0xdafdd4,0xdafdd4,0xdafed4,0xd9fed4,0xd9fed4,0xdbfed6,0xdcfed7,0xd7fed7,0xd7fed7,0xd7fdd6,0xd8fed7,0xd7fdd6,0xd8fed6,0xd8fdd7,0xd7fdd7,0xd7fdd6,0xd8fed7,0xd7fed6,0xd7fed6,0xdafed8,0xdafed9,0xdafed9,0xd9fed9,0xdafedc,0xdafedd,0xdafedd,0xdafedd,0xdafedd,0xdafedd,0xd9fedd,0xdafddc,0xd9fedd,0xd9fedc,0xdcfdde,0xdcfddf,0xdcfddf,0xdcfddf,0xdcfedf,0xddfedf,0xdcfde9,0xdcfde9,0xdcfde9,0xdcfee9,0xdcfee9,0xddfde9,0xdcfde9,0xdcfee9,0xdefeea,0xdffdea,0xdefdea,0xdefdea,0xdefdea,0xdefdea,0xdefdeb,0xdefdea,0xdefdfd,0xdefdfd,0xdefefd,0xdefefd,0xdefefd,0xdefefd,0xdffefd,0xe0fdfd,0xe0fdfd,0xe0fdfd,0xe0fdfd,0xe0fdfc,0xe1fdfc,0xe1fdfc,0xe0fefd,0xe0fdfd,0xe1e7fd,0xe0e8fd,0xe1e7fd,0xe1e7fd,0xe0e7fd,0xe3e9fd,0xe2e9fd,0xe3e9fd,0xe3e9fd,0xe3e9fd,0xe3e9fc,0xe3e9fd,0xe3e9fd,0xe2e9fd,0xe2e9fd,0xe3e9fd,0xe2e3fd,0xe3e2fd,0xe3e3fc,0xe5e5fd,0xe5e5fd,0xe5e5fd,0xe5e5fc,0xe5e5fc,0xe5e5fd,0xe5e5fc,0xe5e5fd,0xe5e5fd,0xe5e5fd,0xe5e5fd,0xe5e5fc,0xe6e5fd,0xe7e5fc,0xe8e5fd,0xe9e7fc,0xeae8fd,0xeae7fc,0xe9e6fd,0xe9e7fc,0xeae7fd,0xe9e7fc,0xe9e7fd,0xeae7fd,0xe9e6fd,0xe9e7fd,0xe9e7fd,0xe9e7fd,0xe9e7fc,0xf1e9fd,0xf2e9fd,0xf1e9fd,0xf2e9fd,0xf1e9fc,0xf1e9fc,0xf1e9fc,0xf1e9fc,0xf1eafd,0xf2e9fc,0xf2eafd,0xf1eafc,0xf1e8fc,0xf1e9fd,0xf2ebfd,
+0xfecbca,0xfecbca,0xfeccca,0xfeccca,0xfecbcb,0xfecbcb,0xfecccb,0xfdcecd,0xfececd,0xfececd,0xfececd,0xfececd,0xfdd1cd,0xfed1cd,0xfed1cd,0xfed1cd,0xfed1cd,0xfed0cd,0xfed0cd,0xfed0cd,0xfed0cc,0xfdd2cf,0xfed3d0,0xfed3cf,0xfed3d0,0xfed3d0,0xfed3cf,0xfed3cf,0xfedbd0,0xfedbcf,0xfedbcf,0xfddbcf,0xfedbcf,0xfddbcf,0xfedbcf,0xfeddd2,0xfdddd2,0xfeddd2,0xfeddd2,0xfeddd2,0xfeddd2,0xfeddd2,0xfeddd2,0xfdddd2,0xfeddd2,0xfdddd2,0xfedcd2,0xfdddd2,0xfeddd2,0xfeded4,0xfeded4,0xfeded4,0xfdded4,0xfeded4,0xfedfd4,0xfddfd4,0xfddfd4,0xfeded5,0xfedfd4,0xfeded4,0xfdebd5,0xfeebd4,0xfdebd4,0xfeebd4,0xfeecd6,0xfeecd7,0xfdecd7,0xfeecd6,0xfeedd6,0xfeecd6,0xfdecd7,0xfdecd7,0xfeecd7,0xfeedd7,0xfeecd7,0xfeecd7,0xfefed7,0xfefed6,0xfdfed9,0xfefed9,0xfefed9,0xfdfed9,0xfdfdd9,0xfefdd9,0xfefed9,0xfdfdd9,0xfefdd9,0xfefed9,0xfefed9,0xfdfed9,0xfdfdd9,0xfefed9,0xeafddb,0xeafedb,0xeafedb,0xeafddb,0xeafddb,0xeafddb,0xeafedb,0xeafddb,0xeafddb,0xeafedb,0xeafedb,0xeafddb,0xeafedb,0xeafedb,0xebfede,0xebfede,0xe2fede,0xe1fede,0xe2fedd,0xe2fddd,0xe2fdde,0xe2fdde,0xe2fedd,0xe1fede,0xe1fdde,0xe2fedd,0xe1fedd,0xe1fedd,0xe1fddd,0xe4fddf,0xe4fde0,0xe3fde0,0xe1fde0,0xe0fee0,0xe1fde0,0xe0fde0,0xe1fee0,0xe1fddf,0xe0fddf,0xe1fee0,0xe0fee0,0xe0fde0,0xe1fde0,0xe3fee2,0xe3fde2,0xe3fee2,0xe3fee2,0xe3fde2,0xe3fde5,0xe2fee4,0xe3fde4,0xe3fde5,0xe3fde5,0xe3fde5,0xe3fde4,0xe3fde5,0xe3fee5,0xe5fee7,0xe5fde6,0xe5fee6,0xe5fde7,0xe5fde6,0xe5fee7,0xe5fee7,0xe4feee,0xe5fdee,0xe5feee,0xe5fdee,0xe5fdee,0xe5fdee,0xe5feef,0xe5feee,0xe7fdef,0xe7fdf0,0xe7fdef,0xe7fdef,0xe7feef,0xe7fef0,0xe7feef,0xe7fdef,0xe7fdfd,0xe7fdfd,0xe7fdfd,0xe7fdfd,0xe6fdfd,0xe7fdfd,0xe9fefc,0xe9fdfd,0xe9fdfd,0xe9fdfd,0xe9fdfd,0xe9fdfc,0xe9fdfc,0xe9fefc,0xeafdfc,0xe9fdfc,0xe9eefc,0xe9eefc,0xe9eefc,0xe9eefc,0xebeffd,0xeceffc,0xebf0fc,0xebeffd,0xebeffc,0xebeffd,0xeceffc,0xebeffc,0xebf0fd,0xebeffc,0xecf0fd,0xeceffd,0xebebfd,0xecebfc,0xededfd,0xededfc,0xedeefd,0xeeeefd,0xededfd,0xededfc,0xededfd,0xedeefd,0xeeeefd,0xededfd,0xeeeefc,0xededfd,0xededfd,0xededfc,0xefedfd,0xf0effc,0xf1f0fc,0xf1effc,0xf1effd,0xf0f0fc,0xf1f0fc,0xf1effc,0xf0effc,0xf1effd,0xf1effc,0xf1effd,0xf0effc,0xf0effc,0xf1effc,0xf3f1fc,0xf6f2fc,0xf6f1fd,0xf6f1fc,0xf6f1fc,0xf6f1fc,0xf6f1fc,0xf6f1fc,0xf6f2fd,0xf6f1fc,0xf6f2fc,0xf6f1fc,0xf6f1fc,0xf6f1fc,0xf7f3fc,0xf7f4fc,
+0xfdd5d4,0xfed5d4,0xfed5d4,0xfed5d4,0xfed5d4,0xfed5d5,0xfed7d7,0xfed8d7,0xfed7d6,0xfed7d6,0xfdd8d7,0xfed8d6,0xfddad6,0xfedad7,0xfedad7,0xfedad7,0xfedad6,0xfddad7,0xfedad7,0xfddad6,0xfddcd9,0xfddcd9,0xfedbd8,0xfedcd9,0xfddbd9,0xfddcd9,0xfddcd9,0xfddcd9,0xfde2d9,0xfee2d9,0xfee2d9,0xfee2d9,0xfee2d9,0xfde2d9,0xfee4db,0xfee3db,0xfde4db,0xfee3db,0xfee4db,0xfde4db,0xfde4db,0xfde4db,0xfee4dc,0xfde4db,0xfde4db,0xfee3db,0xfde3da,0xfde4db,0xfee5dd,0xfde6de,0xfde5dd,0xfee5dd,0xfee5dd,0xfee6de,0xfee6de,0xfde5dd,0xfde6dd,0xfee5de,0xfde5de,0xfee5dd,0xfdf0de,0xfdefdd,0xfdefdd,0xfdf0df,0xfef0e0,0xfdf0e0,0xfef0e0,0xfef0e0,0xfef0e0,0xfef0e0,0xfef0df,0xfdf0df,0xfdf0e0,0xfef1df,0xfdf0e0,0xfdf0e0,0xfdfee0,0xfdfde2,0xfefde2,0xfefde2,0xfdfee2,0xfdfee2,0xfefde2,0xfefde1,0xfdfde2,0xfefee2,0xfefee2,0xfefde2,0xfefee2,0xfdfee2,0xfdfee2,0xfdfde4,0xeffde3,0xeffee4,0xeffde4,0xeffde3,0xeffde4,0xeffde4,0xeffde4,0xeffde4,0xeefde4,0xeffde4,0xeffee4,0xeffde4,0xeffde4,0xeffee4,0xf0fde6,0xf0fde6,0xe9fde6,0xe9fee6,0xe9fde6,0xe9fde6,0xe9fde6,0xe9fee6,0xe9fee6,0xe9fee6,0xeafde6,0xe9fde6,0xe9fee7,0xe9fde6,0xebfde8,0xebfee8,0xebfde9,0xebfee8,0xe9fde8,0xe9fee9,0xe9fde8,0xe9fde8,0xe9fde8,0xe9fee8,0xe9fde9,0xeafde8,0xe9fde8,0xe9fde9,0xebfdea,0xebfeea,0xebfdeb,0xebfdea,0xebfeea,0xebfeea,0xecfeec,0xebfdec,0xebfeec,0xebfdec,0xebfeec,0xecfdec,0xebfdec,0xebfeec,0xeefdee,0xeefdef,0xedfdee,0xedfdee,0xedfdee,0xeefdee,0xedfdee,0xedfdee,0xedfdf2,0xedfef2,0xedfdf3,0xedfdf3,0xedfdf3,0xeefdf3,0xedfef2,0xeffdf4,0xf0fdf4,0xeffdf4,0xf0fdf4,0xeffdf4,0xf0fef4,0xeffdf4,0xf0fef4,0xeffef4,0xeffdfd,0xeffefc,0xeffdfd,0xeffdfc,0xeffefd,0xf1fefc,0xf2fdfc,0xf2fefc,0xf1fdfc,0xf2fdfc,0xf1fdfd,0xf2fefd,0xf2fdfd,0xf1fdfc,0xf1fdfc,0xf1fefc,0xf1f4fd,0xf2f4fc,0xf1f4fc,0xf4f6fc,0xf3f5fc,0xf3f6fc,0xf3f6fc,0xf3f6fc,0xf3f6fc,0xf4f6fd,0xf3f6fc,0xf3f5fd,0xf4f6fc,0xf3f5fc,0xf3f5fd,0xf3f6fc,0xf3f3fc,0xf5f5fc,0xf5f5fc,0xf5f5fc,0xf5f5fc,0xf5f5fc,0xf5f6fd,0xf6f6fc,0xf5f5fc,0xf6f6fc,0xf6f6fc,0xf5f6fd,0xf5f5fc,0xf6f5fc,0xf5f5fc,0xf5f5fc,0xf7f7fc,0xf8f8fc,0xf8f7fc,0xf8f7fc,0xf8f7fc,0xf8f8fc,0xf8f7fd,0xf8f7fc,0xf8f7fc,0xf8f7fc,0xf7f7fc,0xf8f7fc,0xf8f8fc,0xf8f7fc,0xfafafc,0xfaf9fc,0xfaf9fc,0xfaf9fc,0xfbf9fc,0xfbf9fc,0xfbf9fc,0xfbfafc,0xfbf9fc,0xfaf9fc,0xfafafc,0xfbf9fc,0xfaf9fc,0xfbf9fc,0xfcfcfc,0xfcfbfc,0xfbfbfc,
+0xfddede,0xfedede,0xfddedd,0xfedede,0xfedfde,0xfde0e0,0xfee0df,0xfde1e0,0xfee1df,0xfee0df,0xfee1e0,0xfee0e0,0xfde2df,0xfee2df,0xfde2df,0xfee2e0,0xfee2e0,0xfde3df,0xfee2df,0xfde4e1,0xfde4e2,0xfde4e2,0xfee4e1,0xfee4e1,0xfde4e2,0xfde4e2,0xfee4e2,0xfee4e2,0xfde9e2,0xfee9e2,0xfde8e1,0xfee9e2,0xfee9e2,0xfeebe3,0xfeebe4,0xfdeae4,0xfdeae4,0xfeeae4,0xfeeae5,0xfdebe4,0xfeebe4,0xfdeae4,0xfdeae4,0xfdeae5,0xfdeae4,0xfdebe4,0xfdeae4,0xfdeae4,0xfeece6,0xfdece6,0xfdece6,0xfdece6,0xfdece6,0xfdece6,0xfdece7,0xfdece6,0xfeece6,0xfdece6,0xfeece6,0xfdece6,0xfdf3e6,0xfdf3e6,0xfef4e8,0xfdf4e8,0xfef4e8,0xfdf4e8,0xfef4e8,0xfef4e8,0xfdf4e8,0xfdf4e8,0xfdf4e8,0xfdf4e8,0xfef3e8,0xfdf4e9,0xfdf4e8,0xfef4e8,0xfdfeea,0xfefeea,0xfdfeea,0xfefdea,0xfdfdeb,0xfdfdea,0xfdfdea,0xfdfdea,0xfdfdea,0xfdfeea,0xfefeea,0xfdfeea,0xfdfdeb,0xfdfeeb,0xfdfdec,0xfefeed,0xf3fdec,0xf4fded,0xf3fdec,0xf4feec,0xf3fded,0xf4fdec,0xf3feec,0xf4fdec,0xf4fdec,0xf4fded,0xf3fded,0xf4feec,0xf3fded,0xf5feef,0xf5fdee,0xf5fdee,0xf1feef,0xf0feee,0xf1feee,0xf0feee,0xf1feee,0xf0feef,0xf0fdee,0xf1fdee,0xf0fdee,0xf1fdee,0xf1feee,0xf3fdf0,0xf2fdf0,0xf2fdf0,0xf2fdf0,0xf3fef1,0xf2fdf0,0xf2fdf0,0xf1fdf0,0xf2fdf1,0xf1fdf0,0xf1fdf1,0xf2fef0,0xf1fef1,0xf1fdf0,0xf3fdf2,0xf3fef2,0xf3fdf2,0xf3fef3,0xf3fdf2,0xf4fdf2,0xf3fdf2,0xf3fdf3,0xf3fdf3,0xf4fdf4,0xf4fdf3,0xf3fdf3,0xf3fdf3,0xf3fdf3,0xf5fdf5,0xf5fdf5,0xf5fdf6,0xf6fdf5,0xf5fdf5,0xf5fef5,0xf6fdf5,0xf5fdf5,0xf5fdf5,0xf6fdf8,0xf5fdf8,0xf5fdf7,0xf5fdf8,0xf5fdf8,0xf5fdf7,0xf7fef8,0xf7fdf8,0xf8fdf9,0xf8fdf9,0xf7fef9,0xf7fdf9,0xf7fdf8,0xf7fdf8,0xf7fdf9,0xf7fdf9,0xf7fdfc,0xf8fdfc,0xf7fdfc,0xf7fdfc,0xf9fdfd,0xf9fdfc,0xfafdfd,0xf9fdfc,0xf9fdfc,0xf9fdfc,0xf9fdfc,0xf9fdfd,0xfafdfc,0xfafdfc,0xf9fdfc,0xf9fdfc,0xf9fafc,0xfafbfc,0xfbfcfc,0xfbfcfc,0xfbfcfc,0xfbfbfc,0xfbfcfc,0xfbfcfc,0xfbfcfc,0xfbfcfc,0xfbfcfc,0xfbfcfd,0xfbfcfc,0xfbfbfc,0xfbfbfc,0xfbfcfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,
+0xfde7e6,0xfde7e6,0xfee7e6,0xfde7e6,0xfde9e8,0xfde9e8,0xfde9e8,0xfde9e9,0xfde9e8,0xfde9e8,0xfde9e8,0xfdeae9,0xfdeae8,0xfeeae8,0xfdeae9,0xfdeae8,0xfdeae8,0xfdeae8,0xfdecea,0xfdeceb,0xfeedea,0xfeecea,0xfdecea,0xfdecea,0xfdecea,0xfeecea,0xfeecea,0xfdeceb,0xfdf0ea,0xfdefea,0xfeefeb,0xfeefea,0xfdf1ec,0xfdf1ed,0xfef1ed,0xfef0ec,0xfef0ec,0xfdf1ec,0xfdf1ed,0xfdf0ed,0xfdf1ed,0xfdf1ec,0xfdf0ec,0xfdf1ec,0xfdf1ed,0xfdf1ec,0xfdf1ec,0xfdf3ee,0xfdf3ee,0xfdf2ef,0xfdf2ee,0xfef3ee,0xfdf2ef,0xfef2ee,0xfdf2ee,0xfdf2ee,0xfdf3ef,0xfdf2ee,0xfdf2ef,0xfdf2ef,0xfef7ee,0xfdf8f1,0xfdf8f0,0xfdf7f0,0xfdf8f1,0xfdf7f0,0xfdf7f0,0xfdf8f1,0xfef8f0,0xfdf8f1,0xfdf8f1,0xfdf8f0,0xfdf7f0,0xfdf7f1,0xfdf8f0,0xfdf9f3,0xfdfdf3,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf2,0xfdfdf3,0xfdfdf3,0xfdfef5,0xfdfdf4,0xfdfdf5,0xf8fdf4,0xf8fdf4,0xf9fdf4,0xf8fdf4,0xf9fef4,0xf8fdf5,0xf9fdf4,0xf8fdf5,0xf8fdf4,0xf8fdf4,0xf8fdf4,0xf9fdf4,0xfafdf6,0xfafdf6,0xf9fdf6,0xfafdf6,0xf8fdf6,0xf8fdf6,0xf8fdf7,0xf7fdf7,0xf8fdf6,0xf8fdf7,0xf7fdf7,0xf8fdf6,0xf8fdf7,0xf8fdf6,0xfafdf8,0xfafdf8,0xf9fdf8,0xfafdf8,0xf9fdf8,0xf9fdf8,0xf9fdf8,0xf9fdf8,0xf9fdf8,0xf9fdf8,0xf9fdf8,0xfafdf8,0xfafdf8,0xfafdf8,0xfcfdfa,0xfbfefa,0xfbfdfa,0xfbfdfa,0xfbfdfa,0xfbfdfa,0xfbfdfa,0xfbfdfa,0xfcfdfa,0xfcfdfa,0xfcfdfa,0xfbfdfb,0xfbfdfa,0xfcfdfb,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,0xfdfdfc,
+};
+const cm::sprite_item item = {width, height, data, nullptr, nullptr, 0, rgb};
 }
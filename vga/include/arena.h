@@ -0,0 +1,99 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+
+namespace cm
+{
+
+// Linear (bump) allocator over a fixed buffer. Allocation is a pointer bump,
+// there is no per-object free: the whole arena is reset at once.
+class Arena
+{
+private:
+    uint8_t *base;
+    uint32_t capacity;
+    uint32_t offset;
+    uint32_t high_water; // Largest offset ever reached
+    uint32_t failed;     // Allocations that did not fit
+
+public:
+    constexpr Arena(uint8_t *buffer, uint32_t size) : base(buffer), capacity(size), offset(0),
+                                                      high_water(0), failed(0) {}
+
+    // Allocate size bytes aligned to align (a power of two); nullptr when full
+    void *alloc(uint32_t size, uint32_t align = 16)
+    {
+        uint32_t start = (offset + align - 1) & ~(align - 1);
+        if (start + size > capacity || start + size < start)
+        {
+            failed++;
+            return nullptr;
+        }
+        offset = start + size;
+        if (offset > high_water)
+            high_water = offset;
+        return base + start;
+    }
+
+    template <typename T>
+    T *alloc_array(uint32_t count)
+    {
+        return static_cast<T *>(alloc(sizeof(T) * count, alignof(T) > 16 ? alignof(T) : 16));
+    }
+
+    // Free everything allocated so far
+    void reset()
+    {
+        offset = 0;
+    }
+
+    // Save and restore the fill level to drop a group of temporary allocations
+    uint32_t mark() const
+    {
+        return offset;
+    }
+
+    void rewind(uint32_t marker)
+    {
+        if (marker <= offset)
+            offset = marker;
+    }
+
+    uint32_t used() const { return offset; }
+    uint32_t size() const { return capacity; }
+    uint32_t peak() const { return high_water; }
+    uint32_t failures() const { return failed; }
+};
+
+// Scratch memory for a single frame, reset by cm::update() after presenting
+#define FRAME_ARENA_SIZE (256 * 1024)
+// Memory that lives as long as the current level, reset by cm::reset_level()
+#define LEVEL_ARENA_SIZE (1024 * 1024)
+
+alignas(16) uint8_t frame_arena_buffer[FRAME_ARENA_SIZE];
+alignas(16) uint8_t level_arena_buffer[LEVEL_ARENA_SIZE];
+
+Arena frame_arena(frame_arena_buffer, FRAME_ARENA_SIZE);
+Arena level_arena(level_arena_buffer, LEVEL_ARENA_SIZE);
+
+// Per-frame scratch allocation, valid until the end of the current frame
+void *frame_alloc(uint32_t size, uint32_t align = 16)
+{
+    return frame_arena.alloc(size, align);
+}
+
+// Allocation that stays valid until the next reset_level()
+void *level_alloc(uint32_t size, uint32_t align = 16)
+{
+    return level_arena.alloc(size, align);
+}
+
+void reset_level()
+{
+    level_arena.reset();
+}
+
+} // namespace cm
+
+#endif // ARENA_H
@@ -0,0 +1,145 @@
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <stdint.h>
+#include "pixel_format.h"
+
+namespace cm
+{
+
+// Translucency. For 8-bit palette indices every mode is a 256x256 table of
+// the palette entry nearest to the mix of a source and a destination
+// colour, so blending a pixel is one load: table[src][dest]. True-colour
+// pixels are mixed channel by channel.
+enum blend_mode
+{
+    BLEND_NONE,
+    BLEND_HALF,   // 50% mix
+    BLEND_ADD,    // Additive, saturating; glows
+    BLEND_SHADOW, // Multiply; grey sprites darken what is under them
+    BLEND_MODES,
+};
+
+uint8_t blend_tables[BLEND_MODES - 1][256][256];
+
+// Nearest palette entry for each colour at 5 bits per component
+uint8_t inverse_palette[32 * 32 * 32];
+
+// Build the tables for a palette (6-bit DAC components). Run again after
+// changing the palette base colours.
+void build_blend_tables(const uint8_t (*rgb)[3])
+{
+    for (int cell = 0; cell < 32 * 32 * 32; cell++)
+    {
+        int r = (cell >> 10) * 2, g = ((cell >> 5) & 31) * 2, b = (cell & 31) * 2;
+        int best = 0, best_distance = 0x7FFFFFFF;
+        for (int i = 0; i < 256 && best_distance > 0; i++)
+        {
+            int dr = rgb[i][0] - r, dg = rgb[i][1] - g, db = rgb[i][2] - b;
+            int distance = dr * dr + dg * dg + db * db;
+            if (distance < best_distance)
+            {
+                best = i;
+                best_distance = distance;
+            }
+        }
+        inverse_palette[cell] = (uint8_t)best;
+    }
+
+    for (int s = 0; s < 256; s++)
+    {
+        for (int d = 0; d < 256; d++)
+        {
+            int mix[BLEND_MODES - 1][3];
+            for (int c = 0; c < 3; c++)
+            {
+                int a = rgb[s][c], b = rgb[d][c];
+                mix[BLEND_HALF - 1][c] = (a + b + 1) / 2;
+                mix[BLEND_ADD - 1][c] = a + b < 63 ? a + b : 63;
+                mix[BLEND_SHADOW - 1][c] = a * b / 63;
+            }
+            for (int m = 0; m < BLEND_MODES - 1; m++)
+            {
+                // Keep exact results exact; the inverse palette is coarser
+                // than the DAC
+                if (mix[m][0] == rgb[d][0] && mix[m][1] == rgb[d][1] && mix[m][2] == rgb[d][2])
+                {
+                    blend_tables[m][s][d] = (uint8_t)d;
+                    continue;
+                }
+                if (mix[m][0] == rgb[s][0] && mix[m][1] == rgb[s][1] && mix[m][2] == rgb[s][2])
+                {
+                    blend_tables[m][s][d] = (uint8_t)s;
+                    continue;
+                }
+                int cell = ((mix[m][0] >> 1) << 10) | ((mix[m][1] >> 1) << 5) | (mix[m][2] >> 1);
+                blend_tables[m][s][d] = inverse_palette[cell];
+            }
+        }
+    }
+}
+
+// Blend a run of source indices into the destination. BLEND_NONE has no
+// table (callers copy instead), so it and unknown modes draw nothing.
+void blend_span(uint8_t *dest, const uint8_t *src, uint32_t count, blend_mode mode)
+{
+    if (mode <= BLEND_NONE || mode >= BLEND_MODES)
+        return;
+    const uint8_t (*table)[256] = blend_tables[mode - 1];
+    for (uint32_t i = 0; i < count; i++)
+        dest[i] = table[src[i]][dest[i]];
+}
+
+// The modes on XRGB8888 colours, rounding like the tables
+uint32_t blend_rgb_half(uint32_t a, uint32_t b)
+{
+    return (a | b) - (((a ^ b) & 0xFEFEFE) >> 1);
+}
+
+uint32_t blend_rgb_add(uint32_t a, uint32_t b)
+{
+    uint32_t mix = 0;
+    for (int shift = 0; shift < 24; shift += 8)
+    {
+        uint32_t sum = ((a >> shift) & 255) + ((b >> shift) & 255);
+        mix |= (sum < 255 ? sum : 255) << shift;
+    }
+    return mix;
+}
+
+uint32_t blend_rgb_shadow(uint32_t a, uint32_t b)
+{
+    uint32_t mix = 0;
+    for (int shift = 0; shift < 24; shift += 8)
+        mix |= ((a >> shift) & 255) * ((b >> shift) & 255) / 255 << shift;
+    return mix;
+}
+
+// Blend a run of true-colour source pixels into the destination; the mode
+// is picked once per run, so each loop is branch-free
+template <pixel_format F>
+void blend_span_rgb(typename pixel_traits<F>::type *dest, const typename pixel_traits<F>::type *src, uint32_t count,
+                    blend_mode mode)
+{
+    switch (mode)
+    {
+    case BLEND_HALF:
+        for (uint32_t i = 0; i < count; i++)
+            dest[i] = pack_rgb<F>(blend_rgb_half(unpack_rgb<F>(src[i]), unpack_rgb<F>(dest[i])));
+        break;
+    case BLEND_ADD:
+        for (uint32_t i = 0; i < count; i++)
+            dest[i] = pack_rgb<F>(blend_rgb_add(unpack_rgb<F>(src[i]), unpack_rgb<F>(dest[i])));
+        break;
+    case BLEND_SHADOW:
+        for (uint32_t i = 0; i < count; i++)
+            dest[i] = pack_rgb<F>(blend_rgb_shadow(unpack_rgb<F>(src[i]), unpack_rgb<F>(dest[i])));
+        break;
+    default:
+        break;
+    }
+}
+
+} // namespace cm
+
+#endif // BLEND_H
@@ -1,14 +1,38 @@
 #include "consts.h"
+#include "memops.h"
+#include "paging.h"
+#include "arena.h"
+#include "ring.h"
+#include "damage.h"
+#include "pixel_format.h"
+#include "fixed.h"
+#include "blend.h"
 
 // Timer variables
 volatile uint64_t timer_ticks = 0;
-volatile bool frame_ready = false;
+
+// Frame signals from the timer ISR: the tick at which each frame started
+cm::SpscRing<uint32_t, 16> frame_events;
 
 volatile bool key_status[58] = {false};
 volatile bool key_hit[58] = {false};
 
 volatile multiboot_info *mbi = nullptr;
 
+// Read the 64-bit tick counter without tearing. The ISR can bump it between
+// the two 32-bit loads, so retry until the high word is the same on both sides.
+uint64_t read_ticks()
+{
+    volatile uint32_t *words = (volatile uint32_t *)&timer_ticks;
+    uint32_t hi, lo;
+    do
+    {
+        hi = words[1];
+        lo = words[0];
+    } while (hi != words[1]);
+    return ((uint64_t)hi << 32) | lo;
+}
+
 // Function to read a byte from an I/O port
 static inline uint8_t inb(uint16_t port)
 {
@@ -56,7 +80,40 @@ volatile uint8_t *vga_memory_13h = (uint8_t *)0xA0000;
 
 // VESA LFB (Linear Frame Buffer) memory base
 volatile uint8_t *vesa_lfb = (uint8_t *)DEFAULT_LFB_ADDRESS;
-volatile uint8_t vesa_buffer[640 * 480 * 4];
+
+// The back buffer, in the framebuffer's pixel format, so room for the
+// widest one. Build with -DSCANLINE_ONLY to leave it out: scanline
+// rendering is then always on, and the paths that draw into a back buffer
+// (the default one, page flipping, scrolling, tiles) refuse to start.
+#ifndef SCANLINE_ONLY
+alignas(16) volatile uint8_t vesa_buffer[SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t)];
+#else
+volatile uint8_t *const vesa_buffer = nullptr;
+#endif
+
+// Bytes between framebuffer rows; the firmware may pad rows past the width
+uint32_t framebuffer_pitch = SCREEN_WIDTH;
+// How framebuffer pixels are stored, and so the back buffer's pixels
+cm::pixel_format framebuffer_format = cm::PIXEL_INDEXED8;
+// Part of the back buffer that fits on the real framebuffer
+uint32_t present_width = SCREEN_WIDTH;
+uint32_t present_height = SCREEN_HEIGHT;
+// rdtsc faults on CPUs without a TSC; set by cm::init()
+bool has_tsc = false;
+
+// Where drawing goes: vesa_buffer, or VRAM while page flipping or
+// scrolling is on. Rows are render_pitch pixels apart.
+volatile uint8_t *render_target = vesa_buffer;
+bool rendering_to_vram = false;
+
+// Size of the image the game draws. With render_scale > 1 it is a fraction
+// of the screen and presenting blows every pixel up into a
+// render_scale x render_scale block.
+#define MAX_RENDER_SCALE 3
+int render_width = SCREEN_WIDTH;
+int render_height = SCREEN_HEIGHT;
+int render_scale = 1;
+int render_pitch = SCREEN_WIDTH;
 
 // Interrupt Descriptor Table structures
 struct idt_entry
@@ -194,6 +251,39 @@ bool set_vesa_mode(uint16_t width, uint16_t height, uint16_t bpp, volatile uint8
     return true;
 }
 
+// Work out the pixel format of a framebuffer set up by the bootloader;
+// false for layouts we cannot present to (text mode, 15/24 bpp, BGR order)
+bool multiboot_pixel_format(volatile multiboot_info *mbi, cm::pixel_format *format)
+{
+    volatile uint8_t *fields = mbi->color_info; // Position and size of R, G, B
+    if (mbi->framebuffer_type == MULTIBOOT_FRAMEBUFFER_INDEXED && mbi->framebuffer_bpp == 8)
+    {
+        *format = cm::PIXEL_INDEXED8;
+        return true;
+    }
+    if (mbi->framebuffer_type != MULTIBOOT_FRAMEBUFFER_RGB)
+    {
+        return false;
+    }
+    if (mbi->framebuffer_bpp == 16 && fields[0] == 11 && fields[1] == 5 && fields[2] == 5 &&
+        fields[3] == 6 && fields[4] == 0 && fields[5] == 5)
+    {
+        *format = cm::PIXEL_RGB565;
+        return true;
+    }
+    if (mbi->framebuffer_bpp == 32 && fields[0] == 16 && fields[2] == 8 && fields[4] == 0)
+    {
+        *format = cm::PIXEL_XRGB8888;
+        return true;
+    }
+    return false;
+}
+
+// What is loaded into the DAC (6-bit components)
+uint8_t palette_rgb[256][3];
+// The palette the game edits; cm::update_palette() applies effects on top
+uint8_t palette_base[256][3];
+
 /**
  * Sets up a full 256-color palette with comprehensive color range
  *
@@ -207,6 +297,8 @@ bool set_vesa_mode(uint16_t width, uint16_t height, uint16_t bpp, volatile uint8
  */
 void setup_full_256_color_palette()
 {
+    int index = 0;
+
     // Tell VGA we're about to send palette data starting at index 0
     outb(VGA_DAC_WRITE_INDEX, 0);
 
@@ -226,6 +318,11 @@ void setup_full_256_color_palette()
                 outb(VGA_DAC_DATA, rv); // R component (0-63)
                 outb(VGA_DAC_DATA, gv); // G component (0-63)
                 outb(VGA_DAC_DATA, bv); // B component (0-63)
+
+                palette_rgb[index][0] = rv;
+                palette_rgb[index][1] = gv;
+                palette_rgb[index][2] = bv;
+                index++;
             }
         }
     }
@@ -245,32 +342,52 @@ void setup_full_256_color_palette()
         outb(VGA_DAC_DATA, gray);
         outb(VGA_DAC_DATA, gray);
         outb(VGA_DAC_DATA, gray);
+
+        palette_rgb[index][0] = gray;
+        palette_rgb[index][1] = gray;
+        palette_rgb[index][2] = gray;
+        index++;
     }
+
+    memcpy(palette_base, palette_rgb, sizeof(palette_base));
+
+    // True-colour framebuffers get the same colours through lookup tables
+    cm::build_palette_tables(palette_rgb);
+    cm::build_blend_tables(palette_rgb);
 }
 
-void plot_rgb(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+// Palette index of a color from the 6x6x6 cube (components 0..5). Must
+// match rgb_index() in scripts/import_img.py.
+uint8_t rgb_index(uint8_t r, uint8_t g, uint8_t b)
 {
-    if (x <= 640 && x >= 0 && y <= 480 && y >= 0)
-    {
-        // Clamp RGB values to valid range
-        r = (r > 5) ? 5 : r;
-        g = (g > 5) ? 5 : g;
-        b = (b > 5) ? 5 : b;
+    // Clamp RGB values to valid range
+    r = (r > 5) ? 5 : r;
+    g = (g > 5) ? 5 : g;
+    b = (b > 5) ? 5 : b;
 
-        // Calculate color index in our palette (based on 6×6×6 RGB cube)
-        uint8_t color = 36 * r + 6 * g + b;
+    // Special case for white - redirect to the brightest grayscale entry
+    if (r == 5 && g == 5 && b == 5)
+    {
+        return 255; // Last grayscale entry (pure white)
+    }
 
-        // Special case for white - redirect to the brightest grayscale entry
-        if (r == 5 && g == 5 && b == 5)
-        {
-            color = 255; // Last grayscale entry (pure white)
-        }
+    // Calculate color index in our palette (based on 6×6×6 RGB cube)
+    return 36 * r + 6 * g + b;
+}
 
-        // Set the pixel
-        vesa_buffer[y * 640 + x] = color;
+void plot_index(int x, int y, uint8_t color)
+{
+    if (x < render_width && x >= 0 && y < render_height && y >= 0)
+    {
+        render_target[y * render_pitch + x] = color;
     }
 }
 
+void plot_rgb(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    plot_index(x, y, rgb_index(r, g, b));
+}
+
 void scankey()
 {
     for (int t = 0; t < 58; t++)
@@ -296,32 +413,154 @@ void scankey()
 
 namespace cm
 {
-    struct pixel
+    int max(int a, int b)
+    {
+        return a > b ? a : b;
+    }
+
+    int min(int a, int b)
+    {
+        return a < b ? a : b;
+    }
+
+    // Run of opaque pixels within one row of a sprite
+    struct sprite_span
     {
-        uint8_t r;
-        uint8_t g;
-        uint8_t b;
+        uint16_t x;
+        uint16_t length;
     };
 
     struct sprite_item
     {
         int width;
         int height;
-        const pixel *data;
+        const uint8_t *data; // Palette indices, row by row
+        // Color-keyed sprites only (nullptr for opaque rectangles): the
+        // opaque spans of row y are spans[row_spans[y]..row_spans[y + 1])
+        const sprite_span *spans;
+        const uint32_t *row_spans;
+        int key; // Index of the see-through pixels, for keyed sprites
+        // XRGB8888 colours, row by row, that true-colour framebuffers show
+        // instead of the palette colours of data; nullptr if there are none
+        const uint32_t *rgb;
+    };
+
+    // Fixed-size bitmap font (scripts/import_font.py). Glyphs are stored as
+    // opaque spans like keyed sprites, so drawing a glyph row is one fill
+    // per run: row r of glyph g is
+    // spans[row_spans[g * glyph_height + r]..row_spans[g * glyph_height + r + 1])
+    struct font
+    {
+        int glyph_width;
+        int glyph_height;
+        int first_char;
+        int glyph_count;
+        const sprite_span *spans;
+        const uint32_t *row_spans;
     };
 
+#define MAX_FLIP_PAGES 3
+
     struct sprite_ptr
     {
         const sprite_item *item;
         int x, y, prev_x, prev_y;
+        int page_x[MAX_FLIP_PAGES], page_y[MAX_FLIP_PAGES]; // Last drawn on each page
+        blend_mode blend; // How it mixes with what is under it
+        uint8_t redraw_pages; // Pages to repaint though it has not moved, one bit each
+    };
+
+    // Sprite pool. Live sprites are packed at the front of sprites[] so the
+    // render loops only walk sprite_count entries; destroying one moves the
+    // last live sprite into its place. Games hold sprite_handles, which go
+    // through a slot table (slot -> dense index) and carry the generation
+    // of their slot, so a handle to a destroyed sprite is detected instead
+    // of silently aliasing whatever sprite reuses the slot.
+#define MAX_SPRITES 256
+#define INVALID_SPRITE_SLOT 0xFFFF
+
+    struct sprite_handle
+    {
+        uint16_t slot;
+        uint16_t generation;
+
+        bool valid() const;
+        sprite_ptr *operator->() const;
     };
 
-    sprite_ptr sprites[256];
+    struct sprite_slot
+    {
+        uint16_t dense;      // Index into sprites[] while the slot is live
+        uint16_t generation; // Bumped every time the slot is freed
+    };
+
+    sprite_ptr sprites[MAX_SPRITES];               // Live sprites, densely packed
+    uint16_t sprite_dense_slot[MAX_SPRITES];       // Slot of each dense entry
+    sprite_slot sprite_slots[MAX_SPRITES];
+    uint16_t sprite_free_slots[MAX_SPRITES];       // Stack of released slots
+    int sprite_free_count = 0;
+    int sprite_slots_used = 0;                     // Slots handed out at least once
     sprite_ptr background;
     int sprite_count = 0;
 
-    sprite_ptr *create_sprite(const sprite_item *item_, int x = 0, int y = 0)
+    // Regions of vesa_buffer that differ from the framebuffer. Everything
+    // that writes the back buffer reports here; present() copies only these
+    // regions unless they cover more than FULL_PRESENT_PERCENT of the screen.
+#define MAX_DAMAGE_RECTS 32
+#define FULL_PRESENT_PERCENT 50
+    DamageList<MAX_DAMAGE_RECTS> damage(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    void mark_damage(int x, int y, int width, int height)
+    {
+        damage.add(x, y, width, height);
+    }
+
+    void mark_full_damage()
+    {
+        damage.add_all();
+    }
+
+    // Resolve a handle; nullptr if its sprite has been destroyed
+    sprite_ptr *get_sprite(sprite_handle handle)
+    {
+        if (handle.slot >= sprite_slots_used || sprite_slots[handle.slot].generation != handle.generation)
+        {
+            return nullptr;
+        }
+        return &sprites[sprite_slots[handle.slot].dense];
+    }
+
+    bool sprite_handle::valid() const
+    {
+        return get_sprite(*this) != nullptr;
+    }
+
+    sprite_ptr *sprite_handle::operator->() const
+    {
+        return get_sprite(*this);
+    }
+
+    // Returns an invalid handle when all MAX_SPRITES sprites are live
+    sprite_handle create_sprite(const sprite_item *item_, int x = 0, int y = 0)
     {
+        sprite_handle handle = {INVALID_SPRITE_SLOT, 0};
+        if (sprite_count == MAX_SPRITES)
+        {
+            return handle;
+        }
+
+        if (sprite_free_count > 0)
+        {
+            handle.slot = sprite_free_slots[--sprite_free_count];
+        }
+        else
+        {
+            handle.slot = sprite_slots_used++;
+        }
+        handle.generation = sprite_slots[handle.slot].generation;
+        sprite_slots[handle.slot].dense = sprite_count;
+        sprite_dense_slot[sprite_count] = handle.slot;
+
         sprite_ptr *my_sprite;
         my_sprite = &sprites[sprite_count];
         my_sprite->item = item_;
@@ -329,360 +568,2440 @@ namespace cm
         my_sprite->y = y;
         my_sprite->prev_x = x;
         my_sprite->prev_y = y;
+        my_sprite->blend = BLEND_NONE;
+        my_sprite->redraw_pages = 0;
+        for (int page = 0; page < MAX_FLIP_PAGES; page++)
+        {
+            my_sprite->page_x[page] = x;
+            my_sprite->page_y[page] = y;
+        }
         sprite_count++;
-        return my_sprite;
+        mark_damage(x, y, item_->width, item_->height);
+        return handle;
     }
 
-    void draw_sprite(const sprite_item *item, int x, int y)
+    // Page flipping state; flip_pages is 1 while drawing into vesa_buffer
+    int flip_pages = 1;
+    int front_page = 0;
+    int back_page = 0;
+
+    // Scrolling state. The background lives in a virtual screen twice the
+    // screen size in both directions. World pixel (x, y) of the background
+    // is kept at virtual (x mod SCREEN_WIDTH, y mod SCREEN_HEIGHT) and its
+    // copies SCREEN_WIDTH to the right and SCREEN_HEIGHT down, so any
+    // screen-sized window at offsets below one screen is a consistent
+    // view: panning is a DISPI offset write plus refreshing the strip that
+    // came into view. There are two virtual screens, one above the other,
+    // flipped between like VRAM pages, so sprites are never erased and
+    // redrawn on the one being displayed.
+#define SCROLL_VIRT_WIDTH (SCREEN_WIDTH * 2)
+#define SCROLL_VIRT_HEIGHT (SCREEN_HEIGHT * 2)
+#define SCROLL_PAGES 2
+    bool scrolling = false;
+    int scroll_x = 0, scroll_y = 0;                           // Requested world position of the screen
+    int shown_x[SCROLL_PAGES] = {}, shown_y[SCROLL_PAGES] = {}; // Position each virtual screen holds
+    uint8_t scroll_refresh_pages = 0;                         // Virtual screens to redraw all of
+
+    // Compose the screen in tiles or line by line instead of drawing into
+    // render_target
+    bool tiled_rendering = false;
+#ifndef SCANLINE_ONLY
+    bool scanline_rendering = false;
+#else
+    bool scanline_rendering = true;
+#endif
+
+    // Move the screen to world position (x, y) of the background, clamped
+    // so the screen stays on it. Takes effect on the next update().
+    void scroll_to(int x, int y)
     {
-        for (int x_ = 0; x_ < item->width; x_++)
+        if (background.item)
         {
-            for (int y_ = 0; y_ < item->height; y_++)
-            {
-                const pixel *p = &item->data[y_ * item->width + x_];
-                plot_rgb(x + x_, y + y_, p->r, p->g, p->b);
-            }
+            x = min(x, background.item->width - SCREEN_WIDTH);
+            y = min(y, background.item->height - SCREEN_HEIGHT);
         }
+        scroll_x = max(x, 0);
+        scroll_y = max(y, 0);
     }
 
-    void set_background(const sprite_item *item_, int x = 0, int y = 0)
+    void scroll_by(int dx, int dy)
     {
-        background.item = item_;
-        background.x = x;
-        background.y = y;
-        background.prev_x = x;
-        background.prev_y = y;
-        draw_sprite(item_, x, y);
+        scroll_to(scroll_x + dx, scroll_y + dy);
     }
 
-    void beep(int frequency, int duration)
+    int wrap(int value, int period)
     {
-        // Set the speaker control register
-        int speaker_control_port = 0x43;
-        int speaker_data_port = 0x61;
-        int timer_0_channel = 0x0;
-
-        // Set the speaker's clock to the timer 0 clock
-        outb(speaker_control_port, 0x36);
+        value %= period;
+        return value < 0 ? value + period : value;
+    }
 
-        // Set the frequency
-        outb(speaker_data_port, 0x13); // for 1193180 Hz
-        outb(speaker_control_port, timer_0_channel);
+    // Top-left of the screen on a VRAM page; while scrolling, of the page's
+    // window into its virtual screen
+    volatile uint8_t *page_address(int page)
+    {
+        if (scrolling)
+        {
+            return vesa_lfb + page * SCROLL_VIRT_WIDTH * SCROLL_VIRT_HEIGHT +
+                   wrap(shown_y[page], SCREEN_HEIGHT) * SCROLL_VIRT_WIDTH + wrap(shown_x[page], SCREEN_WIDTH);
+        }
+        return vesa_lfb + page * SCREEN_WIDTH * SCREEN_HEIGHT;
+    }
 
-        // Start the speaker
-        outb(speaker_data_port, (0x0 | (1 << 7))); // Enable the speaker
-        outb(speaker_data_port, 0x00);
+    // Draw into a VRAM page. While scrolling, the page's window also decides
+    // where the background lies on the screen.
+    void select_page(int page)
+    {
+        render_target = page_address(page);
+        if (scrolling)
+        {
+            background.x = -shown_x[page];
+            background.y = -shown_y[page];
+        }
+    }
 
-        // Stop the speaker
-        outb(speaker_data_port, 0x0);
+    // Copy count pixels of an image, from pixel offset on, to a surface of
+    // pixel format F. Indexed surfaces take the indices; true-colour ones
+    // the image's own colours, or the palette colours of its indices.
+    template <pixel_format F>
+    void copy_pixels(typename pixel_traits<F>::type *dest, const sprite_item *item, uint32_t offset, uint32_t count)
+    {
+        if (!item->rgb)
+        {
+            const uint8_t *src = item->data + offset;
+            for (uint32_t i = 0; i < count; i++)
+                dest[i] = palette_lookup<F>(src[i]);
+            return;
+        }
+        const uint32_t *src = item->rgb + offset;
+        if (rgb_tinted)
+        {
+            for (uint32_t i = 0; i < count; i++)
+                dest[i] = pack_rgb<F>(tint_rgb(src[i]));
+            return;
+        }
+        for (uint32_t i = 0; i < count; i++)
+            dest[i] = pack_rgb<F>(src[i]);
     }
 
-    bool keydown(uint8_t c)
+    template <>
+    void copy_pixels<PIXEL_INDEXED8>(uint8_t *dest, const sprite_item *item, uint32_t offset, uint32_t count)
     {
-        return key_status[c];
+        // VRAM is never read back, so skip the cache for it
+        void *(*copy)(void *, const void *, uint32_t) = rendering_to_vram ? memcpy_stream_impl : memcpy_impl;
+        copy(dest, item->data + offset, count);
     }
 
-    bool keyhit(uint8_t c)
+    // Image colours staged for true-colour blending
+    alignas(16) uint32_t blend_row[SCREEN_WIDTH];
+
+    // Blend count pixels of an image, from pixel offset on, into a surface
+    // of pixel format F
+    template <pixel_format F>
+    void blend_pixels(typename pixel_traits<F>::type *dest, const sprite_item *item, uint32_t offset, uint32_t count,
+                      blend_mode blend)
     {
-        return key_hit[c];
+        typedef typename pixel_traits<F>::type pixel;
+        pixel *src = (pixel *)blend_row;
+        for (uint32_t done = 0; done < count; done += SCREEN_WIDTH)
+        {
+            uint32_t run = count - done < SCREEN_WIDTH ? count - done : SCREEN_WIDTH;
+            copy_pixels<F>(src, item, offset + done, run);
+            blend_span_rgb<F>(dest + done, src, run, blend);
+        }
     }
 
-    class PWMSpeaker
+    template <>
+    void blend_pixels<PIXEL_INDEXED8>(uint8_t *dest, const sprite_item *item, uint32_t offset, uint32_t count,
+                                      blend_mode blend)
     {
-    private:
-        const uint8_t *samples;   // 8-bit samples
-        const int16_t *samples16; // 16-bit samples
-        uint32_t sampleRate;
-        uint32_t numSamples;
-        uint8_t bitsPerSample;
-        uint32_t currentSample;
-        bool playing;
-        uint32_t tickCounter;
-        uint32_t ticksPerSample;
+        blend_span(dest, item->data + offset, count, blend);
+    }
 
-        // For PWM frequency generation
-        uint8_t prevValue;
-        uint8_t pwmCounter;
-        uint8_t pwmDutyCycle;
+    // Copy the width x height block at (src_x, src_y) of an image to
+    // (x, y) of a target_width x target_height surface of pixel format F.
+    // The block is clipped against the image and the surface once up front,
+    // then copied a row at a time.
+    template <pixel_format F = PIXEL_INDEXED8>
+    void blit_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                 const sprite_item *item, int src_x, int src_y, int x, int y, int width, int height)
+    {
+        typedef typename pixel_traits<F>::type pixel;
 
-        // Turn PC speaker on/off
-        void speakerOn()
+        if (src_x < 0)
         {
-            // Set bits 0 and 1 of port 0x61 to enable the speaker
-            outb(0x61, inb(0x61) | 0x3);
+            x -= src_x;
+            width += src_x;
+            src_x = 0;
+        }
+        if (src_y < 0)
+        {
+            y -= src_y;
+            height += src_y;
+            src_y = 0;
+        }
+        if (x < 0)
+        {
+            src_x -= x;
+            width += x;
+            x = 0;
+        }
+        if (y < 0)
+        {
+            src_y -= y;
+            height += y;
+            y = 0;
+        }
+        width = min(width, min(item->width - src_x, target_width - x));
+        height = min(height, min(item->height - src_y, target_height - y));
+        if (width <= 0 || height <= 0)
+        {
+            return;
         }
 
-        void speakerOff()
+        uint32_t offset = src_y * item->width + src_x;
+        pixel *dest = (pixel *)target + y * pitch + x;
+        for (int row = 0; row < height; row++)
         {
-            // Clear bits 0 and 1 of port 0x61 to disable the speaker
-            outb(0x61, inb(0x61) & ~0x3);
+            copy_pixels<F>(dest, item, offset, width);
+            offset += item->width;
+            dest += pitch;
         }
+    }
 
-    public:
-        PWMSpeaker() : samples(nullptr), samples16(nullptr), sampleRate(0),
-                       numSamples(0), bitsPerSample(0), currentSample(0),
-                       playing(false), tickCounter(0), ticksPerSample(0),
-                       prevValue(0), pwmCounter(0), pwmDutyCycle(0) {}
+    // blit_to for the back buffer's pixel format (select_present_path)
+    void (*blit_impl)(volatile uint8_t *, int, int, int, const sprite_item *, int, int, int, int, int,
+                      int) = blit_to<PIXEL_INDEXED8>;
 
-        // Initialize with 8-bit samples
-        void init(const uint8_t *wavSamples, uint32_t rate, uint32_t count)
+    // Copy part of an image to the screen at (x, y)
+    void blit(const sprite_item *item, int src_x, int src_y, int x, int y, int width, int height)
+    {
+        // The composing paths never show the render target
+        if (tiled_rendering || scanline_rendering)
         {
-            samples = wavSamples;
-            samples16 = nullptr;
-            sampleRate = rate;
-            numSamples = count;
-            bitsPerSample = 8;
-            currentSample = 0;
-            playing = false;
+            return;
+        }
+        blit_impl(render_target, render_pitch, render_width, render_height, item, src_x, src_y, x, y, width, height);
+    }
 
-            // Calculate how many timer ticks per sample
-            // Assuming your timer frequency is 1000Hz
-            ticksPerSample = 1000 / sampleRate;
-            if (ticksPerSample == 0)
-                ticksPerSample = 1;
+    // Draw only the opaque spans of a color-keyed sprite, clipped once per
+    // sprite and once per span
+    template <pixel_format F = PIXEL_INDEXED8>
+    void blit_spans_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                       const sprite_item *item, int x, int y)
+    {
+        typedef typename pixel_traits<F>::type pixel;
 
-            tickCounter = 0;
-            pwmCounter = 0;
-            pwmDutyCycle = 0;
+        int first_row = max(0, -y);
+        int last_row = min(item->height, target_height - y);
+        int left = max(0, -x);
+        int right = min(item->width, target_width - x);
+        if (first_row >= last_row || left >= right)
+        {
+            return;
         }
 
-        // Initialize with 16-bit samples
-        void init(const int16_t *wavSamples, uint32_t rate, uint32_t count)
+        for (int row = first_row; row < last_row; row++)
         {
-            samples = nullptr;
-            samples16 = wavSamples;
-            sampleRate = rate;
-            numSamples = count;
-            bitsPerSample = 16;
-            currentSample = 0;
-            playing = false;
+            uint32_t offset = row * item->width;
+            pixel *dest = (pixel *)target + (y + row) * pitch + x;
+            for (uint32_t i = item->row_spans[row]; i < item->row_spans[row + 1]; i++)
+            {
+                int start = max(item->spans[i].x, left);
+                int end = min(item->spans[i].x + item->spans[i].length, right);
+                if (start < end)
+                {
+                    copy_pixels<F>(dest + start, item, offset + start, end - start);
+                }
+            }
+        }
+    }
 
-            // Calculate how many timer ticks per sample
-            ticksPerSample = 1000 / sampleRate;
-            if (ticksPerSample == 0)
-                ticksPerSample = 1;
+    // Blend a sprite into the target (through a blend table for indices);
+    // for a color-keyed sprite only its opaque spans
+    template <pixel_format F = PIXEL_INDEXED8>
+    void blit_blend_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                       const sprite_item *item, int x, int y, blend_mode blend)
+    {
+        typedef typename pixel_traits<F>::type pixel;
 
-            tickCounter = 0;
-            pwmCounter = 0;
-            pwmDutyCycle = 0;
+        int first_row = max(0, -y);
+        int last_row = min(item->height, target_height - y);
+        int left = max(0, -x);
+        int right = min(item->width, target_width - x);
+        if (first_row >= last_row || left >= right)
+        {
+            return;
         }
 
-        void play()
+        for (int row = first_row; row < last_row; row++)
         {
-            currentSample = 0;
-            playing = true;
-            tickCounter = 0;
+            uint32_t offset = row * item->width;
+            pixel *dest = (pixel *)target + (y + row) * pitch + x;
+            if (!item->spans)
+            {
+                blend_pixels<F>(dest + left, item, offset + left, right - left, blend);
+                continue;
+            }
+            for (uint32_t i = item->row_spans[row]; i < item->row_spans[row + 1]; i++)
+            {
+                int start = max(item->spans[i].x, left);
+                int end = min(item->spans[i].x + item->spans[i].length, right);
+                if (start < end)
+                {
+                    blend_pixels<F>(dest + start, item, offset + start, end - start, blend);
+                }
+            }
         }
+    }
 
-        void stop()
+    template <pixel_format F = PIXEL_INDEXED8>
+    void draw_sprite_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                        const sprite_item *item, int x, int y, blend_mode blend = BLEND_NONE)
+    {
+        if (blend != BLEND_NONE)
         {
-            playing = false;
-            speakerOff();
+            blit_blend_to<F>(target, pitch, target_width, target_height, item, x, y, blend);
         }
-
-        bool isPlaying() const
+        else if (item->spans)
         {
-            return playing;
+            blit_spans_to<F>(target, pitch, target_width, target_height, item, x, y);
         }
-
-        // This should be called on every timer tick (1000Hz)
-        void update()
+        else
         {
-            if (!playing)
-                return;
+            blit_to<F>(target, pitch, target_width, target_height, item, 0, 0, x, y, item->width, item->height);
+        }
+    }
 
-            // Increment tick counter
-            tickCounter++;
+    void (*draw_sprite_impl)(volatile uint8_t *, int, int, int, const sprite_item *, int, int,
+                             blend_mode) = draw_sprite_to<PIXEL_INDEXED8>;
 
-            // Check if it's time to process a new sample
-            if (tickCounter >= ticksPerSample)
-            {
-                tickCounter = 0;
+    void draw_sprite(const sprite_item *item, int x, int y, blend_mode blend = BLEND_NONE)
+    {
+        if (tiled_rendering || scanline_rendering)
+        {
+            return;
+        }
+        draw_sprite_impl(render_target, render_pitch, render_width, render_height, item, x, y, blend);
+    }
 
-                // Get the current sample
-                if (currentSample >= numSamples)
-                {
-                    // End of sound
-                    stop();
+    // Floor division for a positive divisor
+    int div_floor(int a, int b)
+    {
+        return a >= 0 ? a / b : -((b - 1 - a) / b);
+    }
+
+    // Narrow [*first, *end) to the steps i where lo <= p + i * step < hi
+    void clip_fixed_range(fixed p, fixed step, fixed lo, fixed hi, int *first, int *end)
+    {
+        int from, to;
+        if (step == 0)
+        {
+            from = p >= lo && p < hi ? *first : *end;
+            to = *end;
+        }
+        else if (step > 0)
+        {
+            from = -div_floor(p - lo, step);
+            to = -div_floor(p - hi, step);
+        }
+        else
+        {
+            from = div_floor(p - hi, -step) + 1;
+            to = div_floor(p - lo, -step) + 1;
+        }
+        *first = max(*first, from);
+        *end = min(*end, to);
+    }
+
+    // Where affine texels get their colour: the palette index, or the
+    // image's own colour (with or without the palette effects)
+    template <pixel_format F>
+    struct index_texels
+    {
+        const uint8_t *data;
+        typename pixel_traits<F>::type operator()(uint32_t offset) const { return palette_lookup<F>(data[offset]); }
+    };
+
+    template <pixel_format F, bool TINT>
+    struct rgb_texels
+    {
+        const uint32_t *rgb;
+        typename pixel_traits<F>::type operator()(uint32_t offset) const
+        {
+            return pack_rgb<F>(TINT ? tint_rgb(rgb[offset]) : rgb[offset]);
+        }
+    };
+
+    // Fill the destination rect x0,y0..x1,y1 with texels of item, sampling
+    // at (u, v) for the top-left pixel and stepping by (du_dx, dv_dx) along a
+    // row and (du_dy, dv_dy) down a column, all 16.16 fixed point. This is
+    // the inverse transform, as on affine sprite hardware. The rect is
+    // clipped once, and each row is narrowed to where the texture is, so the
+    // inner loop has no bounds checks. Mode 7-style floors draw one row per
+    // call with the scale of that row.
+    template <pixel_format F, typename Texels>
+    void draw_affine_texels(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                            const sprite_item *item, Texels texels, int x0, int y0, int x1, int y1,
+                            fixed u, fixed v, fixed du_dx, fixed dv_dx, fixed du_dy, fixed dv_dy)
+    {
+        typedef typename pixel_traits<F>::type pixel;
+
+        int left = max(x0, 0);
+        int top = max(y0, 0);
+        int right = min(x1, target_width);
+        int bottom = min(y1, target_height);
+        if (left >= right || top >= bottom)
+        {
+            return;
+        }
+        u += (left - x0) * du_dx + (top - y0) * du_dy;
+        v += (left - x0) * dv_dx + (top - y0) * dv_dy;
+
+        const uint8_t *data = item->data;
+        int width = item->width;
+        bool keyed = item->spans != nullptr;
+        uint8_t key = (uint8_t)item->key;
+
+        for (int y = top; y < bottom; y++, u += du_dy, v += dv_dy)
+        {
+            int first = 0;
+            int end = right - left;
+            clip_fixed_range(u, du_dx, 0, to_fixed(width), &first, &end);
+            clip_fixed_range(v, dv_dx, 0, to_fixed(item->height), &first, &end);
+            if (first >= end)
+            {
+                continue;
+            }
+
+            pixel *dest = (pixel *)target + y * pitch + left;
+            fixed su = u + first * du_dx;
+            fixed sv = v + first * dv_dx;
+            if (keyed)
+            {
+                for (int i = first; i < end; i++, su += du_dx, sv += dv_dx)
+                {
+                    uint32_t offset = (sv >> 16) * width + (su >> 16);
+                    if (data[offset] != key)
+                    {
+                        dest[i] = texels(offset);
+                    }
+                }
+            }
+            else
+            {
+                for (int i = first; i < end; i++, su += du_dx, sv += dv_dx)
+                {
+                    dest[i] = texels((sv >> 16) * width + (su >> 16));
+                }
+            }
+        }
+    }
+
+    // draw_affine_texels into a surface of pixel format F. Image colours get
+    // the palette effects unless tint is false (for drawing into a sprite,
+    // which gets them when it is drawn itself).
+    template <pixel_format F = PIXEL_INDEXED8>
+    void draw_sprite_affine_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                               const sprite_item *item, int x0, int y0, int x1, int y1,
+                               fixed u, fixed v, fixed du_dx, fixed dv_dx, fixed du_dy, fixed dv_dy, bool tint = true)
+    {
+        if (!item->rgb)
+        {
+            draw_affine_texels<F>(target, pitch, target_width, target_height, item, index_texels<F>{item->data},
+                                  x0, y0, x1, y1, u, v, du_dx, dv_dx, du_dy, dv_dy);
+        }
+        else if (tint && rgb_tinted)
+        {
+            draw_affine_texels<F>(target, pitch, target_width, target_height, item, rgb_texels<F, true>{item->rgb},
+                                  x0, y0, x1, y1, u, v, du_dx, dv_dx, du_dy, dv_dy);
+        }
+        else
+        {
+            draw_affine_texels<F>(target, pitch, target_width, target_height, item, rgb_texels<F, false>{item->rgb},
+                                  x0, y0, x1, y1, u, v, du_dx, dv_dx, du_dy, dv_dy);
+        }
+    }
+
+    template <>
+    void draw_sprite_affine_to<PIXEL_INDEXED8>(volatile uint8_t *target, int pitch, int target_width,
+                                               int target_height, const sprite_item *item, int x0, int y0, int x1,
+                                               int y1, fixed u, fixed v, fixed du_dx, fixed dv_dx, fixed du_dy,
+                                               fixed dv_dy, bool)
+    {
+        draw_affine_texels<PIXEL_INDEXED8>(target, pitch, target_width, target_height, item,
+                                           index_texels<PIXEL_INDEXED8>{item->data}, x0, y0, x1, y1, u, v, du_dx,
+                                           dv_dx, du_dy, dv_dy);
+    }
+
+    void (*draw_sprite_affine_impl)(volatile uint8_t *, int, int, int, const sprite_item *, int, int, int, int, fixed,
+                                    fixed, fixed, fixed, fixed, fixed, bool) = draw_sprite_affine_to<PIXEL_INDEXED8>;
+
+    // The render_target versions of the affine draws are immediate, like
+    // draw_sprite: they only show on the default render path, and erasing
+    // them next frame (restore_background over the drawn rect) is up to the
+    // caller. The tiled and scanline paths compose the screen from the
+    // sprite pool and skip them; a transformed_sprite works on every path.
+    void draw_sprite_affine(const sprite_item *item, int x0, int y0, int x1, int y1,
+                            fixed u, fixed v, fixed du_dx, fixed dv_dx, fixed du_dy, fixed dv_dy)
+    {
+        if (tiled_rendering || scanline_rendering)
+        {
+            return;
+        }
+        draw_sprite_affine_impl(render_target, render_pitch, render_width, render_height, item, x0, y0, x1, y1,
+                                u, v, du_dx, dv_dx, du_dy, dv_dy, true);
+        mark_damage(x0, y0, x1 - x0, y1 - y0);
+    }
+
+    // Draw item centred on (cx, cy), rotated by angle (256 steps per turn,
+    // clockwise on screen) and scaled by scale (16.16, at least 1/16384).
+    // Returns the rect it covers, empty when the scale is too small.
+    template <pixel_format F = PIXEL_INDEXED8>
+    rect draw_sprite_rotozoom_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                                 const sprite_item *item, int cx, int cy, uint8_t angle, fixed scale, bool tint = true)
+    {
+        if (scale < 4)
+        {
+            return rect();
+        }
+        fixed c = fixed_cos(angle);
+        fixed s = fixed_sin(angle);
+
+        // Screen bounds of the rotated rectangle
+        fixed half_width = fixed_mul(to_fixed(item->width) / 2, scale);
+        fixed half_height = fixed_mul(to_fixed(item->height) / 2, scale);
+        fixed abs_c = c < 0 ? -c : c;
+        fixed abs_s = s < 0 ? -s : s;
+        int extent_x = (fixed_mul(abs_c, half_width) + fixed_mul(abs_s, half_height)) >> 16;
+        int extent_y = (fixed_mul(abs_s, half_width) + fixed_mul(abs_c, half_height)) >> 16;
+        rect bounds = {cx - extent_x - 1, cy - extent_y - 1, cx + extent_x + 2, cy + extent_y + 2};
+
+        // Inverse transform: rotate back, then divide by the scale. 2^32 / scale
+        // is done in 32 bits as (2^30 / scale) * 4.
+        fixed inverse = (fixed)(((1u << 30) / (uint32_t)scale) << 2);
+        fixed du_dx = fixed_mul(c, inverse);
+        fixed du_dy = fixed_mul(s, inverse);
+        fixed dv_dx = -du_dy;
+        fixed dv_dy = du_dx;
+
+        // Sample at pixel centres, relative to the middle of the texture
+        fixed dx = to_fixed(bounds.x0 - cx) + FIXED_ONE / 2;
+        fixed dy = to_fixed(bounds.y0 - cy) + FIXED_ONE / 2;
+        fixed u = fixed_mul(du_dx, dx) + fixed_mul(du_dy, dy) + to_fixed(item->width) / 2;
+        fixed v = fixed_mul(dv_dx, dx) + fixed_mul(dv_dy, dy) + to_fixed(item->height) / 2;
+
+        draw_sprite_affine_to<F>(target, pitch, target_width, target_height, item, bounds.x0, bounds.y0, bounds.x1,
+                                 bounds.y1, u, v, du_dx, dv_dx, du_dy, dv_dy, tint);
+        return bounds;
+    }
+
+    rect (*draw_sprite_rotozoom_impl)(volatile uint8_t *, int, int, int, const sprite_item *, int, int, uint8_t, fixed,
+                                      bool) = draw_sprite_rotozoom_to<PIXEL_INDEXED8>;
+
+    rect draw_sprite_rotozoom(const sprite_item *item, int cx, int cy, uint8_t angle, fixed scale)
+    {
+        if (tiled_rendering || scanline_rendering)
+        {
+            return rect();
+        }
+        rect bounds = draw_sprite_rotozoom_impl(render_target, render_pitch, render_width, render_height, item, cx, cy,
+                                                angle, scale, true);
+        mark_damage(bounds.x0, bounds.y0, bounds.width(), bounds.height());
+        return bounds;
+    }
+
+    // A rotated and scaled sprite in the pool. The transformed image is
+    // rendered into a keyed square big enough for any angle up to max_scale,
+    // so its screen bounds never change and every render path draws it like
+    // any other keyed sprite. It is only re-rendered when the transform
+    // changes.
+    struct transformed_sprite
+    {
+        sprite_handle sprite; // Top-left of the square; its centre is the pivot
+        const sprite_item *source;
+        uint8_t angle;
+        fixed scale;
+        fixed max_scale;
+        uint8_t *pixels;
+        uint32_t *rgb; // Colours, for a source that has them on a true-colour framebuffer
+        sprite_span *spans;
+        uint32_t *row_spans;
+        sprite_item item;
+    };
+
+    // Rebuild the opaque spans of a transformed sprite from its pixels
+    void build_transformed_spans(transformed_sprite *t)
+    {
+        const sprite_item &item = t->item;
+        uint32_t count = 0;
+        for (int row = 0; row < item.height; row++)
+        {
+            const uint8_t *line = t->pixels + row * item.width;
+            t->row_spans[row] = count;
+            int x = 0;
+            while (x < item.width)
+            {
+                if (line[x] == item.key)
+                {
+                    x++;
+                    continue;
+                }
+                int start = x;
+                while (x < item.width && line[x] != item.key)
+                {
+                    x++;
+                }
+                t->spans[count++] = {(uint16_t)start, (uint16_t)(x - start)};
+            }
+        }
+        t->row_spans[item.height] = count;
+    }
+
+    void render_transformed(transformed_sprite *t)
+    {
+        int side = t->item.width;
+        memset_impl(t->pixels, t->item.key, side * side);
+        draw_sprite_rotozoom_to(t->pixels, side, side, side, t->source, side / 2, side / 2, t->angle, t->scale);
+        if (t->rgb)
+        {
+            draw_sprite_rotozoom_to<PIXEL_XRGB8888>((uint8_t *)t->rgb, side, side, side, t->source, side / 2, side / 2,
+                                                    t->angle, t->scale, false);
+        }
+        build_transformed_spans(t);
+    }
+
+    // Memory comes from the level arena; nullptr when it or the sprite pool
+    // is full, or when an opaque source uses all 256 indices and leaves none
+    // to mark see-through pixels. Starts unrotated at scale 1 (max_scale
+    // must be at least 1).
+    transformed_sprite *create_transformed_sprite(const sprite_item *source, int x, int y, fixed max_scale)
+    {
+        if (max_scale < FIXED_ONE)
+        {
+            max_scale = FIXED_ONE;
+        }
+        int diagonal = isqrt(source->width * source->width + source->height * source->height) + 1;
+        int side = (fixed_mul(to_fixed(diagonal), max_scale) >> 16) + 4;
+        // Worst case a row alternates opaque and see-through pixels
+        int max_spans = side * (side / 2 + 1);
+
+        // The see-through index: the source's key, or one it does not use.
+        // An opaque source that uses every index has none to spare.
+        int key = source->key;
+        if (!source->spans)
+        {
+            bool used[256] = {};
+            for (int i = 0; i < source->width * source->height; i++)
+            {
+                used[source->data[i]] = true;
+            }
+            for (key = 0; key < 256 && used[key]; key++)
+            {
+            }
+            if (key == 256)
+            {
+                return nullptr;
+            }
+        }
+
+        transformed_sprite *t = (transformed_sprite *)level_alloc(sizeof(transformed_sprite));
+        uint8_t *pixels = (uint8_t *)level_alloc(side * side);
+        sprite_span *spans = (sprite_span *)level_alloc(max_spans * sizeof(sprite_span), 4);
+        uint32_t *row_spans = (uint32_t *)level_alloc((side + 1) * sizeof(uint32_t), 4);
+        bool true_colour = source->rgb && framebuffer_format != PIXEL_INDEXED8;
+        uint32_t *rgb = true_colour ? (uint32_t *)level_alloc(side * side * sizeof(uint32_t), 4) : nullptr;
+        if (!t || !pixels || !spans || !row_spans || (true_colour && !rgb))
+        {
+            return nullptr;
+        }
+
+        t->source = source;
+        t->angle = 0;
+        t->scale = FIXED_ONE;
+        t->max_scale = max_scale;
+        t->pixels = pixels;
+        t->rgb = rgb;
+        t->spans = spans;
+        t->row_spans = row_spans;
+        t->item = {side, side, pixels, spans, row_spans, key, rgb};
+        render_transformed(t);
+
+        t->sprite = create_sprite(&t->item, x, y);
+        return t->sprite.valid() ? t : nullptr;
+    }
+
+    // Change the rotation and scale (clamped to max_scale); the same
+    // transform as before costs nothing
+    void set_sprite_transform(transformed_sprite *t, uint8_t angle, fixed scale)
+    {
+        scale = min(scale, t->max_scale);
+        if (angle == t->angle && scale == t->scale)
+        {
+            return;
+        }
+        t->angle = angle;
+        t->scale = scale;
+        render_transformed(t);
+
+        // Repaint it on every page, even if it has not moved
+        sprite_ptr *sprite = get_sprite(t->sprite);
+        if (sprite)
+        {
+            sprite->redraw_pages = (1 << MAX_FLIP_PAGES) - 1;
+            mark_damage(sprite->x, sprite->y, t->item.width, t->item.height);
+        }
+    }
+
+    void set_background(const sprite_item *item_, int x = 0, int y = 0)
+    {
+        background.item = item_;
+        background.x = x;
+        background.y = y;
+        background.prev_x = x;
+        background.prev_y = y;
+
+        // While scrolling the background is the world; it is drawn into the
+        // virtual screen by the next update
+        if (scrolling)
+        {
+            background.x = -shown_x[back_page];
+            background.y = -shown_y[back_page];
+            scroll_refresh_pages = (1 << SCROLL_PAGES) - 1;
+            scroll_to(scroll_x, scroll_y);
+            return;
+        }
+
+        // Tiles and lines are composed from the background image as they are
+        // drawn
+        if (tiled_rendering || scanline_rendering)
+        {
+            mark_full_damage();
+            return;
+        }
+
+        // Every VRAM page needs the new background, not just the back page
+        for (int page = 0; page < flip_pages; page++)
+        {
+            if (flip_pages > 1)
+            {
+                select_page(page);
+            }
+            draw_sprite(item_, x, y);
+        }
+        if (flip_pages > 1)
+        {
+            select_page(back_page);
+        }
+        mark_full_damage();
+    }
+
+    // Text. draw_text() draws straight into the render target, one fill per
+    // glyph run. Like draw_sprite it is immediate: it only shows on the
+    // default render path, and erasing it (restore_background over the
+    // returned rect) is up to the caller. For HUD text, and on the tiled and
+    // scanline paths, use a text_label, which keeps the rendered string as a
+    // keyed sprite in the pool: setting the same string again costs a string
+    // compare, and every render path redraws it like any other sprite.
+    template <pixel_format F = PIXEL_INDEXED8>
+    void draw_text_to(volatile uint8_t *target, int pitch, int target_width, int target_height,
+                      const font *face, int x, int y, const char *text, uint8_t color)
+    {
+        typedef typename pixel_traits<F>::type pixel;
+        pixel value = palette_lookup<F>(color);
+        int first_row = max(0, -y);
+        int last_row = min(face->glyph_height, target_height - y);
+        for (; *text && x < target_width; text++, x += face->glyph_width)
+        {
+            int glyph = (uint8_t)*text - face->first_char;
+            if (glyph < 0 || glyph >= face->glyph_count || x + face->glyph_width <= 0)
+            {
+                continue;
+            }
+            const uint32_t *row_spans = face->row_spans + glyph * face->glyph_height;
+            for (int row = first_row; row < last_row; row++)
+            {
+                pixel *dest = (pixel *)target + (y + row) * pitch;
+                for (uint32_t i = row_spans[row]; i < row_spans[row + 1]; i++)
+                {
+                    int start = max(x + face->spans[i].x, 0);
+                    int end = min(x + face->spans[i].x + face->spans[i].length, target_width);
+                    if (start < end)
+                    {
+                        fill_pixels<F>(dest + start, value, end - start);
+                    }
+                }
+            }
+        }
+    }
+
+    void (*draw_text_impl)(volatile uint8_t *, int, int, int, const font *, int, int, const char *,
+                           uint8_t) = draw_text_to<PIXEL_INDEXED8>;
+
+    rect draw_text(const font *face, int x, int y, const char *text, uint8_t color)
+    {
+        // The composing paths never show the render target
+        if (tiled_rendering || scanline_rendering)
+        {
+            return rect();
+        }
+        draw_text_impl(render_target, render_pitch, render_width, render_height, face, x, y, text, color);
+        int length = 0;
+        while (text[length])
+        {
+            length++;
+        }
+        rect bounds = {x, y, x + length * face->glyph_width, y + face->glyph_height};
+        mark_damage(x, y, bounds.width(), bounds.height());
+        return bounds;
+    }
+
+    struct text_label
+    {
+        sprite_handle sprite;
+        const font *face;
+        uint8_t color;
+        int capacity; // Characters
+        char *text;   // What is rendered, capacity + 1 bytes
+        uint8_t *pixels;
+        sprite_span *spans;
+        uint32_t *row_spans;
+        sprite_item item;
+    };
+
+    // Render a string into a label's sprite: the glyph spans of each row,
+    // shifted to their character cell
+    void render_label(text_label *label)
+    {
+        const font *face = label->face;
+        int width = label->item.width;
+        uint32_t count = 0;
+        for (int row = 0; row < face->glyph_height; row++)
+        {
+            label->row_spans[row] = count;
+            for (int column = 0; label->text[column]; column++)
+            {
+                int glyph = (uint8_t)label->text[column] - face->first_char;
+                if (glyph < 0 || glyph >= face->glyph_count)
+                {
+                    continue;
+                }
+                const uint32_t *row_spans = face->row_spans + glyph * face->glyph_height;
+                for (uint32_t i = row_spans[row]; i < row_spans[row + 1]; i++)
+                {
+                    sprite_span span = face->spans[i];
+                    span.x += column * face->glyph_width;
+                    memset_impl(label->pixels + row * width + span.x, label->color, span.length);
+                    label->spans[count++] = span;
+                }
+            }
+        }
+        label->row_spans[face->glyph_height] = count;
+    }
+
+    // Show a string of up to capacity characters at x, y. Memory comes from
+    // the level arena; nullptr when it or the sprite pool is full.
+    text_label *create_text_label(const font *face, int x, int y, uint8_t color, int capacity)
+    {
+        int width = capacity * face->glyph_width;
+        // Worst case a glyph row alternates set and clear pixels
+        int max_spans = capacity * face->glyph_height * ((face->glyph_width + 1) / 2);
+        text_label *label = (text_label *)level_alloc(sizeof(text_label));
+        char *text = (char *)level_alloc(capacity + 1, 1);
+        uint8_t *pixels = (uint8_t *)level_alloc(width * face->glyph_height);
+        sprite_span *spans = (sprite_span *)level_alloc(max_spans * sizeof(sprite_span), 4);
+        uint32_t *row_spans = (uint32_t *)level_alloc((face->glyph_height + 1) * sizeof(uint32_t), 4);
+        if (!label || !text || !pixels || !spans || !row_spans)
+        {
+            return nullptr;
+        }
+
+        // Everything outside the glyph spans holds the key
+        uint8_t key = color == 0 ? 1 : 0;
+        memset_impl(pixels, key, width * face->glyph_height);
+        text[0] = 0;
+        label->face = face;
+        label->color = color;
+        label->capacity = capacity;
+        label->text = text;
+        label->pixels = pixels;
+        label->spans = spans;
+        label->row_spans = row_spans;
+        label->item = {width, face->glyph_height, pixels, spans, row_spans, key};
+        render_label(label);
+
+        label->sprite = create_sprite(&label->item, x, y);
+        return label->sprite.valid() ? label : nullptr;
+    }
+
+    // Change a label's text; the same string as before costs nothing more
+    // than the compare. Longer strings are cut to the label's capacity.
+    void set_text(text_label *label, const char *text)
+    {
+        int length = 0;
+        while (length < label->capacity && text[length] && text[length] == label->text[length])
+        {
+            length++;
+        }
+        if (length == label->capacity || text[length] == label->text[length])
+        {
+            return;
+        }
+
+        // Clear the old glyphs back to the key
+        const sprite_item &item = label->item;
+        for (int row = 0; row < item.height; row++)
+        {
+            for (uint32_t i = label->row_spans[row]; i < label->row_spans[row + 1]; i++)
+            {
+                memset_impl(label->pixels + row * item.width + label->spans[i].x, item.key, label->spans[i].length);
+            }
+        }
+
+        for (length = 0; length < label->capacity && text[length]; length++)
+        {
+            label->text[length] = text[length];
+        }
+        label->text[length] = 0;
+        render_label(label);
+
+        // Repaint it on every page, even if it has not moved
+        sprite_ptr *sprite = get_sprite(label->sprite);
+        if (sprite)
+        {
+            sprite->redraw_pages = (1 << MAX_FLIP_PAGES) - 1;
+            mark_damage(sprite->x, sprite->y, item.width, item.height);
+        }
+    }
+
+    // Decimal text of a number, for HUD counters; out needs 11 bytes
+    void format_uint(uint32_t value, char *out)
+    {
+        char digits[10];
+        int count = 0;
+        do
+        {
+            digits[count++] = '0' + value % 10;
+            value /= 10;
+        } while (value);
+        while (count)
+        {
+            *out++ = digits[--count];
+        }
+        *out = 0;
+    }
+
+    // Fill a rectangle of render_target with black: palette index 0, or 0
+    // in the true-colour formats
+    void clear_rect(int x, int y, int width, int height)
+    {
+        if (tiled_rendering || scanline_rendering)
+        {
+            return;
+        }
+        int left = max(x, 0);
+        int top = max(y, 0);
+        int right = min(x + width, render_width);
+        int bottom = min(y + height, render_height);
+        uint32_t bytes_per_pixel = pixel_size(framebuffer_format);
+        for (int row = top; row < bottom && left < right; row++)
+        {
+            memset_impl((uint8_t *)render_target + (row * render_pitch + left) * bytes_per_pixel, 0,
+                        (right - left) * bytes_per_pixel);
+        }
+    }
+
+    // Repaint a screen rectangle from the background image. Where the image
+    // does not reach the screen is black, as on the composing render paths,
+    // so blended sprites never mix with stale pixels.
+    void restore_background(int x, int y, int width, int height)
+    {
+        const sprite_item *bg = background.item;
+        if (!bg || x < background.x || y < background.y ||
+            x + width > background.x + bg->width || y + height > background.y + bg->height)
+        {
+            clear_rect(x, y, width, height);
+        }
+        if (background.item)
+        {
+            blit(background.item, x - background.x, y - background.y, x, y, width, height);
+        }
+    }
+
+    // Remove a sprite from the screen and the pool; the handle (and any copy
+    // of it) turns invalid
+    void destroy_sprite(sprite_handle handle)
+    {
+        sprite_ptr *sprite = get_sprite(handle);
+        if (!sprite)
+        {
+            return;
+        }
+
+        // Erase it where it was last drawn
+        if (background.item && flip_pages > 1)
+        {
+            for (int page = 0; page < flip_pages; page++)
+            {
+                select_page(page);
+                restore_background(sprite->page_x[page], sprite->page_y[page], sprite->item->width, sprite->item->height);
+            }
+            select_page(back_page);
+        }
+        else if (background.item)
+        {
+            restore_background(sprite->prev_x, sprite->prev_y, sprite->item->width, sprite->item->height);
+            mark_damage(sprite->prev_x, sprite->prev_y, sprite->item->width, sprite->item->height);
+        }
+
+        // Swap-remove: the last live sprite takes over the hole
+        int dense = sprite_slots[handle.slot].dense;
+        int last = sprite_count - 1;
+        if (dense != last)
+        {
+            sprites[dense] = sprites[last];
+            sprite_dense_slot[dense] = sprite_dense_slot[last];
+            sprite_slots[sprite_dense_slot[dense]].dense = dense;
+        }
+        sprite_count--;
+
+        sprite_slots[handle.slot].generation++;
+        sprite_free_slots[sprite_free_count++] = handle.slot;
+    }
+
+    void beep(int frequency, int duration)
+    {
+        // Set the speaker control register
+        int speaker_control_port = 0x43;
+        int speaker_data_port = 0x61;
+        int timer_0_channel = 0x0;
+
+        // Set the speaker's clock to the timer 0 clock
+        outb(speaker_control_port, 0x36);
+
+        // Set the frequency
+        outb(speaker_data_port, 0x13); // for 1193180 Hz
+        outb(speaker_control_port, timer_0_channel);
+
+        // Start the speaker
+        outb(speaker_data_port, (0x0 | (1 << 7))); // Enable the speaker
+        outb(speaker_data_port, 0x00);
+
+        // Stop the speaker
+        outb(speaker_data_port, 0x0);
+    }
+
+    bool keydown(uint8_t c)
+    {
+        return key_status[c];
+    }
+
+    bool keyhit(uint8_t c)
+    {
+        return key_hit[c];
+    }
+
+    class PWMSpeaker
+    {
+    private:
+        const uint8_t *samples;   // 8-bit samples
+        const int16_t *samples16; // 16-bit samples
+        uint32_t sampleRate;
+        uint32_t numSamples;
+        uint8_t bitsPerSample;
+        uint32_t currentSample;
+        bool playing;
+        uint32_t tickCounter;
+        uint32_t ticksPerSample;
+
+        // For PWM frequency generation
+        uint8_t prevValue;
+        uint8_t pwmCounter;
+        uint8_t pwmDutyCycle;
+
+        // Turn PC speaker on/off
+        void speakerOn()
+        {
+            // Set bits 0 and 1 of port 0x61 to enable the speaker
+            outb(0x61, inb(0x61) | 0x3);
+        }
+
+        void speakerOff()
+        {
+            // Clear bits 0 and 1 of port 0x61 to disable the speaker
+            outb(0x61, inb(0x61) & ~0x3);
+        }
+
+    public:
+        PWMSpeaker() : samples(nullptr), samples16(nullptr), sampleRate(0),
+                       numSamples(0), bitsPerSample(0), currentSample(0),
+                       playing(false), tickCounter(0), ticksPerSample(0),
+                       prevValue(0), pwmCounter(0), pwmDutyCycle(0) {}
+
+        // Initialize with 8-bit samples
+        void init(const uint8_t *wavSamples, uint32_t rate, uint32_t count)
+        {
+            samples = wavSamples;
+            samples16 = nullptr;
+            sampleRate = rate;
+            numSamples = count;
+            bitsPerSample = 8;
+            currentSample = 0;
+            playing = false;
+
+            // Calculate how many timer ticks per sample
+            // Assuming your timer frequency is 1000Hz
+            ticksPerSample = 1000 / sampleRate;
+            if (ticksPerSample == 0)
+                ticksPerSample = 1;
+
+            tickCounter = 0;
+            pwmCounter = 0;
+            pwmDutyCycle = 0;
+        }
+
+        // Initialize with 16-bit samples
+        void init(const int16_t *wavSamples, uint32_t rate, uint32_t count)
+        {
+            samples = nullptr;
+            samples16 = wavSamples;
+            sampleRate = rate;
+            numSamples = count;
+            bitsPerSample = 16;
+            currentSample = 0;
+            playing = false;
+
+            // Calculate how many timer ticks per sample
+            ticksPerSample = 1000 / sampleRate;
+            if (ticksPerSample == 0)
+                ticksPerSample = 1;
+
+            tickCounter = 0;
+            pwmCounter = 0;
+            pwmDutyCycle = 0;
+        }
+
+        void play()
+        {
+            currentSample = 0;
+            playing = true;
+            tickCounter = 0;
+        }
+
+        void stop()
+        {
+            playing = false;
+            speakerOff();
+        }
+
+        bool isPlaying() const
+        {
+            return playing;
+        }
+
+        // This should be called on every timer tick (1000Hz)
+        void update()
+        {
+            if (!playing)
+                return;
+
+            // Increment tick counter
+            tickCounter++;
+
+            // Check if it's time to process a new sample
+            if (tickCounter >= ticksPerSample)
+            {
+                tickCounter = 0;
+
+                // Get the current sample
+                if (currentSample >= numSamples)
+                {
+                    // End of sound
+                    stop();
                     return;
                 }
 
-                // Read sample value
-                uint8_t sampleValue;
-                if (bitsPerSample == 8)
-                {
-                    sampleValue = samples[currentSample];
-                }
-                else
+                // Read sample value
+                uint8_t sampleValue;
+                if (bitsPerSample == 8)
+                {
+                    sampleValue = samples[currentSample];
+                }
+                else
+                {
+                    // Convert 16-bit to 8-bit
+                    int16_t sample16 = samples16[currentSample];
+                    // Map from -32768..32767 to 0..255
+                    sampleValue = (sample16 + 32768) >> 8;
+                }
+
+                // Set PWM duty cycle based on sample value
+                pwmDutyCycle = sampleValue;
+
+                // Move to next sample
+                currentSample++;
+            }
+
+            // Simple PWM implementation
+            // For each tick, we increment a counter and compare to duty cycle
+            pwmCounter = (pwmCounter + 1) % 256;
+
+            if (pwmCounter < pwmDutyCycle)
+            {
+                speakerOn();
+            }
+            else
+            {
+                speakerOff();
+            }
+        }
+    };
+
+    // Global PWM speaker instance
+    PWMSpeaker pwmSpeaker;
+
+    // Helper function to play WAV with PWM speaker
+    void play_wav_pwm(const void *samples, uint32_t sampleRate, uint32_t numSamples, uint8_t bitsPerSample)
+    {
+        if (bitsPerSample == 8)
+        {
+            pwmSpeaker.init(static_cast<const uint8_t *>(samples), sampleRate, numSamples);
+        }
+        else if (bitsPerSample == 16)
+        {
+            pwmSpeaker.init(static_cast<const int16_t *>(samples), sampleRate, numSamples);
+        }
+        pwmSpeaker.play();
+    }
+
+    void select_present_path();
+    void detect_vertical_retrace();
+
+    void init(multiboot_info *mbi_)
+    {
+        mbi = mbi_;
+
+        // Use SSE2 copies if boot.asm managed to enable SSE
+        init_memops();
+
+        // Initialize interrupt system
+        idt_install();
+        init_pic();
+        init_timer();
+        enable_interrupts(); // This is critical - enables the CPU to respond to interrupts
+
+        bool vesa_supported = false;
+        uint32_t framebuffer_width = 640;
+        uint32_t framebuffer_height = 480;
+
+        // Check if multiboot provides a suitable framebuffer
+        if (mbi && (mbi->flags & (1 << 12)))
+        { // Bit 12 indicates framebuffer info is available
+            // Use the multiboot framebuffer info even if it's not exact match for our target
+            vesa_lfb = (volatile uint8_t *)(uint32_t)mbi->framebuffer_addr;
+            framebuffer_width = mbi->framebuffer_width;
+            framebuffer_height = mbi->framebuffer_height;
+            framebuffer_pitch = mbi->framebuffer_pitch;
+
+            // If it's a usable framebuffer, we can proceed
+            if (vesa_lfb && framebuffer_width > 0 && framebuffer_height > 0 &&
+                multiboot_pixel_format(mbi, &framebuffer_format))
+            {
+                vesa_supported = true;
+            }
+        }
+
+        // If multiboot didn't provide a suitable mode, try setting VESA mode manually
+        if (!vesa_supported)
+        {
+            vesa_supported = set_vesa_mode(640, 480, 8, &vesa_lfb);
+            framebuffer_width = 640;
+            framebuffer_height = 480;
+            framebuffer_pitch = 640;
+            framebuffer_format = PIXEL_INDEXED8;
+        }
+
+        present_width = framebuffer_width < SCREEN_WIDTH ? framebuffer_width : SCREEN_WIDTH;
+        present_height = framebuffer_height < SCREEN_HEIGHT ? framebuffer_height : SCREEN_HEIGHT;
+        if (framebuffer_pitch < present_width * pixel_size(framebuffer_format))
+        {
+            framebuffer_pitch = present_width * pixel_size(framebuffer_format);
+        }
+        select_present_path();
+        has_tsc = cpu_has(CPUID_EDX_TSC);
+
+        // Map the framebuffer write-combining so presenting uses burst writes
+        init_paging((uint32_t)vesa_lfb, LFB_MAP_SIZE);
+
+        setup_full_256_color_palette();
+        detect_vertical_retrace();
+    }
+
+    void cls()
+    {
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            const sprite_item *item = sprites[sprite_loc].item;
+            int x = sprites[sprite_loc].x;
+            int y = sprites[sprite_loc].y;
+            // Where the sprite is on the page about to be drawn; with a single
+            // buffer that is simply the previous frame's position
+            int prev_x = sprites[sprite_loc].page_x[back_page];
+            int prev_y = sprites[sprite_loc].page_y[back_page];
+            int width = item->width;
+            int height = item->height;
+            // A blended sprite mixes with what is under it, so it goes over
+            // fresh background every frame even when it has not moved; so
+            // does one whose pixels changed
+            bool blended = sprites[sprite_loc].blend != BLEND_NONE;
+            bool changed = sprites[sprite_loc].redraw_pages & (1 << back_page);
+            sprites[sprite_loc].redraw_pages &= ~(1 << back_page);
+
+            // Only clear if the sprite has moved
+            if (x != prev_x || y != prev_y || blended || changed)
+            {
+                mark_damage(prev_x, prev_y, width, height);
+                mark_damage(x, y, width, height);
+
+                // Calculate overlapping region
+                int overlap_left = max(prev_x, x);
+                int overlap_top = max(prev_y, y);
+                int overlap_right = min(prev_x + width, x + width);
+                int overlap_bottom = min(prev_y + height, y + height);
+
+                // Clear previous position (excluding overlap): the bands
+                // above and below the overlap, then the strips beside it.
+                // A color-keyed sprite does not cover the whole overlap when
+                // redrawn, so clear all of it.
+                if (overlap_left >= overlap_right || overlap_top >= overlap_bottom || item->spans || blended ||
+                    changed)
+                {
+                    restore_background(prev_x, prev_y, width, height);
+                    if (blended && (x != prev_x || y != prev_y))
+                    {
+                        restore_background(x, y, width, height);
+                    }
+                }
+                else
+                {
+                    restore_background(prev_x, prev_y, width, overlap_top - prev_y);
+                    restore_background(prev_x, overlap_bottom, width, prev_y + height - overlap_bottom);
+                    restore_background(prev_x, overlap_top, overlap_left - prev_x, overlap_bottom - overlap_top);
+                    restore_background(overlap_right, overlap_top, prev_x + width - overlap_right, overlap_bottom - overlap_top);
+                }
+            }
+
+            // Update previous position
+            sprites[sprite_loc].prev_x = x;
+            sprites[sprite_loc].prev_y = y;
+            sprites[sprite_loc].page_x[back_page] = x;
+            sprites[sprite_loc].page_y[back_page] = y;
+        }
+    }
+
+    // Frame signals that arrived while the previous frame was still running
+    uint32_t frames_missed = 0;
+
+    // Timer ticks (milliseconds) between the starts of the last two frames,
+    // for frame-rate independent movement and FPS counters
+    uint32_t frame_time = 0;
+    uint64_t frame_start_ticks = 0;
+
+    // TSC cycles spent copying the back buffer to the framebuffer, for the
+    // last frame and the slowest one so far (0 if the CPU has no TSC)
+    uint32_t present_cycles = 0;
+    uint32_t present_cycles_max = 0;
+
+    // Bytes copied to the framebuffer by the last present
+    uint32_t present_bytes = 0;
+
+    // One upscaled row in framebuffer format, copied to each of its S rows
+    alignas(16) uint8_t scaled_row[SCREEN_WIDTH * 4];
+
+    // Copy a rectangle of the back buffer (in render coordinates) to the
+    // framebuffer, blowing pixels up S times and stepping the destination by
+    // the pitch
+    template <pixel_format F, int S>
+    void present_rect(int x0, int y0, int x1, int y1)
+    {
+        typedef typename pixel_traits<F>::type fb_pixel;
+
+        x1 = min(x1, present_width / S);
+        y1 = min(y1, present_height / S);
+        if (x0 >= x1 || y0 >= y1)
+            return;
+
+        const fb_pixel *src = (const fb_pixel *)vesa_buffer + y0 * render_width + x0;
+        uint8_t *dest = (uint8_t *)vesa_lfb + y0 * S * framebuffer_pitch + x0 * S * sizeof(fb_pixel);
+        uint32_t width = x1 - x0;
+        uint32_t row_bytes = width * S * sizeof(fb_pixel);
+        present_bytes += row_bytes * (y1 - y0) * S;
+
+        if (S == 1)
+        {
+            // Whole rows with no padding in between are one contiguous run
+            if (width == (uint32_t)render_width && framebuffer_pitch == row_bytes)
+            {
+                memcpy_stream_impl(dest, src, row_bytes * (y1 - y0));
+                return;
+            }
+            for (int y = y0; y < y1; y++)
+            {
+                memcpy_stream_impl(dest, src, row_bytes);
+                src += render_width;
+                dest += framebuffer_pitch;
+            }
+            return;
+        }
+
+        for (int y = y0; y < y1; y++)
+        {
+            scale_span<F, S>(scaled_row, src, width);
+            for (int k = 0; k < S; k++)
+            {
+                memcpy_stream_impl(dest, scaled_row, row_bytes);
+                dest += framebuffer_pitch;
+            }
+            src += render_width;
+        }
+    }
+
+    // Instantiations of present_rect by pixel format and render scale
+    void (*const present_paths[][MAX_RENDER_SCALE])(int, int, int, int) = {
+        {present_rect<PIXEL_INDEXED8, 1>, present_rect<PIXEL_INDEXED8, 2>, present_rect<PIXEL_INDEXED8, 3>},
+        {present_rect<PIXEL_RGB565, 1>, present_rect<PIXEL_RGB565, 2>, present_rect<PIXEL_RGB565, 3>},
+        {present_rect<PIXEL_XRGB8888, 1>, present_rect<PIXEL_XRGB8888, 2>, present_rect<PIXEL_XRGB8888, 3>},
+    };
+
+    void (*present_rect_impl)(int, int, int, int) = present_rect<PIXEL_INDEXED8, 1>;
+
+    template <pixel_format F>
+    void select_draw_paths();
+
+    // Pick the present and drawing paths for the framebuffer's format
+    void select_present_path()
+    {
+        present_rect_impl = present_paths[framebuffer_format][render_scale - 1];
+        switch (framebuffer_format)
+        {
+        case PIXEL_RGB565:
+            select_draw_paths<PIXEL_RGB565>();
+            break;
+        case PIXEL_XRGB8888:
+            select_draw_paths<PIXEL_XRGB8888>();
+            break;
+        default:
+            select_draw_paths<PIXEL_INDEXED8>();
+            break;
+        }
+    }
+
+    // Draw at 1/scale of the screen resolution (320x240 for 2, 213x160 for
+    // 3) and upscale while presenting. Not available with page flipping,
+    // which draws straight into the full-size VRAM pages.
+    bool set_render_scale(int scale)
+    {
+        if (scale < 1 || scale > MAX_RENDER_SCALE || rendering_to_vram || tiled_rendering || scanline_rendering)
+        {
+            return false;
+        }
+
+        render_scale = scale;
+        render_width = SCREEN_WIDTH / scale;
+        render_height = SCREEN_HEIGHT / scale;
+        render_pitch = render_width;
+        damage.resize(render_width, render_height);
+        select_present_path();
+
+        // The back buffer still holds the last frame at the old pitch;
+        // repaint all of it so nothing stale is presented
+        restore_background(0, 0, render_width, render_height);
+        mark_full_damage();
+
+        // Blank the edge the scaled image may not reach (640 / 3 * 3 = 639)
+        memset_impl((uint8_t *)vesa_lfb, 0, present_height * framebuffer_pitch);
+        return true;
+    }
+
+    // Show the finished back page and start drawing into the next one
+    void flip()
+    {
+        if (scrolling)
+        {
+            write_vbe_register(VBE_DISPI_INDEX_X_OFFSET, wrap(shown_x[back_page], SCREEN_WIDTH));
+            write_vbe_register(VBE_DISPI_INDEX_Y_OFFSET,
+                               back_page * SCROLL_VIRT_HEIGHT + wrap(shown_y[back_page], SCREEN_HEIGHT));
+        }
+        else
+        {
+            write_vbe_register(VBE_DISPI_INDEX_Y_OFFSET, back_page * SCREEN_HEIGHT);
+        }
+        front_page = back_page;
+        back_page = (back_page + 1) % flip_pages;
+        select_page(back_page);
+    }
+
+    // Drawing straight into VRAM needs the Bochs DISPI interface running the
+    // 8 bpp SCREEN_WIDTH x SCREEN_HEIGHT mode, at full render resolution,
+    // with vram_size bytes mapped
+    bool can_render_to_vram(uint32_t vram_size)
+    {
+        return !rendering_to_vram && !tiled_rendering && !scanline_rendering && framebuffer_format == PIXEL_INDEXED8 && render_scale == 1 &&
+               (read_vbe_register(VBE_DISPI_INDEX_ID) & 0xFFF0) == 0xB0C0 &&
+               read_vbe_register(VBE_DISPI_INDEX_XRES) == SCREEN_WIDTH &&
+               read_vbe_register(VBE_DISPI_INDEX_YRES) == SCREEN_HEIGHT &&
+               read_vbe_register(VBE_DISPI_INDEX_BPP) == 8 &&
+               vram_size <= LFB_MAP_SIZE;
+    }
+
+    // Render straight into VRAM and flip between pages (2 or 3) by moving
+    // the Bochs DISPI display start, instead of copying vesa_buffer to the
+    // framebuffer. Needs the 8 bpp SCREEN_WIDTH x SCREEN_HEIGHT DISPI mode
+    // and enough VRAM; returns false (and keeps copying) otherwise.
+    bool enable_page_flipping(int pages = 2)
+    {
+        if (pages < 2 || pages > MAX_FLIP_PAGES || !can_render_to_vram(SCREEN_WIDTH * SCREEN_HEIGHT * pages))
+        {
+            return false;
+        }
+
+        // The card clamps the virtual height to its memory size
+        write_vbe_register(VBE_DISPI_INDEX_VIRT_WIDTH, SCREEN_WIDTH);
+        write_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT, SCREEN_HEIGHT * pages);
+        if (read_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT) < SCREEN_HEIGHT * pages)
+        {
+            write_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT, SCREEN_HEIGHT);
+            return false;
+        }
+        write_vbe_register(VBE_DISPI_INDEX_X_OFFSET, 0);
+        write_vbe_register(VBE_DISPI_INDEX_Y_OFFSET, 0);
+        framebuffer_pitch = SCREEN_WIDTH;
+
+        // Start every page as a copy of the current frame; sprites are on
+        // each page where they were last drawn
+        for (int page = 0; page < pages; page++)
+        {
+            memcpy_stream_impl((uint8_t *)page_address(page), (const uint8_t *)vesa_buffer, SCREEN_WIDTH * SCREEN_HEIGHT);
+        }
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            for (int page = 0; page < MAX_FLIP_PAGES; page++)
+            {
+                sprites[sprite_loc].page_x[page] = sprites[sprite_loc].prev_x;
+                sprites[sprite_loc].page_y[page] = sprites[sprite_loc].prev_y;
+            }
+        }
+
+        flip_pages = pages;
+        front_page = 0;
+        back_page = 1;
+        select_page(back_page);
+        rendering_to_vram = true;
+        damage.clear();
+        return true;
+    }
+
+    // Copy a world rectangle of the background (at most a screen in size)
+    // to every place it lives in a page's virtual screen. The rectangle is
+    // cut where it wraps, and each piece is written to all four copies.
+    void refresh_world_rect(int page, int x, int y, int width, int height)
+    {
+        volatile uint8_t *virt = vesa_lfb + page * SCROLL_VIRT_WIDTH * SCROLL_VIRT_HEIGHT;
+        int vx = wrap(x, SCREEN_WIDTH);
+        int vy = wrap(y, SCREEN_HEIGHT);
+        int first_width = min(width, SCREEN_WIDTH - vx);
+        int first_height = min(height, SCREEN_HEIGHT - vy);
+        const int piece_x[2] = {vx, 0};
+        const int piece_y[2] = {vy, 0};
+        const int piece_width[2] = {first_width, width - first_width};
+        const int piece_height[2] = {first_height, height - first_height};
+
+        for (int i = 0; i < 2; i++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                if (piece_width[i] <= 0 || piece_height[j] <= 0)
+                {
+                    continue;
+                }
+                int src_x = x + (i ? first_width : 0);
+                int src_y = y + (j ? first_height : 0);
+                for (int copy = 0; copy < 4; copy++)
+                {
+                    blit_to(virt, SCROLL_VIRT_WIDTH, SCROLL_VIRT_WIDTH, SCROLL_VIRT_HEIGHT, background.item,
+                            src_x, src_y,
+                            piece_x[i] + (copy & 1) * SCREEN_WIDTH, piece_y[j] + (copy >> 1) * SCREEN_HEIGHT,
+                            piece_width[i], piece_height[j]);
+                }
+            }
+        }
+    }
+
+    // Let the background be larger than the screen and scroll over it with
+    // scroll_to(); the screen shows the background from (scroll_x,
+    // scroll_y). Sprites stay in screen coordinates. Needs the same DISPI
+    // mode as page flipping and flips pages itself, so the two cannot be
+    // combined.
+    bool enable_scrolling()
+    {
+        if (!can_render_to_vram(SCROLL_VIRT_WIDTH * SCROLL_VIRT_HEIGHT * SCROLL_PAGES))
+        {
+            return false;
+        }
+
+        write_vbe_register(VBE_DISPI_INDEX_VIRT_WIDTH, SCROLL_VIRT_WIDTH);
+        write_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT, SCROLL_VIRT_HEIGHT * SCROLL_PAGES);
+        if (read_vbe_register(VBE_DISPI_INDEX_VIRT_WIDTH) != SCROLL_VIRT_WIDTH ||
+            read_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT) < SCROLL_VIRT_HEIGHT * SCROLL_PAGES)
+        {
+            write_vbe_register(VBE_DISPI_INDEX_VIRT_WIDTH, SCREEN_WIDTH);
+            write_vbe_register(VBE_DISPI_INDEX_VIRT_HEIGHT, SCREEN_HEIGHT);
+            return false;
+        }
+        write_vbe_register(VBE_DISPI_INDEX_X_OFFSET, 0);
+        write_vbe_register(VBE_DISPI_INDEX_Y_OFFSET, 0);
+        framebuffer_pitch = SCROLL_VIRT_WIDTH;
+
+        scrolling = true;
+        rendering_to_vram = true;
+        render_pitch = SCROLL_VIRT_WIDTH;
+        scroll_x = scroll_y = 0;
+        for (int page = 0; page < SCROLL_PAGES; page++)
+        {
+            shown_x[page] = shown_y[page] = 0;
+        }
+        scroll_refresh_pages = (1 << SCROLL_PAGES) - 1;
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            for (int page = 0; page < MAX_FLIP_PAGES; page++)
+            {
+                sprites[sprite_loc].page_x[page] = sprites[sprite_loc].prev_x;
+                sprites[sprite_loc].page_y[page] = sprites[sprite_loc].prev_y;
+            }
+        }
+
+        flip_pages = SCROLL_PAGES;
+        front_page = 0;
+        back_page = 1;
+        select_page(back_page);
+        damage.clear();
+        return true;
+    }
+
+    // Bring the back page's virtual screen to the requested scroll
+    // position: erase the sprites from its old window, refresh the rows and
+    // columns that come into view and move the window. present() then flips
+    // to it, panning the display to the window.
+    void apply_scroll()
+    {
+        int page = back_page;
+        bool refresh_all = scroll_refresh_pages & (1 << page);
+        if (!background.item || (!refresh_all && scroll_x == shown_x[page] && scroll_y == shown_y[page]))
+        {
+            return;
+        }
+
+        // Sprites are erased where they were drawn, relative to the old window
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            const sprite_ptr &sprite = sprites[sprite_loc];
+            restore_background(sprite.page_x[page], sprite.page_y[page], sprite.item->width, sprite.item->height);
+        }
+
+        // The page last moved two frames ago, so this catches up on both
+        int dx = scroll_x - shown_x[page];
+        int dy = scroll_y - shown_y[page];
+        if (refresh_all || dx >= SCREEN_WIDTH || -dx >= SCREEN_WIDTH || dy >= SCREEN_HEIGHT || -dy >= SCREEN_HEIGHT)
+        {
+            refresh_world_rect(page, scroll_x, scroll_y, SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+        else
+        {
+            if (dx > 0)
+            {
+                refresh_world_rect(page, shown_x[page] + SCREEN_WIDTH, scroll_y, dx, SCREEN_HEIGHT);
+            }
+            else if (dx < 0)
+            {
+                refresh_world_rect(page, scroll_x, scroll_y, -dx, SCREEN_HEIGHT);
+            }
+            if (dy > 0)
+            {
+                refresh_world_rect(page, scroll_x, shown_y[page] + SCREEN_HEIGHT, SCREEN_WIDTH, dy);
+            }
+            else if (dy < 0)
+            {
+                refresh_world_rect(page, scroll_x, scroll_y, SCREEN_WIDTH, -dy);
+            }
+        }
+
+        shown_x[page] = scroll_x;
+        shown_y[page] = scroll_y;
+        scroll_refresh_pages &= ~(1 << page);
+        select_page(page);
+    }
+
+    // Copy the damaged parts of the back buffer to the framebuffer, or all
+    // of it when most of the screen changed anyway. With page flipping the
+    // frame is already in VRAM and presenting is just the flip.
+    void present()
+    {
+        uint64_t start = has_tsc ? rdtsc() : 0;
+
+        present_bytes = 0;
+        if (flip_pages > 1)
+        {
+            flip();
+        }
+        else if (damage.full() || damage.area() * 100 > (uint32_t)(render_width * render_height * FULL_PRESENT_PERCENT))
+        {
+            present_rect_impl(0, 0, present_width, present_height);
+        }
+        else
+        {
+            for (int i = 0; i < damage.size(); i++)
+            {
+                present_rect_impl(damage[i].x0, damage[i].y0, damage[i].x1, damage[i].y1);
+            }
+        }
+        damage.clear();
+
+        if (has_tsc)
+        {
+            present_cycles = (uint32_t)(rdtsc() - start);
+            if (present_cycles > present_cycles_max)
+            {
+                present_cycles_max = present_cycles;
+            }
+        }
+    }
+
+    // Moved sprites damage their old and new bounds; for the composing
+    // render paths, which have no cls() pass
+    void damage_moved_sprites()
+    {
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            sprite_ptr &sprite = sprites[sprite_loc];
+            if (sprite.x != sprite.prev_x || sprite.y != sprite.prev_y)
+            {
+                mark_damage(sprite.prev_x, sprite.prev_y, sprite.item->width, sprite.item->height);
+                mark_damage(sprite.x, sprite.y, sprite.item->width, sprite.item->height);
+                sprite.prev_x = sprite.x;
+                sprite.prev_y = sprite.y;
+            }
+        }
+    }
+
+    // Tile-binned rendering. Instead of drawing every sprite into
+    // vesa_buffer and copying it out, the screen is cut into tiles and each
+    // tile that needs redrawing is composed in a small buffer that stays in
+    // L1 (background, then the sprites overlapping it in draw order) and
+    // written to the framebuffer once. Overdraw then stays in the cache.
+#define TILE_WIDTH 64
+#define TILE_HEIGHT 32
+#define TILES_X ((SCREEN_WIDTH + TILE_WIDTH - 1) / TILE_WIDTH)
+#define TILES_Y ((SCREEN_HEIGHT + TILE_HEIGHT - 1) / TILE_HEIGHT)
+    alignas(64) uint8_t tile_buffer[TILE_WIDTH * TILE_HEIGHT * sizeof(uint32_t)]; // Widest pixel format
+
+    // Sprites overlapping tile t, in draw order, are
+    // tile_bin_sprites[tile_bin_start[t]..tile_bin_start[t + 1])
+    uint32_t tile_bin_start[TILES_X * TILES_Y + 1];
+    uint32_t tile_bin_fill[TILES_X * TILES_Y];
+    uint8_t tile_bin_sprites[MAX_SPRITES * TILES_X * TILES_Y];
+    bool tile_dirty[TILES_X * TILES_Y];
+
+    // Not available together with drawing into VRAM or a render scale
+    bool enable_tiled_rendering()
+    {
+        if (rendering_to_vram || render_scale != 1 || scanline_rendering)
+        {
+            return false;
+        }
+        tiled_rendering = true;
+        mark_full_damage();
+        return true;
+    }
+
+    // Range of tiles a screen rectangle touches; false if it is off-screen
+    bool tile_range(int x, int y, int width, int height, int &tx0, int &ty0, int &tx1, int &ty1)
+    {
+        int x1 = min(x + width, SCREEN_WIDTH);
+        int y1 = min(y + height, SCREEN_HEIGHT);
+        x = max(x, 0);
+        y = max(y, 0);
+        if (x >= x1 || y >= y1)
+        {
+            return false;
+        }
+        tx0 = x / TILE_WIDTH;
+        ty0 = y / TILE_HEIGHT;
+        tx1 = (x1 - 1) / TILE_WIDTH;
+        ty1 = (y1 - 1) / TILE_HEIGHT;
+        return true;
+    }
+
+    // Sort the sprites into the tiles they overlap (a counting sort: count
+    // per tile, prefix sums, then fill)
+    void bin_sprites()
+    {
+        int tx0, ty0, tx1, ty1;
+
+        for (int t = 0; t < TILES_X * TILES_Y; t++)
+        {
+            tile_bin_fill[t] = 0;
+        }
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            const sprite_ptr &sprite = sprites[sprite_loc];
+            if (tile_range(sprite.x, sprite.y, sprite.item->width, sprite.item->height, tx0, ty0, tx1, ty1))
+            {
+                for (int ty = ty0; ty <= ty1; ty++)
+                    for (int tx = tx0; tx <= tx1; tx++)
+                        tile_bin_fill[ty * TILES_X + tx]++;
+            }
+        }
+
+        tile_bin_start[0] = 0;
+        for (int t = 0; t < TILES_X * TILES_Y; t++)
+        {
+            tile_bin_start[t + 1] = tile_bin_start[t] + tile_bin_fill[t];
+            tile_bin_fill[t] = tile_bin_start[t];
+        }
+
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            const sprite_ptr &sprite = sprites[sprite_loc];
+            if (tile_range(sprite.x, sprite.y, sprite.item->width, sprite.item->height, tx0, ty0, tx1, ty1))
+            {
+                for (int ty = ty0; ty <= ty1; ty++)
+                    for (int tx = tx0; tx <= tx1; tx++)
+                        tile_bin_sprites[tile_bin_fill[ty * TILES_X + tx]++] = sprite_loc;
+            }
+        }
+    }
+
+    template <pixel_format F>
+    void compose_tile(int tx, int ty)
+    {
+        typedef typename pixel_traits<F>::type pixel;
+        int x0 = tx * TILE_WIDTH;
+        int y0 = ty * TILE_HEIGHT;
+        int width = min(TILE_WIDTH, (int)present_width - x0);
+        int height = min(TILE_HEIGHT, (int)present_height - y0);
+        if (width <= 0 || height <= 0)
+        {
+            return;
+        }
+
+        // Background first; clear whatever part of the tile it misses
+        const sprite_item *bg = background.item;
+        if (!bg || x0 < background.x || y0 < background.y ||
+            x0 + width > background.x + bg->width || y0 + height > background.y + bg->height)
+        {
+            memset_impl(tile_buffer, 0, TILE_WIDTH * TILE_HEIGHT * sizeof(pixel));
+        }
+        if (bg)
+        {
+            blit_to<F>(tile_buffer, TILE_WIDTH, width, height, bg, x0 - background.x, y0 - background.y, 0, 0, width,
+                       height);
+        }
+
+        int t = ty * TILES_X + tx;
+        for (uint32_t i = tile_bin_start[t]; i < tile_bin_start[t + 1]; i++)
+        {
+            const sprite_ptr &sprite = sprites[tile_bin_sprites[i]];
+            draw_sprite_to<F>(tile_buffer, TILE_WIDTH, width, height, sprite.item, sprite.x - x0, sprite.y - y0,
+                              sprite.blend);
+        }
+
+        const pixel *src = (const pixel *)tile_buffer;
+        uint8_t *dest = (uint8_t *)vesa_lfb + y0 * framebuffer_pitch + x0 * sizeof(pixel);
+        for (int row = 0; row < height; row++)
+        {
+            memcpy_stream_impl(dest, src, width * sizeof(pixel));
+            src += TILE_WIDTH;
+            dest += framebuffer_pitch;
+        }
+        present_bytes += width * height * sizeof(pixel);
+    }
+
+    void (*compose_tile_impl)(int, int) = compose_tile<PIXEL_INDEXED8>;
+
+    // Compose and write out every tile touched by damage this frame
+    void render_tiles()
+    {
+        uint64_t start = has_tsc ? rdtsc() : 0;
+        int tx0, ty0, tx1, ty1;
+
+        damage_moved_sprites();
+
+        for (int t = 0; t < TILES_X * TILES_Y; t++)
+        {
+            tile_dirty[t] = damage.full();
+        }
+        for (int i = 0; !damage.full() && i < damage.size(); i++)
+        {
+            const rect &r = damage[i];
+            if (tile_range(r.x0, r.y0, r.width(), r.height(), tx0, ty0, tx1, ty1))
+            {
+                for (int ty = ty0; ty <= ty1; ty++)
+                    for (int tx = tx0; tx <= tx1; tx++)
+                        tile_dirty[ty * TILES_X + tx] = true;
+            }
+        }
+        damage.clear();
+
+        bin_sprites();
+        present_bytes = 0;
+        for (int ty = 0; ty < TILES_Y; ty++)
+        {
+            for (int tx = 0; tx < TILES_X; tx++)
+            {
+                if (tile_dirty[ty * TILES_X + tx])
                 {
-                    // Convert 16-bit to 8-bit
-                    int16_t sample16 = samples16[currentSample];
-                    // Map from -32768..32767 to 0..255
-                    sampleValue = (sample16 + 32768) >> 8;
+                    compose_tile_impl(tx, ty);
                 }
+            }
+        }
 
-                // Set PWM duty cycle based on sample value
-                pwmDutyCycle = sampleValue;
+        if (has_tsc)
+        {
+            present_cycles = (uint32_t)(rdtsc() - start);
+            if (present_cycles > present_cycles_max)
+            {
+                present_cycles_max = present_cycles;
+            }
+        }
+    }
 
-                // Move to next sample
-                currentSample++;
+    // Scanline rendering, like the sprite hardware of old consoles: sprites
+    // are sorted by their top row, and every output line is composed in a
+    // line buffer from the background row and the rows of the sprites
+    // crossing it, then written to the framebuffer. No full-screen buffer
+    // is drawn into and every framebuffer pixel is written once.
+    alignas(16) uint8_t scanline_buffer[SCREEN_WIDTH * sizeof(uint32_t)]; // Widest pixel format
+    uint8_t scanline_order[MAX_SPRITES];  // Sprites by top row
+    uint8_t scanline_active[MAX_SPRITES]; // Sprites crossing the line, in draw order
+    int16_t line_dirty_left[SCREEN_HEIGHT];
+    int16_t line_dirty_right[SCREEN_HEIGHT];
+
+    // Not available together with drawing into VRAM, a render scale or tiles
+    bool enable_scanline_rendering()
+    {
+        if (rendering_to_vram || render_scale != 1 || tiled_rendering)
+        {
+            return false;
+        }
+        scanline_rendering = true;
+        mark_full_damage();
+        return true;
+    }
+
+    template <pixel_format F>
+    void compose_span(typename pixel_traits<F>::type *dest, const sprite_item *item, uint32_t offset, uint32_t count,
+                      blend_mode blend)
+    {
+        if (blend != BLEND_NONE)
+        {
+            blend_pixels<F>(dest, item, offset, count, blend);
+        }
+        else
+        {
+            copy_pixels<F>(dest, item, offset, count);
+        }
+    }
+
+    // Copy or blend row `row` of a sprite placed at x into the line buffer
+    template <pixel_format F>
+    void compose_sprite_row(const sprite_item *item, int x, int row, blend_mode blend)
+    {
+        typedef typename pixel_traits<F>::type pixel;
+        int left = max(0, -x);
+        int right = min(item->width, SCREEN_WIDTH - x);
+        uint32_t offset = row * item->width;
+        pixel *dest = (pixel *)scanline_buffer + x;
+
+        if (!item->spans)
+        {
+            if (left < right)
+            {
+                compose_span<F>(dest + left, item, offset + left, right - left, blend);
+            }
+            return;
+        }
+        for (uint32_t i = item->row_spans[row]; i < item->row_spans[row + 1]; i++)
+        {
+            int start = max(item->spans[i].x, left);
+            int end = min(item->spans[i].x + item->spans[i].length, right);
+            if (start < end)
+            {
+                compose_span<F>(dest + start, item, offset + start, end - start, blend);
             }
+        }
+    }
 
-            // Simple PWM implementation
-            // For each tick, we increment a counter and compare to duty cycle
-            pwmCounter = (pwmCounter + 1) % 256;
+    // Compose pixels left..right of line y from the background row and the
+    // active sprites, and write them to the framebuffer
+    template <pixel_format F>
+    void compose_line(int y, int left, int right, int active)
+    {
+        typedef typename pixel_traits<F>::type pixel;
+        pixel *line = (pixel *)scanline_buffer;
+
+        // Background row, cleared where the image does not reach
+        const sprite_item *bg = background.item;
+        int bg_row = y - background.y;
+        int bg_left = bg ? max(0, background.x) : 0;
+        int bg_right = bg ? min(SCREEN_WIDTH, background.x + bg->width) : 0;
+        if (!bg || bg_row < 0 || bg_row >= bg->height || bg_left >= bg_right)
+        {
+            memset_impl(line, 0, SCREEN_WIDTH * sizeof(pixel));
+        }
+        else
+        {
+            if (bg_left > 0 || bg_right < SCREEN_WIDTH)
+            {
+                memset_impl(line, 0, SCREEN_WIDTH * sizeof(pixel));
+            }
+            copy_pixels<F>(line + bg_left, bg, bg_row * bg->width + bg_left - background.x, bg_right - bg_left);
+        }
 
-            if (pwmCounter < pwmDutyCycle)
+        for (int i = 0; i < active; i++)
+        {
+            const sprite_ptr &sprite = sprites[scanline_active[i]];
+            compose_sprite_row<F>(sprite.item, sprite.x, y - sprite.y, sprite.blend);
+        }
+
+        memcpy_stream_impl((uint8_t *)vesa_lfb + y * framebuffer_pitch + left * sizeof(pixel), line + left,
+                           (right - left) * sizeof(pixel));
+    }
+
+    void (*compose_line_impl)(int, int, int, int) = compose_line<PIXEL_INDEXED8>;
+
+    void render_scanlines()
+    {
+        uint64_t start = has_tsc ? rdtsc() : 0;
+
+        // Per line, the horizontal extent that has to be written
+        damage_moved_sprites();
+        for (int y = 0; y < SCREEN_HEIGHT; y++)
+        {
+            line_dirty_left[y] = damage.full() ? 0 : SCREEN_WIDTH;
+            line_dirty_right[y] = damage.full() ? SCREEN_WIDTH : 0;
+        }
+        for (int i = 0; !damage.full() && i < damage.size(); i++)
+        {
+            const rect &r = damage[i];
+            for (int y = r.y0; y < r.y1; y++)
             {
-                speakerOn();
+                line_dirty_left[y] = min(line_dirty_left[y], r.x0);
+                line_dirty_right[y] = max(line_dirty_right[y], r.x1);
             }
-            else
+        }
+        damage.clear();
+
+        // Sort the on-screen sprites by top row (insertion sort, stable so
+        // equal rows keep draw order)
+        int sorted = 0;
+        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        {
+            const sprite_ptr &sprite = sprites[sprite_loc];
+            if (sprite.y >= SCREEN_HEIGHT || sprite.y + sprite.item->height <= 0 ||
+                sprite.x >= SCREEN_WIDTH || sprite.x + sprite.item->width <= 0)
             {
-                speakerOff();
+                continue;
+            }
+            int i = sorted++;
+            for (; i > 0 && sprites[scanline_order[i - 1]].y > sprite.y; i--)
+            {
+                scanline_order[i] = scanline_order[i - 1];
+            }
+            scanline_order[i] = sprite_loc;
+        }
+
+        int next = 0;   // Next sprite in scanline_order to become active
+        int active = 0; // Entries in scanline_active
+        present_bytes = 0;
+        uint32_t bytes_per_pixel = pixel_size(framebuffer_format);
+
+        for (int y = 0; y < (int)present_height; y++)
+        {
+            // Drop sprites that ended above this line, add the ones starting
+            // on it (kept in draw order)
+            int kept = 0;
+            for (int i = 0; i < active; i++)
+            {
+                const sprite_ptr &sprite = sprites[scanline_active[i]];
+                if (sprite.y + sprite.item->height > y)
+                {
+                    scanline_active[kept++] = scanline_active[i];
+                }
+            }
+            active = kept;
+            for (; next < sorted && sprites[scanline_order[next]].y <= y; next++)
+            {
+                int i = active++;
+                for (; i > 0 && scanline_active[i - 1] > scanline_order[next]; i--)
+                {
+                    scanline_active[i] = scanline_active[i - 1];
+                }
+                scanline_active[i] = scanline_order[next];
+            }
+
+            int left = line_dirty_left[y];
+            int right = min(line_dirty_right[y], (int)present_width);
+            if (left >= right)
+            {
+                continue;
+            }
+
+            compose_line_impl(y, left, right, active);
+            present_bytes += (right - left) * bytes_per_pixel;
+        }
+
+        if (has_tsc)
+        {
+            present_cycles = (uint32_t)(rdtsc() - start);
+            if (present_cycles > present_cycles_max)
+            {
+                present_cycles_max = present_cycles;
             }
         }
+    }
+
+    // Draw the back buffer and the composing paths in the framebuffer's
+    // format, so true-colour output shows sprite colours unquantized
+    template <pixel_format F>
+    void select_draw_paths()
+    {
+        blit_impl = blit_to<F>;
+        draw_sprite_impl = draw_sprite_to<F>;
+        draw_sprite_affine_impl = draw_sprite_affine_to<F>;
+        draw_sprite_rotozoom_impl = draw_sprite_rotozoom_to<F>;
+        draw_text_impl = draw_text_to<F>;
+        compose_tile_impl = compose_tile<F>;
+        compose_line_impl = compose_line<F>;
+    }
+
+    // Palette animation. The game edits palette_base; cycles, fades and
+    // flashes are applied on top of it once per frame, and only the entries
+    // whose result differs from palette_rgb (what the DAC holds) are written.
+    // A full-screen fade therefore costs at most 768 DAC writes in 8 bpp.
+    // True-colour framebuffers have no DAC: their lookup tables are rebuilt
+    // and the screen repainted instead, immediate draws included. Fades and
+    // flashes apply to sprite colours that bypass the palette too; cycles
+    // only to indices.
+#define MAX_PALETTE_CYCLES 8
+#define PALETTE_LEVEL_MAX (64 << 8) // Effect strength, 8.8 fixed point over 0..64
+    struct palette_cycle
+    {
+        uint8_t first;
+        uint8_t last;
+        uint8_t frames_per_step;
+        uint8_t timer;
+        bool reverse;
     };
 
-    // Global PWM speaker instance
-    PWMSpeaker pwmSpeaker;
+    palette_cycle palette_cycles[MAX_PALETTE_CYCLES];
+    int palette_cycle_count = 0;
+    bool palette_base_changed = false;
 
-    // Helper function to play WAV with PWM speaker
-    void play_wav_pwm(const void *samples, uint32_t sampleRate, uint32_t numSamples, uint8_t bitsPerSample)
+    // Brightness: PALETTE_LEVEL_MAX is the base palette, 0 is black
+    int fade_level = PALETTE_LEVEL_MAX;
+    int fade_target = PALETTE_LEVEL_MAX;
+    int fade_step = 0;
+
+    // Flash: blend towards flash_rgb, decaying to nothing
+    uint8_t flash_rgb[3];
+    int flash_level = 0;
+    int flash_step = 0;
+
+    // Blend tables are built for the palette at init; call
+    // build_blend_tables(palette_base) once the edits are done
+    void set_palette_entry(uint8_t index, uint8_t r, uint8_t g, uint8_t b)
     {
-        if (bitsPerSample == 8)
+        palette_base[index][0] = r & 63;
+        palette_base[index][1] = g & 63;
+        palette_base[index][2] = b & 63;
+        palette_base_changed = true;
+    }
+
+    // Rotate entries first..last by one every frames_per_step frames, like
+    // water or fire animations. Returns false when all cycle slots are used.
+    bool cycle_palette(uint8_t first, uint8_t last, uint8_t frames_per_step, bool reverse = false)
+    {
+        if (palette_cycle_count == MAX_PALETTE_CYCLES || first >= last || frames_per_step == 0)
         {
-            pwmSpeaker.init(static_cast<const uint8_t *>(samples), sampleRate, numSamples);
+            return false;
         }
-        else if (bitsPerSample == 16)
+        palette_cycles[palette_cycle_count++] = {first, last, frames_per_step, 0, reverse};
+        return true;
+    }
+
+    void stop_palette_cycles()
+    {
+        palette_cycle_count = 0;
+    }
+
+    void start_fade(int target, int frames)
+    {
+        fade_target = target;
+        if (frames < 1)
         {
-            pwmSpeaker.init(static_cast<const int16_t *>(samples), sampleRate, numSamples);
+            frames = 1;
         }
-        pwmSpeaker.play();
+        fade_step = (max(fade_level, target) - min(fade_level, target) + frames - 1) / frames;
     }
 
-    void init(multiboot_info *mbi_)
+    void fade_palette_out(int frames)
     {
-        mbi = mbi_;
+        start_fade(0, frames);
+    }
 
-        // Initialize interrupt system
-        idt_install();
-        init_pic();
-        init_timer();
-        enable_interrupts(); // This is critical - enables the CPU to respond to interrupts
+    void fade_palette_in(int frames)
+    {
+        start_fade(PALETTE_LEVEL_MAX, frames);
+    }
 
-        bool vesa_supported = false;
-        uint32_t framebuffer_width = 640;
-        uint32_t framebuffer_height = 480;
+    bool palette_fading()
+    {
+        return fade_level != fade_target;
+    }
 
-        // Check if multiboot provides a suitable framebuffer
-        if (mbi && (mbi->flags & (1 << 12)))
-        { // Bit 12 indicates framebuffer info is available
-            // Use the multiboot framebuffer info even if it's not exact match for our target
-            vesa_lfb = (volatile uint8_t *)(uint32_t)mbi->framebuffer_addr;
-            framebuffer_width = mbi->framebuffer_width;
-            framebuffer_height = mbi->framebuffer_height;
+    // Blend the whole palette towards a colour, fading back over the frames
+    void flash_palette(uint8_t r, uint8_t g, uint8_t b, int frames)
+    {
+        flash_rgb[0] = r & 63;
+        flash_rgb[1] = g & 63;
+        flash_rgb[2] = b & 63;
+        flash_level = PALETTE_LEVEL_MAX;
+        flash_step = (PALETTE_LEVEL_MAX + max(frames, 1) - 1) / max(frames, 1);
+    }
 
-            // If it's a usable framebuffer, we can proceed
-            if (vesa_lfb && framebuffer_width > 0 && framebuffer_height > 0)
+    // Port reads per display refresh, measured once by
+    // detect_vertical_retrace(); 0 when the adapter never reports retrace
+    // (framebuffers that are not VGA compatible), so nothing waits for it
+    uint32_t retrace_period_spins = 0;
+
+#define RETRACE_DETECT_SPINS 100000
+
+    // Poll until the retrace bit equals set; false once *spins reaches limit
+    bool wait_retrace_bit(bool set, uint32_t limit, uint32_t *spins)
+    {
+        while (((inb(VGA_INSTAT_READ) & 0x08) != 0) != set)
+        {
+            if (++*spins >= limit)
             {
-                vesa_supported = true;
+                return false;
             }
         }
+        return true;
+    }
 
-        // If multiboot didn't provide a suitable mode, try setting VESA mode manually
-        if (!vesa_supported)
+    void detect_vertical_retrace()
+    {
+        retrace_period_spins = 0;
+
+        // Line up on the start of a retrace, then time one whole refresh
+        uint32_t spins = 0;
+        if (!wait_retrace_bit(false, RETRACE_DETECT_SPINS, &spins) ||
+            !wait_retrace_bit(true, RETRACE_DETECT_SPINS, &spins))
         {
-            vesa_supported = set_vesa_mode(640, 480, 8, &vesa_lfb);
-            framebuffer_width = 640;
-            framebuffer_height = 480;
+            return;
         }
-
-        setup_full_256_color_palette();
+        spins = 0;
+        if (!wait_retrace_bit(false, RETRACE_DETECT_SPINS, &spins) ||
+            !wait_retrace_bit(true, RETRACE_DETECT_SPINS, &spins))
+        {
+            return;
+        }
+        retrace_period_spins = spins;
     }
 
-    int max(int a, int b)
+    // Wait for vertical retrace so DAC writes do not tear; returns at once
+    // during retrace or when the adapter has none. A retrace starts within
+    // every refresh, so the wait is bounded by one measured period.
+    void wait_vertical_retrace()
     {
-        return a > b ? a : b;
+        if (retrace_period_spins == 0)
+        {
+            return;
+        }
+        uint32_t spins = 0;
+        wait_retrace_bit(true, retrace_period_spins + retrace_period_spins / 8, &spins);
     }
 
-    int min(int a, int b)
+    // Fade and flash for sprite colours that bypass the palette, in 8 bits
+    // per channel, as update_palette() applies them to the 6-bit entries
+    void build_rgb_tint()
     {
-        return a < b ? a : b;
+        rgb_tinted = flash_level > 0 || fade_level < PALETTE_LEVEL_MAX;
+        for (int c = 0; c < 3; c++)
+        {
+            int flash = (flash_rgb[c] << 2) | (flash_rgb[c] >> 4);
+            for (int v = 0; v < 256; v++)
+            {
+                int value = v + (flash - v) * flash_level / PALETTE_LEVEL_MAX;
+                rgb_tint[c][v] = (uint8_t)(value * fade_level / PALETTE_LEVEL_MAX);
+            }
+        }
     }
 
-    void cls()
+    // Apply this frame's palette effects and write out the changed entries
+    void update_palette()
     {
-        for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
+        bool animating = palette_base_changed || palette_cycle_count > 0 || palette_fading() || flash_step > 0;
+        if (!animating)
         {
-            const sprite_item *item = sprites[sprite_loc].item;
-            int x = sprites[sprite_loc].x;
-            int y = sprites[sprite_loc].y;
-            int prev_x = sprites[sprite_loc].prev_x;
-            int prev_y = sprites[sprite_loc].prev_y;
-            int width = item->width;
-            int height = item->height;
+            return;
+        }
+        palette_base_changed = false;
 
-            // Only clear if the sprite has moved
-            if (x != prev_x || y != prev_y)
+        for (int i = 0; i < palette_cycle_count; i++)
+        {
+            palette_cycle &cycle = palette_cycles[i];
+            if (++cycle.timer < cycle.frames_per_step)
             {
-                // Calculate overlapping region
-                int overlap_left = max(prev_x, x);
-                int overlap_top = max(prev_y, y);
-                int overlap_right = min(prev_x + width, x + width);
-                int overlap_bottom = min(prev_y + height, y + height);
+                continue;
+            }
+            cycle.timer = 0;
+
+            uint8_t saved[3];
+            int from = cycle.reverse ? cycle.first : cycle.last;
+            int to = cycle.reverse ? cycle.last : cycle.first;
+            int dir = cycle.reverse ? 1 : -1;
+            memcpy(saved, palette_base[from], 3);
+            for (int j = from; j != to; j += dir)
+            {
+                memcpy(palette_base[j], palette_base[j + dir], 3);
+            }
+            memcpy(palette_base[to], saved, 3);
+        }
 
-                // Clear previous position (excluding overlap)
-                for (int dx = 0; dx < width; dx++)
-                {
-                    for (int dy = 0; dy < height; dy++)
-                    {
-                        int px = prev_x + dx;
-                        int py = prev_y + dy;
-
-                        // Skip if in overlapping region
-                        if (px >= overlap_left && px < overlap_right &&
-                            py >= overlap_top && py < overlap_bottom)
-                        {
-                            continue;
-                        }
-
-                        pixel bg_pixel = background.item->data[(background.y + py) * background.item->width + background.x + px];
-                        plot_rgb(px, py, bg_pixel.r, bg_pixel.g, bg_pixel.b);
-                    }
-                }
+        if (fade_level < fade_target)
+        {
+            fade_level = min(fade_level + fade_step, fade_target);
+        }
+        else if (fade_level > fade_target)
+        {
+            fade_level = max(fade_level - fade_step, fade_target);
+        }
+
+        // Find the entries that change
+        uint8_t next[256][3];
+        bool changed[256];
+        int changed_count = 0;
+        for (int i = 0; i < 256; i++)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                int value = palette_base[i][c];
+                value += (flash_rgb[c] - value) * flash_level / PALETTE_LEVEL_MAX;
+                next[i][c] = (uint8_t)(value * fade_level / PALETTE_LEVEL_MAX);
             }
+            changed[i] = next[i][0] != palette_rgb[i][0] || next[i][1] != palette_rgb[i][1] ||
+                         next[i][2] != palette_rgb[i][2];
+            changed_count += changed[i];
+        }
+        if (framebuffer_format != PIXEL_INDEXED8)
+        {
+            build_rgb_tint();
+        }
+        // One more frame at level 0 puts the base colours back
+        if (flash_level == 0)
+        {
+            flash_step = 0;
+        }
+        flash_level = max(flash_level - flash_step, 0);
+        if (changed_count == 0)
+        {
+            return;
+        }
 
-            // Update previous position
-            sprites[sprite_loc].prev_x = x;
-            sprites[sprite_loc].prev_y = y;
+        if (framebuffer_format != PIXEL_INDEXED8)
+        {
+            memcpy(palette_rgb, next, sizeof(palette_rgb));
+            build_palette_tables(palette_rgb);
+            // The back buffer holds finished colours
+            restore_background(0, 0, render_width, render_height);
+            mark_full_damage();
+            return;
+        }
+
+        // The DAC write index auto-increments, so each run of changed
+        // entries needs a single index write
+        wait_vertical_retrace();
+        for (int i = 0; i < 256; i++)
+        {
+            if (!changed[i])
+            {
+                continue;
+            }
+            if (i == 0 || !changed[i - 1])
+            {
+                outb(VGA_DAC_WRITE_INDEX, i);
+            }
+            outb(VGA_DAC_DATA, next[i][0]);
+            outb(VGA_DAC_DATA, next[i][1]);
+            outb(VGA_DAC_DATA, next[i][2]);
+            memcpy(palette_rgb[i], next[i], 3);
         }
     }
 
-    void update()
+    // Draw the frame into render_target and present it
+    void draw_frame()
     {
+        // Erase sprites that moved since the last frame before drawing them
+        // again, so the presented frame has no trace of old positions
+        cls();
+
+        if (scrolling)
+        {
+            apply_scroll();
+        }
+
         for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
         {
             const sprite_item *item = sprites[sprite_loc].item;
             int x = sprites[sprite_loc].x;
             int y = sprites[sprite_loc].y;
-            draw_sprite(item, x, y);
+            draw_sprite(item, x, y, sprites[sprite_loc].blend);
         }
 
-        for (int x = 0; x < 640; x++)
+        present();
+    }
+
+    void update()
+    {
+        if (tiled_rendering)
         {
-            for (int y = 0; y < 480; y++)
-            {
-                vesa_lfb[y * 640 + x] = vesa_buffer[y * 640 + x];
-            }
+            render_tiles();
+        }
+        else if (scanline_rendering)
+        {
+            render_scanlines();
+        }
+        else
+        {
+            draw_frame();
         }
 
-        // wait
-        while (!frame_ready)
+        // Wait for the next frame signal, counting the ones we were too slow for
+        uint32_t frame_ticks[16];
+        while (frame_events.empty())
             asm volatile("hlt");
-        frame_ready = false;
+        frames_missed += frame_events.pop_batch(frame_ticks, 16) - 1;
+
+        uint64_t now = read_ticks();
+        frame_time = (uint32_t)(now - frame_start_ticks);
+        frame_start_ticks = now;
+
+        update_palette();
 
-        cls();
         scankey();
+
+        // Scratch data of this frame is dead now
+        frame_arena.reset();
     }
 }
 
@@ -695,11 +3014,11 @@ extern "C" void isr_timer_handler()
 
     cm::pwmSpeaker.update();
 
-    // Set frame_ready flag at 60Hz (assuming PIT is configured for 1000Hz)
-    // Every ~16.67ms (1000/60) we should set frame_ready
+    // Signal a new frame at 60Hz (assuming PIT is configured for 1000Hz)
+    // Every ~16.67ms (1000/60) the main loop gets a frame event
     if (timer_ticks % (1000 / TARGET_FPS) == 0)
     {
-        frame_ready = true;
+        frame_events.push((uint32_t)timer_ticks);
     }
 
     // Send End of Interrupt signal to PIC
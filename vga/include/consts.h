@@ -1,15 +1,5 @@
 #include <stdint.h>
 
-void *memset(void *dest, int val, int len)
-{
-    unsigned char *ptr = (unsigned char *)dest;
-    while (len-- > 0)
-    {
-        *ptr++ = (unsigned char)val;
-    }
-    return dest;
-}
-
 typedef enum
 {
     // Main section of the keyboard
@@ -153,6 +143,11 @@ struct multiboot_info
     uint8_t color_info[6];
 };
 
+// multiboot_info::framebuffer_type values
+#define MULTIBOOT_FRAMEBUFFER_INDEXED 0
+#define MULTIBOOT_FRAMEBUFFER_RGB 1
+#define MULTIBOOT_FRAMEBUFFER_EGA_TEXT 2
+
 // VGA and VBE constants
 #define VGA_AC_INDEX 0x3C0
 #define VGA_AC_WRITE 0x3C0
@@ -229,4 +224,8 @@ struct multiboot_info
 #define IRQ_KEYBOARD 1
 
 // Frame rate target (in Hz)
-#define TARGET_FPS 60
\ No newline at end of file
+#define TARGET_FPS 60
+
+// Size of the back buffer the engine draws into (8 bits per pixel)
+#define SCREEN_WIDTH 640
+#define SCREEN_HEIGHT 480
\ No newline at end of file
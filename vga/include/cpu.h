@@ -0,0 +1,104 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdint.h>
+
+// CPUID leaf 1 EDX feature bits
+#define CPUID_EDX_PSE (1 << 3)
+#define CPUID_EDX_TSC (1 << 4)
+#define CPUID_EDX_MSR (1 << 5)
+#define CPUID_EDX_PAT (1 << 16)
+#define CPUID_EDX_FXSR (1 << 24)
+#define CPUID_EDX_SSE (1 << 25)
+#define CPUID_EDX_SSE2 (1 << 26)
+
+// Control register bits
+#define CR0_PG (1u << 31)
+#define CR4_PSE (1 << 4)
+#define CR4_OSFXSR (1 << 9)
+
+// Model specific registers
+#define MSR_PAT 0x277
+
+static inline void cpuid(uint32_t leaf, uint32_t *eax, uint32_t *ebx, uint32_t *ecx, uint32_t *edx)
+{
+    asm volatile("cpuid" : "=a"(*eax), "=b"(*ebx), "=c"(*ecx), "=d"(*edx) : "a"(leaf), "c"(0));
+}
+
+static inline uint32_t read_cr4()
+{
+    uint32_t value;
+    asm volatile("mov %%cr4, %0" : "=r"(value));
+    return value;
+}
+
+static inline uint32_t read_cr0()
+{
+    uint32_t value;
+    asm volatile("mov %%cr0, %0" : "=r"(value));
+    return value;
+}
+
+static inline void write_cr0(uint32_t value)
+{
+    asm volatile("mov %0, %%cr0" : : "r"(value) : "memory");
+}
+
+static inline void write_cr3(uint32_t value)
+{
+    asm volatile("mov %0, %%cr3" : : "r"(value) : "memory");
+}
+
+static inline void write_cr4(uint32_t value)
+{
+    asm volatile("mov %0, %%cr4" : : "r"(value) : "memory");
+}
+
+static inline uint64_t rdmsr(uint32_t msr)
+{
+    uint32_t lo, hi;
+    asm volatile("rdmsr" : "=a"(lo), "=d"(hi) : "c"(msr));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static inline void wrmsr(uint32_t msr, uint64_t value)
+{
+    asm volatile("wrmsr" : : "c"(msr), "a"((uint32_t)value), "d"((uint32_t)(value >> 32)));
+}
+
+// Write back and invalidate all caches
+static inline void wbinvd()
+{
+    asm volatile("wbinvd" : : : "memory");
+}
+
+// Read the time stamp counter
+static inline uint64_t rdtsc()
+{
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+// Check a CPUID leaf 1 EDX feature bit
+bool cpu_has(uint32_t edx_bit)
+{
+    static uint32_t features = 0;
+    static bool detected = false;
+
+    if (!detected)
+    {
+        uint32_t eax, ebx, ecx;
+        cpuid(1, &eax, &ebx, &ecx, &features);
+        detected = true;
+    }
+    return (features & edx_bit) != 0;
+}
+
+// SSE2 is only usable if boot.asm also turned on CR4.OSFXSR
+bool cpu_sse2_enabled()
+{
+    return cpu_has(CPUID_EDX_SSE2) && (read_cr4() & CR4_OSFXSR);
+}
+
+#endif // CPU_H
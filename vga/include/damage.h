@@ -0,0 +1,124 @@
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include <stdint.h>
+
+namespace cm
+{
+
+// Half-open screen rectangle: x0 <= x < x1, y0 <= y < y1
+struct rect
+{
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    int width() const { return x1 - x0; }
+    int height() const { return y1 - y0; }
+    uint32_t area() const { return (uint32_t)(width() * height()); }
+
+    // Overlapping or sharing an edge, so the union is a single rectangle
+    // without much wasted area
+    bool touches(const rect &o) const
+    {
+        return x0 <= o.x1 && o.x0 <= x1 && y0 <= o.y1 && o.y0 <= y1;
+    }
+
+    void merge(const rect &o)
+    {
+        if (o.x0 < x0) x0 = o.x0;
+        if (o.y0 < y0) y0 = o.y0;
+        if (o.x1 > x1) x1 = o.x1;
+        if (o.y1 > y1) y1 = o.y1;
+    }
+};
+
+// Screen regions changed since the last present. Touching rectangles are
+// merged as they are added, so the list stays small and the regions never
+// overlap. Running out of slots degrades to "everything is dirty".
+template <int N>
+class DamageList
+{
+private:
+    rect rects[N];
+    int count;
+    bool all;
+    int screen_width;
+    int screen_height;
+
+public:
+    constexpr DamageList(int width, int height) : count(0), all(true),
+                                                  screen_width(width), screen_height(height) {}
+
+    void add(int x, int y, int width, int height)
+    {
+        if (all)
+            return;
+
+        rect r = {x, y, x + width, y + height};
+        if (r.x0 < 0) r.x0 = 0;
+        if (r.y0 < 0) r.y0 = 0;
+        if (r.x1 > screen_width) r.x1 = screen_width;
+        if (r.y1 > screen_height) r.y1 = screen_height;
+        if (r.x0 >= r.x1 || r.y0 >= r.y1)
+            return;
+
+        // Absorb every rectangle the new one touches; the grown rectangle
+        // can reach ones it missed before, so rescan after each merge
+        int i = 0;
+        while (i < count)
+        {
+            if (rects[i].touches(r))
+            {
+                r.merge(rects[i]);
+                rects[i] = rects[--count];
+                i = 0;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (count == N)
+        {
+            all = true;
+            return;
+        }
+        rects[count++] = r;
+    }
+
+    // Change the screen size rectangles are clipped to; everything is dirty
+    void resize(int width, int height)
+    {
+        screen_width = width;
+        screen_height = height;
+        count = 0;
+        all = true;
+    }
+
+    void add_all() { all = true; }
+
+    void clear()
+    {
+        count = 0;
+        all = false;
+    }
+
+    // Pixels covered; the rectangles never overlap so this is exact
+    uint32_t area() const
+    {
+        if (all)
+            return (uint32_t)(screen_width * screen_height);
+        uint32_t total = 0;
+        for (int i = 0; i < count; i++)
+            total += rects[i].area();
+        return total;
+    }
+
+    bool full() const { return all; }
+    int size() const { return count; }
+    const rect &operator[](int i) const { return rects[i]; }
+};
+
+} // namespace cm
+
+#endif // DAMAGE_H
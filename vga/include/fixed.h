@@ -0,0 +1,72 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+namespace cm
+{
+
+// 16.16 fixed point, for transforms without the FPU
+typedef int32_t fixed;
+
+#define FIXED_ONE 0x10000
+
+constexpr fixed to_fixed(int value) { return value * FIXED_ONE; }
+
+fixed fixed_mul(fixed a, fixed b)
+{
+    return (fixed)(((int64_t)a * b) >> 16);
+}
+
+// Integer square root, rounded down
+uint32_t isqrt(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value)
+        bit >>= 2;
+    while (bit)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Angles are 256 steps per turn, so they wrap for free in a uint8_t.
+// sin() over the first quarter turn; the rest follows by symmetry.
+const fixed sine_quarter[65] = {
+    0, 1608, 3216, 4821, 6424, 8022, 9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536,
+};
+
+fixed fixed_sin(uint8_t angle)
+{
+    int step = angle & 127;
+    fixed value = step <= 64 ? sine_quarter[step] : sine_quarter[128 - step];
+    return angle < 128 ? value : -value;
+}
+
+fixed fixed_cos(uint8_t angle)
+{
+    return fixed_sin((uint8_t)(angle + 64));
+}
+
+} // namespace cm
+
+#endif // FIXED_H
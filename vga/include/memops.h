@@ -0,0 +1,196 @@
+#ifndef MEMOPS_H
+#define MEMOPS_H
+
+#include <stdint.h>
+#include "cpu.h"
+
+// memcpy/memset/memmove for the kernel. Each has a rep movsd/stosd version
+// that works on any CPU and an SSE2 version that moves 64 bytes per loop
+// iteration; init_memops() picks one through CPUID. Until then (and on CPUs
+// without SSE2) the rep versions are used. memcpy_stream_impl is the same
+// copy with non-temporal stores, for writing the framebuffer.
+
+typedef long long xmm_t __attribute__((vector_size(16)));
+typedef long long xmm_unaligned_t __attribute__((vector_size(16), aligned(1)));
+
+static inline void rep_movsb(uint8_t *&d, const uint8_t *&s, uint32_t n)
+{
+    asm volatile("rep movsb" : "+D"(d), "+S"(s), "+c"(n) : : "memory");
+}
+
+void *memcpy_rep(void *dest, const void *src, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    const uint8_t *s = (const uint8_t *)src;
+    uint32_t dwords = n / 4;
+    asm volatile("rep movsl" : "+D"(d), "+S"(s), "+c"(dwords) : : "memory");
+    rep_movsb(d, s, n % 4);
+    return dest;
+}
+
+void *memset_rep(void *dest, int val, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    uint32_t pattern = (uint8_t)val * 0x01010101u;
+    uint32_t dwords = n / 4;
+    asm volatile("rep stosl" : "+D"(d), "+c"(dwords) : "a"(pattern) : "memory");
+    uint32_t tail = n % 4;
+    asm volatile("rep stosb" : "+D"(d), "+c"(tail) : "a"(pattern) : "memory");
+    return dest;
+}
+
+// Copy backwards with the direction flag set; for overlapping dest > src
+void *memmove_back_rep(void *dest, const void *src, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest + n - 1;
+    const uint8_t *s = (const uint8_t *)src + n - 1;
+    asm volatile("std\n\t"
+                 "rep movsb\n\t"
+                 "cld"
+                 : "+D"(d), "+S"(s), "+c"(n)
+                 :
+                 : "memory");
+    return dest;
+}
+
+__attribute__((target("sse2"))) void *memcpy_sse2(void *dest, const void *src, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    const uint8_t *s = (const uint8_t *)src;
+
+    if (n >= 64)
+    {
+        // Align the destination so the stores are movdqa
+        uint32_t head = (16 - ((uint32_t)d & 15)) & 15;
+        rep_movsb(d, s, head);
+        n -= head;
+
+        for (; n >= 64; n -= 64, d += 64, s += 64)
+        {
+            xmm_t a = ((const xmm_unaligned_t *)s)[0];
+            xmm_t b = ((const xmm_unaligned_t *)s)[1];
+            xmm_t c = ((const xmm_unaligned_t *)s)[2];
+            xmm_t e = ((const xmm_unaligned_t *)s)[3];
+            ((xmm_t *)d)[0] = a;
+            ((xmm_t *)d)[1] = b;
+            ((xmm_t *)d)[2] = c;
+            ((xmm_t *)d)[3] = e;
+        }
+    }
+    rep_movsb(d, s, n);
+    return dest;
+}
+
+__attribute__((target("sse2"))) void *memset_sse2(void *dest, int val, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+
+    if (n >= 64)
+    {
+        uint32_t head = (16 - ((uint32_t)d & 15)) & 15;
+        memset_rep(d, val, head);
+        d += head;
+        n -= head;
+
+        long long pattern = (uint8_t)val * 0x0101010101010101ull;
+        xmm_t v = {pattern, pattern};
+        for (; n >= 64; n -= 64, d += 64)
+        {
+            ((xmm_t *)d)[0] = v;
+            ((xmm_t *)d)[1] = v;
+            ((xmm_t *)d)[2] = v;
+            ((xmm_t *)d)[3] = v;
+        }
+    }
+    memset_rep(d, val, n);
+    return dest;
+}
+
+// Backward copy in 16-byte blocks from the end; safe for dest > src overlap
+__attribute__((target("sse2"))) void *memmove_back_sse2(void *dest, const void *src, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest + n;
+    const uint8_t *s = (const uint8_t *)src + n;
+
+    for (; n >= 16; n -= 16)
+    {
+        d -= 16;
+        s -= 16;
+        *(xmm_unaligned_t *)d = *(const xmm_unaligned_t *)s;
+    }
+    if (n)
+    {
+        memmove_back_rep(dest, src, n);
+    }
+    return dest;
+}
+
+// Copy with non-temporal stores for destinations that are only written,
+// never read back (the framebuffer). The stores bypass the cache and are
+// combined into full-line bursts; the sfence orders them before returning.
+__attribute__((target("sse2"))) void *memcpy_stream_sse2(void *dest, const void *src, uint32_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    const uint8_t *s = (const uint8_t *)src;
+
+    if (n >= 64)
+    {
+        uint32_t head = (16 - ((uint32_t)d & 15)) & 15;
+        rep_movsb(d, s, head);
+        n -= head;
+
+        for (; n >= 64; n -= 64, d += 64, s += 64)
+        {
+            xmm_t a = ((const xmm_unaligned_t *)s)[0];
+            xmm_t b = ((const xmm_unaligned_t *)s)[1];
+            xmm_t c = ((const xmm_unaligned_t *)s)[2];
+            xmm_t e = ((const xmm_unaligned_t *)s)[3];
+            __builtin_ia32_movntdq((xmm_t *)d + 0, a);
+            __builtin_ia32_movntdq((xmm_t *)d + 1, b);
+            __builtin_ia32_movntdq((xmm_t *)d + 2, c);
+            __builtin_ia32_movntdq((xmm_t *)d + 3, e);
+        }
+        asm volatile("sfence" ::: "memory");
+    }
+    rep_movsb(d, s, n);
+    return dest;
+}
+
+void *(*memcpy_impl)(void *, const void *, uint32_t) = memcpy_rep;
+void *(*memcpy_stream_impl)(void *, const void *, uint32_t) = memcpy_rep;
+void *(*memset_impl)(void *, int, uint32_t) = memset_rep;
+void *(*memmove_back_impl)(void *, const void *, uint32_t) = memmove_back_rep;
+
+// Pick the fastest routines the CPU supports
+void init_memops()
+{
+    if (cpu_sse2_enabled())
+    {
+        memcpy_impl = memcpy_sse2;
+        memcpy_stream_impl = memcpy_stream_sse2;
+        memset_impl = memset_sse2;
+        memmove_back_impl = memmove_back_sse2;
+    }
+}
+
+extern "C" void *memcpy(void *dest, const void *src, uint32_t n)
+{
+    return memcpy_impl(dest, src, n);
+}
+
+extern "C" void *memset(void *dest, int val, uint32_t n)
+{
+    return memset_impl(dest, val, n);
+}
+
+extern "C" void *memmove(void *dest, const void *src, uint32_t n)
+{
+    // A forward copy is fine unless dest starts inside the source
+    if ((uint8_t *)dest <= (const uint8_t *)src || (uint8_t *)dest >= (const uint8_t *)src + n)
+    {
+        return memcpy_impl(dest, src, n);
+    }
+    return memmove_back_impl(dest, src, n);
+}
+
+#endif // MEMOPS_H
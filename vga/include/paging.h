@@ -0,0 +1,81 @@
+#ifndef PAGING_H
+#define PAGING_H
+
+#include <stdint.h>
+#include "cpu.h"
+
+// Identity-mapped paging with 4 MiB pages (PSE): one page directory covers
+// the whole 4 GiB address space, so physical and virtual addresses stay
+// equal for the engine, the AC97 DMA buffers and the framebuffer. The only
+// reason to turn paging on is the memory type: through PAT the framebuffer
+// pages become write-combining, so stores to the LFB are merged into bursts
+// instead of going out one uncached store at a time.
+
+#define PDE_PRESENT (1 << 0)
+#define PDE_WRITABLE (1 << 1)
+#define PDE_PWT (1 << 3) // Together with PCD and PAT: index into the PAT MSR
+#define PDE_PCD (1 << 4)
+#define PDE_LARGE (1 << 7) // 4 MiB page
+#define LARGE_PAGE_SIZE (4 * 1024 * 1024)
+
+// PAT memory types
+#define PAT_UC 0x00
+#define PAT_WC 0x01
+#define PAT_WT 0x04
+#define PAT_WB 0x06
+#define PAT_UC_MINUS 0x07
+
+// Power-on PAT layout except entry 1 (PWT=1 PCD=0), which becomes WC
+#define PAT_VALUE ((uint64_t)PAT_WB | (uint64_t)PAT_WC << 8 | (uint64_t)PAT_UC_MINUS << 16 | (uint64_t)PAT_UC << 24 | \
+                   (uint64_t)PAT_WB << 32 | (uint64_t)PAT_WT << 40 | (uint64_t)PAT_UC_MINUS << 48 | (uint64_t)PAT_UC << 56)
+
+// How much of the framebuffer aperture to map write-combining (room for
+// several 640x480 pages of VRAM)
+#define LFB_MAP_SIZE (16 * 1024 * 1024)
+
+alignas(4096) uint32_t page_directory[1024];
+
+bool paging_enabled = false;
+bool framebuffer_write_combining = false;
+
+// Turn on paging with an identity map; lfb_base..lfb_base+lfb_size is mapped
+// write-combining if the CPU has PAT. Returns false if the CPU lacks PSE.
+bool init_paging(uint32_t lfb_base, uint32_t lfb_size)
+{
+    if (!cpu_has(CPUID_EDX_PSE))
+    {
+        return false;
+    }
+
+    bool use_pat = cpu_has(CPUID_EDX_PAT) && cpu_has(CPUID_EDX_MSR);
+    if (use_pat)
+    {
+        // Caches must not hold lines of the old type when the PAT changes
+        wbinvd();
+        wrmsr(MSR_PAT, PAT_VALUE);
+        wbinvd();
+    }
+
+    uint32_t lfb_first = lfb_base / LARGE_PAGE_SIZE;
+    uint32_t lfb_last = (lfb_base + lfb_size - 1) / LARGE_PAGE_SIZE;
+
+    for (uint32_t i = 0; i < 1024; i++)
+    {
+        uint32_t entry = (i * LARGE_PAGE_SIZE) | PDE_PRESENT | PDE_WRITABLE | PDE_LARGE;
+        if (use_pat && lfb_size && i >= lfb_first && i <= lfb_last)
+        {
+            entry |= PDE_PWT; // PAT entry 1: write-combining
+        }
+        page_directory[i] = entry;
+    }
+
+    write_cr4(read_cr4() | CR4_PSE);
+    write_cr3((uint32_t)page_directory);
+    write_cr0(read_cr0() | CR0_PG);
+
+    paging_enabled = true;
+    framebuffer_write_combining = use_pat && lfb_size;
+    return true;
+}
+
+#endif // PAGING_H
@@ -0,0 +1,169 @@
+#ifndef PIXEL_FORMAT_H
+#define PIXEL_FORMAT_H
+
+#include <stdint.h>
+#include "memops.h"
+
+namespace cm
+{
+
+// Framebuffer layouts. The back buffer and the composing paths use the
+// framebuffer's layout, so presenting is a copy. Sprites hold 8-bit palette
+// indices and, optionally, their own XRGB8888 colours: indexed surfaces take
+// the indices, true-colour ones the colours (or, without them, the palette
+// colours of the indices, from tables already packed for the format).
+enum pixel_format
+{
+    PIXEL_INDEXED8,
+    PIXEL_RGB565,
+    PIXEL_XRGB8888,
+};
+
+template <pixel_format F>
+struct pixel_traits;
+
+template <>
+struct pixel_traits<PIXEL_INDEXED8>
+{
+    typedef uint8_t type;
+};
+
+template <>
+struct pixel_traits<PIXEL_RGB565>
+{
+    typedef uint16_t type;
+};
+
+template <>
+struct pixel_traits<PIXEL_XRGB8888>
+{
+    typedef uint32_t type;
+};
+
+// Bytes per framebuffer pixel
+uint32_t pixel_size(pixel_format format)
+{
+    switch (format)
+    {
+    case PIXEL_RGB565:
+        return sizeof(pixel_traits<PIXEL_RGB565>::type);
+    case PIXEL_XRGB8888:
+        return sizeof(pixel_traits<PIXEL_XRGB8888>::type);
+    default:
+        return sizeof(pixel_traits<PIXEL_INDEXED8>::type);
+    }
+}
+
+// Palette colours packed for each true-colour format
+uint16_t palette_rgb565[256];
+uint32_t palette_xrgb8888[256];
+
+// Fades and flashes for sprite colours that do not go through the palette:
+// while rgb_tinted, channel c of value v shows as rgb_tint[c][v]
+uint8_t rgb_tint[3][256];
+bool rgb_tinted = false;
+
+// Repack the palette (6-bit DAC components) for the true-colour formats
+void build_palette_tables(const uint8_t (*rgb)[3])
+{
+    for (int i = 0; i < 256; i++)
+    {
+        // Widen 6-bit DAC values to 8 bits, repeating the top bits
+        uint32_t r = (rgb[i][0] << 2) | (rgb[i][0] >> 4);
+        uint32_t g = (rgb[i][1] << 2) | (rgb[i][1] >> 4);
+        uint32_t b = (rgb[i][2] << 2) | (rgb[i][2] >> 4);
+        palette_rgb565[i] = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        palette_xrgb8888[i] = (r << 16) | (g << 8) | b;
+    }
+}
+
+// An XRGB8888 colour with rgb_tint applied
+uint32_t tint_rgb(uint32_t rgb)
+{
+    return (rgb_tint[0][(rgb >> 16) & 255] << 16) | (rgb_tint[1][(rgb >> 8) & 255] << 8) | rgb_tint[2][rgb & 255];
+}
+
+// Framebuffer pixel for an XRGB8888 colour, and back (true-colour formats)
+template <pixel_format F>
+typename pixel_traits<F>::type pack_rgb(uint32_t rgb);
+
+template <>
+uint16_t pack_rgb<PIXEL_RGB565>(uint32_t rgb)
+{
+    return (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+}
+
+template <>
+uint32_t pack_rgb<PIXEL_XRGB8888>(uint32_t rgb)
+{
+    return rgb & 0xFFFFFF;
+}
+
+template <pixel_format F>
+uint32_t unpack_rgb(typename pixel_traits<F>::type pixel);
+
+template <>
+uint32_t unpack_rgb<PIXEL_RGB565>(uint16_t pixel)
+{
+    uint32_t r = pixel >> 11, g = (pixel >> 5) & 63, b = pixel & 31;
+    return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+template <>
+uint32_t unpack_rgb<PIXEL_XRGB8888>(uint32_t pixel)
+{
+    return pixel & 0xFFFFFF;
+}
+
+// Framebuffer pixel for a palette index
+template <pixel_format F>
+typename pixel_traits<F>::type palette_lookup(uint8_t index);
+
+template <>
+uint8_t palette_lookup<PIXEL_INDEXED8>(uint8_t index)
+{
+    return index;
+}
+
+template <>
+uint16_t palette_lookup<PIXEL_RGB565>(uint8_t index)
+{
+    return palette_rgb565[index];
+}
+
+template <>
+uint32_t palette_lookup<PIXEL_XRGB8888>(uint8_t index)
+{
+    return palette_xrgb8888[index];
+}
+
+// Set a run of pixels to one value
+template <pixel_format F>
+void fill_pixels(typename pixel_traits<F>::type *dest, typename pixel_traits<F>::type value, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+        dest[i] = value;
+}
+
+template <>
+void fill_pixels<PIXEL_INDEXED8>(uint8_t *dest, uint8_t value, uint32_t count)
+{
+    memset_impl(dest, value, count);
+}
+
+// Copy a run of pixels, repeating every pixel S times
+template <pixel_format F, int S>
+void scale_span(uint8_t *dest, const typename pixel_traits<F>::type *src, uint32_t count)
+{
+    typedef typename pixel_traits<F>::type fb_pixel;
+    fb_pixel *d = (fb_pixel *)dest;
+    for (uint32_t i = 0; i < count; i++, d += S)
+    {
+        for (int k = 0; k < S; k++)
+            d[k] = src[i];
+    }
+}
+
+} // namespace cm
+
+#endif // PIXEL_FORMAT_H
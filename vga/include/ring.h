@@ -0,0 +1,88 @@
+#ifndef RING_H
+#define RING_H
+
+#include <stdint.h>
+
+namespace cm
+{
+
+// Single-producer/single-consumer ring buffer, e.g. an ISR producing and the
+// main loop consuming. N must be a power of two; head and tail run freely
+// and are masked on access, so all N slots are usable. The producer only
+// writes head and the consumer only writes tail, so neither side has to
+// disable interrupts. Acquire/release accesses order the slot contents
+// against the index updates (on x86 they compile to plain movs).
+template <typename T, uint32_t N>
+class SpscRing
+{
+    static_assert(N != 0 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+private:
+    T slots[N];
+    uint32_t head; // Next slot to write (producer)
+    uint32_t tail; // Next slot to read (consumer)
+
+public:
+    constexpr SpscRing() : slots(), head(0), tail(0) {}
+
+    // Producer side: false if the ring is full
+    bool push(const T &value)
+    {
+        uint32_t h = head;
+        if (h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE) == N)
+            return false;
+        slots[h & (N - 1)] = value;
+        __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // Producer side: push up to count values, returns how many fit
+    uint32_t push_batch(const T *values, uint32_t count)
+    {
+        uint32_t h = head;
+        uint32_t space = N - (h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+        if (count > space)
+            count = space;
+        for (uint32_t i = 0; i < count; i++)
+            slots[(h + i) & (N - 1)] = values[i];
+        __atomic_store_n(&head, h + count, __ATOMIC_RELEASE);
+        return count;
+    }
+
+    // Consumer side: false if the ring is empty
+    bool pop(T &value)
+    {
+        uint32_t t = tail;
+        if (__atomic_load_n(&head, __ATOMIC_ACQUIRE) == t)
+            return false;
+        value = slots[t & (N - 1)];
+        __atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // Consumer side: pop up to count values, returns how many were read
+    uint32_t pop_batch(T *values, uint32_t count)
+    {
+        uint32_t t = tail;
+        uint32_t available = __atomic_load_n(&head, __ATOMIC_ACQUIRE) - t;
+        if (count > available)
+            count = available;
+        for (uint32_t i = 0; i < count; i++)
+            values[i] = slots[(t + i) & (N - 1)];
+        __atomic_store_n(&tail, t + count, __ATOMIC_RELEASE);
+        return count;
+    }
+
+    uint32_t size() const
+    {
+        return __atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+    }
+
+    bool empty() const { return size() == 0; }
+    bool full() const { return size() == N; }
+    uint32_t capacity() const { return N; }
+};
+
+} // namespace cm
+
+#endif // RING_H
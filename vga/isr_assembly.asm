@@ -5,11 +5,28 @@ global isr_timer_wrapper     ; Make the ISR handler visible to C code
 global load_idt              ; Make IDT loader visible to C code
 extern isr_timer_handler     ; Reference to the C handler function
 extern idtp                  ; Reference to IDT pointer structure
+extern sse_enabled           ; Set by boot.asm when SSE is on
+
+section .bss
+align 16
+fxsave_area:
+    resb 512                 ; FPU/SSE state of the interrupted code
+
+section .text
 
 ; ISR for Timer (IRQ0)
 isr_timer_wrapper:
     pusha                    ; Push all registers
+    cmp dword [sse_enabled], 0
+    je .call
+    fxsave [fxsave_area]     ; Save x87/XMM state, the handler may use SSE copies
+.call:
+    cld                      ; The C ABI expects the direction flag clear
     call isr_timer_handler   ; Call our C handler
+    cmp dword [sse_enabled], 0
+    je .done
+    fxrstor [fxsave_area]    ; Restore x87/XMM state
+.done:
     popa                     ; Pop all registers
     iret                     ; Return from interrupt
 
@@ -2,6 +2,7 @@
 #include "build/sprite_item_don.h"
 #include "build/sprite_item_noki.h"
 #include "build/sprite_item_wood.h"
+#include "build/font_hud.h"
 #include "build/wav_riff.h"
 
 using namespace cm;
@@ -9,14 +10,19 @@ using namespace cm;
 extern "C" void main(multiboot_info *mbi)
 {
     init(mbi);
+    enable_page_flipping(2);
 
     int dir_x = 1;
     int dir_y = 1;
 
-    sprite_ptr *don = create_sprite(&sprite_don::item, 64, 64);
-    sprite_ptr *noki = create_sprite(&sprite_noki::item, 128, 64);
+    sprite_handle don = create_sprite(&sprite_don::item, 64, 64);
+    sprite_handle noki = create_sprite(&sprite_noki::item, 128, 64);
     set_background(&sprite_wood::item, 0, 0);
 
+    // Frames the loop was too slow for
+    text_label *hud = create_text_label(&font_hud::font, 8, 8, rgb_index(5, 5, 0), 20);
+    char hud_text[20] = "missed ";
+
     play_wav_ac97(wav_riff::SAMPLES, wav_riff::SAMPLE_RATE, wav_riff::NUM_SAMPLES, 
         wav_riff::BITS_PER_SAMPLE, wav_riff::NUM_CHANNELS);
 
@@ -45,6 +51,12 @@ extern "C" void main(multiboot_info *mbi)
             don->x += -2;
         }
 
+        if (hud)
+        {
+            format_uint(frames_missed, hud_text + 7);
+            set_text(hud, hud_text);
+        }
+
         update();
     }
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+from PIL import Image, ImageDraw, ImageFont
+
+# Convert Pillow's built-in bitmap font (6x11 cells) into build/font_hud.h.
+# Glyph rows are stored as opaque (x, length) spans, like keyed sprites, so
+# drawing text is a fill per run.
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+font = ImageFont.load_default_imagefont()
+left, top, width, height = font.getbbox("M")
+
+spans = []
+row_spans = [0]
+for code in range(FIRST_CHAR, LAST_CHAR + 1):
+    img = Image.new("1", (width, height))
+    ImageDraw.Draw(img).text((0, 0), chr(code), font=font, fill=1)
+    for y in range(height):
+        x = 0
+        while x < width:
+            if not img.getpixel((x, y)):
+                x += 1
+                continue
+            start = x
+            while x < width and img.getpixel((x, y)):
+                x += 1
+            spans.append((start, x - start))
+        row_spans.append(len(spans))
+
+print("- importing font (" + str(LAST_CHAR - FIRST_CHAR + 1) + " glyphs)")
+with open("build/font_hud.h", "w") as f:
+    f.write("namespace font_hud {\n")
+    f.write("const cm::sprite_span spans[] = {\n")
+    f.write(",".join(f"{{{x}, {length}}}" for x, length in spans))
+    f.write("};\n")
+    f.write("const uint32_t row_spans[] = {\n")
+    for i in range(0, len(row_spans), height):
+        f.write(",".join(str(index) for index in row_spans[i:i + height]))
+        f.write(",\n")
+    f.write("};\n")
+    f.write(f"const cm::font font = {{{width}, {height}, {FIRST_CHAR}, {LAST_CHAR - FIRST_CHAR + 1}, spans, row_spans}};\n")
+    f.write("}\n")
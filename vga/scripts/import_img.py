@@ -5,40 +5,101 @@ import numpy as np
 import sys
 import os
 
+
+# Palette index of a color from the 6x6x6 cube; must match cm.h's rgb_index()
+def rgb_index(r, g, b):
+    if r == 5 and g == 5 and b == 5:
+        return 255  # Last grayscale entry (pure white)
+    return 36 * r + 6 * g + b
+
+
+# Palette index that is see-through in each sprite. Pixels with alpha below
+# 128 are see-through as well. Images with neither stay opaque rectangles.
+COLOR_KEYS = {
+    "don": rgb_index(5, 5, 5),
+    "noki": rgb_index(5, 5, 5),
+}
+
 # Load the image
 for src in os.listdir("images"):
     print("- importing " + src)
     name = src[:src.index(".")]
 
-    img = Image.open(os.path.join("images", src)).convert("RGB")
+    img = Image.open(os.path.join("images", src)).convert("RGBA")
     width, height = img.size
     pixels = []
+    colors = []
+    opaque = []
+    key = COLOR_KEYS.get(name)
 
     # Process each pixel
     for y in range(height):
         for x in range(width):
-            r, g, b = img.getpixel((x, y))
+            r, g, b, a = img.getpixel((x, y))
             
             # Find the closest color in our palette
             rr = round(r / 51) 
             gg = round(g / 51)
             bb = round(b / 51)
             
-            # Store HSV components to match your C++ struct
-            pixels.append([rr, gg, bb])
+            # Store the palette index so drawing is a plain copy, and the
+            # colour itself for true-colour framebuffers
+            pixels.append(rgb_index(rr, gg, bb))
+            colors.append((r << 16) | (g << 8) | b)
+            opaque.append(a >= 128 and pixels[-1] != key)
+
+    # See-through pixels hold the key, so transformed drawing can test the
+    # sampled index instead of the spans. Alpha-only images get an index no
+    # opaque pixel uses.
+    if not all(opaque):
+        if key is None:
+            used = set(index for index, o in zip(pixels, opaque) if o)
+            key = next(index for index in range(256) if index not in used)
+        pixels = [index if o else key for index, o in zip(pixels, opaque)]
+        colors = [color if o else 0 for color, o in zip(colors, opaque)]
+
+    # Encode the opaque pixels of each row as (x, length) spans so the
+    # blitter can skip the see-through runs
+    spans = []
+    row_spans = [0]
+    if not all(opaque):
+        for y in range(height):
+            x = 0
+            while x < width:
+                if not opaque[y * width + x]:
+                    x += 1
+                    continue
+                start = x
+                while x < width and opaque[y * width + x]:
+                    x += 1
+                spans.append((start, x - start))
+            row_spans.append(len(spans))
 
     # Generate header file
     with open("build/sprite_item_" + name + ".h", "w") as f:
         f.write("namespace sprite_" + name + " {\n")
         f.write(f"const int width = {width};\n")
         f.write(f"const int height = {height};\n")
-        f.write("const cm::pixel data[] = {\n")
-        count = 0
-        for pixel in pixels:
-            f.write(f"{{{pixel[0]}, {pixel[1]}, {pixel[2]}}},")
-            count += 1
-            if count % width == 0:
-                f.write("\n")
+        f.write("const uint8_t data[] = {\n")
+        for y in range(height):
+            f.write(",".join(str(index) for index in pixels[y * width:(y + 1) * width]))
+            f.write(",\n")
+        f.write("};\n")
+        f.write("const uint32_t rgb[] = {\n")
+        for y in range(height):
+            f.write(",".join(f"0x{color:06x}" for color in colors[y * width:(y + 1) * width]))
+            f.write(",\n")
         f.write("};\n")
-        f.write("const cm::sprite_item item = {width, height, data};\n")
+        if len(row_spans) > 1:
+            if not spans:
+                spans.append((0, 0))  # Fully see-through; C++ has no empty arrays
+            f.write("const cm::sprite_span spans[] = {\n")
+            f.write(",".join(f"{{{x}, {length}}}" for x, length in spans))
+            f.write("};\n")
+            f.write("const uint32_t row_spans[] = {\n")
+            f.write(",".join(str(index) for index in row_spans))
+            f.write("};\n")
+            f.write(f"const cm::sprite_item item = {{width, height, data, spans, row_spans, {key}, rgb}};\n")
+        else:
+            f.write("const cm::sprite_item item = {width, height, data, nullptr, nullptr, 0, rgb};\n")
         f.write("}\n")
\ No newline at end of file